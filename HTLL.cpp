@@ -396,11 +396,14 @@ size_t HTVM_Size(const std::vector<bool>& arr) {
 //
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
-// global vars NEEDED
-int HT_LIB_theIdNumOfThe34 = 0;
-std::vector<std::string> HT_Lib_theIdNumOfThe34theVar;
+// The string literals preserveStrings() takes out of a program, numbered from 1, for
+// restoreStrings() to put back. Each compilation has its own, so parallel ones never share them.
+struct HT_StringLiterals {
+    int count = 0;
+    std::vector<std::string> texts;
+};
 //;;;;;;;;;;;;;;;;;;;;;;;;;
-std::string preserveStrings(std::string code, std::string keyWordEscpaeChar = "\\") {
+std::string preserveStrings(std::string code, HT_StringLiterals& literals, std::string keyWordEscpaeChar = "\\") {
     std::vector<std::string> getAllCharForTheFurtureSoIcanAddEscapeChar;
     std::string ReplaceFixWhitOutFixDoubleQuotesInsideDoubleQuotes = "";
     std::string str21 = "";
@@ -412,13 +415,13 @@ std::string preserveStrings(std::string code, std::string keyWordEscpaeChar = "\
     std::vector<std::string> items1 = LoopParseFunc(code);
     for (size_t A_Index1 = 0; A_Index1 < items1.size(); A_Index1++) {
         std::string A_LoopField1 = items1[A_Index1 - 0];
-        HTVM_Append(HT_Lib_theIdNumOfThe34theVar, "");
-        HTVM_Append(HT_Lib_theIdNumOfThe34theVar, "");
+        HTVM_Append(literals.texts, "");
+        HTVM_Append(literals.texts, "");
     }
     std::vector<std::string> items2 = LoopParseFunc(code);
     for (size_t A_Index2 = 0; A_Index2 < items2.size(); A_Index2++) {
         std::string A_LoopField2 = items2[A_Index2 - 0];
-        HT_Lib_theIdNumOfThe34theVar[A_Index2] = HT_Lib_theIdNumOfThe34theVar[A_Index2] + Chr(34);
+        literals.texts[A_Index2] = literals.texts[A_Index2] + Chr(34);
         HTVM_Append(getAllCharForTheFurtureSoIcanAddEscapeChar, A_LoopField2);
     }
     HTVM_Append(getAllCharForTheFurtureSoIcanAddEscapeChar, " ");
@@ -451,13 +454,13 @@ std::string preserveStrings(std::string code, std::string keyWordEscpaeChar = "\
             if (areWEinSome34sNum == 1) {
                 if (A_LoopField4 != Chr(34)) {
                     if (A_LoopField4 == keyWordEscpaeChar) {
-                        HT_Lib_theIdNumOfThe34theVar[HT_LIB_theIdNumOfThe34] = HT_Lib_theIdNumOfThe34theVar[HT_LIB_theIdNumOfThe34] + Chr(92);
+                        literals.texts[literals.count] = literals.texts[literals.count] + Chr(92);
                     } else {
-                        HT_Lib_theIdNumOfThe34theVar[HT_LIB_theIdNumOfThe34] = HT_Lib_theIdNumOfThe34theVar[HT_LIB_theIdNumOfThe34] + A_LoopField4;
+                        literals.texts[literals.count] = literals.texts[literals.count] + A_LoopField4;
                     }
                 } else {
-                    HT_LIB_theIdNumOfThe34++;
-                    htCodeOUT754754 += "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(HT_LIB_theIdNumOfThe34) + Chr(65) + Chr(65);
+                    literals.count++;
+                    htCodeOUT754754 += "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(literals.count) + Chr(65) + Chr(65);
                 }
             }
             if (areWEinSome34sNum == 2 || areWEinSome34sNum == 0) {
@@ -477,21 +480,21 @@ std::string preserveStrings(std::string code, std::string keyWordEscpaeChar = "\
             if (areWEinSome34sNum == 1) {
                 if (A_LoopField5 != Chr(34)) {
                     if (A_LoopField5 == keyWordEscpaeChar && keyWordEscpaeChar == getAllCharForTheFurtureSoIcanAddEscapeChar[A_Index5 + 1]) {
-                        HT_Lib_theIdNumOfThe34theVar[HT_LIB_theIdNumOfThe34] = HT_Lib_theIdNumOfThe34theVar[HT_LIB_theIdNumOfThe34] + keyWordEscpaeChar;
+                        literals.texts[literals.count] = literals.texts[literals.count] + keyWordEscpaeChar;
                         removeNexFixkeyWordEscpaeChar = 1;
                     }
                     else if (A_LoopField5 == keyWordEscpaeChar) {
                         if (removeNexFixkeyWordEscpaeChar != 1) {
-                            HT_Lib_theIdNumOfThe34theVar[HT_LIB_theIdNumOfThe34] = HT_Lib_theIdNumOfThe34theVar[HT_LIB_theIdNumOfThe34] + Chr(92);
+                            literals.texts[literals.count] = literals.texts[literals.count] + Chr(92);
                         } else {
                             removeNexFixkeyWordEscpaeChar = 0;
                         }
                     } else {
-                        HT_Lib_theIdNumOfThe34theVar[HT_LIB_theIdNumOfThe34] = HT_Lib_theIdNumOfThe34theVar[HT_LIB_theIdNumOfThe34] + A_LoopField5;
+                        literals.texts[literals.count] = literals.texts[literals.count] + A_LoopField5;
                     }
                 } else {
-                    HT_LIB_theIdNumOfThe34++;
-                    htCodeOUT754754 += "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(HT_LIB_theIdNumOfThe34) + Chr(65) + Chr(65);
+                    literals.count++;
+                    htCodeOUT754754 += "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(literals.count) + Chr(65) + Chr(65);
                 }
             }
             if (areWEinSome34sNum == 2 || areWEinSome34sNum == 0) {
@@ -503,20 +506,23 @@ std::string preserveStrings(std::string code, std::string keyWordEscpaeChar = "\
         }
     }
     code = htCodeOUT754754;
-    for (int A_Index6 = 0; A_Index6 < HT_LIB_theIdNumOfThe34; A_Index6++) {
-        HT_Lib_theIdNumOfThe34theVar[A_Index6] = HT_Lib_theIdNumOfThe34theVar[A_Index6] + Chr(34);
+    for (int A_Index6 = 0; A_Index6 < literals.count; A_Index6++) {
+        literals.texts[A_Index6] = literals.texts[A_Index6] + Chr(34);
     }
-    HTVM_Append(HT_Lib_theIdNumOfThe34theVar, Chr(34));
+    // keep the literals, not the two slots per character of the program
+    literals.texts.resize(literals.count + 1);
+    literals.texts.shrink_to_fit();
+    HTVM_Append(literals.texts, Chr(34));
     return code;
 }
 //;;;;;;;;;;;;;;;;;;;;;;;;;;
 //;;;;;;;;;;;;;;;;;;;;;;;;;;
-std::string restoreStrings(std::string codeOUT, std::string keyWordEscpaeChar = Chr(92)) {
-    for (int A_Index7 = 0; A_Index7 < HT_LIB_theIdNumOfThe34; A_Index7++) {
-        if (HT_LIB_theIdNumOfThe34 == A_Index7 + 1) {
-            codeOUT = StrReplace(codeOUT, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(A_Index7 + 1) + Chr(65) + Chr(65), StrReplace(HT_Lib_theIdNumOfThe34theVar[A_Index7 + 1], keyWordEscpaeChar, "\\") + Chr(34));
+std::string restoreStrings(std::string codeOUT, const HT_StringLiterals& literals, std::string keyWordEscpaeChar = Chr(92)) {
+    for (int A_Index7 = 0; A_Index7 < literals.count; A_Index7++) {
+        if (literals.count == A_Index7 + 1) {
+            codeOUT = StrReplace(codeOUT, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(A_Index7 + 1) + Chr(65) + Chr(65), StrReplace(literals.texts[A_Index7 + 1], keyWordEscpaeChar, "\\") + Chr(34));
         } else {
-            codeOUT = StrReplace(codeOUT, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(A_Index7 + 1) + Chr(65) + Chr(65), StrReplace(HT_Lib_theIdNumOfThe34theVar[A_Index7 + 1], keyWordEscpaeChar, "\\"));
+            codeOUT = StrReplace(codeOUT, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(A_Index7 + 1) + Chr(65) + Chr(65), StrReplace(literals.texts[A_Index7 + 1], keyWordEscpaeChar, "\\"));
         }
     }
     return codeOUT;
@@ -719,37 +725,47 @@ std::string indent_nested_curly_braces(std::string input_string, int modeCurlyBr
     return result;
 }
 // end of HT-Lib.htvm
-std::string str0 = "";
-std::string str1 = "";
-std::string str2 = "";
-std::string str3 = "";
-std::string str4 = "";
-std::string str5 = "";
-std::string str6 = "";
-std::string str7 = "";
-std::string str8 = "";
-std::string str9 = "";
-std::string str10 = "";
-std::string str11 = "";
-std::string str12 = "";
-std::string str13 = "";
-std::string str14 = "";
-std::string str15 = "";
-std::string str16 = "";
-std::string str17 = "";
-std::string str18 = "";
-std::string str19 = "";
-std::string str20 = "";
-int is_arm = 0;
-int is_oryx = 0;
-int ring0 = 0;
-std::vector<std::string> nintArr;
-std::string langToConvertTo = "";
-std::vector<std::string> programmingBlock_InTheTranspiledLang;
-std::vector<std::string> programmingBlock_CPP;
-std::vector<std::string> programmingBlock_PY;
-std::vector<std::string> programmingBlock_JS;
-std::vector<std::string> programmingBlock_GO;
+// Compiler state. It is thread_local so that files compiled on different threads
+// (-j) never share it, and HTLL_resetCompilerState() clears it before each compilation.
+thread_local std::string str0 = "";
+thread_local std::string str1 = "";
+thread_local std::string str2 = "";
+thread_local std::string str3 = "";
+thread_local std::string str4 = "";
+thread_local std::string str5 = "";
+thread_local std::string str6 = "";
+thread_local std::string str7 = "";
+thread_local std::string str8 = "";
+thread_local std::string str9 = "";
+thread_local std::string str10 = "";
+thread_local std::string str11 = "";
+thread_local std::string str12 = "";
+thread_local std::string str13 = "";
+thread_local std::string str14 = "";
+thread_local std::string str15 = "";
+thread_local std::string str16 = "";
+thread_local std::string str17 = "";
+thread_local std::string str18 = "";
+thread_local std::string str19 = "";
+thread_local std::string str20 = "";
+thread_local int is_arm = 0;
+thread_local int is_oryx = 0;
+thread_local int ring0 = 0;
+thread_local std::vector<std::string> nintArr;
+thread_local std::string langToConvertTo = "";
+thread_local std::vector<std::string> programmingBlock_InTheTranspiledLang;
+thread_local std::vector<std::string> programmingBlock_CPP;
+thread_local std::vector<std::string> programmingBlock_PY;
+thread_local std::vector<std::string> programmingBlock_JS;
+thread_local std::vector<std::string> programmingBlock_GO;
+thread_local int COUNT_programmingBlock_InTheTranspiledLang = 0;
+thread_local int COUNT_programmingBlock_CPP = 0;
+thread_local int COUNT_programmingBlock_PY = 0;
+thread_local int COUNT_programmingBlock_JS = 0;
+thread_local int COUNT_programmingBlock_GO = 0;
+thread_local std::string programmingBlocksTemp = "";
+thread_local int inProgarmmingBlock = 0;
+thread_local std::string holdTempDataProgrammingBlockThenPutInArr = "";
 std::string keyWordCodeInTheTranspiledLangStart = "___start asm";
 std::string keyWordCodeInTheTranspiledLangStartCPP = "___start x86-64";
 std::string keyWordCodeInTheTranspiledLangStartPY = "___start arm";
@@ -760,14 +776,6 @@ std::string keyWordCodeInTheTranspiledLangEndCPP = "___end x86-64";
 std::string keyWordCodeInTheTranspiledLangEndPY = "___end arm";
 std::string keyWordCodeInTheTranspiledLangEndJS = "___end oryx";
 std::string keyWordCodeInTheTranspiledLangEndGO = "___end x86-64-ring0";
-int COUNT_programmingBlock_InTheTranspiledLang = 0;
-int COUNT_programmingBlock_CPP = 0;
-int COUNT_programmingBlock_PY = 0;
-int COUNT_programmingBlock_JS = 0;
-int COUNT_programmingBlock_GO = 0;
-std::string programmingBlocksTemp = "";
-int inProgarmmingBlock = 0;
-std::string holdTempDataProgrammingBlockThenPutInArr = "";
 std::string SubStrLastChars(std::string text, int numOfChars) {
     std::string LastOut = "";
     int NumOfChars = 0;
@@ -936,9121 +944,8403 @@ bool doseHaveInclude(std::string TheCodeThatMightHaveInclude) {
     }
     return false;
 }
-std::string HTLL_Lang(std::string code) {
-    std::string out = "";
-    // PROGRAMMING BLOCK
-    // PROGRAMMING BLOCK
-    // PROGRAMMING BLOCK
-    // PROGRAMMING BLOCK
-    std::vector<std::string> items26 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index26 = 0; A_Index26 < items26.size(); A_Index26++) {
-        std::string A_LoopField26 = items26[A_Index26 - 0];
-        if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangEnd)) {
-            COUNT_programmingBlock_InTheTranspiledLang++;
-            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
-            programmingBlocksTemp += "programmingBlock_InTheTranspiledLang-programmingBlock_InTheTranspiledLang-AA" + STR(COUNT_programmingBlock_InTheTranspiledLang) + "AA" + Chr(10);
-            HTVM_Append(programmingBlock_InTheTranspiledLang, holdTempDataProgrammingBlockThenPutInArr);
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 0;
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <dirent.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/uio.h>
+#include <climits>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+// --time-passes: wall time, heap allocations and peak RSS for each compiler pass.
+// HTLL_pass(name) ends the running pass and starts the next one; passes that run more
+// than once (programming blocks, brace formatting, ...) are added up under one name.
+// Allocations are counted per thread by the operator new below, so parallel
+// compilations do not mix their numbers. It replaces operator new for the whole binary,
+// but only counts when --time-passes is given; otherwise it is a plain malloc.
+int HTLL_timePasses = 0; // 0 = off, 1 = table, 2 = JSON; set before any compilation starts
+thread_local long long HTLL_allocCount = 0;
+thread_local long long HTLL_allocBytes = 0;
+void* operator new(std::size_t size) {
+    if (HTLL_timePasses != 0) {
+        HTLL_allocCount++;
+        HTLL_allocBytes += (long long)size;
+    }
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+struct HTLL_PassStats {
+    std::string name;
+    double ms = 0;
+    long long allocs = 0;
+    long long bytes = 0;
+    long long peakRssKb = 0;
+};
+thread_local std::vector<HTLL_PassStats> HTLL_passStats;
+thread_local std::string HTLL_passName;
+thread_local std::chrono::steady_clock::time_point HTLL_passStart;
+thread_local long long HTLL_passAllocs = 0;
+thread_local long long HTLL_passBytes = 0;
+long long HTLL_peakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (long long)usage.ru_maxrss;
+}
+void HTLL_pass(const std::string& name) {
+    if (HTLL_timePasses == 0) {
+        return;
+    }
+    if (HTLL_passName != "") {
+        HTLL_PassStats* stats = nullptr;
+        for (HTLL_PassStats& existing : HTLL_passStats) {
+            if (existing.name == HTLL_passName) {
+                stats = &existing;
+            }
+        }
+        if (stats == nullptr) {
+            HTLL_passStats.push_back(HTLL_PassStats());
+            stats = &HTLL_passStats.back();
+            stats->name = HTLL_passName;
+        }
+        stats->ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - HTLL_passStart).count();
+        stats->allocs += HTLL_allocCount - HTLL_passAllocs;
+        stats->bytes += HTLL_allocBytes - HTLL_passBytes;
+        stats->peakRssKb = HTLL_peakRssKb();
+    }
+    HTLL_passName = name;
+    HTLL_passAllocs = HTLL_allocCount;
+    HTLL_passBytes = HTLL_allocBytes;
+    HTLL_passStart = std::chrono::steady_clock::now();
+}
+// HTLL_count(name, n) adds n to a named counter that is reported with the passes, such as
+// the hits of a peephole rule.
+thread_local std::vector<std::pair<std::string, long long>> HTLL_passCounters;
+void HTLL_count(const std::string& name, long long n) {
+    if (HTLL_timePasses == 0) {
+        return;
+    }
+    for (std::pair<std::string, long long>& counter : HTLL_passCounters) {
+        if (counter.first == name) {
+            counter.second += n;
+            return;
         }
-        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangEndCPP)) {
-            COUNT_programmingBlock_CPP++;
-            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
-            programmingBlocksTemp += "programmingBlock_CPP-programmingBlock_CPP-AA" + STR(COUNT_programmingBlock_CPP) + "AA" + Chr(10);
-            HTVM_Append(programmingBlock_CPP, holdTempDataProgrammingBlockThenPutInArr);
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 0;
+    }
+    HTLL_passCounters.push_back({name, n});
+}
+// s as the contents of a JSON string: quotes, backslashes and control characters escaped.
+std::string HTLL_jsonEscape(const std::string& s) {
+    std::string out;
+    for (unsigned char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += (char)c;
+        } else if (c < 0x20) {
+            static const char digits[] = "0123456789abcdef";
+            out += "\\u00";
+            out += digits[c >> 4];
+            out += digits[c & 0xF];
+        } else {
+            out += (char)c;
         }
-        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangEndPY)) {
-            COUNT_programmingBlock_PY++;
-            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
-            programmingBlocksTemp += "programmingBlock_PY-programmingBlock_PY-AA" + STR(COUNT_programmingBlock_PY) + "AA" + Chr(10);
-            HTVM_Append(programmingBlock_PY, holdTempDataProgrammingBlockThenPutInArr);
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 0;
+    }
+    return out;
+}
+// Ends the running pass and returns this thread's passes and counters as a table or a
+// JSON object for the given output file, then clears them for the next compilation.
+std::string HTLL_passReport(const std::string& label) {
+    HTLL_pass("");
+    std::ostringstream out;
+    double totalMs = 0;
+    long long totalAllocs = 0;
+    long long totalBytes = 0;
+    for (const HTLL_PassStats& stats : HTLL_passStats) {
+        totalMs += stats.ms;
+        totalAllocs += stats.allocs;
+        totalBytes += stats.bytes;
+    }
+    out << std::fixed;
+    if (HTLL_timePasses == 2) {
+        out << "{\"file\": \"" << HTLL_jsonEscape(label) << "\", \"passes\": [";
+        for (size_t i = 0; i < HTLL_passStats.size(); i++) {
+            const HTLL_PassStats& stats = HTLL_passStats[i];
+            out << (i > 0 ? ", " : "") << "{\"name\": \"" << HTLL_jsonEscape(stats.name) << "\", \"ms\": " << std::setprecision(3) << stats.ms << ", \"allocations\": " << stats.allocs << ", \"allocated_bytes\": " << stats.bytes << ", \"peak_rss_kb\": " << stats.peakRssKb << "}";
+        }
+        out << "], \"counters\": {";
+        for (size_t i = 0; i < HTLL_passCounters.size(); i++) {
+            out << (i > 0 ? ", " : "") << "\"" << HTLL_jsonEscape(HTLL_passCounters[i].first) << "\": " << HTLL_passCounters[i].second;
+        }
+        out << "}, \"total_ms\": " << std::setprecision(3) << totalMs << ", \"total_allocations\": " << totalAllocs << ", \"total_allocated_bytes\": " << totalBytes << ", \"peak_rss_kb\": " << HTLL_peakRssKb() << "}";
+    } else {
+        out << "Pass times for " << label << ":" << "\n";
+        out << std::left << std::setw(30) << "  pass" << std::right << std::setw(12) << "ms" << std::setw(8) << "%" << std::setw(14) << "allocations" << std::setw(14) << "alloc KB" << std::setw(14) << "peak RSS KB" << "\n";
+        for (const HTLL_PassStats& stats : HTLL_passStats) {
+            out << std::left << std::setw(30) << ("  " + stats.name) << std::right << std::setprecision(2) << std::setw(12) << stats.ms << std::setprecision(1) << std::setw(8) << (totalMs > 0 ? 100.0 * stats.ms / totalMs : 0.0) << std::setw(14) << stats.allocs << std::setw(14) << stats.bytes / 1024 << std::setw(14) << stats.peakRssKb << "\n";
         }
-        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangEndJS)) {
-            COUNT_programmingBlock_JS++;
-            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
-            programmingBlocksTemp += "programmingBlock_JS-programmingBlock_JS-AA" + STR(COUNT_programmingBlock_JS) + "AA" + Chr(10);
-            HTVM_Append(programmingBlock_JS, holdTempDataProgrammingBlockThenPutInArr);
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 0;
+        out << std::left << std::setw(30) << "  total" << std::right << std::setprecision(2) << std::setw(12) << totalMs << std::setw(8) << "" << std::setw(14) << totalAllocs << std::setw(14) << totalBytes / 1024 << std::setw(14) << HTLL_peakRssKb();
+        for (const std::pair<std::string, long long>& counter : HTLL_passCounters) {
+            out << "\n" << std::left << std::setw(30) << ("  " + counter.first) << std::right << std::setw(12) << counter.second;
         }
-        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangEndGO)) {
-            COUNT_programmingBlock_GO++;
-            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
-            programmingBlocksTemp += "programmingBlock_GO-programmingBlock_GO-AA" + STR(COUNT_programmingBlock_GO) + "AA" + Chr(10);
-            HTVM_Append(programmingBlock_GO, holdTempDataProgrammingBlockThenPutInArr);
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 0;
+    }
+    HTLL_passStats.clear();
+    HTLL_passCounters.clear();
+    return out.str();
+}
+// 128-bit FNV-1a, printed as 32 hex digits. Used to fingerprint sources and cache keys.
+std::string HTLL_hash128(const std::string& data) {
+    unsigned __int128 prime = ((unsigned __int128)0x0000000001000000ULL << 64) | 0x000000000000013BULL;
+    unsigned __int128 hash = ((unsigned __int128)0x6c62272e07bb0142ULL << 64) | 0x62b821756295c58dULL;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= prime;
+    }
+    static const char digits[] = "0123456789abcdef";
+    std::string out(32, '0');
+    for (int i = 31; i >= 0; i--) {
+        out[i] = digits[(int)(hash & 0xF)];
+        hash >>= 4;
+    }
+    return out;
+}
+// A generated program, kept as chunks of up to 64 KiB. The back end returns one, the assembly
+// writer appends the finished lines to it and the chunks are written out one by one, so the
+// program is never joined into one string or copied as a whole.
+class HTLL_Output {
+public:
+    static const size_t chunkSize = 1 << 16;
+    void append(const char* data, size_t size) {
+        while (size > 0) {
+            if (chunks.empty() || chunks.back().size() == chunkSize) {
+                chunks.emplace_back();
+                chunks.back().reserve(chunkSize);
+            }
+            size_t n = std::min(size, chunkSize - chunks.back().size());
+            chunks.back().append(data, n);
+            data += n;
+            size -= n;
         }
-        else if (inProgarmmingBlock == 1) {
-            holdTempDataProgrammingBlockThenPutInArr += A_LoopField26 + Chr(10);
+    }
+    void append(const std::string& text) {
+        append(text.data(), text.size());
+    }
+    const std::vector<std::string>& parts() const {
+        return chunks;
+    }
+    void clear() {
+        std::vector<std::string>().swap(chunks);
+    }
+private:
+    std::vector<std::string> chunks;
+};
+// Writes a generated file, replacing any previous version.
+bool HTLL_writeOutput(const std::string& path, const std::string& content) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open the file for writing: " << path << std::endl;
+        return false;
+    }
+    file.write(content.data(), (std::streamsize)content.size());
+    return (bool)file;
+}
+bool HTLL_writeOutput(const std::string& path, const HTLL_Output& content) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open the file for writing: " << path << std::endl;
+        return false;
+    }
+    for (const std::string& chunk : content.parts()) {
+        file.write(chunk.data(), (std::streamsize)chunk.size());
+    }
+    return (bool)file;
+}
+// One exported function of a library module (.htllm).
+struct HTLL_ModuleFunc {
+    std::string name;
+    std::vector<std::string> deps;
+    std::string text;
+};
+// Include resolution: every included file is read and split into lines once per
+// process and cached by its canonical path. The cache entry is reused as long as
+// the file's mtime and size did not change, so compiling many programs that share
+// HTLL_Lib.htll only touches the disk for it once.
+struct HTLL_IncludeFile {
+    long long mtime = -1;
+    long long size = -1;
+    std::string contentHash;
+    std::vector<std::string> lines;
+    // for every line: the path it includes, or "" if it is not an include line
+    std::vector<std::string> includes;
+    // set when the file is a library module; lines then only hold its top level
+    bool isModule = false;
+    std::string moduleSourceHash;
+    std::vector<HTLL_ModuleFunc> funcs;
+};
+// Shared by all compilations; entries are immutable once published, so a compilation keeps
+// using the version it loaded even if another one reloads the file.
+std::unordered_map<std::string, std::shared_ptr<const HTLL_IncludeFile>> HTLL_includeCache;
+std::mutex HTLL_includeCacheMutex;
+std::string HTLL_canonicalPath(const std::string& path) {
+    char resolved[PATH_MAX];
+    if (realpath(path.c_str(), resolved) != nullptr) {
+        return std::string(resolved);
+    }
+    return path;
+}
+std::string HTLL_includePathOf(const std::string& line) {
+    std::string keyWordInclude = "include ";
+    std::string trimmed = Trim(line);
+    if (StrLower(trimmed.substr(0, keyWordInclude.size())) != keyWordInclude) {
+        return "";
+    }
+    return StrReplace(StringTrimLeft(trimmed, keyWordInclude.size()), Chr(34), "");
+}
+void HTLL_lexIncludeText(const std::string& text, HTLL_IncludeFile& file) {
+    file.lines = LoopParseFunc(text, "\n", "\r");
+    file.includes.clear();
+    file.includes.reserve(file.lines.size());
+    for (const std::string& line : file.lines) {
+        file.includes.push_back(HTLL_includePathOf(line));
+    }
+}
+bool HTLL_endsWith(const std::string& text, const std::string& suffix) {
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+// Splits a line into identifier tokens; used for module export/import references.
+void HTLL_identifiersOf(const std::string& line, std::vector<std::string>& out) {
+    std::string word;
+    for (char c : line) {
+        if (std::isalnum((unsigned char)c) || c == '_') {
+            word += c;
+        } else if (!word.empty()) {
+            out.push_back(word);
+            word.clear();
         }
-        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangStart)) {
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 1;
+    }
+    if (!word.empty()) {
+        out.push_back(word);
+    }
+}
+// Reads a .htllm module: a header, the export table ("export <name> <deps...>")
+// and one $$$$name$$$$ ... %%%%name%%%% section per function (the same markers the
+// runtime libraries use). The __toplevel__ section holds everything outside functions.
+void HTLL_lexModuleText(const std::string& text, HTLL_IncludeFile& file) {
+    file.isModule = true;
+    file.funcs.clear();
+    std::unordered_map<std::string, size_t> funcIndex;
+    std::string topLevel = "";
+    std::string section = "";
+    std::string sectionText = "";
+    std::vector<std::string> lines = LoopParseFunc(text, "\n", "\r");
+    for (const std::string& line : lines) {
+        if (section == "") {
+            if (SubStr(line, 1, 9) == "; source ") {
+                file.moduleSourceHash = Trim(StringTrimLeft(line, 9));
+            } else if (SubStr(line, 1, 7) == "export ") {
+                std::vector<std::string> words;
+                HTLL_identifiersOf(StringTrimLeft(line, 7), words);
+                if (!words.empty()) {
+                    funcIndex[words[0]] = file.funcs.size();
+                    file.funcs.push_back({words[0], std::vector<std::string>(words.begin() + 1, words.end()), ""});
+                }
+            } else if (SubStr(line, 1, 4) == "$$$$") {
+                section = StringTrimLeft(StringTrimRight(Trim(line), 4), 4);
+                sectionText = "";
+            }
+        } else if (SubStr(line, 1, 4) == "%%%%") {
+            if (section == "__toplevel__") {
+                topLevel = sectionText;
+            } else if (funcIndex.count(section)) {
+                file.funcs[funcIndex[section]].text = sectionText;
+            }
+            section = "";
+        } else {
+            sectionText += line + Chr(10);
         }
-        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangStartCPP)) {
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 1;
+    }
+    HTLL_lexIncludeText(topLevel, file);
+}
+std::shared_ptr<const HTLL_IncludeFile> HTLL_loadInclude(const std::string& canonicalPath, const std::string& path) {
+    struct stat st;
+    long long mtime = -1;
+    long long size = -1;
+    if (stat(canonicalPath.c_str(), &st) == 0) {
+        mtime = (long long)st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+        size = (long long)st.st_size;
+    }
+    {
+        std::lock_guard<std::mutex> lock(HTLL_includeCacheMutex);
+        auto it = HTLL_includeCache.find(canonicalPath);
+        if (it != HTLL_includeCache.end() && mtime != -1 && it->second->mtime == mtime && it->second->size == size) {
+            return it->second;
         }
-        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangStartPY)) {
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 1;
+    }
+    auto file = std::make_shared<HTLL_IncludeFile>();
+    std::string content = Trim(FileRead(path));
+    file->contentHash = HTLL_hash128(content);
+    if (HTLL_endsWith(path, ".htllm")) {
+        HTLL_lexModuleText(content, *file);
+    } else {
+        HTLL_lexIncludeText(content, *file);
+    }
+    file->mtime = mtime;
+    file->size = size;
+    std::lock_guard<std::mutex> lock(HTLL_includeCacheMutex);
+    HTLL_includeCache[canonicalPath] = file;
+    return file;
+}
+// An include of X.htll is served from X.htllm when that module exists and was
+// built from the current contents of X.htll; a stale module is ignored.
+std::shared_ptr<const HTLL_IncludeFile> HTLL_loadIncludeOrModule(const std::string& canonicalPath, const std::string& path) {
+    std::shared_ptr<const HTLL_IncludeFile> source = HTLL_loadInclude(canonicalPath, path);
+    if (!HTLL_endsWith(path, ".htll")) {
+        return source;
+    }
+    struct stat st;
+    std::string modulePath = canonicalPath + "m";
+    if (stat(modulePath.c_str(), &st) != 0) {
+        return source;
+    }
+    std::shared_ptr<const HTLL_IncludeFile> module = HTLL_loadInclude(modulePath, modulePath);
+    if (module->isModule && module->moduleSourceHash == source->contentHash) {
+        return module;
+    }
+    return source;
+}
+// Expands every include directive in a single walk over the include graph.
+// A file is expanded at its first occurrence in breadth-first order (the order
+// the old pass-by-pass resolver used) and every later include of it is dropped.
+// Library modules only contribute the functions the program references.
+std::string HTLL_resolveIncludes(const std::string& code) {
+    struct Node {
+        std::shared_ptr<const HTLL_IncludeFile> file;
+        std::vector<int> children; // node index per line, -1 = not expanded
+        std::string path;
+    };
+    std::string keyWordComment = ";";
+    auto root = std::make_shared<HTLL_IncludeFile>();
+    HTLL_lexIncludeText(code, *root);
+    std::vector<Node> nodes;
+    nodes.push_back({root, {}, ""});
+    std::unordered_set<std::string> visited;
+    for (size_t n = 0; n < nodes.size(); n++) {
+        const HTLL_IncludeFile* file = nodes[n].file.get();
+        std::vector<int> children(file->lines.size(), -1);
+        for (size_t i = 0; i < file->lines.size(); i++) {
+            const std::string& path = file->includes[i];
+            if (path.empty()) {
+                continue;
+            }
+            std::string canonicalPath = HTLL_canonicalPath(path);
+            if (!visited.insert(canonicalPath).second) {
+                continue;
+            }
+            children[i] = (int)nodes.size();
+            nodes.push_back({HTLL_loadIncludeOrModule(canonicalPath, path), {}, path});
         }
-        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangStartJS)) {
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 1;
+        nodes[n].children = std::move(children);
+    }
+    // import only the module functions reachable from the rest of the program; two modules
+    // exporting the same name is an error rather than one silently replacing the other
+    std::unordered_map<std::string, const HTLL_ModuleFunc*> exported;
+    std::unordered_map<std::string, const std::string*> exportedBy;
+    for (const Node& node : nodes) {
+        for (const HTLL_ModuleFunc& func : node.file->funcs) {
+            if (!exported.emplace(func.name, &func).second) {
+                throw std::runtime_error("ERROR The function " + func.name + " is exported by both " + *exportedBy[func.name] + " and " + node.path + ".");
+            }
+            exportedBy[func.name] = &node.path;
         }
-        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangStartGO)) {
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 1;
-        } else {
-            programmingBlocksTemp += A_LoopField26 + Chr(10);
+    }
+    std::unordered_set<const HTLL_ModuleFunc*> imported;
+    if (!exported.empty()) {
+        std::vector<std::string> pending;
+        for (const Node& node : nodes) {
+            for (const std::string& line : node.file->lines) {
+                HTLL_identifiersOf(line, pending);
+            }
+        }
+        while (!pending.empty()) {
+            std::string name = pending.back();
+            pending.pop_back();
+            auto it = exported.find(name);
+            if (it != exported.end() && imported.insert(it->second).second) {
+                pending.insert(pending.end(), it->second->deps.begin(), it->second->deps.end());
+            }
         }
     }
-    code = StringTrimRight(programmingBlocksTemp, 1);
-    //programmingBlock_InTheTranspiledLang
-    //programmingBlock_CPP
-    //programmingBlock_PY
-    //programmingBlock_JS
-    //programmingBlock_GO
-    // PROGRAMMING BLOCK
-    // PROGRAMMING BLOCK
-    // PROGRAMMING BLOCK
-    // PROGRAMMING BLOCK
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    // this is the start of include
-    // this is the start of include
-    // this is the start of include
-    // this is the start of include
-    std::vector<std::string> includedFilePaths;
-    bool includesWereFoundInPass = false;
-    std::string reconstructedCode = "";
-    std::string currentLine = "";
-    std::string filePathToInclude = "";
-    bool isAlreadyIncluded = false;
-    std::string fileContent = "";
-    std::string keyWordInclude = "include";
-    std::string keyWordComment = ";";
-    if (doseHaveInclude(code)) {
-        // Loop up to 10000 times to resolve nested includes. Each pass processes one level of includes.
-        for (int A_Index27 = 0; A_Index27 < 10000; A_Index27++) {
-            // Reset the flag and the temporary code string for this pass.
-            includesWereFoundInPass = false;
-            reconstructedCode = "";
-            // Iterate through each line of the current code.
-            std::vector<std::string> items28 = LoopParseFunc(code, "\n", "\r");
-            for (size_t A_Index28 = 0; A_Index28 < items28.size(); A_Index28++) {
-                std::string A_LoopField28 = items28[A_Index28 - 0];
-                currentLine = A_LoopField28;
-                // Check if the current line is an 'include' directive.
-                if (SubStr(StrLower(Trim(currentLine)), 1, StrLen(keyWordInclude + " ")) == StrLower(keyWordInclude + " ")) {
-                    includesWereFoundInPass = true;
-                    filePathToInclude = StrReplace(StringTrimLeft(Trim(currentLine), StrLen(keyWordInclude + " ")), Chr(34), "");
-                    // Reset flag for the inner loop.
-                    isAlreadyIncluded = false;
-                    // NOTE: Both this loop's A_Index and the array access are 0-based, which is correct.
-                    for (int A_Index29 = 0; A_Index29 < HTVM_Size(includedFilePaths); A_Index29++) {
-                        if (filePathToInclude == includedFilePaths[A_Index29]) {
-                            isAlreadyIncluded = true;
-                            break;
-                        }
-                    }
-                    if (isAlreadyIncluded == false) {
-                        fileContent = Trim(FileRead(filePathToInclude));
-                        // The 'include' line is replaced by the file's content in the reconstructed code.
-                        reconstructedCode = reconstructedCode + Chr(10) + keyWordComment + " start of " + filePathToInclude + Chr(10) + fileContent + Chr(10) + keyWordComment + " end of " + filePathToInclude + Chr(10) + Chr(10);
-                        HTVM_Append(includedFilePaths, filePathToInclude);
-                    }
-                } else {
-                    // If it's not an include directive, just copy the line as is.
-                    reconstructedCode = reconstructedCode + currentLine + Chr(10);
-                }
+    std::string out;
+    out.reserve(code.size());
+    // explicit stack so deeply nested includes cannot overflow the C++ stack
+    std::vector<std::pair<int, size_t>> stack;
+    stack.push_back({0, 0});
+    while (!stack.empty()) {
+        int n = stack.back().first;
+        size_t i = stack.back().second;
+        const HTLL_IncludeFile* file = nodes[n].file.get();
+        if (i == file->lines.size()) {
+            for (const HTLL_ModuleFunc& func : file->funcs) {
+                if (imported.count(&func)) {
+                    out += func.text;
+                }
+            }
+            stack.pop_back();
+            if (!stack.empty()) {
+                const std::string& path = nodes[stack.back().first].file->includes[stack.back().second - 1];
+                out += Chr(10) + keyWordComment + " end of " + path + Chr(10) + Chr(10);
             }
-            // --- Cleanup and Preparation for Next Pass ---
-            // Replace the old code with the newly reconstructed code. This "clears up" the processed includes.
-            code = reconstructedCode;
-            // If no includes were found in this entire pass, all directives are resolved. Exit the loop.
-            if (includesWereFoundInPass == false) {
-                break;
+            continue;
+        }
+        stack.back().second++;
+        if (file->includes[i].empty()) {
+            out += file->lines[i] + Chr(10);
+        } else if (nodes[n].children[i] != -1) {
+            out += Chr(10) + keyWordComment + " start of " + file->includes[i] + Chr(10);
+            stack.push_back({nodes[n].children[i], 0});
+        }
+    }
+    return out;
+}
+// Canonical paths of every file the source includes, directly or through other includes,
+// with the .htllm module next to each included .htll. Used by --watch to find the
+// programs a changed file affects.
+std::vector<std::string> HTLL_includeDeps(const std::string& code) {
+    std::vector<std::string> deps;
+    std::unordered_set<std::string> visited;
+    std::vector<std::shared_ptr<const HTLL_IncludeFile>> pending;
+    auto root = std::make_shared<HTLL_IncludeFile>();
+    HTLL_lexIncludeText(code, *root);
+    pending.push_back(root);
+    while (!pending.empty()) {
+        std::shared_ptr<const HTLL_IncludeFile> file = pending.back();
+        pending.pop_back();
+        for (const std::string& path : file->includes) {
+            if (path.empty()) {
+                continue;
+            }
+            std::string canonicalPath = HTLL_canonicalPath(path);
+            if (!visited.insert(canonicalPath).second) {
+                continue;
+            }
+            deps.push_back(canonicalPath);
+            if (HTLL_endsWith(path, ".htll")) {
+                deps.push_back(canonicalPath + "m");
+            }
+            struct stat st;
+            if (stat(canonicalPath.c_str(), &st) == 0) {
+                pending.push_back(HTLL_loadIncludeOrModule(canonicalPath, path));
             }
         }
     }
-    // this is the end of include
-    //;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;
-    programmingBlocksTemp = "";
-    inProgarmmingBlock = 0;
-    holdTempDataProgrammingBlockThenPutInArr = "";
-    std::vector<std::string> items30 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index30 = 0; A_Index30 < items30.size(); A_Index30++) {
-        std::string A_LoopField30 = items30[A_Index30 - 0];
-        if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangEnd)) {
-            COUNT_programmingBlock_InTheTranspiledLang++;
-            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
-            programmingBlocksTemp += "programmingBlock_InTheTranspiledLang-programmingBlock_InTheTranspiledLang-AA" + STR(COUNT_programmingBlock_InTheTranspiledLang) + "AA" + Chr(10);
-            HTVM_Append(programmingBlock_InTheTranspiledLang, holdTempDataProgrammingBlockThenPutInArr);
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 0;
+    return deps;
+}
+// Brace/funcend depth change of one source line, ignoring string literals and comments.
+int HTLL_braceDelta(const std::string& line) {
+    int delta = 0;
+    bool inString = false;
+    for (size_t i = 0; i < line.size(); i++) {
+        char c = line[i];
+        if (c == '"') {
+            inString = !inString;
+        } else if (!inString && c == ';' && (i == 0 || line[i - 1] == ' ' || line[i - 1] == '\t')) {
+            break;
+        } else if (!inString && c == '{') {
+            delta++;
+        } else if (!inString && c == '}') {
+            delta--;
         }
-        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangEndCPP)) {
-            COUNT_programmingBlock_CPP++;
-            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
-            programmingBlocksTemp += "programmingBlock_CPP-programmingBlock_CPP-AA" + STR(COUNT_programmingBlock_CPP) + "AA" + Chr(10);
-            HTVM_Append(programmingBlock_CPP, holdTempDataProgrammingBlockThenPutInArr);
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 0;
+    }
+    return delta;
+}
+// ./HTLL lib.htll --module
+// Writes lib.htllm, the library's source split per function with an export table:
+// comment-only and blank lines are dropped, and every function's references to the
+// other exports are recorded so importers can pull in exactly the closure they need.
+// The functions stay HTLL source and are compiled with each program that imports them.
+int HTLL_writeLibraryModule(const std::string& sourcePath, const std::string& modulePath) {
+    std::string content = Trim(FileRead(sourcePath));
+    std::vector<std::string> lines = LoopParseFunc(content, "\n", "\r");
+    std::vector<HTLL_ModuleFunc> funcs;
+    std::string topLevel = "";
+    int depth = 0;
+    bool inFunc = false;
+    bool braceSeen = false;
+    for (const std::string& rawLine : lines) {
+        std::string line = Trim(rawLine);
+        if (line == "" || SubStr(line, 1, 1) == ";") {
+            continue;
         }
-        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangEndPY)) {
-            COUNT_programmingBlock_PY++;
-            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
-            programmingBlocksTemp += "programmingBlock_PY-programmingBlock_PY-AA" + STR(COUNT_programmingBlock_PY) + "AA" + Chr(10);
-            HTVM_Append(programmingBlock_PY, holdTempDataProgrammingBlockThenPutInArr);
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 0;
+        if (!inFunc && StrLower(SubStr(line, 1, 5)) == "func ") {
+            std::string head = Trim(StrSplit(StringTrimLeft(line, 5), "(", 1));
+            std::vector<std::string> words;
+            HTLL_identifiersOf(head, words);
+            funcs.push_back({words.empty() ? head : words.back(), {}, ""});
+            inFunc = true;
+            braceSeen = false;
+            depth = 0;
+        }
+        if (!inFunc) {
+            topLevel += line + Chr(10);
+            continue;
         }
-        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangEndJS)) {
-            COUNT_programmingBlock_JS++;
-            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
-            programmingBlocksTemp += "programmingBlock_JS-programmingBlock_JS-AA" + STR(COUNT_programmingBlock_JS) + "AA" + Chr(10);
-            HTVM_Append(programmingBlock_JS, holdTempDataProgrammingBlockThenPutInArr);
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 0;
+        funcs.back().text += line + Chr(10);
+        int delta = HTLL_braceDelta(line);
+        if (delta != 0 || InStr(line, "{")) {
+            braceSeen = true;
         }
-        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangEndGO)) {
-            COUNT_programmingBlock_GO++;
-            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
-            programmingBlocksTemp += "programmingBlock_GO-programmingBlock_GO-AA" + STR(COUNT_programmingBlock_GO) + "AA" + Chr(10);
-            HTVM_Append(programmingBlock_GO, holdTempDataProgrammingBlockThenPutInArr);
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 0;
+        depth += delta;
+        if ((braceSeen && depth <= 0) || StrLower(line) == "funcend" || StrLower(line) == "endfunc") {
+            inFunc = false;
         }
-        else if (inProgarmmingBlock == 1) {
-            holdTempDataProgrammingBlockThenPutInArr += A_LoopField30 + Chr(10);
+    }
+    std::unordered_set<std::string> names;
+    for (const HTLL_ModuleFunc& func : funcs) {
+        names.insert(func.name);
+    }
+    std::string out = "; HTLL module generated from " + sourcePath + " by " + "./HTLL " + sourcePath + " --module" + Chr(10);
+    out += "; source " + HTLL_hash128(content) + Chr(10);
+    for (HTLL_ModuleFunc& func : funcs) {
+        std::vector<std::string> words;
+        std::unordered_set<std::string> seen;
+        std::vector<std::string> bodyLines = LoopParseFunc(func.text, "\n", "\r");
+        for (size_t i = 1; i < bodyLines.size(); i++) {
+            HTLL_identifiersOf(bodyLines[i], words);
         }
-        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangStart)) {
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 1;
+        for (const std::string& word : words) {
+            if (word != func.name && names.count(word) && seen.insert(word).second) {
+                func.deps.push_back(word);
+            }
         }
-        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangStartCPP)) {
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 1;
+        out += "export " + func.name;
+        for (const std::string& dep : func.deps) {
+            out += " " + dep;
         }
-        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangStartPY)) {
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 1;
+        out += Chr(10);
+    }
+    out += "$$$$__toplevel__$$$$" + Chr(10) + topLevel + "%%%%__toplevel__%%%%" + Chr(10);
+    for (const HTLL_ModuleFunc& func : funcs) {
+        out += "$$$$" + func.name + "$$$$" + Chr(10) + func.text + "%%%%" + func.name + "%%%%" + Chr(10);
+    }
+    HTLL_writeOutput(modulePath, out);
+    return (int)funcs.size();
+}
+// Identifiers used by one line of assembly, skipping string literals and the comment.
+// FASM (x86-64) comments start with ;, GNU as (AArch64) comments with //.
+std::vector<std::string> HTLL_asmIdentifiers(const std::string& line, int isArm) {
+    std::vector<std::string> out;
+    size_t i = 0;
+    size_t n = line.size();
+    auto isIdentChar = [](char c) {
+        return std::isalnum((unsigned char)c) || c == '_' || c == '.' || c == '?' || c == '@';
+    };
+    while (i < n) {
+        char c = line[i];
+        if (c == '"' || c == '\'') {
+            size_t end = i + 1;
+            while (end < n && line[end] != c) {
+                if (isArm == 1 && line[end] == '\\') {
+                    end++;
+                }
+                end++;
+            }
+            i = end < n ? end + 1 : i + 1;
+            continue;
         }
-        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangStartJS)) {
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 1;
+        if ((isArm == 1 && c == '/' && i + 1 < n && line[i + 1] == '/') || (isArm == 0 && c == ';')) {
+            break;
         }
-        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangStartGO)) {
-            holdTempDataProgrammingBlockThenPutInArr = "";
-            inProgarmmingBlock = 1;
-        } else {
-            programmingBlocksTemp += A_LoopField30 + Chr(10);
+        if (std::isalpha((unsigned char)c) || c == '_' || c == '.' || c == '?' || c == '@') {
+            size_t start = i;
+            while (i < n && isIdentChar(line[i])) {
+                i++;
+            }
+            out.push_back(line.substr(start, i - start));
+            continue;
+        }
+        if (std::isdigit((unsigned char)c)) {
+            while (i < n && isIdentChar(line[i])) {
+                i++;
+            }
+            continue;
         }
+        i++;
     }
-    code = StringTrimRight(programmingBlocksTemp, 1);
-    //programmingBlock_InTheTranspiledLang
-    //programmingBlock_CPP
-    //programmingBlock_PY
-    //programmingBlock_JS
-    //programmingBlock_GO
-    // PROGRAMMING BLOCK
-    // PROGRAMMING BLOCK
-    // PROGRAMMING BLOCK
-    // PROGRAMMING BLOCK
-    code = cleanUpFirst(code);
-    code = preserveStrings(code);
-    code = handleComments(code);
-    code = formatCurlyBracesForParsing(code);
-    int doWeEverSeeExprestion = 0;
-    out = "";
-    std::vector<std::string> items31 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index31 = 0; A_Index31 < items31.size(); A_Index31++) {
-        std::string A_LoopField31 = items31[A_Index31 - 0];
-        if (InStr(A_LoopField31, " := ") || InStr(A_LoopField31, " += ") || InStr(A_LoopField31, " -= ") || InStr(A_LoopField31, " *= ") || InStr(A_LoopField31, " //= ") || InStr(A_LoopField31, " %= ") || InStr(A_LoopField31, " <<= ") || InStr(A_LoopField31, " >>= ") || InStr(A_LoopField31, " &= ") || InStr(A_LoopField31, " |= ") || InStr(A_LoopField31, " ^= ")) {
-            str1 = Trim(A_LoopField31);
-            if (InStr(A_LoopField31, " + ") || InStr(A_LoopField31, " - ") || InStr(A_LoopField31, " * ") || InStr(A_LoopField31, " // ") || InStr(A_LoopField31, " % ") || InStr(A_LoopField31, " << ") || InStr(A_LoopField31, " >> ") || InStr(A_LoopField31, " & ") || InStr(A_LoopField31, " | ") || InStr(A_LoopField31, " ^ ")) {
-                if (InStr(A_LoopField31, " := ")) {
-                    str10 = ":=";
-                }
-                else if (InStr(A_LoopField31, " += ")) {
-                    str10 = "+=";
-                }
-                else if (InStr(A_LoopField31, " -= ")) {
-                    str10 = "-=";
-                }
-                else if (InStr(A_LoopField31, " *= ")) {
-                    str10 = "*=";
-                }
-                else if (InStr(A_LoopField31, " //= ")) {
-                    str10 = "//=";
-                }
-                else if (InStr(A_LoopField31, " %= ")) {
-                    str10 = "%=";
-                }
-                else if (InStr(A_LoopField31, " <<= ")) {
-                    str10 = "<<=";
-                }
-                else if (InStr(A_LoopField31, " >>= ")) {
-                    str10 = ">>=";
-                }
-                else if (InStr(A_LoopField31, " &= ")) {
-                    str10 = "&=";
-                }
-                else if (InStr(A_LoopField31, " |= ")) {
-                    str10 = "|=";
+    return out;
+}
+bool HTLL_asmIsBlankOrComment(const std::string& line, int isArm) {
+    std::string t = Trim(line);
+    if (t == "") {
+        return true;
+    }
+    return isArm == 1 ? t.rfind("//", 0) == 0 : t[0] == ';';
+}
+// What a line of assembly defines:
+// 0 nothing (an instruction, a local .label, data without a name, a comment),
+// 1 a label that opens a block of the following lines (a routine, a data table),
+// 2 a one-line definition (name db 0, name = 8, name: .quad 0, .lcomm name, 8, .equ name, 4),
+// 3 a header or section directive, which closes the current block.
+int HTLL_asmLineKind(const std::string& line, int isArm, std::string& name) {
+    static const std::unordered_set<std::string> x86Data = {"db", "dw", "dd", "dq", "dt", "du", "rb", "rw", "rd", "rq", "rt", "file", "equ"};
+    static const std::unordered_set<std::string> x86Directives = {"format", "entry", "public", "extrn", "segment", "section", "use16", "use32", "use64", "org", "align", "include"};
+    static const std::unordered_set<std::string> armData = {".quad", ".word", ".byte", ".hword", ".short", ".long", ".int", ".string", ".asciz", ".ascii", ".zero", ".space", ".skip", ".fill", ".8byte", ".4byte", ".2byte", ".double", ".float"};
+    static const std::unordered_set<std::string> armDirectives = {".data", ".bss", ".text", ".section", ".global", ".globl", ".extern", ".align", ".balign", ".p2align"};
+    std::string t = Trim(line);
+    name = "";
+    if (HTLL_asmIsBlankOrComment(t, isArm)) {
+        return 0;
+    }
+    size_t identEnd = 0;
+    while (identEnd < t.size() && (std::isalnum((unsigned char)t[identEnd]) || t[identEnd] == '_' || t[identEnd] == '.' || t[identEnd] == '?' || t[identEnd] == '@')) {
+        identEnd++;
+    }
+    std::string ident = t.substr(0, identEnd);
+    std::string rest = Trim(t.substr(identEnd));
+    std::string restWord = rest.substr(0, rest.find_first_of(" \t,"));
+    if (isArm == 1 && (ident == ".equ" || ident == ".set" || ident == ".lcomm" || ident == ".comm")) {
+        name = Trim(rest.substr(0, rest.find(',')));
+        return 2;
+    }
+    if ((isArm == 1 && armDirectives.count(ident)) || (isArm == 0 && x86Directives.count(ident))) {
+        return 3;
+    }
+    if (ident == "" || std::isdigit((unsigned char)ident[0])) {
+        return 0;
+    }
+    if (identEnd < t.size() && t[identEnd] == ':') {
+        if (ident[0] == '.') {
+            return 0;
+        }
+        name = ident;
+        std::string after = Trim(t.substr(identEnd + 1));
+        std::string afterWord = after.substr(0, after.find_first_of(" \t,"));
+        if ((isArm == 1 && armData.count(afterWord)) || (isArm == 0 && x86Data.count(afterWord))) {
+            return 2;
+        }
+        return 1;
+    }
+    if (ident[0] != '.' && rest.size() > 0 && rest[0] == '=' && rest.rfind("==", 0) != 0) {
+        name = ident;
+        return 2;
+    }
+    if (isArm == 0 && identEnd < t.size() && (t[identEnd] == ' ' || t[identEnd] == '\t') && x86Data.count(restWord)) {
+        name = ident;
+        return 2;
+    }
+    return 0;
+}
+// True when control never continues past this instruction into the next line.
+bool HTLL_asmEndsFlow(const std::string& line, int isArm) {
+    std::string t = Trim(line);
+    std::string word = StrLower(t.substr(0, t.find_first_of(" \t")));
+    if (isArm == 1) {
+        return word == "ret" || word == "b" || word == "br" || word == "eret";
+    }
+    return word == "ret" || word == "retn" || word == "retf" || word == "iret" || word == "iretq" || word == "jmp" || word == "ud2";
+}
+#if __has_include("HTLL_Libs_embedded.h")
+    #include "HTLL_Libs_embedded.h"
+    #define HTLL_EMBEDDED_LIBS 1
+#else
+    #define HTLL_EMBEDDED_LIBS 0
+    #pragma message("WARNING: HTLL_Libs_embedded.h not found. Run ./embed_libs.sh. Falling back to reading HTLL_Libs_*.txt from the current directory.")
+#endif
+#include <cstring>
+// The runtime libraries (HTLL_Libs_*.txt) split into their $$$$name$$$$ ... %%%%name%%%% routines.
+// A routine body keeps the non-empty lines between its markers, each ending in a newline.
+#if HTLL_EMBEDDED_LIBS
+// Compiled in by embed_libs.sh, together with a name -> routine index sorted by name.
+const HTLL_EmbeddedLibrary* HTLL_embeddedLibraryFor(const std::string& libraryFile) {
+    for (const HTLL_EmbeddedLibrary& library : HTLL_embeddedLibraries) {
+        if (libraryFile == library.file) {
+            return &library;
+        }
+    }
+    return nullptr;
+}
+int HTLL_runtimeRoutineCount(const std::string& libraryFile) {
+    const HTLL_EmbeddedLibrary* library = HTLL_embeddedLibraryFor(libraryFile);
+    return library ? library->count : 0;
+}
+std::string_view HTLL_runtimeRoutineName(const std::string& libraryFile, int routine) {
+    return HTLL_embeddedLibraryFor(libraryFile)->routines[routine].name;
+}
+std::string_view HTLL_runtimeRoutineBody(const std::string& libraryFile, int routine) {
+    return HTLL_embeddedLibraryFor(libraryFile)->routines[routine].body;
+}
+int HTLL_runtimeRoutineFind(const std::string& libraryFile, const std::string& name) {
+    const HTLL_EmbeddedLibrary* library = HTLL_embeddedLibraryFor(libraryFile);
+    if (!library) {
+        return -1;
+    }
+    int low = 0;
+    int high = library->count - 1;
+    while (low <= high) {
+        int middle = (low + high) / 2;
+        int order = std::strcmp(library->index[middle].name, name.c_str());
+        if (order == 0) {
+            return library->index[middle].routine;
+        }
+        if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+    return -1;
+}
+#else
+// Read and split once per process, on first use.
+struct HTLL_RuntimeLibrary {
+    std::vector<std::string> names;
+    std::vector<std::string> bodies;
+    std::unordered_map<std::string, int> index;
+};
+const HTLL_RuntimeLibrary& HTLL_runtimeLibraryFor(const std::string& libraryFile) {
+    static std::unordered_map<std::string, HTLL_RuntimeLibrary> libraries;
+    static std::mutex librariesMutex;
+    std::lock_guard<std::mutex> lock(librariesMutex);
+    auto found = libraries.find(libraryFile);
+    if (found != libraries.end()) {
+        return found->second;
+    }
+    HTLL_RuntimeLibrary library;
+    if (libraryFile != "") {
+        int inRoutine = 0;
+        for (const std::string& line : LoopParseFunc(FileRead(libraryFile), "\n", "\r")) {
+            if (InStr(line, "$$$$")) {
+                std::string name = StringTrimLeft(StringTrimRight(Trim(line), 4), 4);
+                library.index.emplace(name, (int)library.names.size());
+                library.names.push_back(name);
+                library.bodies.push_back("");
+                inRoutine = 1;
+            }
+            else if (InStr(line, "%%%%")) {
+                inRoutine = 0;
+            }
+            else if (inRoutine == 1) {
+                library.bodies.back() += line + Chr(10);
+            }
+        }
+    }
+    return libraries.emplace(libraryFile, std::move(library)).first->second;
+}
+int HTLL_runtimeRoutineCount(const std::string& libraryFile) {
+    return (int)HTLL_runtimeLibraryFor(libraryFile).names.size();
+}
+std::string_view HTLL_runtimeRoutineName(const std::string& libraryFile, int routine) {
+    return HTLL_runtimeLibraryFor(libraryFile).names[routine];
+}
+std::string_view HTLL_runtimeRoutineBody(const std::string& libraryFile, int routine) {
+    return HTLL_runtimeLibraryFor(libraryFile).bodies[routine];
+}
+int HTLL_runtimeRoutineFind(const std::string& libraryFile, const std::string& name) {
+    const HTLL_RuntimeLibrary& library = HTLL_runtimeLibraryFor(libraryFile);
+    auto found = library.index.find(name);
+    return found == library.index.end() ? -1 : found->second;
+}
+#endif
+// Runtime routines each routine of a library refers to, worked out once per library.
+const std::vector<int>& HTLL_runtimeRoutineDeps(const std::string& libraryFile, int routine) {
+    static std::unordered_map<std::string, std::vector<std::vector<int>>> libraries;
+    static std::mutex librariesMutex;
+    std::lock_guard<std::mutex> lock(librariesMutex);
+    auto found = libraries.find(libraryFile);
+    if (found == libraries.end()) {
+        int isArm = libraryFile == "HTLL_Libs_AArch64.txt" ? 1 : 0;
+        int count = HTLL_runtimeRoutineCount(libraryFile);
+        std::vector<std::vector<int>> deps(count);
+        for (int r = 0; r < count; r++) {
+            std::string body(HTLL_runtimeRoutineBody(libraryFile, r));
+            for (const std::string& line : LoopParseFunc(body, "\n", "\r")) {
+                for (const std::string& ident : HTLL_asmIdentifiers(line, isArm)) {
+                    int dep = HTLL_runtimeRoutineFind(libraryFile, ident);
+                    if (dep >= 0 && dep != r && std::find(deps[r].begin(), deps[r].end(), dep) == deps[r].end()) {
+                        deps[r].push_back(dep);
+                    }
+                }
+            }
+        }
+        found = libraries.emplace(libraryFile, std::move(deps)).first;
+    }
+    return found->second[routine];
+}
+// Returns the bodies of the routines named in calls and of everything they use in turn, in library order.
+std::string HTLL_runtimeRoutines(const std::string& libraryFile, const std::vector<std::string>& calls) {
+    int count = HTLL_runtimeRoutineCount(libraryFile);
+    std::vector<char> wanted(count, 0);
+    std::vector<int> pending;
+    for (const std::string& call : calls) {
+        int routine = HTLL_runtimeRoutineFind(libraryFile, call);
+        if (routine >= 0 && !wanted[routine]) {
+            wanted[routine] = 1;
+            pending.push_back(routine);
+        }
+    }
+    while (!pending.empty()) {
+        int routine = pending.back();
+        pending.pop_back();
+        for (int dep : HTLL_runtimeRoutineDeps(libraryFile, routine)) {
+            if (!wanted[dep]) {
+                wanted[dep] = 1;
+                pending.push_back(dep);
+            }
+        }
+    }
+    std::string out = "";
+    for (int routine = 0; routine < count; routine++) {
+        if (wanted[routine]) {
+            out += HTLL_runtimeRoutineBody(libraryFile, routine);
+        }
+    }
+    return out;
+}
+// Every routine name and body of a runtime library, for fingerprinting it in cache keys.
+std::string HTLL_runtimeLibraryText(const std::string& libraryFile) {
+    std::string out = "";
+    int count = HTLL_runtimeRoutineCount(libraryFile);
+    for (int routine = 0; routine < count; routine++) {
+        out += HTLL_runtimeRoutineName(libraryFile, routine);
+        out += Chr(10);
+        out += HTLL_runtimeRoutineBody(libraryFile, routine);
+    }
+    return out;
+}
+// Dead-code elimination over the finished assembly, removing dead lines in place. The output is cut
+// into blocks: a label with the lines that follow it (a routine, a data table) or a one-line
+// definition (a variable, a constant). Only blocks reachable from _start are kept, following symbol
+// references and fallthrough from a block into the next one. Lines outside any block (headers,
+// section directives) always stay, and whatever they reference is a root as well.
+void HTLL_eliminateDeadCode(std::vector<std::string>& lines, int isArm) {
+    struct Block {
+        size_t first;
+        size_t last;
+        bool owned;
+        bool label;
+    };
+    std::vector<Block> blocks;
+    blocks.push_back({0, 0, false, false});
+    std::unordered_map<std::string, std::vector<int>> definedIn;
+    std::string name;
+    for (size_t i = 0; i < lines.size(); i++) {
+        int kind = HTLL_asmLineKind(lines[i], isArm, name);
+        if (kind == 1) {
+            // comments and blank lines right above a label belong to it
+            size_t start = i;
+            while (start > blocks.back().first + 1 && HTLL_asmIsBlankOrComment(lines[start - 1], isArm)) {
+                start--;
+            }
+            blocks.back().last = start;
+            blocks.push_back({start, 0, true, true});
+            definedIn[name].push_back((int)blocks.size() - 1);
+        }
+        else if (kind == 2) {
+            blocks.back().last = i;
+            blocks.push_back({i, i + 1, true, false});
+            definedIn[name].push_back((int)blocks.size() - 1);
+            blocks.push_back({i + 1, 0, false, false});
+        }
+        else if (kind == 3) {
+            blocks.back().last = i;
+            blocks.push_back({i, 0, false, false});
+        }
+        else if (isArm == 1 && blocks.back().owned) {
+            // GNU as has no local labels: .name: is global and may be branched to from anywhere
+            std::string t = Trim(lines[i]);
+            if (t.size() > 2 && t[0] == '.' && t.back() == ':' && t.find_first_of(" \t") == std::string::npos) {
+                definedIn[t.substr(0, t.size() - 1)].push_back((int)blocks.size() - 1);
+            }
+        }
+    }
+    blocks.back().last = lines.size();
+    if (definedIn.find("_start") == definedIn.end()) {
+        return;
+    }
+    std::vector<char> kept(blocks.size(), 0);
+    std::vector<int> pending;
+    auto reach = [&](int block) {
+        if (!kept[block]) {
+            kept[block] = 1;
+            pending.push_back(block);
+        }
+    };
+    for (size_t b = 0; b < blocks.size(); b++) {
+        if (!blocks[b].owned) {
+            reach((int)b);
+        }
+    }
+    for (int block : definedIn["_start"]) {
+        reach(block);
+    }
+    while (!pending.empty()) {
+        int b = pending.back();
+        pending.pop_back();
+        for (size_t i = blocks[b].first; i < blocks[b].last; i++) {
+            for (const std::string& ident : HTLL_asmIdentifiers(lines[i], isArm)) {
+                if (isArm == 0 && ident[0] == '.') {
+                    continue;
                 }
-                else if (InStr(A_LoopField31, " ^= ")) {
-                    str10 = "^=";
+                auto found = definedIn.find(ident);
+                if (found != definedIn.end()) {
+                    for (int target : found->second) {
+                        reach(target);
+                    }
                 }
-                doWeEverSeeExprestion = 1;
-                //;;;; code here
-                //;;;; code here
-                // x := x + 5 * 7 // var1
-                // ___HTLL_expression_helper___
-                str2 = Trim(StrSplit(str1, str10, 1));
-                str3 = Trim(StrSplit(str1, str10, 2));
-                std::vector<std::string> items32 = LoopParseFunc(str3, " ");
-                for (size_t A_Index32 = 0; A_Index32 < items32.size(); A_Index32++) {
-                    std::string A_LoopField32 = items32[A_Index32 - 0];
-                    if (Trim(A_LoopField32) != "") {
-                        if (A_Index32 == 0) {
-                            out += "___HTLL_expression_helper___ := " + Trim(A_LoopField32) + Chr(10);
-                        } else {
-                            if (InStr(A_LoopField32, "+") || InStr(A_LoopField32, "-") || InStr(A_LoopField32, "*") || InStr(A_LoopField32, "//") || InStr(A_LoopField32, "%") || InStr(A_LoopField32, "<<") || InStr(A_LoopField32, ">>") || InStr(A_LoopField32, "&") || InStr(A_LoopField32, "|") || InStr(A_LoopField32, "^")) {
-                                out += "___HTLL_expression_helper___ " + Trim(A_LoopField32) + "= ";
-                            } else {
-                                out += Trim(A_LoopField32) + Chr(10);
-                            }
+                size_t dot = ident.find('.', 1);
+                if (dot != std::string::npos) {
+                    found = definedIn.find(ident.substr(0, dot));
+                    if (found != definedIn.end()) {
+                        for (int target : found->second) {
+                            reach(target);
                         }
                     }
                 }
-                out += str2 + " " + str10 + " ___HTLL_expression_helper___" + Chr(10);
-                //;;;; code here
-                //;;;; code here
-            } else {
-                out += A_LoopField31 + Chr(10);
             }
         }
-        else if (SubStr(StrLower(Trim(A_LoopField31)), 1, 7) == "return ") {
-            //;;;;;;;;;;;;; return
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField31), 7));
-            if (InStr(A_LoopField31, " + ") || InStr(A_LoopField31, " - ") || InStr(A_LoopField31, " * ") || InStr(A_LoopField31, " // ") || InStr(A_LoopField31, " % ") || InStr(A_LoopField31, " << ") || InStr(A_LoopField31, " >> ") || InStr(A_LoopField31, " & ") || InStr(A_LoopField31, " | ") || InStr(A_LoopField31, " ^ ")) {
-                //;;;;;;;;;;;;; return return
-                //;;;;;;;;;;;;; return return
-                doWeEverSeeExprestion = 1;
-                str3 = str1;
-                std::vector<std::string> items33 = LoopParseFunc(str3, " ");
-                for (size_t A_Index33 = 0; A_Index33 < items33.size(); A_Index33++) {
-                    std::string A_LoopField33 = items33[A_Index33 - 0];
-                    if (Trim(A_LoopField33) != "") {
-                        if (A_Index33 == 0) {
-                            out += "___HTLL_expression_helper___ := " + Trim(A_LoopField33) + Chr(10);
-                        } else {
-                            if (InStr(A_LoopField33, "+") || InStr(A_LoopField33, "-") || InStr(A_LoopField33, "*") || InStr(A_LoopField33, "//") || InStr(A_LoopField33, "%") || InStr(A_LoopField33, "<<") || InStr(A_LoopField33, ">>") || InStr(A_LoopField33, "&") || InStr(A_LoopField33, "|") || InStr(A_LoopField33, "^")) {
-                                out += "___HTLL_expression_helper___ " + Trim(A_LoopField33) + "= ";
-                            } else {
-                                out += Trim(A_LoopField33) + Chr(10);
-                            }
-                        }
-                    }
+        if (blocks[b].label) {
+            bool fallsThrough = true;
+            for (size_t i = blocks[b].last; i > blocks[b].first; i--) {
+                std::string t = Trim(lines[i - 1]);
+                if (HTLL_asmIsBlankOrComment(t, isArm) || (t.back() == ':' && t.find_first_of(" \t") == std::string::npos)) {
+                    continue;
                 }
-                out += "return ___HTLL_expression_helper___" + Chr(10);
-                //;;;;;;;;;;;;; return return
-                //;;;;;;;;;;;;; return return
-            } else {
-                out += A_LoopField31 + Chr(10);
+                if (HTLL_asmLineKind(t, isArm, name) == 1) {
+                    t = Trim(t.substr(t.find(':') + 1));
+                }
+                fallsThrough = !HTLL_asmEndsFlow(t, isArm);
+                break;
             }
-            //;;;;;;;;;;;;; return
+            size_t next = b + 1;
+            while (next < blocks.size() && blocks[next].first == blocks[next].last) {
+                next++;
+            }
+            if (fallsThrough && next < blocks.size()) {
+                reach((int)next);
+            }
+        }
+    }
+    size_t keptLines = 0;
+    for (size_t b = 0; b < blocks.size(); b++) {
+        if (!kept[b]) {
+            continue;
+        }
+        for (size_t i = blocks[b].first; i < blocks[b].last; i++) {
+            if (keptLines != i) {
+                lines[keptLines] = std::move(lines[i]);
+            }
+            keptLines++;
+        }
+    }
+    lines.resize(keptLines);
+}
+// Register allocation for int variables, over the finished x86-64 and AArch64 output. Every
+// int is a memory slot ("name dq N" / "name: .quad N"), and each statement loads and stores
+// it: through "[name]" on x86-64, and on AArch64 through an address register set with
+// "ldr xA, =name". This pass runs over the lines of _start and of each HTLL function, and
+// moves the scalars worth it into registers the region never mentions.
+// - A variable's live interval starts at its first use and ends at its last. It is
+//   widened over any loop it is used in, then closed under jumps, so every way into the
+//   interval goes through the load at its start.
+// - Intervals are packed into the free registers by linear scan, the cheapest ones being
+//   spilled.
+// - Around every call and inline code block the register is stored and reloaded. Callees
+//   and runtime routines therefore still see and update the memory slot, and no register
+//   has to be preserved across a call.
+// - The slot is also written back before ret and before jumps that leave the region.
+// Variables whose address is taken, or that are accessed with another size or by an
+// instruction that cannot take a register, stay in memory. On AArch64 the remaining
+// literal-pool address loads of data labels in HTLL code become adrp/add pairs.
+// --no-regalloc turns it off.
+int HTLL_registerAllocation = 1;
+// One instruction or label of a region, with its comment removed.
+struct HTLL_AsmOp {
+    size_t line;
+    std::string op;
+    std::vector<std::string> args;
+    std::string label;
+    bool inlineCode;
+};
+std::vector<std::string> HTLL_asmSplitArgs(const std::string& text) {
+    std::vector<std::string> args;
+    std::string current = "";
+    int depth = 0;
+    char quote = 0;
+    for (char c : text) {
+        if (quote != 0) {
+            current += c;
+            if (c == quote) {
+                quote = 0;
+            }
+        }
+        else if (c == '\'' || c == '"') {
+            quote = c;
+            current += c;
+        }
+        else if (c == '[') {
+            depth++;
+            current += c;
+        }
+        else if (c == ']') {
+            depth--;
+            current += c;
+        }
+        else if (c == ',' && depth == 0) {
+            args.push_back(Trim(current));
+            current = "";
         } else {
-            out += A_LoopField31 + Chr(10);
+            current += c;
         }
     }
-    code = StringTrimRight(out, 1);
-    if (doWeEverSeeExprestion == 1) {
-        code = "int ___HTLL_expression_helper___ := 0" + Chr(10) + code;
+    if (Trim(current) != "") {
+        args.push_back(Trim(current));
     }
-    out = "";
-    std::vector<std::string> items34 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index34 = 0; A_Index34 < items34.size(); A_Index34++) {
-        std::string A_LoopField34 = items34[A_Index34 - 0];
-        if (SubStr(StrLower(Trim(A_LoopField34)), 1, 6) == "loop, ") {
-            str1 = Trim(A_LoopField34);
-            str2 = Trim(StrSplit(str1, ",", 2));
-            if (InStr(str2, ".size")) {
-                out += Trim(str2) + Chr(10) + "Loop, rax" + Chr(10);
-            } else {
-                out += A_LoopField34 + Chr(10);
+    return args;
+}
+std::string HTLL_asmStripComment(const std::string& line, int isArm) {
+    char quote = 0;
+    for (size_t i = 0; i < line.size(); i++) {
+        if (quote != 0) {
+            if (line[i] == quote) {
+                quote = 0;
             }
         }
-        else if (StrLower(Trim(A_LoopField34)) == "loop") {
-            out += "Loop, -1" + Chr(10);
-        } else {
-            out += A_LoopField34 + Chr(10);
+        else if (line[i] == '"' || (line[i] == '\'' && (isArm == 0 || i + 2 >= line.size() || line[i + 2] != '\''))) {
+            quote = line[i];
+        }
+        else if (line[i] == '\'') {
+            i += 2;
+        }
+        else if ((isArm == 0 && line[i] == ';') || (isArm == 1 && line.compare(i, 2, "//") == 0)) {
+            return Trim(line.substr(0, i));
         }
     }
-    code = StringTrimRight(out, 1);
-    out = "";
-    if (InStr(code, "{")) {
-        code = transformBracesToHTLL(code);
+    return Trim(line);
+}
+// The 64-bit register an x86-64 or AArch64 register name belongs to, or "" when it is not
+// one the allocator hands out (or, on AArch64, x16, which it uses as scratch).
+std::string HTLL_asmAllocatableFamily(const std::string& name, int isArm) {
+    static const std::unordered_map<std::string, std::string> families = [] {
+        std::unordered_map<std::string, std::string> map;
+        for (const char* r : {"r8", "r9", "r10", "r14", "r15"}) {
+            for (const char* suffix : {"", "d", "w", "b", "l"}) {
+                map[std::string(r) + suffix] = r;
+            }
+        }
+        for (const char* r : {"rbx", "ebx", "bx", "bl", "bh"}) {
+            map[r] = "rbx";
+        }
+        return map;
+    }();
+    std::string lower = StrLower(name);
+    if (isArm == 1) {
+        if (lower.size() == 3 && (lower[0] == 'x' || lower[0] == 'w') && (lower.compare(1, 2, "16") == 0 || (lower[1] == '2' && lower[2] >= '1' && lower[2] <= '8'))) {
+            return "x" + lower.substr(1);
+        }
+        return "";
     }
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    int dose_func_exist = 0;
-    std::vector<std::string> items35 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index35 = 0; A_Index35 < items35.size(); A_Index35++) {
-        std::string A_LoopField35 = items35[A_Index35 - 0];
-        if (SubStr(StrLower(Trim(A_LoopField35)), 1, 5) == "func ") {
-            dose_func_exist = 1;
-            break;
+    auto found = families.find(lower);
+    return found == families.end() ? "" : found->second;
+}
+// If arg is exactly "[name]" or "qword [name]", returns name.
+std::string HTLL_asmSlotOperand(const std::string& arg) {
+    std::string a = arg;
+    if (StrLower(a.substr(0, 5)) == "qword") {
+        a = Trim(a.substr(5));
+    }
+    if (a.size() < 3 || a[0] != '[' || a.back() != ']') {
+        return "";
+    }
+    std::string name = Trim(a.substr(1, a.size() - 2));
+    for (char c : name) {
+        if (!std::isalnum((unsigned char)c) && c != '_' && c != '.' && c != '?' && c != '@') {
+            return "";
         }
     }
-    int is_in_func = 0;
-    int is_in_main = 0;
-    std::vector<std::string> arrays_from_global_scope;
-    std::vector<std::string> func_arrs_params;
-    std::vector<std::string> func_arrs_params_ORIGINAL_NAME;
-    std::vector<std::string> func_vars_and_arrs;
-    std::vector<std::string> main_vars_and_arrs;
-    std::vector<std::string> funcs_and_what_types;
-    std::string ALoopField = "";
-    int AIndex = 0;
-    int AAIndex = 0;
-    int it_macth_arr_name = 0;
-    out = "";
-    std::vector<std::string> items36 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index36 = 0; A_Index36 < items36.size(); A_Index36++) {
-        std::string A_LoopField36 = items36[A_Index36 - 0];
-        if (SubStr(StrLower(Trim(A_LoopField36)), 1, 5) == "func ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField36), 5));
-            is_in_func = 1;
-            str2 = "";
-            str3 = "";
-            str4 = "";
-            str5 = "";
-            str6 = "";
-            str7 = "";
-            str8 = "";
-            str9 = "";
-            func_arrs_params = {};
-            str2 = Trim(StrSplit(str1, "(", 1));
-            str4 = Trim(StrSplit(str1, "(", 2));
-            str4 = StringTrimRight(str4, 1);
-            if (InStr(str2, " ")) {
-                // is an array func return
-                // get name of func
-                str3 = Trim(StrSplit(str2, " ", 2));
-                str8 = "";
-                str6 += "arr __HTLL_ret_" + str3 + Chr(10);
-                str5 = "";
-                if (InStr(str1, "()") == false) {
-                    std::vector<std::string> items37 = LoopParseFunc(str4, ",");
-                    for (size_t A_Index37 = 0; A_Index37 < items37.size(); A_Index37++) {
-                        std::string A_LoopField37 = items37[A_Index37 - 0];
-                        if (InStr(Trim(A_LoopField37), " ")) {
-                            // its an array param
-                            HTVM_Append(func_arrs_params, "__HTLL_param_" + str3 + "_" + Trim(StrSplit(Trim(A_LoopField37), " ", 2)));
-                            str8 += Trim(StrSplit(Trim(A_LoopField37), " ", 2)) + ",";
-                            HTVM_Append(func_arrs_params_ORIGINAL_NAME, Trim(StrSplit(Trim(A_LoopField37), " ", 2)));
-                        } else {
-                            str8 += "__000_NOT-ARRAY_000__,";
-                            str5 += Trim(A_LoopField37) + ", ";
-                        }
+    return name;
+}
+// The label a jump goes to, "" for an instruction that is not a jump, and "*" for an indirect
+// jump.
+std::string HTLL_asmJumpTarget(const std::string& op, const std::vector<std::string>& args, int isArm) {
+    if (isArm == 1) {
+        if (op == "br") {
+            return "*";
+        }
+        if ((op == "b" || op.rfind("b.", 0) == 0) && args.size() == 1) {
+            return args[0];
+        }
+        if ((op == "cbz" || op == "cbnz") && args.size() == 2) {
+            return args[1];
+        }
+        if ((op == "tbz" || op == "tbnz") && args.size() == 3) {
+            return args[2];
+        }
+        return "";
+    }
+    if (op == "loop" || op == "loope" || op == "loopne" || op == "jrcxz" || op == "jecxz") {
+        return "*";
+    }
+    static const std::unordered_set<std::string> registers = {"rax", "rbx", "rcx", "rdx", "rsi", "rdi", "rbp", "rsp", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "eax", "ebx", "ecx", "edx", "esi", "edi", "ebp", "esp"};
+    if (op.size() >= 2 && op[0] == 'j') {
+        if (args.size() != 1 || args[0].find('[') != std::string::npos || args[0] == "$" || registers.count(StrLower(args[0]))) {
+            return "*";
+        }
+        return args[0];
+    }
+    return "";
+}
+// Which lines lie in an inline code block.
+std::vector<bool> HTLL_asmInlineLines(size_t count, const std::vector<std::pair<size_t, size_t>>& inlineBlocks) {
+    std::vector<bool> isInline(count, false);
+    for (const std::pair<size_t, size_t>& block : inlineBlocks) {
+        for (size_t i = block.first; i < block.second && i < count; i++) {
+            isInline[i] = true;
+        }
+    }
+    return isInline;
+}
+// Which lines are in the code segment (x86 "segment ... executable", AArch64 .text).
+std::vector<bool> HTLL_asmCodeLines(const std::vector<std::string>& lines, int isArm) {
+    std::vector<bool> inText(lines.size(), false);
+    bool code = false;
+    for (size_t i = 0; i < lines.size(); i++) {
+        std::string t = Trim(lines[i]);
+        std::string word = StrLower(t.substr(0, t.find_first_of(" \t")));
+        if (isArm == 0 && word == "segment") {
+            code = t.find("executable") != std::string::npos;
+        }
+        else if (isArm == 1 && (word == ".text" || word == ".data" || word == ".bss" || word == ".section")) {
+            code = word == ".text" || (word == ".section" && t.find("text") != std::string::npos);
+        }
+        inText[i] = code;
+    }
+    return inText;
+}
+// The code of _start and of each HTLL function as [first, last) line ranges, first being
+// the line of its label. Runtime library routines are left out.
+std::vector<std::pair<size_t, size_t>> HTLL_asmUserRegions(const std::vector<std::string>& lines, const std::vector<bool>& inText, const std::vector<bool>& isInline, int isArm) {
+    std::vector<size_t> starts;
+    for (size_t i = 0; i < lines.size(); i++) {
+        std::string name;
+        if (inText[i] && !isInline[i] && HTLL_asmLineKind(lines[i], isArm, name) == 1) {
+            starts.push_back(i);
+        }
+    }
+    std::string runtimeLibrary = isArm == 1 ? "HTLL_Libs_AArch64.txt" : ring0 == 1 ? "HTLL_Libs_ring0.txt" : "HTLL_Libs_x86.txt";
+    std::vector<std::pair<size_t, size_t>> regions;
+    for (size_t r = 0; r < starts.size(); r++) {
+        size_t first = starts[r];
+        size_t last = first + 1;
+        while (last < lines.size() && inText[last] && (r + 1 == starts.size() || last < starts[r + 1])) {
+            last++;
+        }
+        std::string name;
+        HTLL_asmLineKind(lines[first], isArm, name);
+        if (name == "_start" || HTLL_runtimeRoutineFind(runtimeLibrary, name) < 0) {
+            regions.push_back({first, last});
+        }
+    }
+    return regions;
+}
+// Loop counters by nesting depth. A loop keeps its remaining count in a register of its
+// depth and A_Index in r13 (x20 on AArch64); a nested loop parks the outer A_Index in the
+// second register of its depth instead of pushing it. That gives x86-64 two depths in
+// r12-r15 and AArch64 five in x19-x28. Deeper loops spill: they push the depth 1 pair and
+// reuse it. A function saves the pairs its loops use once, in its prologue, and the
+// register allocator leaves the pairs of every depth the program uses alone, since they
+// stay live across calls.
+thread_local int HTLL_loopDepth = 0;
+int HTLL_loopRegisterDepths(int isArm) {
+    return isArm == 1 ? 5 : 2;
+}
+std::string HTLL_loopCountRegister(int depth, int isArm) {
+    if (isArm == 1) {
+        return depth == 1 ? "x19" : "x" + STR(21 + 2 * (depth - 2));
+    }
+    return depth == 1 ? "r12" : "r14";
+}
+// The register an outer A_Index is parked in; at depth 1 that is A_Index itself.
+std::string HTLL_loopSavedRegister(int depth, int isArm) {
+    if (isArm == 1) {
+        return depth == 1 ? "x20" : "x" + STR(22 + 2 * (depth - 2));
+    }
+    return depth == 1 ? "r13" : "r15";
+}
+// The register pairs of loop depths 1..depth that live in registers.
+std::vector<std::string> HTLL_loopRegisters(int depth, int isArm) {
+    std::vector<std::string> regs;
+    for (int d = 1; d <= depth && d <= HTLL_loopRegisterDepths(isArm); d++) {
+        regs.push_back(HTLL_loopCountRegister(d, isArm));
+        regs.push_back(HTLL_loopSavedRegister(d, isArm));
+    }
+    return regs;
+}
+// Inserting and removing lines moves the inline code blocks, so inlineBlocks is updated.
+void HTLL_allocateRegisters(std::vector<std::string>& lines, std::vector<std::pair<size_t, size_t>>& inlineBlocks, int isArm) {
+    static const std::unordered_set<std::string> slotOps = {"mov", "add", "sub", "and", "or", "xor", "cmp", "test", "inc", "dec", "neg", "not", "imul", "mul", "div", "idiv", "shl", "shr", "sar", "sal", "adc", "sbb", "push", "pop", "xchg", "cmove", "cmovne", "cmovz", "cmovnz", "cmovl", "cmovle", "cmovg", "cmovge", "cmova", "cmovae", "cmovb", "cmovbe"};
+    static const std::unordered_set<std::string> readOnlyOps = {"cmp", "test", "push", "mul", "imul", "div", "idiv"};
+    // AArch64 instructions whose first operand is not a destination register
+    static const std::unordered_set<std::string> armNoDest = {"str", "strb", "strh", "stp", "stur", "cmp", "cmn", "tst", "b", "bl", "br", "blr", "ret", "cbz", "cbnz", "tbz", "tbnz", "svc"};
+    static const std::vector<std::string> x86Pool = {"r14", "r15", "rbx", "r8", "r9", "r10"};
+    // All of x19-x28. x19/x20 hold the depth 1 loop count and A_Index, so like the deeper
+    // loop pairs they drop out below whenever the program has a loop.
+    static const std::vector<std::string> armPool = {"x19", "x20", "x21", "x22", "x23", "x24", "x25", "x26", "x27", "x28"};
+    std::vector<std::string> loopRegs = HTLL_loopRegisters(HTLL_loopDepth, isArm);
+    std::vector<std::string> pool;
+    for (const std::string& reg : isArm == 1 ? armPool : x86Pool) {
+        if (std::find(loopRegs.begin(), loopRegs.end(), reg) == loopRegs.end()) {
+            pool.push_back(reg);
+        }
+    }
+    std::vector<bool> isInline = HTLL_asmInlineLines(lines.size(), inlineBlocks);
+    // The int slots, the other data labels, which lines are code, and the registers inline
+    // code uses: those can hold a value across a call, so they are never handed out.
+    std::vector<std::string> text(lines.size());
+    std::vector<bool> inText = HTLL_asmCodeLines(lines, isArm);
+    std::unordered_set<std::string> slots;
+    std::unordered_set<std::string> dataLabels;
+    std::unordered_set<std::string> inlineRegs;
+    for (size_t i = 0; i < lines.size(); i++) {
+        std::string t = HTLL_asmStripComment(lines[i], isArm);
+        text[i] = t;
+        if (isInline[i]) {
+            for (const std::string& ident : HTLL_asmIdentifiers(t, isArm)) {
+                if (HTLL_asmAllocatableFamily(ident, isArm) != "") {
+                    inlineRegs.insert(HTLL_asmAllocatableFamily(ident, isArm));
+                }
+            }
+        }
+        if (inText[i]) {
+            continue;
+        }
+        std::vector<std::string> parts;
+        for (const std::string& w : LoopParseFunc(StrReplace(t, Chr(9), " "), " ")) {
+            if (w != "") {
+                parts.push_back(w);
+            }
+        }
+        if (isArm == 0 && parts.size() == 3 && parts[1] == "dq" && RegExMatch(parts[2], "^-?\\d+$")) {
+            slots.insert(parts[0]);
+        }
+        if (isArm == 1 && parts.size() >= 2 && parts[0].back() == ':') {
+            std::string name = parts[0].substr(0, parts[0].size() - 1);
+            dataLabels.insert(name);
+            if (parts.size() == 3 && parts[1] == ".quad" && RegExMatch(parts[2], "^-?\\d+$")) {
+                slots.insert(name);
+            }
+        }
+        if (isArm == 1 && parts.size() >= 2 && (parts[0] == ".lcomm" || parts[0] == ".comm")) {
+            dataLabels.insert(Trim(StrReplace(parts[1], ",", "")));
+        }
+    }
+    if (slots.empty()) {
+        return;
+    }
+    // Which slot each instruction reads or writes. A slot stays in memory when any line uses
+    // it in another way. On AArch64 an access is "ldr xD, [xA]" or "str xS, [xA]" after
+    // "ldr xA, =slot" in the same block of straight-line code, and xA must be dead at the
+    // end of the block, so the address load can go once the slot lives in a register.
+    std::vector<std::string> lineSlot(lines.size());
+    std::vector<bool> lineWrites(lines.size(), false);
+    std::vector<long long> addressLine(lines.size(), -1);
+    std::unordered_set<std::string> pinned;
+    struct Chain {
+        std::string slot;
+        size_t def;
+    };
+    std::unordered_map<std::string, Chain> chains;
+    auto endChains = [&]() {
+        for (const auto& chain : chains) {
+            int reg = std::stoi(chain.first.substr(1));
+            if (reg < 9 || reg > 15) {
+                pinned.insert(chain.second.slot);
+            }
+        }
+        chains.clear();
+    };
+    for (size_t i = 0; i < lines.size(); i++) {
+        const std::string& t = text[i];
+        if (t == "") {
+            continue;
+        }
+        size_t space = t.find_first_of(" \t");
+        std::string op = StrLower(t.substr(0, space));
+        std::vector<std::string> args = HTLL_asmSplitArgs(space == std::string::npos ? "" : t.substr(space));
+        std::vector<std::string> idents = HTLL_asmIdentifiers(t, isArm);
+        if (isArm == 0) {
+            std::unordered_set<std::string> exact;
+            if (inText[i] && slotOps.count(op) && args.size() <= 2) {
+                for (size_t a = 0; a < args.size(); a++) {
+                    std::string name = HTLL_asmSlotOperand(args[a]);
+                    if (name != "" && slots.count(name)) {
+                        exact.insert(name);
+                        lineSlot[i] = name;
+                        lineWrites[i] = (a == 0 && !readOnlyOps.count(op)) || op == "xchg" || (op == "imul" && a == 0 && args.size() > 1);
                     }
-                    str8 = StringTrimRight(str8, 1);
-                    HTVM_Append(funcs_and_what_types, "yes|" + str3 + "|" + Trim(str8));
-                    str5 = Trim(str5);
-                    str5 = StringTrimRight(str5, 1);
+                }
+            }
+            std::unordered_map<std::string, int> seen;
+            for (const std::string& ident : idents) {
+                if (slots.count(ident)) {
+                    seen[ident]++;
+                }
+            }
+            for (const auto& s : seen) {
+                bool definition = !inText[i] && t.compare(0, s.first.size() + 1, s.first + " ") == 0;
+                if (!definition && (s.second > 1 || !exact.count(s.first))) {
+                    pinned.insert(s.first);
+                }
+            }
+            continue;
+        }
+        if (!inText[i]) {
+            endChains();
+            for (const std::string& ident : idents) {
+                if (slots.count(ident) && t.compare(0, ident.size() + 1, ident + ":") != 0) {
+                    pinned.insert(ident);
+                }
+            }
+            continue;
+        }
+        bool label = t.back() == ':' && space == std::string::npos;
+        if (label || (i > 0 && isInline[i] != isInline[i - 1])) {
+            endChains();
+        }
+        if (label) {
+            continue;
+        }
+        std::vector<std::string> regs;
+        for (const std::string& ident : idents) {
+            std::string lower = StrLower(ident);
+            if (lower.size() >= 2 && (lower[0] == 'x' || lower[0] == 'w') && std::isdigit((unsigned char)lower[1])) {
+                regs.push_back("x" + lower.substr(1));
+            }
+            else if (slots.count(ident) && !(op == "ldr" && args.size() == 2 && args[1] == "=" + ident)) {
+                pinned.insert(ident);
+            }
+        }
+        for (const std::string& reg : regs) {
+            auto chain = chains.find(reg);
+            if (chain == chains.end()) {
+                continue;
+            }
+            std::string dest = args.size() > 0 ? StrLower(args[0]) : "";
+            bool wide = (dest.size() >= 2 && dest[0] == 'x' && std::isdigit((unsigned char)dest[1])) || (op == "str" && dest == "xzr");
+            bool access = (op == "ldr" || op == "str") && args.size() == 2 && StrLower(args[1]) == "[" + reg + "]" && wide && (op == "ldr" || dest != reg);
+            if (access) {
+                lineSlot[i] = chain->second.slot;
+                lineWrites[i] = op == "str";
+                addressLine[i] = (long long)chain->second.def;
+                if (op == "ldr" && dest == reg) {
+                    chains.erase(chain);
+                }
+                continue;
+            }
+            size_t mentions = 0;
+            for (const std::string& other : regs) {
+                mentions += other == reg ? 1 : 0;
+            }
+            if (!armNoDest.count(op) && dest == reg && mentions == 1) {
+                chains.erase(chain);
+                continue;
+            }
+            pinned.insert(chain->second.slot);
+            chains.erase(chain);
+        }
+        if (op == "ldr" && args.size() == 2 && args[1].size() > 1 && args[1][0] == '=' && slots.count(args[1].substr(1)) && StrLower(args[0])[0] == 'x') {
+            chains[StrLower(args[0])] = Chain{args[1].substr(1), i};
+        }
+        if (op == "b" || op == "bl" || op == "br" || op == "blr" || op == "ret" || op == "svc" || op.rfind("b.", 0) == 0 || op == "cbz" || op == "cbnz" || op == "tbz" || op == "tbnz") {
+            endChains();
+        }
+    }
+    endChains();
+    // AArch64 local labels are plain symbols, so note every line that names one
+    std::unordered_map<std::string, std::vector<size_t>> labelMentions;
+    if (isArm == 1) {
+        for (size_t i = 0; i < lines.size(); i++) {
+            if (!inText[i] || text[i] == "" || text[i].back() == ':') {
+                continue;
+            }
+            for (const std::string& ident : HTLL_asmIdentifiers(text[i], isArm)) {
+                if (ident[0] == '.') {
+                    labelMentions[ident].push_back(i);
+                }
+            }
+        }
+    }
+    std::vector<std::vector<std::string>> before(lines.size());
+    std::vector<std::vector<std::string>> after(lines.size());
+    std::vector<bool> removed(lines.size(), false);
+    std::vector<bool> userCode(lines.size(), false);
+    for (const std::pair<size_t, size_t>& region : HTLL_asmUserRegions(lines, inText, isInline, isArm)) {
+        size_t first = region.first;
+        size_t last = region.second;
+        for (size_t i = first; i < last; i++) {
+            userCode[i] = !isInline[i];
+        }
+        // parse the region; give up on anything that could enter it other than at the top
+        std::vector<HTLL_AsmOp> ops;
+        std::unordered_map<std::string, int> labelAt;
+        std::unordered_set<std::string> usedRegs = inlineRegs;
+        bool usable = true;
+        for (size_t i = first + 1; i < last && usable; i++) {
+            const std::string& t = text[i];
+            if (t == "") {
+                continue;
+            }
+            for (const std::string& ident : HTLL_asmIdentifiers(t, isArm)) {
+                std::string family = HTLL_asmAllocatableFamily(ident, isArm);
+                if (family != "") {
+                    usedRegs.insert(family);
+                }
+            }
+            HTLL_AsmOp op;
+            op.line = i;
+            op.inlineCode = isInline[i];
+            size_t space = t.find_first_of(" \t");
+            if (t.back() == ':' && space == std::string::npos) {
+                op.label = t.substr(0, t.size() - 1);
+                if (op.inlineCode || op.label[0] != '.') {
+                    usable = false;
+                }
+                labelAt[op.label] = (int)ops.size();
+                for (size_t mention : labelMentions[op.label]) {
+                    if (mention < first || mention >= last) {
+                        usable = false;
+                    }
+                }
+            } else {
+                op.op = StrLower(t.substr(0, space));
+                op.args = HTLL_asmSplitArgs(space == std::string::npos ? "" : t.substr(space));
+                if (op.op == "cpuid" || op.op == "xlatb") {
+                    usedRegs.insert("rbx");
+                }
+                if (op.inlineCode && (HTLL_asmJumpTarget(op.op, op.args, isArm) != "" || op.op == "ret")) {
+                    usable = false;
+                }
+                if (!op.inlineCode && op.args.size() > 0 && t.find(':') != std::string::npos && t.find(':') < t.find_first_of("[\"'#=")) {
+                    usable = false;
+                }
+            }
+            ops.push_back(op);
+        }
+        if (!usable || usedRegs.count("x16")) {
+            continue;
+        }
+        int n = (int)ops.size();
+        // jumps inside the region (src, dst), exits, calls and inline blocks
+        std::vector<std::pair<int, int>> jumps;
+        std::vector<int> exits;
+        std::vector<std::pair<int, int>> barriers;
+        for (int i = 0; i < n && usable; i++) {
+            const HTLL_AsmOp& op = ops[i];
+            if (op.inlineCode) {
+                int j = i;
+                while (j + 1 < n && ops[j + 1].inlineCode && ops[j + 1].line == ops[j].line + 1) {
+                    j++;
+                }
+                barriers.push_back({i, j});
+                i = j;
+                continue;
+            }
+            std::string target = HTLL_asmJumpTarget(op.op, op.args, isArm);
+            if (op.op == "call" || op.op == "bl" || op.op == "blr") {
+                barriers.push_back({i, i});
+            }
+            else if (op.op == "ret" || op.op == "retn" || op.op == "iretq") {
+                exits.push_back(i);
+            }
+            else if (target == "*") {
+                usable = false;
+            }
+            else if (target != "") {
+                auto found = labelAt.find(target);
+                if (found != labelAt.end()) {
+                    jumps.push_back({i, found->second});
+                }
+                else if (isArm == 0 && target[0] == '.') {
+                    usable = false;
                 } else {
-                    str5 = "";
-                    HTVM_Append(funcs_and_what_types, "yes|" + str3 + "|");
+                    exits.push_back(i);
+                }
+            }
+        }
+        if (!usable) {
+            continue;
+        }
+        // loop depth of each op: the number of back edges around it
+        std::vector<int> depth(n, 0);
+        for (const std::pair<int, int>& j : jumps) {
+            if (j.second < j.first) {
+                for (int i = j.second; i <= j.first; i++) {
+                    depth[i]++;
+                }
+            }
+        }
+        auto weight = [&](int i) {
+            double w = 1.0;
+            for (int d = 0; d < depth[i] && d < 8; d++) {
+                w *= 10.0;
+            }
+            return w;
+        };
+        // The uses of each slot, cut into pieces at calls and inline blocks: the register
+        // is written back and reloaded there anyway, so the pieces cost nothing extra.
+        // Each piece is widened over the loops it is used in and closed under jumps, and
+        // pieces that come to overlap are merged.
+        struct Use {
+            int op;
+            bool written;
+        };
+        std::unordered_map<std::string, std::vector<Use>> uses;
+        std::vector<std::string> usedSlots;
+        for (int i = 0; i < n; i++) {
+            const std::string& name = lineSlot[ops[i].line];
+            if (ops[i].inlineCode || name == "" || pinned.count(name)) {
+                continue;
+            }
+            std::vector<Use>& list = uses[name];
+            if (list.empty()) {
+                usedSlots.push_back(name);
+            }
+            list.push_back({i, lineWrites[ops[i].line]});
+        }
+        std::vector<int> barriersBefore(n + 1, 0);
+        for (const std::pair<int, int>& b : barriers) {
+            barriersBefore[b.first + 1]++;
+        }
+        for (int i = 0; i < n; i++) {
+            barriersBefore[i + 1] += barriersBefore[i];
+        }
+        struct Interval {
+            std::string slot;
+            int start;
+            int end;
+            double uses;
+            bool written;
+            bool load;
+            std::string reg;
+        };
+        auto close = [&](Interval& iv) {
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                for (const std::pair<int, int>& j : jumps) {
+                    int lo = std::min(j.first, j.second);
+                    int hi = std::max(j.first, j.second);
+                    bool backEdge = j.second < j.first;
+                    bool touches = (j.first >= iv.start && j.first <= iv.end) || (j.second >= iv.start && j.second <= iv.end);
+                    bool overlaps = backEdge && lo <= iv.end && hi >= iv.start;
+                    if ((touches || overlaps) && (lo < iv.start || hi > iv.end)) {
+                        iv.start = std::min(iv.start, lo);
+                        iv.end = std::max(iv.end, hi);
+                        changed = true;
+                    }
+                }
+            }
+        };
+        std::vector<Interval> order;
+        for (const std::string& slot : usedSlots) {
+            const std::vector<Use>& list = uses[slot];
+            std::vector<Interval> pieces;
+            for (size_t u = 0; u < list.size(); u++) {
+                if (u == 0 || barriersBefore[list[u].op] != barriersBefore[list[u - 1].op + 1]) {
+                    pieces.push_back(Interval{slot, list[u].op, list[u].op, 0.0, false, true, ""});
+                }
+                pieces.back().end = list[u].op;
+            }
+            bool merged = true;
+            while (merged) {
+                merged = false;
+                for (Interval& piece : pieces) {
+                    close(piece);
+                }
+                std::vector<Interval> joined;
+                for (const Interval& piece : pieces) {
+                    if (!joined.empty() && piece.start <= joined.back().end) {
+                        joined.back().end = std::max(joined.back().end, piece.end);
+                        merged = true;
+                    } else {
+                        joined.push_back(piece);
+                    }
+                }
+                pieces.swap(joined);
+            }
+            size_t u = 0;
+            for (Interval& iv : pieces) {
+                while (u < list.size() && list[u].op < iv.start) {
+                    u++;
+                }
+                // no load is needed when the piece starts by overwriting the slot
+                const HTLL_AsmOp& firstOp = ops[iv.start];
+                bool overwrites = isArm == 1 ? firstOp.op == "str" : firstOp.op == "mov" && firstOp.args.size() == 2 && HTLL_asmSlotOperand(firstOp.args[0]) == slot && firstOp.args[1].find(slot) == std::string::npos;
+                iv.load = !(u < list.size() && list[u].op == iv.start && overwrites);
+                for (; u < list.size() && list[u].op <= iv.end; u++) {
+                    iv.uses += weight(list[u].op);
+                    iv.written = iv.written || list[u].written;
+                }
+                double cost = (iv.load ? weight(iv.start) : 0.0) + (iv.written ? weight(iv.end) : 0.0);
+                for (const std::pair<int, int>& b : barriers) {
+                    if (b.first > iv.start && b.second < iv.end) {
+                        cost += (iv.written ? 2.0 : 1.0) * weight(b.first);
+                    }
+                }
+                for (int e : exits) {
+                    if (iv.written && e >= iv.start && e <= iv.end) {
+                        cost += weight(e);
+                    }
+                }
+                if (iv.uses > cost) {
+                    order.push_back(iv);
+                }
+            }
+        }
+        std::sort(order.begin(), order.end(), [](const Interval& a, const Interval& b) {
+            return a.start != b.start ? a.start < b.start : a.slot < b.slot;
+        });
+        // linear scan
+        std::vector<std::string> freeRegs;
+        for (const std::string& reg : pool) {
+            if (!usedRegs.count(reg)) {
+                freeRegs.push_back(reg);
+            }
+        }
+        std::vector<int> active;
+        for (int k = 0; k < (int)order.size(); k++) {
+            for (size_t a = 0; a < active.size();) {
+                if (order[active[a]].end < order[k].start) {
+                    freeRegs.push_back(order[active[a]].reg);
+                    active.erase(active.begin() + a);
+                } else {
+                    a++;
                 }
+            }
+            if (!freeRegs.empty()) {
+                order[k].reg = freeRegs.front();
+                freeRegs.erase(freeRegs.begin());
+                active.push_back(k);
+                continue;
+            }
+            int cheapest = -1;
+            for (size_t a = 0; a < active.size(); a++) {
+                if (cheapest == -1 || order[active[a]].uses < order[active[cheapest]].uses) {
+                    cheapest = (int)a;
+                }
+            }
+            if (cheapest != -1 && order[active[cheapest]].uses < order[k].uses) {
+                order[k].reg = order[active[cheapest]].reg;
+                order[active[cheapest]].reg = "";
+                active[cheapest] = k;
+            }
+        }
+        // rewrite the uses and add the loads and stores
+        for (const Interval& iv : order) {
+            if (iv.reg == "") {
+                continue;
+            }
+            std::vector<std::string> load;
+            std::vector<std::string> store;
+            if (isArm == 1) {
+                load = {"    adrp " + iv.reg + ", " + iv.slot, "    add " + iv.reg + ", " + iv.reg + ", #:lo12:" + iv.slot, "    ldr " + iv.reg + ", [" + iv.reg + "]"};
+                store = {"    adrp x16, " + iv.slot, "    add x16, x16, #:lo12:" + iv.slot, "    str " + iv.reg + ", [x16]"};
             } else {
-                // get name of func
-                str3 = Trim(str2);
-                str8 = "";
-                str5 = "";
-                if (InStr(str1, "()") == false) {
-                    std::vector<std::string> items38 = LoopParseFunc(str4, ",");
-                    for (size_t A_Index38 = 0; A_Index38 < items38.size(); A_Index38++) {
-                        std::string A_LoopField38 = items38[A_Index38 - 0];
-                        if (InStr(Trim(A_LoopField38), " ")) {
-                            // its an array param
-                            HTVM_Append(func_arrs_params, "__HTLL_param_" + str3 + "_" + Trim(StrSplit(Trim(A_LoopField38), " ", 2)));
-                            str8 += Trim(StrSplit(Trim(A_LoopField38), " ", 2)) + ",";
-                            HTVM_Append(func_arrs_params_ORIGINAL_NAME, Trim(StrSplit(Trim(A_LoopField38), " ", 2)));
-                        } else {
-                            str8 += "__000_NOT-ARRAY_000__,";
-                            str5 += Trim(A_LoopField38) + ", ";
-                        }
+                load = {"mov " + iv.reg + ", [" + iv.slot + "]"};
+                store = {"mov [" + iv.slot + "], " + iv.reg};
+            }
+            for (int i = iv.start; i <= iv.end; i++) {
+                HTLL_AsmOp& op = ops[i];
+                if (op.inlineCode || lineSlot[op.line] != iv.slot) {
+                    continue;
+                }
+                if (isArm == 1) {
+                    lines[op.line] = op.op == "ldr" ? "    mov " + op.args[0] + ", " + iv.reg : "    mov " + iv.reg + ", " + op.args[0];
+                    removed[addressLine[op.line]] = true;
+                    continue;
+                }
+                std::string rewritten = op.op + " ";
+                for (size_t a = 0; a < op.args.size(); a++) {
+                    rewritten += (a > 0 ? ", " : "") + (HTLL_asmSlotOperand(op.args[a]) == iv.slot ? iv.reg : op.args[a]);
+                }
+                lines[op.line] = rewritten;
+            }
+            if (iv.load) {
+                before[ops[iv.start].line].insert(before[ops[iv.start].line].end(), load.begin(), load.end());
+            }
+            if (iv.written && !HTLL_asmEndsFlow(lines[ops[iv.end].line], isArm)) {
+                after[ops[iv.end].line].insert(after[ops[iv.end].line].begin(), store.begin(), store.end());
+            }
+            for (const std::pair<int, int>& b : barriers) {
+                if (b.first > iv.start && b.second < iv.end) {
+                    if (iv.written) {
+                        before[ops[b.first].line].insert(before[ops[b.first].line].end(), store.begin(), store.end());
                     }
-                    str8 = StringTrimRight(str8, 1);
-                    HTVM_Append(funcs_and_what_types, "no|" + str3 + "|" + Trim(str8));
-                    str5 = Trim(str5);
-                    str5 = StringTrimRight(str5, 1);
-                } else {
-                    str5 = "";
-                    HTVM_Append(funcs_and_what_types, "no|" + str3 + "|");
+                    after[ops[b.second].line].insert(after[ops[b.second].line].end(), load.begin(), load.end());
                 }
             }
-            for (int A_Index39 = 0; A_Index39 < HTVM_Size(func_arrs_params); A_Index39++) {
-                str6 += "arr " + func_arrs_params[A_Index39] + Chr(10);
+            for (int e : exits) {
+                if (iv.written && e >= iv.start && e <= iv.end) {
+                    before[ops[e].line].insert(before[ops[e].line].end(), store.begin(), store.end());
+                }
             }
-            str6 += "func " + str3 + "(" + str5 + ")";
-            out += str6 + Chr(10);
-            str14 = str3;
         }
-        else if (Trim(A_LoopField36) == "funcend") {
-            is_in_func = 0;
-            str1 = "";
-            str2 = "";
-            str3 = "";
-            str4 = "";
-            str5 = "";
-            out += A_LoopField36 + Chr(10);
+    }
+    // AArch64: the address loads left in HTLL code take the label from adrp/add instead of a
+    // literal pool
+    if (isArm == 1) {
+        for (size_t i = 0; i < lines.size(); i++) {
+            const std::string& t = text[i];
+            size_t space = t.find_first_of(" \t");
+            if (!userCode[i] || removed[i] || space == std::string::npos || StrLower(t.substr(0, space)) != "ldr") {
+                continue;
+            }
+            std::vector<std::string> args = HTLL_asmSplitArgs(t.substr(space));
+            if (args.size() == 2 && args[1].size() > 1 && args[1][0] == '=' && dataLabels.count(args[1].substr(1)) && StrLower(args[0])[0] == 'x') {
+                std::string label = args[1].substr(1);
+                lines[i] = "    adrp " + args[0] + ", " + label;
+                after[i].insert(after[i].begin(), "    add " + args[0] + ", " + args[0] + ", #:lo12:" + label);
+            }
         }
-        else if (Trim(A_LoopField36) == "main") {
-            is_in_main = 1;
-            str1 = "";
-            str2 = "";
-            str3 = "";
-            str4 = "";
-            str5 = "";
-            out += A_LoopField36 + Chr(10);
+    }
+    std::vector<std::string> out;
+    out.reserve(lines.size());
+    std::vector<size_t> moved(lines.size() + 1);
+    for (size_t i = 0; i < lines.size(); i++) {
+        for (std::string& l : before[i]) {
+            out.push_back(std::move(l));
+        }
+        moved[i] = out.size();
+        if (!removed[i]) {
+            out.push_back(std::move(lines[i]));
+        }
+        for (std::string& l : after[i]) {
+            out.push_back(std::move(l));
+        }
+    }
+    moved[lines.size()] = out.size();
+    for (std::pair<size_t, size_t>& block : inlineBlocks) {
+        // the reloads after a block's last line are not part of it
+        size_t end = std::min(block.second, lines.size());
+        block = {moved[std::min(block.first, lines.size())], end > 0 ? moved[end - 1] + 1 : 0};
+    }
+    lines.swap(out);
+}
+// Peephole optimizer (-O1). It runs after register allocation over the code of _start and
+// of each HTLL function, never over runtime routines or inline code blocks. Each rule
+// looks at one instruction or a short run of instructions with no label between them.
+// Rules that drop a register write first ask a liveness analysis of the region (following
+// fall-through and jumps to its labels) whether the register is read again. Calls,
+// returns, jumps out of the region and instructions it does not model count as reading
+// every register. The rules, in the order they are tried at each instruction:
+// - jump-to-next: a jump to a label that directly follows it is dropped.
+// - self-move:    "mov r, r" is dropped.
+// - move-back:    "mov a, b" followed by "mov b, a": the second mov is dropped.
+// - store-load:   a store followed by a load of the same memory: the load becomes a mov
+//                 from the stored register, or is dropped when it loads that register.
+// - load-store:   a load followed by a store of the same register to the same memory:
+//                 the store is dropped.
+// - push-pop:     "push a; pop b" becomes "mov b, a" (nothing when a is b); an stp/ldp pair
+//                 of the same registers is dropped.
+// - pop-push:     "pop a; push a" becomes "mov a, [rsp]", and "pop a; mov b, [rsp]; push a"
+//                 becomes two loads; "ldp a, b, [sp], #16; stp a, b, [sp, #-16]!" becomes
+//                 "ldp a, b, [sp]". The loop setup leaves these between two loops.
+// - copy-forward: "mov a, x" whose only reader is the next instruction: x takes the place
+//                 of a there (a constant index goes into the address) and the mov is dropped.
+// - dead-move:    a mov, load or arithmetic instruction that only writes a register nobody
+//                 reads afterwards is dropped.
+// The hits of each rule are counted for the --time-passes report.
+int HTLL_optLevel = 0;
+static const char* const HTLL_peepholeRules[] = {"jump-to-next", "self-move", "move-back", "store-load", "load-store", "push-pop", "pop-push", "copy-forward", "dead-move"};
+enum HTLL_PeepholeRule {
+    HTLL_PEEP_JUMP_TO_NEXT,
+    HTLL_PEEP_SELF_MOVE,
+    HTLL_PEEP_MOVE_BACK,
+    HTLL_PEEP_STORE_LOAD,
+    HTLL_PEEP_LOAD_STORE,
+    HTLL_PEEP_PUSH_POP,
+    HTLL_PEEP_POP_PUSH,
+    HTLL_PEEP_COPY_FORWARD,
+    HTLL_PEEP_DEAD_MOVE,
+    HTLL_PEEP_RULES
+};
+// The number of an x86-64 register (0-15 in encoding order: rax, rcx, rdx, rbx, rsp, rbp,
+// rsi, rdi, r8-r15) or AArch64 register (x0-x30) and its width in bits, or -1 when the
+// name is not one (sp and xzr are not tracked).
+int HTLL_asmRegister(const std::string& name, int isArm, int& bits) {
+    static const std::unordered_map<std::string, std::pair<int, int>> x86 = [] {
+        std::unordered_map<std::string, std::pair<int, int>> map;
+        const char* names[4][8] = {{"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi"}, {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi"}, {"ax", "cx", "dx", "bx", "sp", "bp", "si", "di"}, {"al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil"}};
+        const int widths[4] = {64, 32, 16, 8};
+        for (int w = 0; w < 4; w++) {
+            for (int r = 0; r < 8; r++) {
+                map[names[w][r]] = {r, widths[w]};
+            }
+        }
+        map["ah"] = {0, 8};
+        map["ch"] = {1, 8};
+        map["dh"] = {2, 8};
+        map["bh"] = {3, 8};
+        for (int r = 8; r < 16; r++) {
+            std::string base = "r" + std::to_string(r);
+            map[base] = {r, 64};
+            map[base + "d"] = {r, 32};
+            map[base + "w"] = {r, 16};
+            map[base + "b"] = {r, 8};
+            map[base + "l"] = {r, 8};
+        }
+        return map;
+    }();
+    bits = 0;
+    std::string lower = StrLower(name);
+    if (isArm == 1) {
+        if (lower.size() < 2 || lower.size() > 3 || (lower[0] != 'x' && lower[0] != 'w')) {
+            return -1;
+        }
+        int number = 0;
+        for (size_t i = 1; i < lower.size(); i++) {
+            if (!std::isdigit((unsigned char)lower[i]) || (i == 1 && lower[i] == '0' && lower.size() == 3)) {
+                return -1;
+            }
+            number = number * 10 + (lower[i] - '0');
+        }
+        if (number > 30) {
+            return -1;
+        }
+        bits = lower[0] == 'x' ? 64 : 32;
+        return number;
+    }
+    auto found = x86.find(lower);
+    if (found == x86.end()) {
+        return -1;
+    }
+    bits = found->second.second;
+    return found->second.first;
+}
+// Splits a comment-free line into its label or its mnemonic and operands. Returns false
+// for an empty line.
+bool HTLL_asmParse(const std::string& text, HTLL_AsmOp& op) {
+    op.op = "";
+    op.args.clear();
+    op.label = "";
+    if (text == "") {
+        return false;
+    }
+    size_t space = text.find_first_of(" \t");
+    if (text.back() == ':' && space == std::string::npos) {
+        op.label = text.substr(0, text.size() - 1);
+        return true;
+    }
+    op.op = StrLower(text.substr(0, space));
+    op.args = HTLL_asmSplitArgs(space == std::string::npos ? "" : text.substr(space));
+    return true;
+}
+// The registers an instruction reads and writes, as bit masks over HTLL_asmRegister
+// numbers. An instruction that is not modelled reads every register and writes none,
+// which keeps the liveness analysis on the safe side.
+void HTLL_asmEffects(const HTLL_AsmOp& op, int isArm, uint64_t& use, uint64_t& def) {
+    static const std::unordered_set<std::string> x86Moves = {"mov", "movzx", "movsx", "movsxd", "lea"};
+    static const std::unordered_set<std::string> x86Alu = {"add", "sub", "and", "or", "xor", "adc", "sbb", "shl", "shr", "sar", "sal", "rol", "ror"};
+    static const std::unordered_set<std::string> armReaders = {"str", "strb", "strh", "stur", "sturb", "sturh", "stp", "cmp", "cmn", "tst"};
+    static const std::unordered_set<std::string> armWriters = {"mov", "movz", "movn", "movk", "mvn", "ldr", "ldrb", "ldrh", "ldrsb", "ldrsh", "ldrsw", "ldur", "adrp", "adr", "add", "adds", "sub", "subs", "mul", "madd", "msub", "umulh", "smulh", "udiv", "sdiv", "lsl", "lsr", "asr", "ror", "and", "ands", "orr", "orn", "eor", "eon", "bic", "neg", "negs", "csel", "csinc", "csneg", "csinv", "cset", "csetm", "sxtb", "sxth", "sxtw", "uxtb", "uxth"};
+    const uint64_t all = isArm == 1 ? 0x7FFFFFFFULL : 0xFFFFULL;
+    use = 0;
+    def = 0;
+    if (op.label != "") {
+        return;
+    }
+    if (op.inlineCode) {
+        use = all;
+        return;
+    }
+    auto registersIn = [&](const std::string& arg) {
+        uint64_t mask = 0;
+        int bits;
+        for (const std::string& ident : HTLL_asmIdentifiers(arg, isArm)) {
+            int reg = HTLL_asmRegister(ident, isArm, bits);
+            if (reg >= 0) {
+                mask |= 1ULL << reg;
+            }
+        }
+        return mask;
+    };
+    auto readsFrom = [&](size_t first) {
+        for (size_t a = first; a < op.args.size(); a++) {
+            use |= registersIn(op.args[a]);
+        }
+    };
+    // the first operand as a destination; narrow x86 writes keep the rest of the register
+    auto writes = [&](bool reads) {
+        int bits;
+        int reg = HTLL_asmRegister(op.args[0], isArm, bits);
+        if (reg < 0) {
+            use |= registersIn(op.args[0]);
+            return;
+        }
+        def |= 1ULL << reg;
+        if (reads || bits < 32) {
+            use |= 1ULL << reg;
+        }
+    };
+    const std::string& o = op.op;
+    size_t n = op.args.size();
+    std::string target = HTLL_asmJumpTarget(o, op.args, isArm);
+    if (isArm == 1) {
+        if (o == "b" || o.rfind("b.", 0) == 0) {
+            return;
+        }
+        if ((o == "cbz" || o == "cbnz" || o == "tbz" || o == "tbnz") && n >= 2) {
+            use |= registersIn(op.args[0]);
+        }
+        else if (o == "svc") {
+            use |= 0x13FULL;
+            def |= 1ULL;
+        }
+        else if (armReaders.count(o)) {
+            readsFrom(0);
+        }
+        else if (o == "ldp" && n >= 3) {
+            int bits;
+            for (size_t a = 0; a < 2; a++) {
+                int reg = HTLL_asmRegister(op.args[a], isArm, bits);
+                if (reg >= 0) {
+                    def |= 1ULL << reg;
+                }
+            }
+            readsFrom(2);
+        }
+        else if (armWriters.count(o) && n >= 1) {
+            writes(o == "movk");
+            readsFrom(1);
         } else {
-            if (is_in_func == 1 && is_in_main == 0) {
-                // in a func
-                str1 = "";
-                str2 = "";
-                str4 = "";
-                str5 = "";
-                str1 = A_LoopField36;
-                if (SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "arr " || SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "int ") {
-                    if (SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "arr ") {
-                        out += "__HTLL_flocal_" + str3 + "_" + Trim(StringTrimLeft(Trim(A_LoopField36), 4)) + ".clear" + Chr(10);
+            use = all;
+        }
+        return;
+    }
+    int bits0 = 0;
+    int reg0 = n > 0 ? HTLL_asmRegister(op.args[0], isArm, bits0) : -1;
+    if (target != "" && target != "*") {
+        return;
+    }
+    if ((o == "xor" || o == "sub") && n == 2 && reg0 >= 0 && StrLower(op.args[0]) == StrLower(op.args[1]) && bits0 >= 32) {
+        def |= 1ULL << reg0;
+    }
+    else if (x86Moves.count(o) && n == 2) {
+        writes(false);
+        readsFrom(1);
+    }
+    else if ((x86Alu.count(o) || o.rfind("cmov", 0) == 0 || o == "imul") && n == 2) {
+        writes(true);
+        readsFrom(1);
+    }
+    else if (o == "imul" && n == 3) {
+        writes(false);
+        readsFrom(1);
+    }
+    else if (o == "cmp" || o == "test" || o == "push") {
+        readsFrom(0);
+    }
+    else if ((o == "inc" || o == "dec" || o == "neg" || o == "not" || o.rfind("set", 0) == 0) && n == 1) {
+        writes(true);
+    }
+    else if ((o == "mul" || o == "imul" || o == "div" || o == "idiv") && n == 1) {
+        readsFrom(0);
+        use |= 0x5ULL;
+        def |= 0x5ULL;
+    }
+    else if (o == "cqo") {
+        use |= 0x1ULL;
+        def |= 0x4ULL;
+    }
+    else if (o == "pop" && n == 1) {
+        writes(false);
+    }
+    else if (o == "syscall") {
+        use |= 0x7C5ULL;
+        def |= 0x803ULL;
+    }
+    else if (o != "nop") {
+        use = all;
+    }
+}
+// Puts "to" in place of every whole-word "from" in an operand.
+std::string HTLL_asmReplaceRegister(const std::string& text, const std::string& from, const std::string& to) {
+    auto isIdentChar = [](char c) {
+        return std::isalnum((unsigned char)c) || c == '_' || c == '.' || c == '?' || c == '@';
+    };
+    std::string lowerText = StrLower(text);
+    std::string lowerFrom = StrLower(from);
+    std::string out;
+    size_t i = 0;
+    while (i < text.size()) {
+        if (lowerText.compare(i, lowerFrom.size(), lowerFrom) == 0 && (i == 0 || !isIdentChar(text[i - 1])) && (i + lowerFrom.size() >= text.size() || !isIdentChar(text[i + lowerFrom.size()]))) {
+            out += to;
+            i += lowerFrom.size();
+        } else {
+            out += text[i];
+            i++;
+        }
+    }
+    return out;
+}
+void HTLL_peephole(std::vector<std::string>& lines, const std::vector<std::pair<size_t, size_t>>& inlineBlocks, int isArm) {
+    static const std::unordered_set<std::string> x86Pure = {"mov", "movzx", "movsx", "movsxd", "lea"};
+    static const std::unordered_set<std::string> x86Forward = {"mov", "movzx", "movsx", "movsxd", "lea", "add", "sub", "and", "or", "xor", "adc", "sbb", "cmp", "test", "imul", "push", "inc", "dec", "neg", "not"};
+    static const std::unordered_set<std::string> x86ImmediateOk = {"mov", "add", "sub", "and", "or", "xor", "adc", "sbb", "cmp", "test"};
+    static const std::unordered_set<std::string> armPure = {"mov", "movz", "movn", "movk", "mvn", "ldr", "ldrb", "ldrh", "ldrsw", "adrp", "adr", "add", "sub", "mul", "madd", "msub", "udiv", "sdiv", "lsl", "lsr", "asr", "and", "orr", "eor", "neg", "csel", "cset"};
+    static const std::unordered_set<std::string> armForward = {"mov", "add", "sub", "mul", "madd", "msub", "udiv", "sdiv", "lsl", "lsr", "asr", "and", "orr", "eor", "neg", "mvn", "cmp", "cmn", "tst", "ldr", "ldrb", "ldrh", "str", "strb", "strh", "csel", "cbz", "cbnz"};
+    const uint64_t all = isArm == 1 ? 0x7FFFFFFFULL : 0xFFFFULL;
+    // never dropped or renamed: rsp and rbp, x29 and x30
+    const uint64_t fixedRegs = isArm == 1 ? (3ULL << 29) : 0x30ULL;
+    std::vector<bool> isInline = HTLL_asmInlineLines(lines.size(), inlineBlocks);
+    std::vector<bool> inText = HTLL_asmCodeLines(lines, isArm);
+    std::vector<bool> removed(lines.size(), false);
+    long long hits[HTLL_PEEP_RULES] = {};
+    const std::string indent = isArm == 1 ? "    " : "";
+    auto reg64 = [&](const std::string& arg) {
+        int bits;
+        int reg = HTLL_asmRegister(arg, isArm, bits);
+        return reg >= 0 && bits == 64 && !((fixedRegs >> reg) & 1) ? reg : -1;
+    };
+    // "[...]" or "qword [...]" with the spaces removed, "" for anything else; on AArch64
+    // only plain addresses without writeback
+    auto memory = [&](const std::string& arg) {
+        std::string a = arg;
+        if (isArm == 0 && StrLower(a.substr(0, 5)) == "qword") {
+            a = Trim(a.substr(5));
+        }
+        if (a.size() < 2 || a[0] != '[' || a.back() != ']') {
+            return std::string();
+        }
+        return StrReplace(StrReplace(a, " ", ""), Chr(9), "");
+    };
+    auto isNumber = [](const std::string& text) {
+        size_t digits = text.size() > 0 && text[0] == '-' ? 1 : 0;
+        if (text.size() <= digits || text.size() > 18) {
+            return false;
+        }
+        for (size_t i = digits; i < text.size(); i++) {
+            if (!std::isdigit((unsigned char)text[i])) {
+                return false;
+            }
+        }
+        return true;
+    };
+    for (const std::pair<size_t, size_t>& region : HTLL_asmUserRegions(lines, inText, isInline, isArm)) {
+        std::vector<HTLL_AsmOp> ops;
+        for (size_t i = region.first + 1; i < region.second; i++) {
+            HTLL_AsmOp op;
+            if (HTLL_asmParse(HTLL_asmStripComment(lines[i], isArm), op)) {
+                op.line = i;
+                op.inlineCode = isInline[i];
+                ops.push_back(op);
+            }
+        }
+        for (int round = 0; round < 8; round++) {
+            int n = (int)ops.size();
+            std::vector<uint64_t> use(n);
+            std::vector<uint64_t> def(n);
+            std::vector<std::string> target(n);
+            std::unordered_map<std::string, int> labelAt;
+            for (int i = 0; i < n; i++) {
+                HTLL_asmEffects(ops[i], isArm, use[i], def[i]);
+                if (ops[i].label != "") {
+                    labelAt[ops[i].label] = i;
+                } else {
+                    target[i] = HTLL_asmJumpTarget(ops[i].op, ops[i].args, isArm);
+                }
+            }
+            // liveness: live-out of each instruction, iterated to a fixed point
+            std::vector<uint64_t> liveIn(n, 0);
+            std::vector<uint64_t> liveOut(n, 0);
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                for (int i = n - 1; i >= 0; i--) {
+                    const std::string& o = ops[i].op;
+                    bool endsFlow = o == "jmp" || o == "b" || o == "br" || o == "ret" || o == "retn" || o == "iretq";
+                    uint64_t out = endsFlow ? 0 : i + 1 < n ? liveIn[i + 1] : all;
+                    if (target[i] != "") {
+                        auto found = labelAt.find(target[i]);
+                        out |= found == labelAt.end() ? all : liveIn[found->second];
+                    }
+                    uint64_t in = use[i] | (out & ~def[i]);
+                    if (in != liveIn[i] || out != liveOut[i]) {
+                        liveIn[i] = in;
+                        liveOut[i] = out;
+                        changed = true;
+                    }
+                }
+            }
+            std::vector<bool> gone(n, false);
+            auto instruction = [&](int k) {
+                return k < n && ops[k].label == "" && !ops[k].inlineCode;
+            };
+            auto rewrite = [&](int k, const std::string& text) {
+                lines[ops[k].line] = indent + text;
+                HTLL_asmParse(text, ops[k]);
+            };
+            auto drop = [&](int k) {
+                gone[k] = true;
+                removed[ops[k].line] = true;
+            };
+            // Tries the rules at instruction i; returns the last instruction it changed,
+            // or -1.
+            auto apply = [&](int i) -> int {
+                const HTLL_AsmOp& a = ops[i];
+                int j = i + 1;
+                bool pair = instruction(j);
+                const HTLL_AsmOp& b = pair ? ops[j] : a;
+                if (target[i] != "" && target[i] != "*") {
+                    for (int k = j; k < n && ops[k].label != ""; k++) {
+                        if (ops[k].label == target[i]) {
+                            drop(i);
+                            hits[HTLL_PEEP_JUMP_TO_NEXT]++;
+                            return i;
+                        }
+                    }
+                }
+                bool move = a.op == "mov" && a.args.size() == 2;
+                if (move && reg64(a.args[0]) >= 0 && StrLower(a.args[0]) == StrLower(a.args[1])) {
+                    drop(i);
+                    hits[HTLL_PEEP_SELF_MOVE]++;
+                    return i;
+                }
+                if (!pair) {
+                    return -1;
+                }
+                if (move && b.op == "mov" && b.args.size() == 2 && reg64(a.args[0]) >= 0 && reg64(a.args[1]) >= 0 && StrLower(a.args[0]) == StrLower(b.args[1]) && StrLower(a.args[1]) == StrLower(b.args[0])) {
+                    drop(j);
+                    hits[HTLL_PEEP_MOVE_BACK]++;
+                    return j;
+                }
+                std::string storeOp = isArm == 1 ? "str" : "mov";
+                std::string loadOp = isArm == 1 ? "ldr" : "mov";
+                size_t valueArg = isArm == 1 ? 0 : 1;
+                size_t memoryArg = isArm == 1 ? 1 : 0;
+                if (a.op == storeOp && a.args.size() == 2 && b.op == loadOp && b.args.size() == 2 && (reg64(a.args[valueArg]) >= 0 || (isArm == 1 && StrLower(a.args[0]) == "xzr")) && reg64(b.args[0]) >= 0 && memory(a.args[memoryArg]) != "" && memory(a.args[memoryArg]) == memory(b.args[1])) {
+                    if (StrLower(b.args[0]) == StrLower(a.args[valueArg])) {
+                        drop(j);
+                    } else {
+                        rewrite(j, "mov " + b.args[0] + ", " + a.args[valueArg]);
+                    }
+                    hits[HTLL_PEEP_STORE_LOAD]++;
+                    return j;
+                }
+                if (a.op == loadOp && a.args.size() == 2 && b.op == storeOp && b.args.size() == 2 && reg64(a.args[0]) >= 0 && StrLower(b.args[valueArg]) == StrLower(a.args[0]) && memory(a.args[1]) != "" && memory(a.args[1]) == memory(b.args[memoryArg])) {
+                    // the load must not have changed the address
+                    bool inAddress = false;
+                    int bits;
+                    for (const std::string& ident : HTLL_asmIdentifiers(a.args[1], isArm)) {
+                        inAddress = inAddress || HTLL_asmRegister(ident, isArm, bits) == reg64(a.args[0]);
+                    }
+                    if (!inAddress) {
+                        drop(j);
+                        hits[HTLL_PEEP_LOAD_STORE]++;
+                        return j;
+                    }
+                }
+                if (isArm == 0 && a.op == "push" && b.op == "pop" && a.args.size() == 1 && b.args.size() == 1 && reg64(a.args[0]) >= 0 && reg64(b.args[0]) >= 0) {
+                    if (StrLower(a.args[0]) == StrLower(b.args[0])) {
+                        drop(j);
+                    } else {
+                        rewrite(j, "mov " + b.args[0] + ", " + a.args[0]);
+                    }
+                    drop(i);
+                    hits[HTLL_PEEP_PUSH_POP]++;
+                    return j;
+                }
+                bool sameRegisters = a.args.size() >= 2 && b.args.size() >= 2 && StrLower(a.args[0]) == StrLower(b.args[0]) && StrLower(a.args[1]) == StrLower(b.args[1]);
+                if (isArm == 1 && a.op == "stp" && b.op == "ldp" && sameRegisters && a.args.size() == 3 && b.args.size() == 4 && memory(StrReplace(a.args[2], "!", "")) == "[sp,#-16]" && a.args[2].back() == '!' && memory(b.args[2]) == "[sp]" && b.args[3] == "#16") {
+                    drop(i);
+                    drop(j);
+                    hits[HTLL_PEEP_PUSH_POP]++;
+                    return j;
+                }
+                if (isArm == 1 && a.op == "ldp" && b.op == "stp" && sameRegisters && a.args.size() == 4 && b.args.size() == 3 && memory(a.args[2]) == "[sp]" && a.args[3] == "#16" && memory(StrReplace(b.args[2], "!", "")) == "[sp,#-16]" && b.args[2].back() == '!') {
+                    rewrite(i, "ldp " + a.args[0] + ", " + a.args[1] + ", [sp]");
+                    drop(j);
+                    hits[HTLL_PEEP_POP_PUSH]++;
+                    return j;
+                }
+                if (isArm == 0 && a.op == "pop" && a.args.size() == 1 && reg64(a.args[0]) >= 0) {
+                    std::string popped = a.args[0];
+                    if (b.op == "push" && b.args.size() == 1 && StrLower(b.args[0]) == StrLower(popped)) {
+                        rewrite(i, "mov " + popped + ", [rsp]");
+                        drop(j);
+                        hits[HTLL_PEEP_POP_PUSH]++;
+                        return j;
+                    }
+                    if (b.op == "mov" && b.args.size() == 2 && reg64(b.args[0]) >= 0 && StrLower(b.args[0]) != StrLower(popped) && memory(b.args[1]) == "[rsp]" && instruction(j + 1) && ops[j + 1].op == "push" && ops[j + 1].args.size() == 1 && StrLower(ops[j + 1].args[0]) == StrLower(popped)) {
+                        std::string loaded = b.args[0];
+                        rewrite(i, "mov " + popped + ", [rsp]");
+                        rewrite(j, "mov " + loaded + ", [rsp + 8]");
+                        drop(j + 1);
+                        hits[HTLL_PEEP_POP_PUSH]++;
+                        return j + 1;
+                    }
+                }
+                // copy-forward: the reader may come a few instructions later when those
+                // leave both registers alone
+                int copied = move ? reg64(a.args[0]) : -1;
+                const std::string name = copied >= 0 ? StrLower(a.args[0]) : "";
+                const std::string& source = move ? a.args[1] : a.op;
+                // what is copied: 1 a register, 2 memory (x86), 3 a number
+                int kind = 0;
+                std::string value = isArm == 1 && source[0] == '#' ? source.substr(1) : source;
+                if (copied >= 0 && reg64(source) >= 0) {
+                    kind = 1;
+                }
+                else if (copied >= 0 && isArm == 0 && memory(source) != "") {
+                    kind = 2;
+                }
+                else if (copied >= 0 && (isArm == 1) == (source[0] == '#') && isNumber(value)) {
+                    kind = 3;
+                }
+                int k = j;
+                while (kind != 2 && k < j + 3 && instruction(k + 1) && target[k] == "" && !(((use[k] | def[k]) >> copied) & 1) && !(kind == 1 && ((def[k] >> reg64(source)) & 1))) {
+                    k++;
+                }
+                const HTLL_AsmOp& c = ops[k];
+                if (kind != 0 && ((use[k] >> copied) & 1) && !((def[k] >> copied) & 1) && !((liveOut[k] >> copied) & 1) && (isArm == 1 ? armForward.count(c.op) : x86Forward.count(c.op))) {
+                    bool ok = kind != 0;
+                    int bits;
+                    for (const std::string& ident : HTLL_asmIdentifiers(lines[ops[k].line], isArm)) {
+                        if (HTLL_asmRegister(ident, isArm, bits) == copied && StrLower(ident) != name) {
+                            ok = false;
+                        }
+                    }
+                    if (isArm == 1 && (c.op == "ldr" || c.op == "ldrb" || c.op == "ldrh" || c.op == "str" || c.op == "strb" || c.op == "strh") && (c.args.size() != 2 || lines[ops[k].line].find('!') != std::string::npos)) {
+                        ok = false;
+                    }
+                    std::vector<std::string> args = c.args;
+                    for (size_t p = 0; p < args.size() && ok; p++) {
+                        if (StrLower(args[p]) == name) {
+                            bool otherRegisters = true;
+                            for (size_t q = 0; q < args.size(); q++) {
+                                otherRegisters = otherRegisters && (q == p || HTLL_asmRegister(args[q], isArm, bits) >= 0);
+                            }
+                            long long number = kind == 3 ? std::stoll(value) : 0;
+                            if (isArm == 0 && !((p == 1 && c.op != "push") || (p == 0 && (c.op == "cmp" || c.op == "test" || c.op == "push")))) {
+                                ok = false;
+                            }
+                            else if (kind == 2 && (c.op == "push" || !otherRegisters)) {
+                                ok = false;
+                            }
+                            else if (kind == 3 && isArm == 0 && !(p == 1 && x86ImmediateOk.count(c.op) && reg64(args[0]) >= 0 && (c.op == "mov" || (number >= -2147483648LL && number <= 2147483647LL)))) {
+                                ok = false;
+                            }
+                            else if (kind == 3 && isArm == 1) {
+                                bool movImmediate = c.op == "mov" && p == 1 && reg64(args[0]) >= 0;
+                                bool aluImmediate = (c.op == "add" || c.op == "sub") && p == 2 && args.size() == 3 && number >= 0 && number <= 4095;
+                                bool cmpImmediate = c.op == "cmp" && p == 1 && number >= 0 && number <= 4095;
+                                bool zeroStore = c.op == "str" && p == 0 && number == 0;
+                                ok = movImmediate || aluImmediate || cmpImmediate || zeroStore;
+                                args[p] = zeroStore ? "xzr" : "#" + value;
+                                continue;
+                            }
+                            args[p] = source;
+                        }
+                        else if (HTLL_asmReplaceRegister(StrLower(args[p]), name, "") != StrLower(args[p])) {
+                            bool inAddress = args[p].find('[') != std::string::npos;
+                            bool immediateIndex = kind == 3 && isArm == 0 && std::llabs(std::stoll(value)) < (1LL << 24);
+                            if (!inAddress || !(kind == 1 || immediateIndex)) {
+                                ok = false;
+                            } else {
+                                args[p] = HTLL_asmReplaceRegister(args[p], name, value);
+                            }
+                        }
                     }
-                    if (InStr(A_LoopField36, " := ")) {
-                        str2 = Trim(StrSplit(A_LoopField36, ":=", 1));
-                        str4 = Trim(StrSplit(A_LoopField36, " ", 2));
-                    } else {
-                        str2 = Trim(A_LoopField36);
-                        str4 = Trim(StrSplit(A_LoopField36, " ", 2));
+                    if (ok) {
+                        std::string text = c.op;
+                        for (size_t p = 0; p < args.size(); p++) {
+                            text += (p == 0 ? " " : ", ") + args[p];
+                        }
+                        rewrite(k, text);
+                        drop(i);
+                        hits[HTLL_PEEP_COPY_FORWARD]++;
+                        return k;
                     }
-                    HTVM_Append(func_vars_and_arrs, str4);
                 }
-                for (int A_Index40 = 0; A_Index40 < HTVM_Size(func_arrs_params_ORIGINAL_NAME); A_Index40++) {
-                    str1 = RegExReplace(str1, "\\b" + func_arrs_params_ORIGINAL_NAME[A_Index40] + "\\b", "__HTLL_param_" + str14 + "_" + func_arrs_params_ORIGINAL_NAME[A_Index40]);
+                return -1;
+            };
+            // dead-move
+            auto dead = [&](int i) {
+                const HTLL_AsmOp& a = ops[i];
+                if (isArm == 0) {
+                    int bits;
+                    int reg = a.args.size() == 2 && x86Pure.count(a.op) ? HTLL_asmRegister(a.args[0], isArm, bits) : -1;
+                    return reg >= 0 && !((fixedRegs >> reg) & 1) && !((liveOut[i] >> reg) & 1);
                 }
-                for (int A_Index41 = 0; A_Index41 < HTVM_Size(func_vars_and_arrs); A_Index41++) {
-                    str1 = RegExReplace(str1, "\\b" + func_vars_and_arrs[A_Index41] + "\\b", "__HTLL_flocal_" + str14 + "_" + func_vars_and_arrs[A_Index41]);
+                if (lines[ops[i].line].find('!') != std::string::npos || def[i] == 0 || (def[i] & fixedRegs) != 0 || (def[i] & liveOut[i]) != 0) {
+                    return false;
                 }
-                //::::::::::::::::::::::
-                //::::::::::::::::::::::
-                //::::::::::::::::::::::
-                //::::::::::::::::::::::
-                //::::::::::::::::::::::
-                //::::::::::::::::::::::
-                str6 = str1;
-                for (int A_Index42 = 0; A_Index42 < HTVM_Size(funcs_and_what_types); A_Index42++) {
-                    if (InStr(A_LoopField36, ")") && RegExMatch(A_LoopField36, "\\b" + StrSplit(funcs_and_what_types[A_Index42], "|", 2) + "\\b")) {
-                        if (InStr(A_LoopField36, " := ")) {
-                            if (StrSplit(funcs_and_what_types[A_Index42], "|", 1) == "no") {
-                                throw std::runtime_error("ERROR You cannot use the assignment operator and save the function " + StrSplit(funcs_and_what_types[A_Index42], "|", 2) + " please use rax.");
-                            }
-                            // for arrays
-                            // for arrays
-                            str1 = Trim(StrSplit(str6, " := ", 1));
-                            str2 = Trim(StrSplit(str6, " := ", 2));
-                            str3 = Trim(StrSplit(str2, "(", 1));
-                            str4 = Trim(StrSplit(str2, "(", 2));
-                            str4 = StringTrimRight(str4, 1);
-                            // str1 = arrName
-                            // str2 WE DONT CARE
-                            // str3 = func name
-                            // str4 = all params if any
-                            if (Trim(str4) == "") {
-                                // no param handle here
-                                str5 = StrSplit(funcs_and_what_types[A_Index42], "|", 2) + "()" + Chr(10);
-                                str5 += str1 + ".copy __HTLL_ret_" + StrSplit(funcs_and_what_types[A_Index42], "|", 2) + Chr(10);
-                            } else {
-                                // there are params so handle here
-                                str7 = "";
-                                str5 = "";
-                                str8 = StrSplit(funcs_and_what_types[A_Index42], "|", 3);
-                                AAIndex = A_Index42;
-                                std::vector<std::string> items43 = LoopParseFunc(str4, ",");
-                                for (size_t A_Index43 = 0; A_Index43 < items43.size(); A_Index43++) {
-                                    std::string A_LoopField43 = items43[A_Index43 - 0];
-                                    ALoopField = Trim(A_LoopField43);
-                                    AIndex = A_Index43;
-                                    it_macth_arr_name = 0;
-                                    std::vector<std::string> items44 = LoopParseFunc(str8, ",");
-                                    for (size_t A_Index44 = 0; A_Index44 < items44.size(); A_Index44++) {
-                                        std::string A_LoopField44 = items44[A_Index44 - 0];
-                                        if (Trim(A_LoopField44) != "__000_NOT-ARRAY_000__" && AIndex == A_Index44) {
-                                            ALoopField = Trim(A_LoopField44);
-                                            if (Trim(ALoopField) != "") {
-                                                it_macth_arr_name = 1;
-                                            }
-                                            break;
-                                        }
-                                    }
-                                    if (it_macth_arr_name == 1) {
-                                        if (InStr(A_LoopField43, "__HTLL_flocal_")) {
-                                            str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy " + Trim(A_LoopField43) + Chr(10);
-                                        } else {
-                                            str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy __HTLL_flocal_" + str14 + "_" + Trim(A_LoopField43) + Chr(10);
-                                        }
-                                    } else {
-                                        if (RegExMatch(Trim(A_LoopField43), "^\\d+$")) {
-                                            str7 += Trim(A_LoopField43) + ", ";
-                                        } else {
-                                            if (InStr(A_LoopField43, "__HTLL_flocal_")) {
-                                                str7 += "__HTLL_flocal_" + str14 + "_" + Trim(A_LoopField43) + ", ";
-                                            } else {
-                                                str7 += "__HTLL_flocal_" + str14 + "_" + Trim(A_LoopField43) + ", ";
-                                            }
-                                        }
-                                    }
-                                }
-                                str5 += StrSplit(funcs_and_what_types[A_Index42], "|", 2) + "(" + StringTrimRight(Trim(str7), 1) + ")" + Chr(10);
-                                str5 += str1 + ".copy __HTLL_ret_" + StrSplit(funcs_and_what_types[A_Index42], "|", 2) + Chr(10);
-                                // there are params so handle here
-                            }
-                            str6 = str5;
-                            // for arrays
-                            // for arrays
-                        } else {
-                            if (StrSplit(funcs_and_what_types[A_Index42], "|", 1) == "yes") {
-                                throw std::runtime_error("ERROR You must use the assignment operator and save the function " + StrSplit(funcs_and_what_types[A_Index42], "|", 2) + " to an array.");
-                            }
-                            // for not arays returned
-                            // for not arays returned
-                            str1 = Trim(A_LoopField36);
-                            str2 = str1;
-                            str3 = Trim(StrSplit(str2, "(", 1));
-                            str4 = Trim(StrSplit(str2, "(", 2));
-                            str4 = StringTrimRight(str4, 1);
-                            // str2 WE DONT CARE
-                            // str3 = func name
-                            // str4 = all params if any
-                            if (Trim(str4) == "") {
-                                // no param handle here
-                                str5 = StrSplit(funcs_and_what_types[A_Index42], "|", 2) + "()" + Chr(10);
-                            } else {
-                                // there are params so handle here
-                                str7 = "";
-                                str5 = "";
-                                str8 = StrSplit(funcs_and_what_types[A_Index42], "|", 3);
-                                AAIndex = A_Index42;
-                                std::vector<std::string> items45 = LoopParseFunc(str4, ",");
-                                for (size_t A_Index45 = 0; A_Index45 < items45.size(); A_Index45++) {
-                                    std::string A_LoopField45 = items45[A_Index45 - 0];
-                                    ALoopField = Trim(A_LoopField45);
-                                    AIndex = A_Index45;
-                                    it_macth_arr_name = 0;
-                                    std::vector<std::string> items46 = LoopParseFunc(str8, ",");
-                                    for (size_t A_Index46 = 0; A_Index46 < items46.size(); A_Index46++) {
-                                        std::string A_LoopField46 = items46[A_Index46 - 0];
-                                        if (Trim(A_LoopField46) != "__000_NOT-ARRAY_000__" && AIndex == A_Index46) {
-                                            ALoopField = Trim(A_LoopField46);
-                                            if (Trim(ALoopField) != "") {
-                                                it_macth_arr_name = 1;
-                                            }
-                                            break;
-                                        }
-                                    }
-                                    if (it_macth_arr_name == 1) {
-                                        if (InStr(A_LoopField45, "__HTLL_flocal_")) {
-                                            str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy " + Trim(A_LoopField45) + Chr(10);
-                                        } else {
-                                            str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy __HTLL_flocal_" + str14 + "_" + Trim(A_LoopField45) + Chr(10);
-                                        }
-                                    } else {
-                                        if (RegExMatch(Trim(A_LoopField45), "^\\d+$")) {
-                                            str7 += Trim(A_LoopField45) + ", ";
-                                        } else {
-                                            if (InStr(A_LoopField45, "__HTLL_flocal_")) {
-                                                str7 += "__HTLL_flocal_" + str14 + "_" + Trim(A_LoopField45) + ", ";
-                                            } else {
-                                                str7 += "__HTLL_flocal_" + str14 + "_" + Trim(A_LoopField45) + ", ";
-                                            }
-                                        }
-                                    }
-                                }
-                                str5 += StrSplit(funcs_and_what_types[A_Index42], "|", 2) + "(" + StringTrimRight(Trim(str7), 1) + ")" + Chr(10);
-                                // there are params so handle here
-                            }
-                            str6 = str5;
-                            // for not arays returned
-                            // for not arays returned
+                if (a.op == "ldp") {
+                    return a.args.size() == 3;
+                }
+                bool load = a.op == "ldr" || a.op == "ldrb" || a.op == "ldrh" || a.op == "ldrsw";
+                return armPure.count(a.op) > 0 && (!load || a.args.size() == 2);
+            };
+            bool any = false;
+            for (int i = 0; i < n; i++) {
+                if (!instruction(i)) {
+                    continue;
+                }
+                int last = apply(i);
+                if (last < 0 && dead(i)) {
+                    drop(i);
+                    hits[HTLL_PEEP_DEAD_MOVE]++;
+                    last = i;
+                }
+                if (last >= 0) {
+                    any = true;
+                    i = last;
+                }
+            }
+            if (!any) {
+                break;
+            }
+            std::vector<HTLL_AsmOp> kept;
+            kept.reserve(n);
+            for (int i = 0; i < n; i++) {
+                if (!gone[i]) {
+                    kept.push_back(std::move(ops[i]));
+                }
+            }
+            ops.swap(kept);
+        }
+    }
+    for (int r = 0; r < HTLL_PEEP_RULES; r++) {
+        HTLL_count(std::string("peephole ") + HTLL_peepholeRules[r], hits[r]);
+    }
+    std::vector<std::string> out;
+    out.reserve(lines.size());
+    for (size_t i = 0; i < lines.size(); i++) {
+        if (!removed[i]) {
+            out.push_back(std::move(lines[i]));
+        }
+    }
+    lines.swap(out);
+}
+// Puts the final output together. The back end emits each statement's code as soon as it is
+// generated, then the header and data in front of it and the footer after it; everything is streamed
+// through line by line: " [rax]" is fixed, string literals and inline code blocks are put back and x86
+// lines are trimmed. Each literal and block is restored where it occurs instead of by a whole-buffer
+// StrReplace per literal and per block. The finished lines are kept once, for the whole-program passes
+// (register allocation, peephole, dead-code elimination), and then moved into an HTLL_Output one at a
+// time, each freed as soon as it is appended, so no joined copy of the whole program is made.
+class HTLL_AsmWriter {
+public:
+    HTLL_AsmWriter(const std::vector<std::string>& literals, int literalCount, const std::string& escapeChar)
+        : literals(literals), literalCount(literalCount), escapeChar(escapeChar) {
+    }
+    // Appends the next part of the program; parts are joined as if concatenated.
+    void emit(const std::string& text) {
+        size_t start = 0;
+        size_t end;
+        while ((end = text.find('\n', start)) != std::string::npos) {
+            pending.append(text, start, end - start);
+            line(pending);
+            pending.clear();
+            start = end + 1;
+        }
+        pending.append(text, start, std::string::npos);
+    }
+    // What is emitted between startPrefix() and endPrefix() goes in front of everything emitted
+    // before, for the parts that are only known once the code is generated. The prefix ends at a
+    // line break.
+    void startPrefix() {
+        body.swap(lines);
+        bodyBlocks.swap(inlineBlocks);
+        bodyPending.swap(pending);
+    }
+    void endPrefix() {
+        if (pending != "") {
+            line(pending);
+            pending.clear();
+        }
+        size_t offset = lines.size();
+        lines.insert(lines.end(), std::make_move_iterator(body.begin()), std::make_move_iterator(body.end()));
+        for (const auto& block : bodyBlocks) {
+            inlineBlocks.push_back({block.first + offset, block.second + offset});
+        }
+        std::vector<std::string>().swap(body);
+        bodyBlocks.clear();
+        pending.swap(bodyPending);
+    }
+    void finish(HTLL_Output& out) {
+        line(pending);
+        pending.clear();
+        if (is_oryx == 0) {
+            if (ring0 == 0 && HTLL_registerAllocation == 1) {
+                HTLL_pass("register allocation");
+                HTLL_allocateRegisters(lines, inlineBlocks, is_arm);
+            }
+            if (HTLL_optLevel >= 1) {
+                HTLL_pass("peephole");
+                HTLL_peephole(lines, inlineBlocks, is_arm);
+            }
+            HTLL_pass("dead-code elimination");
+            HTLL_eliminateDeadCode(lines, is_arm);
+            HTLL_pass("assembly output");
+        }
+        for (size_t i = 0; i < lines.size(); i++) {
+            if (i > 0) {
+                out.append("\n", 1);
+            }
+            out.append(lines[i]);
+            std::string().swap(lines[i]);
+        }
+        lines.clear();
+        inlineBlocks.clear();
+    }
+private:
+    const std::vector<std::string>& literals;
+    int literalCount;
+    std::string escapeChar;
+    std::string pending;
+    std::vector<std::string> lines;
+    // line ranges [first, last) that came from inline code blocks
+    std::vector<std::pair<size_t, size_t>> inlineBlocks;
+    // the code emitted before startPrefix(), put back behind the prefix by endPrefix()
+    std::vector<std::string> body;
+    std::vector<std::pair<size_t, size_t>> bodyBlocks;
+    std::string bodyPending;
+    void line(const std::string& text) {
+        std::string restored = restoreLiterals(StrReplace(text, " [rax]", " rax"));
+        if (is_arm == 0 && is_oryx == 0) {
+            // drop comment lines, blank lines and indentation from the x86 output
+            size_t start = 0;
+            while (start <= restored.size()) {
+                size_t end = restored.find_first_of("\n\r", start);
+                if (end == std::string::npos) {
+                    end = restored.size();
+                }
+                std::string piece = Trim(restored.substr(start, end - start));
+                if (piece != "" && SubStr(piece, 1, 2) != "; ") {
+                    std::string block = restoreBlocks(piece);
+                    size_t first = lines.size();
+                    collect(block);
+                    if (block != piece) {
+                        inlineBlocks.push_back({first, lines.size()});
+                    }
+                }
+                start = end + 1;
+            }
+        } else {
+            std::string block = restoreBlocks(restored);
+            size_t first = lines.size();
+            collect(block);
+            if (block != restored) {
+                inlineBlocks.push_back({first, lines.size()});
+            }
+        }
+    }
+    void collect(const std::string& text) {
+        size_t start = 0;
+        size_t end;
+        while ((end = text.find('\n', start)) != std::string::npos) {
+            lines.push_back(text.substr(start, end - start));
+            start = end + 1;
+        }
+        lines.push_back(text.substr(start));
+    }
+    std::string restoreLiterals(const std::string& text) {
+        static const std::string marker = "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFCAA";
+        if (text.find(marker) == std::string::npos) {
+            return text;
+        }
+        std::string out = "";
+        size_t pos = 0;
+        size_t found;
+        while ((found = text.find(marker, pos)) != std::string::npos) {
+            size_t digits = found + marker.size();
+            size_t digitsEnd = digits;
+            while (digitsEnd < text.size() && std::isdigit((unsigned char)text[digitsEnd])) {
+                digitsEnd++;
+            }
+            int id = digitsEnd > digits && digitsEnd - digits < 9 ? std::stoi(text.substr(digits, digitsEnd - digits)) : 0;
+            out.append(text, pos, found - pos);
+            if (id >= 1 && id <= literalCount && id < (int)literals.size() && text.compare(digitsEnd, 2, "AA") == 0) {
+                out += StrReplace(literals[id], escapeChar, "\\");
+                if (id == literalCount) {
+                    out += Chr(34);
+                }
+                pos = digitsEnd + 2;
+            } else {
+                out += marker;
+                pos = digits;
+            }
+        }
+        out.append(text, pos, std::string::npos);
+        return out;
+    }
+    // Inline code blocks for the current target come back, the other targets' blocks become empty lines.
+    std::string restoreBlocks(const std::string& text) {
+        if (text.find("programmingBlock_") == std::string::npos) {
+            return text;
+        }
+        std::string out = text;
+        restoreBlock(out, "InTheTranspiledLang", programmingBlock_InTheTranspiledLang, COUNT_programmingBlock_InTheTranspiledLang, true);
+        restoreBlock(out, "CPP", programmingBlock_CPP, COUNT_programmingBlock_CPP, langToConvertTo == "x86-64");
+        restoreBlock(out, "PY", programmingBlock_PY, COUNT_programmingBlock_PY, langToConvertTo == "arm");
+        restoreBlock(out, "JS", programmingBlock_JS, COUNT_programmingBlock_JS, langToConvertTo == "oryx");
+        restoreBlock(out, "GO", programmingBlock_GO, COUNT_programmingBlock_GO, langToConvertTo == "x86-64-ring0");
+        return out;
+    }
+    static void restoreBlock(std::string& text, const std::string& lang, const std::vector<std::string>& blocks, int count, bool forThisTarget) {
+        std::string marker = "programmingBlock_" + lang + "-programmingBlock_" + lang + "-AA";
+        size_t found = 0;
+        while ((found = text.find(marker, found)) != std::string::npos) {
+            size_t digits = found + marker.size();
+            size_t digitsEnd = digits;
+            while (digitsEnd < text.size() && std::isdigit((unsigned char)text[digitsEnd])) {
+                digitsEnd++;
+            }
+            int id = digitsEnd > digits && digitsEnd - digits < 9 ? std::stoi(text.substr(digits, digitsEnd - digits)) : 0;
+            if (id >= 1 && id <= count && id <= (int)blocks.size() && text.compare(digitsEnd, 2, "AA") == 0) {
+                std::string block = forThisTarget ? blocks[id - 1] : Chr(10);
+                text.replace(found, digitsEnd + 2 - found, block);
+                found += block.size();
+            } else {
+                found = digits;
+            }
+        }
+    }
+};
+// Constant propagation over the lowered statements, run at -O1 before the strings go back
+// in. An int is a constant when its only declaration gives it a literal (or nothing, so 0)
+// and every other mention of it is a plain read: a Loop count, an if operand, an .index
+// operand, the source of an assignment or expression, print() or a call argument. Locals
+// are renamed apart by now, so a name is one variable; an assignment to it, ++, inline
+// assembly or anything else that mentions it keeps it a variable. The reads then take the
+// value where the back ends accept a literal, expressions fold their literal prefix left to
+// right with 64-bit wraparound (a division by zero is left to happen at run time), and an
+// if decided at compile time keeps only its body or goes away with it.
+std::string HTLL_propagateConstants(const std::string& code) {
+    static const char* const assignOps[] = {" := ", " += ", " -= ", " *= ", " //= ", " %= ", " <<= ", " >>= ", " &= ", " |= ", " ^= "};
+    static const char* const compareOps[] = {" = ", " != ", " > ", " < ", " >= ", " <= "};
+    static const std::string marker = "___HTLL_expr___ ";
+    auto isIdentifier = [](const std::string& s) {
+        if (s.empty() || !(std::isalpha((unsigned char)s[0]) || s[0] == '_')) {
+            return false;
+        }
+        for (char c : s) {
+            if (!(std::isalnum((unsigned char)c) || c == '_')) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto literal = [](const std::string& s, unsigned long long& value) {
+        if (s.empty() || s.size() > 20) {
+            return false;
+        }
+        unsigned long long v = 0;
+        for (char c : s) {
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            unsigned long long next = v * 10 + (unsigned long long)(c - '0');
+            if (next / 10 != v) {
+                return false;
+            }
+            v = next;
+        }
+        value = v;
+        return true;
+    };
+    auto split = [](const std::string& s) {
+        std::vector<std::string> tokens;
+        std::stringstream stream(s);
+        std::string token;
+        while (stream >> token) {
+            tokens.push_back(token);
+        }
+        return tokens;
+    };
+    // "if (...)", "if2 (...)": the level, or 0 for any other line. "ifend", "endif3": likewise.
+    auto blockLevel = [](const std::string& lower, const std::string& word, bool whole) {
+        if (lower.compare(0, word.size(), word) != 0) {
+            return 0;
+        }
+        size_t k = word.size();
+        int level = 0;
+        while (k < lower.size() && lower[k] >= '0' && lower[k] <= '9' && level < 100000) {
+            level = level * 10 + (lower[k] - '0');
+            k++;
+        }
+        if (whole ? k != lower.size() : lower.compare(k, 2, " (") != 0) {
+            return 0;
+        }
+        return level == 0 ? 1 : level;
+    };
+    // "loop, n", "Loop3, n": the count, or "" for any other line.
+    auto loopCount = [](const std::string& s) -> std::string {
+        size_t comma = s.find(',');
+        if (comma == std::string::npos) {
+            return "";
+        }
+        std::string head = StrLower(Trim(s.substr(0, comma)));
+        if (head.compare(0, 4, "loop") != 0 || head.find_first_not_of("0123456789", 4) != std::string::npos) {
+            return "";
+        }
+        return Trim(s.substr(comma + 1));
+    };
+    auto assignOp = [&](const std::string& s) -> std::string {
+        for (const char* op : assignOps) {
+            if (s.find(op) != std::string::npos) {
+                return op;
+            }
+        }
+        return "";
+    };
+    auto compareOp = [&](const std::string& s) -> std::string {
+        for (const char* op : compareOps) {
+            if (s.find(op) != std::string::npos) {
+                return op;
+            }
+        }
+        return "";
+    };
+    std::vector<std::string> lines;
+    std::stringstream input(code);
+    std::string raw;
+    while (std::getline(input, raw)) {
+        if (!raw.empty() && raw.back() == '\r') {
+            raw.pop_back();
+        }
+        lines.push_back(raw);
+    }
+    // Pass 1: declarations, plain reads and every mention of each name.
+    std::unordered_map<std::string, int> declarations;
+    std::unordered_map<std::string, unsigned long long> declared;
+    std::unordered_map<std::string, int> reads;
+    std::unordered_map<std::string, int> mentions;
+    for (const std::string& line : lines) {
+        std::string t = Trim(line);
+        std::string lower = StrLower(t);
+        auto read = [&](const std::string& name) {
+            if (isIdentifier(name)) {
+                reads[name]++;
+            }
+        };
+        std::string op = assignOp(t);
+        if (lower.compare(0, 4, "int ") == 0) {
+            std::string rest = Trim(t.substr(4));
+            std::string name = rest;
+            unsigned long long value = 0;
+            bool isLiteral = true;
+            if (op == " := ") {
+                name = Trim(rest.substr(0, rest.find(op)));
+                std::string source = Trim(rest.substr(rest.find(op) + op.size()));
+                isLiteral = literal(source, value);
+                if (!isLiteral) {
+                    read(source);
+                }
+            }
+            else if (op != "") {
+                isLiteral = false;
+            }
+            if (isLiteral && isIdentifier(name)) {
+                declarations[name]++;
+                declared[name] = value;
+                reads[name]++;
+            }
+        }
+        else if (t.compare(0, marker.size(), marker) == 0) {
+            std::vector<std::string> tokens = split(t.substr(marker.size()));
+            for (size_t i = 2; i < tokens.size(); i += 2) {
+                read(tokens[i]);
+            }
+        }
+        else if (loopCount(t) != "") {
+            read(loopCount(t));
+        }
+        else if (blockLevel(lower, "if", false) != 0 && t.back() == ')') {
+            std::string condition = t.substr(t.find('(') + 1);
+            condition.pop_back();
+            std::string cmp = compareOp(condition);
+            if (cmp != "") {
+                read(Trim(condition.substr(0, condition.find(cmp))));
+                read(Trim(condition.substr(condition.find(cmp) + cmp.size())));
+            }
+        }
+        else if (t.find(".index ") != std::string::npos) {
+            read(Trim(t.substr(t.find(".index ") + 7)));
+        }
+        else if (t.find(".reserve ") != std::string::npos) {
+            read(Trim(t.substr(t.find(".reserve ") + 9)));
+        }
+        else if (op != "") {
+            read(Trim(t.substr(t.find(op) + op.size())));
+        }
+        else if (t.size() > 1 && t.back() == ')' && t.find('(') != std::string::npos && isIdentifier(t.substr(0, t.find('(')))) {
+            std::string args = t.substr(t.find('(') + 1);
+            args.pop_back();
+            std::stringstream list(args);
+            std::string arg;
+            while (std::getline(list, arg, ',')) {
+                read(Trim(arg));
+            }
+        }
+        for (size_t k = 0; k < t.size();) {
+            if (std::isalpha((unsigned char)t[k]) || t[k] == '_') {
+                size_t end = k;
+                while (end < t.size() && (std::isalnum((unsigned char)t[end]) || t[end] == '_')) {
+                    end++;
+                }
+                mentions[t.substr(k, end - k)]++;
+                k = end;
+            }
+            else if (std::isdigit((unsigned char)t[k])) {
+                while (k < t.size() && (std::isalnum((unsigned char)t[k]) || t[k] == '_')) {
+                    k++;
+                }
+            } else {
+                k++;
+            }
+        }
+    }
+    std::unordered_map<std::string, unsigned long long> constants;
+    for (const auto& entry : declarations) {
+        if (entry.second == 1 && mentions[entry.first] == reads[entry.first]) {
+            constants[entry.first] = declared[entry.first];
+        }
+    }
+    // Pass 2: rewrite. A literal goes where every back end takes it as an immediate: AArch64
+    // adds and subtracts up to 4095 and moves up to 65535; larger values stay in the variable
+    // or go through an expression statement, which loads any 64-bit value.
+    long long propagated = 0;
+    long long folded = 0;
+    long long branches = 0;
+    auto constant = [&](const std::string& name, unsigned long long& value) {
+        auto it = constants.find(name);
+        if (it == constants.end()) {
+            return false;
+        }
+        value = it->second;
+        return true;
+    };
+    auto immediate = [](unsigned long long value, const std::string& op) {
+        return value <= ((op == " += " || op == " -= ") ? 4095ULL : 65535ULL);
+    };
+    std::string out = "";
+    std::vector<int> dropEnds;
+    for (size_t i = 0; i < lines.size(); i++) {
+        const std::string& line = lines[i];
+        std::string t = Trim(line);
+        std::string lower = StrLower(t);
+        std::string indent = line.substr(0, std::min(line.size(), line.find_first_not_of(" \t")));
+        int ifLevel = blockLevel(lower, "if", false);
+        int endLevel = std::max(blockLevel(lower, "ifend", true), blockLevel(lower, "endif", true));
+        std::string op = assignOp(t);
+        if (endLevel != 0 && !dropEnds.empty() && dropEnds.back() == endLevel) {
+            dropEnds.pop_back();
+            continue;
+        }
+        if (t.compare(0, marker.size(), marker) == 0) {
+            std::vector<std::string> tokens = split(t.substr(marker.size()));
+            for (size_t k = 2; k < tokens.size(); k += 2) {
+                unsigned long long value = 0;
+                if (constant(tokens[k], value)) {
+                    tokens[k] = std::to_string(value);
+                    propagated++;
+                }
+            }
+            unsigned long long acc = 0;
+            unsigned long long operand = 0;
+            while (tokens.size() >= 5 && literal(tokens[2], acc) && literal(tokens[4], operand)) {
+                const std::string& o = tokens[3];
+                if ((o == "//" || o == "%") && operand == 0) {
+                    break;
+                }
+                if (o == "+") acc += operand;
+                else if (o == "-") acc -= operand;
+                else if (o == "*") acc *= operand;
+                else if (o == "//") acc /= operand;
+                else if (o == "%") acc %= operand;
+                else if (o == "<<") acc <<= (operand & 63);
+                else if (o == ">>") acc >>= (operand & 63);
+                else if (o == "&") acc &= operand;
+                else if (o == "|") acc |= operand;
+                else if (o == "^") acc ^= operand;
+                else break;
+                tokens[2] = std::to_string(acc);
+                tokens.erase(tokens.begin() + 3, tokens.begin() + 5);
+                folded++;
+            }
+            std::string plainOp = tokens.size() >= 2 ? " " + tokens[1] + " " : "";
+            if (tokens.size() == 3 && tokens[0] != "rax" && literal(tokens[2], acc) && immediate(acc, plainOp)) {
+                out += indent + tokens[0] + plainOp + tokens[2] + "\n";
+            } else {
+                std::string joined = "";
+                for (const std::string& token : tokens) {
+                    joined += " " + token;
+                }
+                out += indent + Trim(marker) + joined + "\n";
+            }
+            continue;
+        }
+        if (loopCount(t) != "") {
+            unsigned long long value = 0;
+            if (constant(loopCount(t), value) && immediate(value, "")) {
+                out += indent + Trim(t.substr(0, t.find(','))) + ", " + std::to_string(value) + "\n";
+                propagated++;
+                continue;
+            }
+        }
+        else if (ifLevel != 0 && t.back() == ')') {
+            std::string head = t.substr(0, t.find('(') + 1);
+            std::string condition = t.substr(t.find('(') + 1);
+            condition.pop_back();
+            std::string cmp = compareOp(condition);
+            if (cmp != "") {
+                std::string left = Trim(condition.substr(0, condition.find(cmp)));
+                std::string right = Trim(condition.substr(condition.find(cmp) + cmp.size()));
+                unsigned long long l = 0;
+                unsigned long long r = 0;
+                bool leftKnown = literal(left, l) || constant(left, l);
+                bool rightKnown = literal(right, r) || constant(right, r);
+                if (leftKnown && rightKnown) {
+                    long long a = (long long)l;
+                    long long b = (long long)r;
+                    bool taken = cmp == " = " ? a == b : cmp == " != " ? a != b : cmp == " > " ? a > b : cmp == " < " ? a < b : cmp == " >= " ? a >= b : a <= b;
+                    // A label inside the block may be jumped to from outside, so such a block stays.
+                    size_t end = i + 1;
+                    bool hasLabel = false;
+                    for (; end < lines.size(); end++) {
+                        std::string inner = StrLower(Trim(lines[end]));
+                        if (std::max(blockLevel(inner, "ifend", true), blockLevel(inner, "endif", true)) == ifLevel) {
+                            break;
                         }
-                        break;
-                    } else {
-                        str6 = str1;
+                        hasLabel = hasLabel || inner.compare(0, 5, "togo ") == 0;
+                    }
+                    if (taken) {
+                        dropEnds.push_back(ifLevel);
+                        branches++;
+                        continue;
+                    }
+                    if (!hasLabel && end < lines.size()) {
+                        i = end;
+                        branches++;
+                        continue;
                     }
                 }
-                out += str6 + Chr(10);
-                //::::::::::::::::::::::
-                //::::::::::::::::::::::
-                //::::::::::::::::::::::
-                //::::::::::::::::::::::
-                //::::::::::::::::::::::
-                //::::::::::::::::::::::
+                // The back ends compare a variable with a literal, not the other way round.
+                else if (leftKnown && immediate(l, "") && (right == "rax" || right == "A_Index" || isIdentifier(right))) {
+                    std::string mirrored = cmp == " > " ? " < " : cmp == " < " ? " > " : cmp == " >= " ? " <= " : cmp == " <= " ? " >= " : cmp;
+                    out += indent + head + right + mirrored + std::to_string(l) + ")\n";
+                    propagated++;
+                    continue;
+                }
+                else if (rightKnown && !literal(right, r) && immediate(r, "")) {
+                    out += indent + head + left + cmp + std::to_string(r) + ")\n";
+                    propagated++;
+                    continue;
+                }
             }
-            else if (is_in_main == 1) {
-                // in main
-                str1 = "";
-                str2 = "";
-                str3 = "";
-                str4 = "";
-                str5 = "";
-                str6 = "";
-                str7 = "";
-                str11 = A_LoopField36;
-                if (SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "arr " || SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "int ") {
-                    if (InStr(A_LoopField36, " := ")) {
-                        str2 = Trim(StrSplit(A_LoopField36, ":=", 1));
-                        str3 = Trim(StrSplit(A_LoopField36, " ", 2));
-                    } else {
-                        str2 = Trim(A_LoopField36);
-                        str3 = Trim(StrSplit(A_LoopField36, " ", 2));
-                    }
-                    HTVM_Append(main_vars_and_arrs, str3);
+        }
+        else if (t.find(".index ") != std::string::npos) {
+            unsigned long long value = 0;
+            std::string index = Trim(t.substr(t.find(".index ") + 7));
+            if (constant(index, value) && immediate(value, "")) {
+                out += indent + t.substr(0, t.find(".index ") + 7) + std::to_string(value) + "\n";
+                propagated++;
+                continue;
+            }
+        }
+        else if (t.find(".reserve ") != std::string::npos) {
+            // Every back end loads the count with a full 64-bit move, so any value goes in.
+            unsigned long long value = 0;
+            if (constant(Trim(t.substr(t.find(".reserve ") + 9)), value)) {
+                out += indent + t.substr(0, t.find(".reserve ") + 9) + std::to_string(value) + "\n";
+                propagated++;
+                continue;
+            }
+        }
+        else if (op != "" && lower.compare(0, 4, "int ") != 0) {
+            unsigned long long value = 0;
+            std::string dest = Trim(t.substr(0, t.find(op)));
+            if (constant(Trim(t.substr(t.find(op) + op.size())), value)) {
+                if (dest != "rax" && immediate(value, op)) {
+                    out += indent + dest + op + std::to_string(value) + "\n";
+                } else {
+                    out += indent + marker + dest + op + std::to_string(value) + "\n";
                 }
-                for (int A_Index47 = 0; A_Index47 < HTVM_Size(main_vars_and_arrs); A_Index47++) {
-                    str11 = RegExReplace(str11, "\\b" + main_vars_and_arrs[A_Index47] + "\\b", "__HTLL_mlocal_" + main_vars_and_arrs[A_Index47]);
+                propagated++;
+                continue;
+            }
+        }
+        out += line + "\n";
+    }
+    HTLL_count("constant propagation uses", propagated);
+    HTLL_count("constant propagation folds", folded);
+    HTLL_count("constant propagation branches", branches);
+    if (!out.empty()) {
+        out.pop_back();
+    }
+    return out;
+}
+// "func noinline name(...)" keeps name out of the inliner. The word is taken off the func line
+// before the functions are lowered, at every -O level, and the name goes into this set.
+thread_local std::unordered_set<std::string> HTLL_noinlineFuncs;
+std::string HTLL_takeNoinline(const std::string& code) {
+    HTLL_noinlineFuncs.clear();
+    if (code.find("noinline") == std::string::npos) {
+        return code;
+    }
+    std::string out = "";
+    size_t start = 0;
+    while (start <= code.size()) {
+        size_t end = code.find('\n', start);
+        if (end == std::string::npos) {
+            end = code.size();
+        }
+        std::string line = code.substr(start, end - start);
+        std::string t = Trim(line);
+        size_t paren = t.find('(');
+        if (StrLower(t.substr(0, 5)) == "func " && paren != std::string::npos) {
+            std::vector<std::string> words;
+            std::stringstream head(t.substr(5, paren - 5));
+            std::string word;
+            bool annotated = false;
+            while (head >> word) {
+                if (StrLower(word) == "noinline") {
+                    annotated = true;
+                } else {
+                    words.push_back(word);
                 }
-                str6 = str11;
-                for (int A_Index48 = 0; A_Index48 < HTVM_Size(funcs_and_what_types); A_Index48++) {
-                    if (InStr(A_LoopField36, ")") && RegExMatch(A_LoopField36, "\\b" + StrSplit(funcs_and_what_types[A_Index48], "|", 2) + "\\b")) {
-                        if (InStr(A_LoopField36, " := ")) {
-                            if (StrSplit(funcs_and_what_types[A_Index48], "|", 1) == "no") {
-                                throw std::runtime_error("ERROR You cannot use the assignment operator and save the function " + StrSplit(funcs_and_what_types[A_Index48], "|", 2) + " please use rax.");
-                            }
-                            // for arrays
-                            // for arrays
-                            str1 = Trim(StrSplit(str6, " := ", 1));
-                            str2 = Trim(StrSplit(str6, " := ", 2));
-                            str3 = Trim(StrSplit(str2, "(", 1));
-                            str4 = Trim(StrSplit(str2, "(", 2));
-                            str4 = StringTrimRight(str4, 1);
-                            // str1 = arrName
-                            // str2 WE DONT CARE
-                            // str3 = func name
-                            // str4 = all params if any
-                            if (Trim(str4) == "") {
-                                // no param handle here
-                                str5 = StrSplit(funcs_and_what_types[A_Index48], "|", 2) + "()" + Chr(10);
-                                str5 += str1 + ".copy __HTLL_ret_" + StrSplit(funcs_and_what_types[A_Index48], "|", 2) + Chr(10);
-                            } else {
-                                // there are params so handle here
-                                str7 = "";
-                                str5 = "";
-                                str8 = StrSplit(funcs_and_what_types[A_Index48], "|", 3);
-                                AAIndex = A_Index48;
-                                std::vector<std::string> items49 = LoopParseFunc(str4, ",");
-                                for (size_t A_Index49 = 0; A_Index49 < items49.size(); A_Index49++) {
-                                    std::string A_LoopField49 = items49[A_Index49 - 0];
-                                    ALoopField = Trim(A_LoopField49);
-                                    AIndex = A_Index49;
-                                    it_macth_arr_name = 0;
-                                    std::vector<std::string> items50 = LoopParseFunc(str8, ",");
-                                    for (size_t A_Index50 = 0; A_Index50 < items50.size(); A_Index50++) {
-                                        std::string A_LoopField50 = items50[A_Index50 - 0];
-                                        if (Trim(A_LoopField50) != "__000_NOT-ARRAY_000__" && AIndex == A_Index50) {
-                                            ALoopField = Trim(A_LoopField50);
-                                            if (Trim(ALoopField) != "") {
-                                                it_macth_arr_name = 1;
-                                            }
-                                            break;
-                                        }
-                                    }
-                                    if (it_macth_arr_name == 1) {
-                                        if (InStr(A_LoopField49, "__HTLL_mlocal_")) {
-                                            str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy " + Trim(A_LoopField49) + Chr(10);
-                                        } else {
-                                            str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy __HTLL_mlocal_" + Trim(A_LoopField49) + Chr(10);
-                                        }
-                                    } else {
-                                        if (RegExMatch(Trim(A_LoopField49), "^\\d+$")) {
-                                            str7 += Trim(A_LoopField49) + ", ";
-                                        } else {
-                                            if (InStr(A_LoopField49, "__HTLL_mlocal_")) {
-                                                str7 += Trim(A_LoopField49) + ", ";
-                                            } else {
-                                                str7 += "__HTLL_mlocal_" + Trim(A_LoopField49) + ", ";
-                                            }
-                                        }
-                                    }
-                                }
-                                str5 += StrSplit(funcs_and_what_types[A_Index48], "|", 2) + "(" + StringTrimRight(Trim(str7), 1) + ")" + Chr(10);
-                                str5 += str1 + ".copy __HTLL_ret_" + StrSplit(funcs_and_what_types[A_Index48], "|", 2) + Chr(10);
-                                // there are params so handle here
-                            }
-                            str6 = str5;
-                            // for arrays
-                            // for arrays
-                        } else {
-                            if (StrSplit(funcs_and_what_types[A_Index48], "|", 1) == "yes") {
-                                throw std::runtime_error("ERROR You must use the assignment operator and save the function " + StrSplit(funcs_and_what_types[A_Index48], "|", 2) + " to an array.");
-                            }
-                            // for not arays returned
-                            // for not arays returned
-                            str1 = Trim(A_LoopField36);
-                            str2 = str1;
-                            str3 = Trim(StrSplit(str2, "(", 1));
-                            str4 = Trim(StrSplit(str2, "(", 2));
-                            str4 = StringTrimRight(str4, 1);
-                            // str2 WE DONT CARE
-                            // str3 = func name
-                            // str4 = all params if any
-                            if (Trim(str4) == "") {
-                                // no param handle here
-                                str5 = StrSplit(funcs_and_what_types[A_Index48], "|", 2) + "()" + Chr(10);
-                            } else {
-                                // there are params so handle here
-                                str7 = "";
-                                str5 = "";
-                                str8 = StrSplit(funcs_and_what_types[A_Index48], "|", 3);
-                                AAIndex = A_Index48;
-                                std::vector<std::string> items51 = LoopParseFunc(str4, ",");
-                                for (size_t A_Index51 = 0; A_Index51 < items51.size(); A_Index51++) {
-                                    std::string A_LoopField51 = items51[A_Index51 - 0];
-                                    ALoopField = Trim(A_LoopField51);
-                                    AIndex = A_Index51;
-                                    it_macth_arr_name = 0;
-                                    std::vector<std::string> items52 = LoopParseFunc(str8, ",");
-                                    for (size_t A_Index52 = 0; A_Index52 < items52.size(); A_Index52++) {
-                                        std::string A_LoopField52 = items52[A_Index52 - 0];
-                                        if (Trim(A_LoopField52) != "__000_NOT-ARRAY_000__" && AIndex == A_Index52) {
-                                            ALoopField = Trim(A_LoopField52);
-                                            if (Trim(ALoopField) != "") {
-                                                it_macth_arr_name = 1;
-                                            }
-                                            break;
-                                        }
-                                    }
-                                    if (it_macth_arr_name == 1) {
-                                        if (InStr(A_LoopField51, "__HTLL_mlocal_")) {
-                                            str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy " + Trim(A_LoopField51) + Chr(10);
-                                        } else {
-                                            str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy __HTLL_mlocal_" + Trim(A_LoopField51) + Chr(10);
-                                        }
-                                    } else {
-                                        if (RegExMatch(Trim(A_LoopField51), "^\\d+$")) {
-                                            str7 += Trim(A_LoopField51) + ", ";
-                                        } else {
-                                            if (InStr(A_LoopField51, "__HTLL_mlocal_")) {
-                                                str7 += Trim(A_LoopField51) + ", ";
-                                            } else {
-                                                str7 += "__HTLL_mlocal_" + Trim(A_LoopField51) + ", ";
-                                            }
-                                        }
-                                    }
-                                }
-                                str5 += StrSplit(funcs_and_what_types[A_Index48], "|", 2) + "(" + StringTrimRight(Trim(str7), 1) + ")" + Chr(10);
-                                // there are params so handle here
-                            }
-                            str6 = str5;
-                            // for not arays returned
-                            // for not arays returned
-                        }
-                        break;
-                    } else {
-                        str6 = str11;
-                    }
-                }
-                out += str6 + Chr(10);
-            } else {
-                // get all array names
-                if (SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "arr ") {
-                    HTVM_Append(arrays_from_global_scope, Trim(StringTrimLeft(Trim(A_LoopField36), 4)));
+            }
+            if (annotated && !words.empty()) {
+                HTLL_noinlineFuncs.insert(words.back());
+                line = line.substr(0, line.find_first_not_of(" \t")) + "func";
+                for (const std::string& w : words) {
+                    line += " " + w;
                 }
-                out += A_LoopField36 + Chr(10);
+                line += t.substr(paren);
             }
         }
+        out += line;
+        if (end < code.size()) {
+            out += "\n";
+        }
+        start = end + 1;
     }
-    code = StringTrimRight(out, 1);
-    out = "";
-    int doWeReturnARR = 0;
-    std::vector<std::string> items53 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index53 = 0; A_Index53 < items53.size(); A_Index53++) {
-        std::string A_LoopField53 = items53[A_Index53 - 0];
-        if (SubStr(StrLower(Trim(A_LoopField53)), 1, 5) == "func ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField53), 5));
-            str2 = "";
-            str3 = "";
-            str4 = "";
-            str6 = "";
-            doWeReturnARR = 0;
-            str2 = Trim(StrSplit(str1, "(", 1));
-            str4 = Trim(StrSplit(str1, "(", 2));
-            str4 = StringTrimRight(str4, 1);
-            if (InStr(str2, " ")) {
-                // is an array func return
-                // get name of func
-                str3 = Trim(StrSplit(str2, " ", 2));
+    return out;
+}
+// Function inlining over the lowered statements, run at -O1 before constant propagation.
+// A function is inlined when it calls no other function (so its body cannot run again
+// before an inlined copy is done with its parameters), has no inline assembly and no return
+// inside a loop, and its body has at most HTLL_inlineBudget statements, or up to four times
+// that when it is called from one place only. --inline-budget=N sets the budget and 0 turns
+// inlining off. At a call, each int parameter becomes the global __HTLL_inline_<func>_<param>
+// and is assigned its argument; array parameters and array returns already go through the
+// __HTLL_param_ and __HTLL_ret_ globals and stay as they are. Locals keep their names, as
+// they are static either way, and their declarations move to the top of the program. A return
+// puts its value in rax and jumps to the end of the copy; labels get the copy's number, and
+// loop and if levels are shifted by the depth of the call. The function itself is still
+// emitted; dead-code elimination drops it once nothing calls it.
+int HTLL_inlineBudget = 12;
+std::string HTLL_inlineFunctions(const std::string& code) {
+    static const std::string marker = "___HTLL_expr___ ";
+    auto isIdentifier = [](const std::string& s) {
+        if (s.empty() || !(std::isalpha((unsigned char)s[0]) || s[0] == '_')) {
+            return false;
+        }
+        for (char c : s) {
+            if (!(std::isalnum((unsigned char)c) || c == '_')) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto isNumber = [](const std::string& s) {
+        return !s.empty() && s.find_first_not_of("0123456789") == std::string::npos;
+    };
+    // "arr x", "int x" and "int x := 5" only reserve storage and can move anywhere.
+    auto isDeclaration = [&](const std::string& t) {
+        std::string lower = StrLower(t);
+        if (lower.compare(0, 4, "arr ") == 0) {
+            return true;
+        }
+        if (lower.compare(0, 4, "int ") != 0) {
+            return false;
+        }
+        std::string rest = Trim(t.substr(4));
+        size_t assign = rest.find(" := ");
+        return assign == std::string::npos ? rest.find(' ') == std::string::npos : isNumber(Trim(rest.substr(assign + 4)));
+    };
+    // "loop3, n" -> ("loop", 3, ", n"); "endif" -> ("endif", 1, ""); anything else -> level 0.
+    struct Block {
+        std::string word;
+        int level;
+        std::string rest;
+        bool opens;
+        bool isLoop;
+    };
+    auto block = [](const std::string& t) {
+        static const char* const words[] = {"loopend", "endloop", "loop", "continue", "break", "ifend", "endif", "if"};
+        std::string lower = StrLower(t);
+        for (const char* w : words) {
+            std::string word = w;
+            if (lower.compare(0, word.size(), word) != 0) {
+                continue;
+            }
+            size_t k = word.size();
+            int level = 0;
+            while (k < lower.size() && lower[k] >= '0' && lower[k] <= '9' && level < 100000) {
+                level = level * 10 + (lower[k] - '0');
+                k++;
+            }
+            std::string rest = t.substr(k);
+            bool ok = word == "loop" ? rest.compare(0, 1, ",") == 0 : word == "if" ? rest.compare(0, 2, " (") == 0 : rest.empty();
+            if (ok) {
+                return Block{t.substr(0, word.size()), level == 0 ? 1 : level, rest, word == "loop" || word == "if", word.find("loop") != std::string::npos || word == "continue" || word == "break"};
+            }
+        }
+        return Block{"", 0, "", false, false};
+    };
+    auto callee = [&](const std::string& t) -> std::string {
+        size_t paren = t.find('(');
+        if (paren == std::string::npos || t.back() != ')' || !isIdentifier(t.substr(0, paren)) || StrLower(t.substr(0, paren)) == "print") {
+            return "";
+        }
+        return t.substr(0, paren);
+    };
+    auto splitArgs = [](const std::string& t) {
+        std::vector<std::string> args;
+        std::string inside = t.substr(t.find('(') + 1);
+        inside.pop_back();
+        if (Trim(inside) == "") {
+            return args;
+        }
+        std::stringstream list(inside);
+        std::string arg;
+        while (std::getline(list, arg, ',')) {
+            args.push_back(Trim(arg));
+        }
+        return args;
+    };
+    // Replaces whole identifiers found in names; a method name after '.' is left alone.
+    auto rename = [](const std::string& t, const std::unordered_map<std::string, std::string>& names) {
+        std::string out = "";
+        for (size_t k = 0; k < t.size();) {
+            if (std::isalpha((unsigned char)t[k]) || t[k] == '_') {
+                size_t end = k;
+                while (end < t.size() && (std::isalnum((unsigned char)t[end]) || t[end] == '_')) {
+                    end++;
+                }
+                std::string word = t.substr(k, end - k);
+                auto it = names.find(word);
+                out += it != names.end() && (k == 0 || t[k - 1] != '.') ? it->second : word;
+                k = end;
+            }
+            else if (std::isdigit((unsigned char)t[k])) {
+                size_t end = k;
+                while (end < t.size() && (std::isalnum((unsigned char)t[end]) || t[end] == '_')) {
+                    end++;
+                }
+                out += t.substr(k, end - k);
+                k = end;
             } else {
-                // get name of func
-                str3 = Trim(str2);
+                out += t[k];
+                k++;
+            }
+        }
+        return out;
+    };
+    struct Func {
+        std::vector<std::string> params;
+        size_t first;
+        size_t last;
+        int size;
+        int calls;
+        bool eligible;
+        bool returnsArr;
+        std::unordered_set<std::string> words;
+    };
+    std::vector<std::string> lines;
+    std::stringstream input(code);
+    std::string raw;
+    while (std::getline(input, raw)) {
+        if (!raw.empty() && raw.back() == '\r') {
+            raw.pop_back();
+        }
+        lines.push_back(raw);
+    }
+    // Pass 1: the functions, their size and whether they can be inlined, then the calls.
+    std::unordered_map<std::string, Func> funcs;
+    for (size_t i = 0; i < lines.size(); i++) {
+        std::string t = Trim(lines[i]);
+        if (StrLower(t.substr(0, 5)) != "func " || t.find('(') == std::string::npos || t.back() != ')') {
+            continue;
+        }
+        std::string name = Trim(t.substr(5, t.find('(') - 5));
+        Func f{splitArgs(t), i, i, 0, 0, isIdentifier(name) && HTLL_noinlineFuncs.count(name) == 0, false, {}};
+        int loopDepth = 0;
+        size_t k = i + 1;
+        for (; k < lines.size(); k++) {
+            std::string inner = Trim(lines[k]);
+            std::string lower = StrLower(inner);
+            if (lower == "funcend" || lower == "endfunc") {
+                break;
             }
-            for (int A_Index54 = 0; A_Index54 < HTVM_Size(funcs_and_what_types); A_Index54++) {
-                if (StrSplit(funcs_and_what_types[A_Index54], "|", 2) == str3) {
-                    if (StrSplit(funcs_and_what_types[A_Index54], "|", 1) == "yes") {
-                        doWeReturnARR = 1;
-                    } else {
-                        doWeReturnARR = 0;
-                    }
-                    break;
-                }
+            Block b = block(inner);
+            if (b.level != 0 && b.isLoop && b.word != "continue" && b.word != "break") {
+                loopDepth = b.opens ? b.level : b.level - 1;
             }
-            out += A_LoopField53 + Chr(10);
+            // nint and compound int declarations do more than declare, so they stay out.
+            bool intLine = lower.compare(0, 4, "int ") == 0;
+            bool plainInt = intLine && (Trim(inner.substr(4)).find(' ') == std::string::npos || inner.find(" := ") != std::string::npos);
+            if (lower.compare(0, 5, "func ") == 0 || lower.compare(0, 5, "nint ") == 0 || (intLine && !plainInt) || inner.find("programmingBlock_") != std::string::npos || callee(inner) != "" || ((lower == "return" || lower.compare(0, 7, "return ") == 0) && loopDepth > 0)) {
+                f.eligible = false;
+            }
+            if (inner != "" && !isDeclaration(inner)) {
+                f.size++;
+            }
+            std::vector<std::string> words;
+            HTLL_identifiersOf(inner, words);
+            f.words.insert(words.begin(), words.end());
         }
-        else if (SubStr(StrLower(Trim(A_LoopField53)), 1, 7) == "return " && isFuncRetARR(A_LoopField53) && doWeReturnARR == 1) {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField53), 21 + StrLen(Trim(str3))));
-            str2 = "__HTLL_ret_" + str3 + ".copy __HTLL_param_" + str3 + "_" + str1 + "";
-            out += str2 + Chr(10);
-            out += "return 0" + Chr(10);
+        f.last = k;
+        for (const std::string& p : f.params) {
+            f.eligible = f.eligible && isIdentifier(p);
         }
-        else if (SubStr(StrLower(Trim(A_LoopField53)), 1, 7) == "return " && isFuncRetARR2(A_LoopField53) && doWeReturnARR == 1) {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField53), 7 ));
-            str2 = "__HTLL_ret_" + str3 + ".copy " + str1;
-            out += str2 + Chr(10);
-            out += "return 0" + Chr(10);
+        funcs[name] = f;
+        i = k;
+    }
+    if (funcs.empty() || HTLL_inlineBudget <= 0) {
+        return code;
+    }
+    for (const std::string& line : lines) {
+        std::string t = Trim(line);
+        auto it = funcs.find(callee(t));
+        if (it != funcs.end()) {
+            it->second.calls++;
         }
-        else if (SubStr(StrLower(Trim(A_LoopField53)), 1, 7) == "return " && isFuncRetARR3(A_LoopField53, arrays_from_global_scope) && doWeReturnARR == 1) {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField53), 7 ));
-            str2 = "__HTLL_ret_" + str3 + ".copy " + str1;
-            out += str2 + Chr(10);
-            out += "return 0" + Chr(10);
-        } else {
-            out += A_LoopField53 + Chr(10);
+        if (t.compare(0, 15, "arr __HTLL_ret_") == 0) {
+            auto ret = funcs.find(t.substr(15));
+            if (ret != funcs.end()) {
+                ret->second.returnsArr = true;
+            }
         }
     }
-    out = RegExReplace(out, "__HTLL_[^ \\n\\],]*?___HTLL", "__HTLL");
-    code = StringTrimRight(out, 1);
-    out = "";
-    out = restoreStrings(code);
-    return out;
-}
-//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-bool isNint(std::string name) {
-    for (int A_Index55 = 0; A_Index55 < HTVM_Size(nintArr); A_Index55++) {
-        if (Trim(name) == Trim(nintArr[A_Index55])) {
-            return true;
+    for (auto& entry : funcs) {
+        Func& f = entry.second;
+        f.eligible = f.eligible && f.calls > 0 && (f.size <= HTLL_inlineBudget || (f.calls == 1 && f.size <= 4 * HTLL_inlineBudget));
+    }
+    // The parameter globals and the declarations of the functions that get copied go to the
+    // top, where Oryx runs them once before the first function; the back ends only reserve
+    // storage for them wherever they are.
+    std::string hoisted = "";
+    for (size_t i = 0; i < lines.size(); i++) {
+        std::string t = Trim(lines[i]);
+        if (StrLower(t.substr(0, 5)) != "func " || t.find('(') == std::string::npos) {
+            continue;
+        }
+        auto self = funcs.find(Trim(t.substr(5, t.find('(') - 5)));
+        if (self == funcs.end() || !self->second.eligible || self->second.first != i) {
+            continue;
+        }
+        for (const std::string& p : self->second.params) {
+            hoisted += "int __HTLL_inline_" + self->first + "_" + p + " := 0\n";
+        }
+        for (size_t k = i + 1; k < self->second.last; k++) {
+            if (isDeclaration(Trim(lines[k]))) {
+                hoisted += Trim(lines[k]) + "\n";
+            }
         }
     }
-    return false;
+    // Pass 2: copy the bodies in.
+    long long inlined = 0;
+    int copies = 0;
+    int loopDepth = 0;
+    int ifDepth = 0;
+    std::vector<std::string> callerParams;
+    bool inCopied = false;
+    std::string out = hoisted;
+    for (size_t i = 0; i < lines.size(); i++) {
+        const std::string& line = lines[i];
+        std::string t = Trim(line);
+        std::string indent = line.substr(0, std::min(line.size(), line.find_first_not_of(" \t")));
+        Block b = block(t);
+        if (b.level != 0 && b.word != "continue" && b.word != "break") {
+            int depth = b.opens ? b.level : b.level - 1;
+            (b.isLoop ? loopDepth : ifDepth) = depth;
+        }
+        if (StrLower(t.substr(0, 5)) == "func ") {
+            loopDepth = 0;
+            ifDepth = 0;
+            callerParams = t.find('(') != std::string::npos && t.back() == ')' ? splitArgs(t) : std::vector<std::string>();
+            auto self = funcs.find(Trim(t.substr(5, t.find('(') == std::string::npos ? 0 : t.find('(') - 5)));
+            inCopied = self != funcs.end() && self->second.eligible && self->second.first == i;
+        }
+        else if (StrLower(t) == "funcend" || StrLower(t) == "endfunc") {
+            inCopied = false;
+        }
+        else if (inCopied && isDeclaration(t)) {
+            continue;
+        }
+        auto it = funcs.find(callee(t));
+        std::vector<std::string> args = it != funcs.end() ? splitArgs(t) : std::vector<std::string>();
+        bool inlinable = it != funcs.end() && it->second.eligible && args.size() == it->second.params.size() && (i < it->second.first || i > it->second.last);
+        for (const std::string& arg : args) {
+            inlinable = inlinable && (isNumber(arg) || isIdentifier(arg));
+        }
+        // The back ends turn a parameter of the calling function into a stack slot wherever
+        // its name stands, so a body that uses the same name elsewhere is not copied there.
+        for (const std::string& p : callerParams) {
+            inlinable = inlinable && (it->second.words.count(p) == 0 || std::find(it->second.params.begin(), it->second.params.end(), p) != it->second.params.end());
+        }
+        if (!inlinable) {
+            out += line + "\n";
+            continue;
+        }
+        const std::string& name = it->first;
+        const Func& f = it->second;
+        copies++;
+        inlined++;
+        std::string suffix = "HTLL_inline" + std::to_string(copies);
+        std::unordered_map<std::string, std::string> names;
+        std::unordered_map<std::string, std::string> labels;
+        for (size_t p = 0; p < f.params.size(); p++) {
+            names[f.params[p]] = "__HTLL_inline_" + name + "_" + f.params[p];
+            out += indent + marker + names[f.params[p]] + " := " + args[p] + "\n";
+        }
+        for (size_t k = f.first + 1; k < f.last; k++) {
+            std::string inner = Trim(lines[k]);
+            if (StrLower(inner).compare(0, 5, "togo ") == 0) {
+                std::string label = Trim(inner.substr(5));
+                labels[label] = suffix + "_" + label;
+            }
+        }
+        size_t lastStatement = f.first;
+        for (size_t k = f.first + 1; k < f.last; k++) {
+            if (Trim(lines[k]) != "") {
+                lastStatement = k;
+            }
+        }
+        bool jumped = false;
+        for (size_t k = f.first + 1; k < f.last; k++) {
+            std::string inner = Trim(lines[k]);
+            std::string lower = StrLower(inner);
+            if (inner == "" || isDeclaration(inner)) {
+                continue;
+            }
+            if (lower.compare(0, 4, "int ") == 0) {
+                inner = Trim(inner.substr(4));
+            }
+            if (lower == "return" || lower.compare(0, 7, "return ") == 0) {
+                std::string value = Trim(inner.substr(6));
+                if (value != "" && value != "rax" && !f.returnsArr) {
+                    out += indent + marker + "rax := " + rename(value, names) + "\n";
+                }
+                if (k != lastStatement) {
+                    out += indent + "goto " + suffix + "_end\n";
+                    jumped = true;
+                }
+                continue;
+            }
+            Block inside = block(inner);
+            if (lower.compare(0, 5, "goto ") == 0 || lower.compare(0, 5, "togo ") == 0) {
+                inner = rename(inner, labels);
+            }
+            else if (inside.level != 0) {
+                int level = inside.level + (inside.isLoop ? loopDepth : ifDepth);
+                inner = inside.word + (level > 1 ? std::to_string(level) : "") + rename(inside.rest, names);
+            } else {
+                inner = rename(inner, names);
+            }
+            out += indent + inner + "\n";
+        }
+        if (jumped) {
+            out += indent + "togo " + suffix + "_end\n";
+        }
+    }
+    HTLL_count("inlined calls", inlined);
+    if (!out.empty()) {
+        out.pop_back();
+    }
+    return out;
 }
-std::string compiler(std::string code) {
-    code = HTLL_Lang(code);
-    std::string out = "";
-    std::vector<std::string> oryx_param_map;
-    std::string main_syntax = "";
-    if (is_arm == 1) {
-        if (RegExMatch(code, "\\bargs_array\\b")) {
-            main_syntax = "_start:" + Chr(10);
-            // FIXED: Removed parens and comments that confuse the parser
-            main_syntax += "    ldr x19, [sp]" + Chr(10);
-            main_syntax += "    stp x29, x30, [sp, #-32]!" + Chr(10);
-            main_syntax += "    mov x29, sp" + Chr(10);
-            main_syntax += "    ldr x0, =args_array" + Chr(10);
-            main_syntax += "    bl array_clear" + Chr(10);
-            main_syntax += "    add x20, sp, #40" + Chr(10);
-            main_syntax += "    mov x21, #1" + Chr(10);
-            main_syntax += ".arg_loop:" + Chr(10);
-            main_syntax += "    cmp x21, x19" + Chr(10);
-            main_syntax += "    b.ge .args_done" + Chr(10);
-            // Load argv[x21]
-            main_syntax += "    ldr x22, [x20, x21, lsl #3]" + Chr(10);
-            main_syntax += ".unpack_byte_loop:" + Chr(10);
-            main_syntax += "    ldrb w1, [x22], #1" + Chr(10);
-            main_syntax += "    cmp w1, #0" + Chr(10);
-            main_syntax += "    b.eq .unpack_byte_done" + Chr(10);
-            main_syntax += "    ldr x0, =args_array" + Chr(10);
-            main_syntax += "    bl array_append" + Chr(10);
-            main_syntax += "    b .unpack_byte_loop" + Chr(10);
-            main_syntax += ".unpack_byte_done:" + Chr(10);
-            main_syntax += "    mov x1, #10" + Chr(10);
-            main_syntax += "    ldr x0, =args_array" + Chr(10);
-            main_syntax += "    bl array_append" + Chr(10);
-            main_syntax += "    add x21, x21, #1" + Chr(10);
-            main_syntax += "    b .arg_loop" + Chr(10);
-            main_syntax += ".args_done:" + Chr(10) + Chr(10);
-        } else {
-            // --- THE FIX IS HERE ---
-            main_syntax = "_start:" + Chr(10);
-            main_syntax += "    stp x29, x30, [sp, #-16]!" + Chr(10);
-            main_syntax += "    mov x29, sp" + Chr(10) + Chr(10);
-        }
+// The array a call passes for the argument arg, given the caller's locals (mangled with
+// local), its array parameters (mangled with param) and the global arrays seen so far.
+// A name that is already mangled is passed as it is.
+std::string HTLL_arrayArgument(const std::string& arg, const std::string& local, const std::vector<std::string>& locals, const std::vector<std::string>& globals, const std::string& param = "", const std::vector<std::string>& params = {}) {
+    if (arg.find("__HTLL_flocal_") != std::string::npos || arg.find("__HTLL_param_") != std::string::npos || arg.find("__HTLL_mlocal_") != std::string::npos) {
+        return arg;
     }
-    else if (is_oryx == 1) {
-        // --- ORYX IR ENTRY ---
-        // Oryx is a VM, so it handles stack alignment automatically.
-        // We just need the entry label to tell the VM where to begin.
-        main_syntax = "_start:" + Chr(10);
-        if (RegExMatch(code, "\\bargs_array\\b")) {
-            // In Oryx IR, we assume the VM environment populates 'args_array'
-            // automatically if it exists, or we add a specific sys-call later.
-            // We don't need manual stack walking code here.
-            main_syntax += "    ; args_array handling" + Chr(10);
+    if (param != "" && std::find(params.begin(), params.end(), param + arg) != params.end()) {
+        return param + arg;
+    }
+    if (std::find(globals.begin(), globals.end(), arg) != globals.end() && std::find(locals.begin(), locals.end(), arg) == locals.end()) {
+        return arg;
+    }
+    return local + arg;
+}
+// Statement kinds of the backend's main loop. Block statements (loop/if, their ends,
+// break and continue) also carry the nesting level written in their keyword.
+enum HTLL_StatementKind {
+    HTLL_STMT_OTHER = 0,
+    HTLL_STMT_ARRADD, HTLL_STMT_INT, HTLL_STMT_NINT, HTLL_STMT_ASSIGN, HTLL_STMT_EXPR, HTLL_STMT_INC, HTLL_STMT_DEC,
+    HTLL_STMT_PRINT, HTLL_STMT_PRINT_RAX_AS_CHAR, HTLL_STMT_CONTINUE, HTLL_STMT_BREAK,
+    HTLL_STMT_LOOP, HTLL_STMT_LOOPEND, HTLL_STMT_IF, HTLL_STMT_IFEND,
+    HTLL_STMT_FUNC, HTLL_STMT_FUNCEND, HTLL_STMT_RETURN_VOID, HTLL_STMT_RETURN, HTLL_STMT_ARR,
+    HTLL_STMT_ARR_ADD, HTLL_STMT_ARR_POP, HTLL_STMT_ARR_CLEAR, HTLL_STMT_ARR_COPY, HTLL_STMT_ARR_BORROW, HTLL_STMT_ARR_SWAP, HTLL_STMT_ARR_RESERVE, HTLL_STMT_ARR_SIZE,
+    HTLL_STMT_ARR_INDEX, HTLL_STMT_ARR_COMPILE, HTLL_STMT_GOTO, HTLL_STMT_TOGO, HTLL_STMT_SLEEP,
+    HTLL_STMT_FILEREAD_ARR, HTLL_STMT_FILEAPPEND_ARR, HTLL_STMT_FILEDELETE_ARR,
+    HTLL_STMT_FILEREAD, HTLL_STMT_FILEAPPEND, HTLL_STMT_FILEDELETE, HTLL_STMT_INPUT, HTLL_STMT_ARR_SET,
+    HTLL_STMT_RAX_INC, HTLL_STMT_RAX_DEC, HTLL_STMT_CALL, HTLL_STMT_COUNT
+};
+// How a rule matches a line: 'p' the line starts with text, 'l' the lowercased line starts
+// with text, 't' the trimmed line is text, 'L' the lowercased trimmed line is text,
+// 's' the line contains text. A '#' in text matches a nesting level (1, 2, ... 10, ...).
+struct HTLL_StatementRule {
+    const char* text;
+    char match;
+    int kind;
+};
+// In the order the main loop used to test them: when several rules match, the first wins.
+static const HTLL_StatementRule HTLL_statementRules[] = {
+    {"___HTLL_expr___ ", 'p', HTLL_STMT_EXPR},
+    {"arradd ", 'p', HTLL_STMT_ARRADD}, {"int ", 'p', HTLL_STMT_INT}, {"nint ", 'p', HTLL_STMT_NINT},
+    {" := ", 's', HTLL_STMT_ASSIGN}, {" += ", 's', HTLL_STMT_ASSIGN}, {" -= ", 's', HTLL_STMT_ASSIGN},
+    {" *= ", 's', HTLL_STMT_ASSIGN}, {" //= ", 's', HTLL_STMT_ASSIGN}, {" %= ", 's', HTLL_STMT_ASSIGN},
+    {" <<= ", 's', HTLL_STMT_ASSIGN}, {" >>= ", 's', HTLL_STMT_ASSIGN}, {" &= ", 's', HTLL_STMT_ASSIGN},
+    {" |= ", 's', HTLL_STMT_ASSIGN}, {" ^= ", 's', HTLL_STMT_ASSIGN},
+    {"++", 's', HTLL_STMT_INC}, {"--", 's', HTLL_STMT_DEC},
+    {"print(", 'p', HTLL_STMT_PRINT}, {"print_rax_as_char", 't', HTLL_STMT_PRINT_RAX_AS_CHAR},
+    {"continue", 'L', HTLL_STMT_CONTINUE}, {"continue#", 'L', HTLL_STMT_CONTINUE},
+    {"break", 'L', HTLL_STMT_BREAK}, {"break#", 'L', HTLL_STMT_BREAK},
+    {"loop, ", 'l', HTLL_STMT_LOOP}, {"loop#, ", 'l', HTLL_STMT_LOOP},
+    {"loopend", 't', HTLL_STMT_LOOPEND}, {"endloop", 't', HTLL_STMT_LOOPEND},
+    {"loopend#", 't', HTLL_STMT_LOOPEND}, {"endloop#", 't', HTLL_STMT_LOOPEND},
+    {"if ", 'l', HTLL_STMT_IF}, {"if# ", 'l', HTLL_STMT_IF},
+    {"ifend", 't', HTLL_STMT_IFEND}, {"endif", 't', HTLL_STMT_IFEND},
+    {"ifend#", 't', HTLL_STMT_IFEND}, {"endif#", 't', HTLL_STMT_IFEND},
+    {"func ", 'l', HTLL_STMT_FUNC}, {"funcend", 't', HTLL_STMT_FUNCEND}, {"endfunc", 't', HTLL_STMT_FUNCEND},
+    {"return", 't', HTLL_STMT_RETURN_VOID}, {"return ", 'l', HTLL_STMT_RETURN}, {"arr ", 'l', HTLL_STMT_ARR},
+    {".add ", 's', HTLL_STMT_ARR_ADD}, {".pop", 's', HTLL_STMT_ARR_POP}, {".clear", 's', HTLL_STMT_ARR_CLEAR},
+    {".copy ", 's', HTLL_STMT_ARR_COPY}, {".borrow ", 's', HTLL_STMT_ARR_BORROW}, {".swap ", 's', HTLL_STMT_ARR_SWAP}, {".reserve ", 's', HTLL_STMT_ARR_RESERVE},
+    {".size", 's', HTLL_STMT_ARR_SIZE}, {".index ", 's', HTLL_STMT_ARR_INDEX},
+    {".compile ", 's', HTLL_STMT_ARR_COMPILE},
+    {"goto ", 'l', HTLL_STMT_GOTO}, {"togo ", 'l', HTLL_STMT_TOGO}, {"sleep, ", 'l', HTLL_STMT_SLEEP},
+    {"fileread_arr ", 'l', HTLL_STMT_FILEREAD_ARR}, {"fileappend_arr ", 'l', HTLL_STMT_FILEAPPEND_ARR},
+    {"filedelete_arr ", 'l', HTLL_STMT_FILEDELETE_ARR}, {"fileread ", 'l', HTLL_STMT_FILEREAD},
+    {"fileappend ", 'l', HTLL_STMT_FILEAPPEND}, {"filedelete ", 'l', HTLL_STMT_FILEDELETE},
+    {"input ", 'p', HTLL_STMT_INPUT}, {".set ", 's', HTLL_STMT_ARR_SET},
+    {"rax++", 't', HTLL_STMT_RAX_INC}, {"rax--", 't', HTLL_STMT_RAX_DEC}
+};
+// The lowercased leading word of s: everything before the first space, ',' or '(', with
+// a trailing nesting level written as '#' so "loop12" and "loop#" land in the same bucket.
+std::string HTLL_statementWord(const std::string& s) {
+    size_t end = s.find_first_of(" ,(");
+    if (end == std::string::npos) {
+        end = s.size();
+    }
+    std::string word = s.substr(0, end);
+    std::transform(word.begin(), word.end(), word.begin(), ::tolower);
+    size_t digits = word.find_last_not_of("0123456789");
+    if (digits != std::string::npos && digits + 1 < word.size()) {
+        word = word.substr(0, digits + 1) + "#";
+    }
+    return word;
+}
+// Matches text against the start of s (or all of s when whole), lowercasing s when lower.
+// A '#' in text matches a level without leading zeros and stores it in level.
+bool HTLL_statementMatch(const char* text, const std::string& s, bool lower, bool whole, int& level) {
+    size_t k = 0;
+    for (; *text; text++) {
+        if (*text == '#') {
+            if (k >= s.size() || s[k] < '1' || s[k] > '9') {
+                return false;
+            }
+            level = 0;
+            while (k < s.size() && s[k] >= '0' && s[k] <= '9' && level < 100000) {
+                level = level * 10 + (s[k] - '0');
+                k++;
+            }
+            continue;
         }
-    } else {
-        // --- YOUR EXISTING X86 CODE - UNCHANGED AND CORRECT ---
-        if (RegExMatch(code, "\\bargs_array\\b")) {
-            main_syntax = Chr(10) + "_start:" + Chr(10) + "push rbp" + Chr(10) + "mov rbp, rsp" + Chr(10) + "and rsp, -16" + Chr(10) + "mov rdi, args_array" + Chr(10) + "call array_clear" + Chr(10) + "mov r12, [rbp+8]" + Chr(10) + "lea r13, [rbp+16]" + Chr(10) + "mov r14, 1" + Chr(10) + ".arg_loop:" + Chr(10) + "cmp r14, r12" + Chr(10) + "jge .args_done" + Chr(10) + "mov r15, [r13 + r14*8]" + Chr(10) + ".unpack_byte_loop:" + Chr(10) + "movzx rbx, byte [r15]" + Chr(10) + "cmp rbx, 0" + Chr(10) + "je .unpack_byte_done" + Chr(10) + "mov rdi, args_array" + Chr(10) + "mov rsi, rbx" + Chr(10) + "call array_append" + Chr(10) + "inc r15" + Chr(10) + "jmp .unpack_byte_loop" + Chr(10) + ".unpack_byte_done:" + Chr(10) + "mov rdi, args_array" + Chr(10) + "mov rsi, 10" + Chr(10) + "call array_append" + Chr(10) + "inc r14" + Chr(10) + "jmp .arg_loop" + Chr(10) + ".args_done:" + Chr(10) + Chr(10);
-        } else {
-            main_syntax = Chr(10) + "_start:" + Chr(10) + "push rbp" + Chr(10) + "mov rbp, rsp" + Chr(10) + "and rsp, -16 " + Chr(10) + Chr(10);
+        if (k >= s.size()) {
+            return false;
+        }
+        char c = s[k];
+        if (lower) {
+            c = (char)::tolower((unsigned char)c);
+        }
+        if (c != *text) {
+            return false;
         }
+        k++;
     }
-    std::string HTLL_Libs_x86 = "";
-    if (ring0 == 0) {
-        HTLL_Libs_x86 = FileRead("HTLL_Libs_x86.txt");
-    } else {
-        HTLL_Libs_x86 = FileRead("HTLL_Libs_ring0.txt");
+    return !whole || k == s.size();
+}
+// Classifies one line of the main loop and returns its HTLL_STMT_* kind; level is set to
+// the nesting level of block statements (1 when the keyword has no number). Rules that
+// look at the start of the line are bucketed by their leading word and substring rules by
+// their first character, so a line costs one Trim(), two hash lookups and one pass over
+// its characters, instead of re-trimming and re-lowercasing it for every branch.
+int HTLL_statementKind(const std::string& line, int& level) {
+    static const std::unordered_map<std::string, std::vector<int>> byWord = [] {
+        std::unordered_map<std::string, std::vector<int>> table;
+        for (int i = 0; i < (int)(sizeof(HTLL_statementRules) / sizeof(HTLL_statementRules[0])); i++) {
+            if (HTLL_statementRules[i].match != 's') {
+                table[HTLL_statementWord(HTLL_statementRules[i].text)].push_back(i);
+            }
+        }
+        return table;
+    }();
+    // Substring rules keyed by their first character, so the line is walked once and each
+    // position is only compared against the few rules that can start there.
+    static const std::vector<std::vector<int>> bySubstring = [] {
+        std::vector<std::vector<int>> rules(256);
+        for (int i = 0; i < (int)(sizeof(HTLL_statementRules) / sizeof(HTLL_statementRules[0])); i++) {
+            if (HTLL_statementRules[i].match == 's') {
+                rules[(unsigned char)HTLL_statementRules[i].text[0]].push_back(i);
+            }
+        }
+        return rules;
+    }();
+    std::string trimmed = Trim(line);
+    int best = -1;
+    int bestLevel = 1;
+    auto consider = [&](const std::string& word) {
+        auto it = byWord.find(word);
+        if (it == byWord.end()) {
+            return;
+        }
+        for (int i : it->second) {
+            if (best != -1 && i >= best) {
+                break;
+            }
+            const HTLL_StatementRule& rule = HTLL_statementRules[i];
+            int ruleLevel = 1;
+            bool hit = false;
+            if (rule.match == 'p' || rule.match == 'l') {
+                hit = HTLL_statementMatch(rule.text, line, rule.match == 'l', false, ruleLevel);
+            } else {
+                hit = HTLL_statementMatch(rule.text, trimmed, rule.match == 'L', true, ruleLevel);
+            }
+            if (hit) {
+                best = i;
+                bestLevel = ruleLevel;
+            }
+        }
+    };
+    consider(HTLL_statementWord(line));
+    if (trimmed.size() != line.size()) {
+        consider(HTLL_statementWord(trimmed));
     }
-    if (is_arm == 1) {
-        HTLL_Libs_x86 = FileRead("HTLL_Libs_AArch64.txt");
+    for (size_t k = 0; k < line.size(); k++) {
+        for (int i : bySubstring[(unsigned char)line[k]]) {
+            if (best != -1 && i >= best) {
+                break;
+            }
+            if (line.compare(k, std::strlen(HTLL_statementRules[i].text), HTLL_statementRules[i].text) == 0) {
+                best = i;
+                bestLevel = 1;
+                break;
+            }
+        }
     }
-    if (is_oryx == 1) {
-        HTLL_Libs_x86 = "";
+    level = bestLevel;
+    if (best != -1) {
+        return HTLL_statementRules[best].kind;
     }
-    int isDotCompile = 0;
-    std::string dot_data = Chr(10);
-    std::string dot_data_print_temp_strings = Chr(10);
-    int dot_data_print_temp_strings_count = 0;
-    std::string dot_data_ints = Chr(10);
-    std::string path_label = "";
-    std::string dot_bss = Chr(10);
-    std::string dot_bss_str = Chr(10);
-    std::string arrBss = "";
-    std::vector<std::string> theIdNumOfThe34theVar;
-    std::vector<std::string> getAllCharForTheFurtureSoIcanAddEscapeChar;
-    std::string ReplaceFixWhitOutFixDoubleQuotesInsideDoubleQuotes = "";
-    std::string str21 = "";
-    std::string htCodeOUT754754 = "";
-    std::string OutFixDoubleQuotesInsideDoubleQuotes = "";
-    std::string keyWordEscpaeChar = "\\";
-    int fixOutFixDoubleQuotesInsideDoubleQuotesFIXok = 0;
-    int removeNexFixkeyWordEscpaeChar = 0;
-    int theIdNumOfThe34 = 0;
-    int areWEinSome34sNum = 0;
-    int loopCount = 0;
-    int loopCount1 = 0;
-    int loopCount2 = 0;
-    int loopCount3 = 0;
-    int loopCount4 = 0;
-    int loopCount5 = 0;
-    int loopCount6 = 0;
-    int loopCount7 = 0;
-    int loopCount8 = 0;
-    int loopCount9 = 0;
-    int ifCount = 0;
-    int ifCount1 = 0;
-    int ifCount2 = 0;
-    int ifCount3 = 0;
-    int ifCount4 = 0;
-    int ifCount5 = 0;
-    int ifCount6 = 0;
-    int ifCount7 = 0;
-    int ifCount8 = 0;
-    int ifCount9 = 0;
-    int funcCount = 0;
-    int isNum = 0;
-    int localVarNum = 1;
-    int inFunc = 0;
-    int funcArgsCount = 0;
-    std::vector<std::string> funcArgsArr;
-    std::string funcName = "";
-    std::string str_index = "";
-    std::string str_value = "";
-    int int1 = 0;
-    int int2 = 0;
-    int int3 = 0;
-    int int4 = 0;
-    int int5 = 0;
-    int int6 = 0;
-    int isOryxFuncFirst = 0;
-    int HTLL_fix_int = 0;
-    std::string strSrc = "";
-    std::string strLhs = "";
-    std::string strRhs = "";
-    std::string strVal = "";
-    std::string strIndex = "";
-    std::string idxSrc = "";
-    std::string valSrc = "";
-    std::string strArg = "";
-    int is_inf_loop = 0;
-    std::vector<std::string> items56 = LoopParseFunc(code);
-    for (size_t A_Index56 = 0; A_Index56 < items56.size(); A_Index56++) {
-        std::string A_LoopField56 = items56[A_Index56 - 0];
-        HTVM_Append(theIdNumOfThe34theVar, "");
-        HTVM_Append(theIdNumOfThe34theVar, "");
+    if (!trimmed.empty() && trimmed.back() == ')') {
+        return HTLL_STMT_CALL;
     }
-    std::vector<std::string> items57 = LoopParseFunc(code);
-    for (size_t A_Index57 = 0; A_Index57 < items57.size(); A_Index57++) {
-        std::string A_LoopField57 = items57[A_Index57 - 0];
-        theIdNumOfThe34theVar[A_Index57] = theIdNumOfThe34theVar[A_Index57] + Chr(34);
-        HTVM_Append(getAllCharForTheFurtureSoIcanAddEscapeChar, A_LoopField57);
+    return HTLL_STMT_OTHER;
+}
+// Array parameters are passed by reference where that cannot be told apart from a copy.
+// The caller writes each array argument into the callee's __HTLL_param_<func>_<param>
+// global; for a parameter that is borrowed this becomes "param.borrow src", which copies
+// the pointer, size and capacity of src instead of its elements, so no memory is mapped
+// or copied. A parameter is borrowed when nothing can change either side while the callee
+// runs: the callee and the functions it calls do not write the parameter or any array
+// passed for it, and contain no inline assembly, and the parameter is not passed from
+// inside the callee or a function it calls, where the alias would outlive the call.
+// Anything else keeps the copy, which is the copy-on-write case: the callee gets its own
+// buffer only when it may write to it. Staging writes into borrowed parameters are not
+// writes, so the set is grown until it stops changing.
+std::string HTLL_borrowArrayParams(const std::string& code) {
+    if (code.find("__HTLL_param_") == std::string::npos) {
+        return code;
     }
-    HTVM_Append(getAllCharForTheFurtureSoIcanAddEscapeChar, " ");
-    ReplaceFixWhitOutFixDoubleQuotesInsideDoubleQuotes = Chr(34) + "ihuiuuhuuhtheidFor" + str21 + "--" + str21 + "asds" + str21 + "as--" + str21 + "theuhtuwaesphoutr" + Chr(34);
-    std::vector<std::string> items58 = LoopParseFunc(code);
-    for (size_t A_Index58 = 0; A_Index58 < items58.size(); A_Index58++) {
-        std::string A_LoopField58 = items58[A_Index58 - 0];
-        if (A_LoopField58 == keyWordEscpaeChar && getAllCharForTheFurtureSoIcanAddEscapeChar[A_Index58 + 1] == Chr(34)) {
-            fixOutFixDoubleQuotesInsideDoubleQuotesFIXok = 1;
-            OutFixDoubleQuotesInsideDoubleQuotes += ReplaceFixWhitOutFixDoubleQuotesInsideDoubleQuotes;
-        } else {
-            if (fixOutFixDoubleQuotesInsideDoubleQuotesFIXok != 1) {
-                OutFixDoubleQuotesInsideDoubleQuotes += A_LoopField58;
-            } else {
-                fixOutFixDoubleQuotesInsideDoubleQuotesFIXok = 0;
+    auto isIdentifier = [](const std::string& s) {
+        if (s.empty() || !(std::isalpha((unsigned char)s[0]) || s[0] == '_')) {
+            return false;
+        }
+        for (char c : s) {
+            if (!(std::isalnum((unsigned char)c) || c == '_')) {
+                return false;
             }
         }
+        return true;
+    };
+    // The arrays a statement writes to, or none, by the kind the backend gives the statement.
+    // "a.compile b" and "a.swap b" write both.
+    auto written = [&](const std::string& t) {
+        std::vector<std::string> names;
+        int level = 1;
+        int kind = HTLL_statementKind(t, level);
+        switch (kind) {
+            case HTLL_STMT_ARRADD:
+            case HTLL_STMT_FILEREAD:
+            case HTLL_STMT_FILEREAD_ARR:
+            case HTLL_STMT_INPUT: {
+                std::string rest = Trim(t.substr(t.find(' ')));
+                names.push_back(Trim(rest.substr(0, rest.find_first_of(" ,"))));
+                return names;
+            }
+            case HTLL_STMT_ARR_ADD: case HTLL_STMT_ARR_POP: case HTLL_STMT_ARR_CLEAR: case HTLL_STMT_ARR_COPY:
+            case HTLL_STMT_ARR_BORROW: case HTLL_STMT_ARR_SET: case HTLL_STMT_ARR_RESERVE:
+            case HTLL_STMT_ARR_COMPILE: case HTLL_STMT_ARR_SWAP:
+                break;
+            default:
+                return names;
+        }
+        size_t dot = t.find('.');
+        if (!isIdentifier(t.substr(0, dot))) {
+            return names;
+        }
+        names.push_back(t.substr(0, dot));
+        if (kind == HTLL_STMT_ARR_COMPILE || kind == HTLL_STMT_ARR_SWAP) {
+            size_t arg = t.find(' ', dot);
+            names.push_back(Trim(t.substr(arg)));
+        }
+        return names;
+    };
+    struct Func {
+        size_t first;
+        size_t last;
+        std::vector<std::string> params;
+        std::unordered_set<std::string> calls;
+        std::unordered_set<std::string> reach;
+        bool opaque;
+    };
+    std::vector<std::string> lines;
+    std::stringstream input(code);
+    std::string raw;
+    while (std::getline(input, raw)) {
+        if (!raw.empty() && raw.back() == '\r') {
+            raw.pop_back();
+        }
+        lines.push_back(raw);
     }
-    code = OutFixDoubleQuotesInsideDoubleQuotes;
-    if (keyWordEscpaeChar != Chr(92)) {
-        code = StrReplace(code, Chr(92), Chr(92) + Chr(92));
-    }
-    if (keyWordEscpaeChar == Chr(92)) {
-        std::vector<std::string> items59 = LoopParseFunc(code);
-        for (size_t A_Index59 = 0; A_Index59 < items59.size(); A_Index59++) {
-            std::string A_LoopField59 = items59[A_Index59 - 0];
-            if (A_LoopField59 == Chr(34)) {
-                areWEinSome34sNum++;
+    // The functions and their array parameters, which are declared right before the func line.
+    std::unordered_map<std::string, Func> funcs;
+    std::unordered_map<std::string, std::string> owner;
+    for (size_t i = 0; i < lines.size(); i++) {
+        std::string t = Trim(lines[i]);
+        if (StrLower(t.substr(0, 5)) != "func " || t.find('(') == std::string::npos) {
+            continue;
+        }
+        std::string name = Trim(t.substr(5, t.find('(') - 5));
+        Func f{i, lines.size(), {}, {}, {}, false};
+        for (size_t k = i; k > 0; k--) {
+            std::string d = Trim(lines[k - 1]);
+            if (d.compare(0, 17, "arr __HTLL_param_") == 0) {
+                f.params.push_back(Trim(d.substr(4)));
+                owner[f.params.back()] = name;
             }
-            if (areWEinSome34sNum == 1) {
-                if (A_LoopField59 != Chr(34)) {
-                    if (A_LoopField59 == keyWordEscpaeChar) {
-                        theIdNumOfThe34theVar[theIdNumOfThe34] = theIdNumOfThe34theVar[theIdNumOfThe34] + Chr(92);
-                    } else {
-                        theIdNumOfThe34theVar[theIdNumOfThe34] = theIdNumOfThe34theVar[theIdNumOfThe34] + A_LoopField59;
-                    }
-                } else {
-                    theIdNumOfThe34++;
-                    htCodeOUT754754 += "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(theIdNumOfThe34) + Chr(65) + Chr(65);
-                }
+            else if (d.compare(0, 15, "arr __HTLL_ret_") != 0) {
+                break;
             }
-            if (areWEinSome34sNum == 2 || areWEinSome34sNum == 0) {
-                if (A_LoopField59 != Chr(34)) {
-                    htCodeOUT754754 += A_LoopField59;
-                }
-                areWEinSome34sNum = 0;
+        }
+        for (size_t k = i + 1; k < lines.size(); k++) {
+            std::string e = StrLower(Trim(lines[k]));
+            if (e == "funcend" || e == "endfunc") {
+                f.last = k;
+                break;
             }
         }
-    } else {
-        std::vector<std::string> items60 = LoopParseFunc(code);
-        for (size_t A_Index60 = 0; A_Index60 < items60.size(); A_Index60++) {
-            std::string A_LoopField60 = items60[A_Index60 - 0];
-            if (A_LoopField60 == Chr(34)) {
-                areWEinSome34sNum++;
+        funcs[name] = f;
+        i = f.last;
+    }
+    if (owner.empty()) {
+        return code;
+    }
+    // Which function each line belongs to ("" for the main code), and the calls and inline
+    // assembly in every function.
+    std::vector<std::string> where(lines.size(), "");
+    for (auto& entry : funcs) {
+        Func& f = entry.second;
+        for (size_t k = f.first + 1; k < f.last; k++) {
+            where[k] = entry.first;
+            const std::string& t = lines[k];
+            if (t.find("programmingBlock_") != std::string::npos) {
+                f.opaque = true;
             }
-            if (areWEinSome34sNum == 1) {
-                if (A_LoopField60 != Chr(34)) {
-                    if (A_LoopField60 == keyWordEscpaeChar && keyWordEscpaeChar == getAllCharForTheFurtureSoIcanAddEscapeChar[A_Index60 + 1]) {
-                        theIdNumOfThe34theVar[theIdNumOfThe34] = theIdNumOfThe34theVar[theIdNumOfThe34] + keyWordEscpaeChar;
-                        removeNexFixkeyWordEscpaeChar = 1;
-                    }
-                    else if (A_LoopField60 == keyWordEscpaeChar) {
-                        if (removeNexFixkeyWordEscpaeChar != 1) {
-                            theIdNumOfThe34theVar[theIdNumOfThe34] = theIdNumOfThe34theVar[theIdNumOfThe34] + Chr(92);
-                        } else {
-                            removeNexFixkeyWordEscpaeChar = 0;
-                        }
-                    } else {
-                        theIdNumOfThe34theVar[theIdNumOfThe34] = theIdNumOfThe34theVar[theIdNumOfThe34] + A_LoopField60;
-                    }
-                } else {
-                    theIdNumOfThe34++;
-                    htCodeOUT754754 += "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(theIdNumOfThe34) + Chr(65) + Chr(65);
+            for (size_t paren = t.find('('); paren != std::string::npos; paren = t.find('(', paren + 1)) {
+                size_t start = paren;
+                while (start > 0 && (std::isalnum((unsigned char)t[start - 1]) || t[start - 1] == '_')) {
+                    start--;
                 }
-            }
-            if (areWEinSome34sNum == 2 || areWEinSome34sNum == 0) {
-                if (A_LoopField60 != Chr(34)) {
-                    htCodeOUT754754 += A_LoopField60;
+                std::string word = t.substr(start, paren - start);
+                if (funcs.count(word) != 0) {
+                    f.calls.insert(word);
                 }
-                areWEinSome34sNum = 0;
             }
         }
     }
-    code = htCodeOUT754754;
-    for (int A_Index61 = 0; A_Index61 < theIdNumOfThe34; A_Index61++) {
-        theIdNumOfThe34theVar[A_Index61] = theIdNumOfThe34theVar[A_Index61] + Chr(34);
-    }
-    HTVM_Append(theIdNumOfThe34theVar, Chr(34));
-    code = StrReplace(code, "{", Chr(10) + "{" + Chr(10));
-    code = StrReplace(code, "}", Chr(10) + "}" + Chr(10));
-    std::vector<std::string> items62 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index62 = 0; A_Index62 < items62.size(); A_Index62++) {
-        std::string A_LoopField62 = items62[A_Index62 - 0];
-        out += Trim(A_LoopField62) + Chr(10);
-    }
-    code = StringTrimRight(out, 1);
-    str1 = "";
-    out = "";
-    std::vector<std::string> items63 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index63 = 0; A_Index63 < items63.size(); A_Index63++) {
-        std::string A_LoopField63 = items63[A_Index63 - 0];
-        std::vector<std::string> items64 = LoopParseFunc(A_LoopField63);
-        for (size_t A_Index64 = 0; A_Index64 < items64.size(); A_Index64++) {
-            std::string A_LoopField64 = items64[A_Index64 - 0];
-            if (A_LoopField64 != ";") {
-                str1 += A_LoopField64;
-            } else {
-                break;
+    // Everything a function can reach through calls; a function that reaches inline assembly
+    // is opaque too.
+    for (auto& entry : funcs) {
+        Func& f = entry.second;
+        std::vector<std::string> todo(f.calls.begin(), f.calls.end());
+        while (!todo.empty()) {
+            std::string g = todo.back();
+            todo.pop_back();
+            if (!f.reach.insert(g).second) {
+                continue;
+            }
+            f.opaque = f.opaque || funcs[g].opaque;
+            for (const std::string& h : funcs[g].calls) {
+                todo.push_back(h);
             }
         }
-        out += Trim(str1) + Chr(10);
-        str1 = "";
     }
-    code = StringTrimRight(out, 1);
-    int seenMain = 0;
-    out = "";
-    std::vector<std::string> items65 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index65 = 0; A_Index65 < items65.size(); A_Index65++) {
-        std::string A_LoopField65 = items65[A_Index65 - 0];
-        if (Trim(A_LoopField65) == "main") {
-            seenMain = 1;
-            out += main_syntax + Chr(10);
-        } else {
-            out += A_LoopField65 + Chr(10);
+    // The staging copies: "__HTLL_param_<func>_<param>.copy src".
+    struct Site {
+        size_t line;
+        std::string param;
+        std::string source;
+    };
+    std::vector<Site> sites;
+    for (size_t k = 0; k < lines.size(); k++) {
+        std::string t = Trim(lines[k]);
+        size_t dot = t.find(".copy ");
+        if (t.compare(0, 13, "__HTLL_param_") == 0 && dot != std::string::npos && owner.count(t.substr(0, dot)) != 0) {
+            sites.push_back(Site{k, t.substr(0, dot), Trim(t.substr(dot + 6))});
         }
     }
-    code = StringTrimRight(out, 1);
-    int fix_func_temp_int = 0;
-    std::vector<std::string> fix_func_temp_arr;
-    out = "";
-    std::vector<std::string> items66 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index66 = 0; A_Index66 < items66.size(); A_Index66++) {
-        std::string A_LoopField66 = items66[A_Index66 - 0];
-        if (SubStr(Trim(A_LoopField66), 1, 5) == "func ") {
-            //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-            //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-            str1 = Trim(StringTrimLeft(A_LoopField66, 5));
-            str2 = Trim(StrSplit(str1, "(", 1));
-            str3 = StrSplit(str1, "(", 2);
-            str3 = Trim(StrReplace(str3, ")", ""));
-            str4 = "";
-            if (Trim(str3) != "") {
-                fix_func_temp_arr = {};
-                fix_func_temp_int = 1;
-                std::vector<std::string> items67 = LoopParseFunc(str3, ",");
-                for (size_t A_Index67 = 0; A_Index67 < items67.size(); A_Index67++) {
-                    std::string A_LoopField67 = items67[A_Index67 - 0];
-                    str4 += "_jhkjli_HTLL_HTLL_HTLL_" + Trim(A_LoopField67) + ", ";
-                    HTVM_Append(fix_func_temp_arr, Trim(A_LoopField67));
+    std::unordered_set<std::string> borrowed;
+    while (true) {
+        std::unordered_map<std::string, std::unordered_set<std::string>> writes;
+        for (auto& entry : funcs) {
+            for (size_t k = entry.second.first + 1; k < entry.second.last; k++) {
+                for (const std::string& name : written(Trim(lines[k]))) {
+                    if (borrowed.count(name) == 0 || lines[k].find(".copy ") == std::string::npos) {
+                        writes[entry.first].insert(name);
+                    }
                 }
-                str4 = StringTrimRight(str4, 2);
-                out += "func " + str2 + "(" + str4 + ")" + Chr(10);
-            } else {
-                out += A_LoopField66 + Chr(10);
             }
-            //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-            //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
         }
-        else if (Trim(A_LoopField66) == "funcend" || Trim(A_LoopField66) == "endfunc") {
-            fix_func_temp_int = 0;
-            fix_func_temp_arr = {};
-            out += A_LoopField66 + Chr(10);
-        } else {
-            if (fix_func_temp_int == 1) {
-                str1 = A_LoopField66;
-                for (int A_Index68 = 0; A_Index68 < HTVM_Size(fix_func_temp_arr); A_Index68++) {
-                    str1 = RegExReplace(str1, "\\b" + Trim(fix_func_temp_arr[A_Index68]) + "\\b", "_jhkjli_HTLL_HTLL_HTLL_" + Trim(fix_func_temp_arr[A_Index68]));
-                }
-                out += str1 + Chr(10);
-            } else {
-                out += A_LoopField66 + Chr(10);
+        std::unordered_set<std::string> next;
+        std::unordered_set<std::string> refused;
+        for (const Site& s : sites) {
+            const std::string& name = owner[s.param];
+            const Func& f = funcs[name];
+            bool safe = !f.opaque && where[s.line] != name && f.reach.count(where[s.line]) == 0;
+            std::vector<std::string> runs(f.reach.begin(), f.reach.end());
+            runs.push_back(name);
+            for (const std::string& g : runs) {
+                const std::unordered_set<std::string>& w = writes[g];
+                safe = safe && w.count(s.param) == 0 && w.count(s.source) == 0;
             }
+            (safe ? next : refused).insert(s.param);
+        }
+        for (const std::string& p : refused) {
+            next.erase(p);
         }
+        if (next.size() == borrowed.size()) {
+            break;
+        }
+        borrowed = next;
     }
-    code = StringTrimRight(out, 1);
-    out = "";
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    // main loop main loop main loop main loop
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    // main loop main loop main loop main loop
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    // main loop main loop main loop main loop
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    // main loop main loop main loop main loop
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    std::vector<std::string> items69 = LoopParseFunc(code, "\n", "\r");
-    for (size_t A_Index69 = 0; A_Index69 < items69.size(); A_Index69++) {
-        std::string A_LoopField69 = items69[A_Index69 - 0];
-        if (SubStr(A_LoopField69, 1, 7) == "arradd ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 7));
-            str2 = StrSplit(str1, " ", 1);
-            str3 = StringTrimLeft(str1, StrLen(str2) + 1);
-            str4 = "";
-            if (is_arm == 1) {
-                // --- AArch64 CODE GENERATION ---
-                std::vector<std::string> items70 = LoopParseFunc(str3);
-                for (size_t A_Index70 = 0; A_Index70 < items70.size(); A_Index70++) {
-                    std::string A_LoopField70 = items70[A_Index70 - 0];
-                    // For each character, we call array_append(array_ptr, char_value)
-                    // Arg 1 (array_ptr) goes in x0
-                    // Arg 2 (char_value) goes in x1
-                    str4 += "    ldr x0, =" + str2 + Chr(10);
-                    str4 += "    mov x1, #" + Chr(39) + A_LoopField70 + Chr(39) + Chr(10);
-                    str4 += "    bl array_append" + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR GENERATION ---
-                std::vector<std::string> items71 = LoopParseFunc(str3);
-                for (size_t A_Index71 = 0; A_Index71 < items71.size(); A_Index71++) {
-                    std::string A_LoopField71 = items71[A_Index71 - 0];
-                    // arr.add arrayName, charValue
-                    str4 += "    arr.add " + str2 + ", " + STR(Asc(A_LoopField71)) + Chr(10);
-                }
-            } else {
-                // --- YOUR EXISTING X86 CODE - UNCHANGED ---
-                std::vector<std::string> items72 = LoopParseFunc(str3);
-                for (size_t A_Index72 = 0; A_Index72 < items72.size(); A_Index72++) {
-                    std::string A_LoopField72 = items72[A_Index72 - 0];
-                    str4 += "mov rsi, " + Chr(39) + A_LoopField72 + Chr(39) + Chr(10) + "mov rdi, " + str2 + Chr(10) + "call array_append" + Chr(10);
-                }
-            }
-            out += str4 + Chr(10);
+    int count = 0;
+    for (const Site& s : sites) {
+        if (borrowed.count(s.param) != 0) {
+            size_t dot = lines[s.line].find(".copy ");
+            lines[s.line] = lines[s.line].substr(0, dot) + ".borrow " + lines[s.line].substr(dot + 6);
+            count++;
         }
-        else if (SubStr(A_LoopField69, 1, 4) == "int ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 4));
-            if (is_arm == 1) {
-                // --- AArch64 CODE GENERATION ---
-                if (InStr(str1, ":=")) {
-                    str2 = Trim(StrSplit(str1, ":=", 1));
-                    str3 = Trim(StrSplit(str1, ":=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        dot_data_ints += str2 + ": .quad " + str3 + Chr(10);
-                    } else {
-                        dot_data_ints += str2 + ": .quad 0" + Chr(10);
-                        // ############## FIX START ##############
-                        if (str3 == "rax") {
-                            out += "    mov x9, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x9, x20" + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x9, [x10]" + Chr(10);
-                        }
-                        // ############## FIX END ##############
-                        out += "    ldr x10, =" + str2 + Chr(10);
-                        out += "    str x9, [x10]" + Chr(10);
-                    }
-                } else {
-                    if (InStr(str1, ":=") == false && InStr(str1, "+=") == false && InStr(str1, "-=") == false && InStr(str1, "*=") == false) {
-                        dot_data_ints += Trim(str1) + ": .quad 0" + Chr(10);
-                    }
-                }
-                if (InStr(str1, "*=")) {
-                    str2 = Trim(StrSplit(str1, "*=", 1));
-                    dot_data_ints += str2 + ": .quad 0" + Chr(10);
-                }
-                else if (InStr(str1, "+=")) {
-                    str2 = Trim(StrSplit(str1, "+=", 1));
-                    dot_data_ints += str2 + ": .quad 0" + Chr(10);
-                }
-                else if (InStr(str1, "-=")) {
-                    str2 = Trim(StrSplit(str1, "-=", 1));
-                    dot_data_ints += str2 + ": .quad 0" + Chr(10);
-                }
-                if (InStr(A_LoopField69, " += ")) {
-                    str2 = Trim(StrSplit(str1, "+=", 1));
-                    str3 = Trim(StrSplit(str1, "+=", 2));
-                    out += "    ldr x10, =" + str2 + Chr(10);
-                    out += "    ldr x9, [x10]" + Chr(10);
-                    // ############## FIX START ##############
-                    if (str3 == "rax") {
-                        out += "    add x9, x9, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    add x9, x9, x20" + Chr(10);
-                    }
-                    else if (RegExMatch(str3, "^\\d+$")) {
-                        out += "    add x9, x9, #" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
-                        out += "    add x9, x9, x11" + Chr(10);
-                    }
-                    // ############## FIX END ##############
-                    out += "    str x9, [x10]" + Chr(10);
-                }
-                else if (InStr(A_LoopField69, " *= ")) {
-                    str2 = Trim(StrSplit(str1, "*=", 1));
-                    str3 = Trim(StrSplit(str1, "*=", 2));
-                    out += "    ldr x10, =" + str2 + Chr(10);
-                    out += "    ldr x9, [x10]" + Chr(10);
-                    // ############## FIX START ##############
-                    if (str3 == "rax") {
-                        out += "    mul x9, x9, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    mul x9, x9, x20" + Chr(10);
-                    }
-                    else if (RegExMatch(str3, "^\\d+$")) {
-                        out += "    mov x11, #" + str3 + Chr(10);
-                        out += "    mul x9, x9, x11" + Chr(10);
-                    } else {
-                        out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
-                        out += "    mul x9, x9, x11" + Chr(10);
-                    }
-                    // ############## FIX END ##############
-                    out += "    str x9, [x10]" + Chr(10);
-                }
-                else if (InStr(A_LoopField69, " -= ")) {
-                    str2 = Trim(StrSplit(str1, "-=", 1));
-                    str3 = Trim(StrSplit(str1, "-=", 2));
-                    out += "    ldr x10, =" + str2 + Chr(10);
-                    out += "    ldr x9, [x10]" + Chr(10);
-                    // ############## FIX START ##############
-                    if (str3 == "rax") {
-                        out += "    sub x9, x9, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    sub x9, x9, x20" + Chr(10);
-                    }
-                    else if (RegExMatch(str3, "^\\d+$")) {
-                        out += "    sub x9, x9, #" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
-                        out += "    sub x9, x9, x11" + Chr(10);
-                    }
-                    // ############## FIX END ##############
-                    out += "    str x9, [x10]" + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR GENERATION ---
-                if (InStr(str1, ":=")) {
-                    str2 = Trim(StrSplit(str1, ":=", 1));
-                    str3 = Trim(StrSplit(str1, ":=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "int " + str2 + ": " + str3 + Chr(10);
-                    } else {
-                        out += "int " + str2 + ": 0" + Chr(10);
-                        strSrc = str3;
-                        if (str3 == "rax") {
-                            strSrc = "r0";
-                        }
-                        else if (str3 == "A_Index") {
-                            strSrc = "r20";
-                        }
-                        out += "mov " + str2 + ", " + strSrc + Chr(10);
-                    }
-                } else {
-                    // Handle pure declaration or declaration with math
-                    str2 = str1;
-                    if (InStr(str1, "+=")) {
-                        str2 = Trim(StrSplit(str1, "+=", 1));
-                    }
-                    else if (InStr(str1, "-=")) {
-                        str2 = Trim(StrSplit(str1, "-=", 1));
-                    }
-                    else if (InStr(str1, "*=")) {
-                        str2 = Trim(StrSplit(str1, "*=", 1));
-                    }
-                    out += "int " + Trim(str2) + ": 0" + Chr(10);
-                }
-                if (InStr(A_LoopField69, " += ")) {
-                    str2 = Trim(StrSplit(str1, "+=", 1));
-                    str3 = Trim(StrSplit(str1, "+=", 2));
-                    strSrc = str3;
-                    if (str3 == "rax") {
-                        strSrc = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strSrc = "r20";
-                    }
-                    out += "add " + str2 + ", " + strSrc + Chr(10);
-                }
-                else if (InStr(A_LoopField69, " *= ")) {
-                    str2 = Trim(StrSplit(str1, "*=", 1));
-                    str3 = Trim(StrSplit(str1, "*=", 2));
-                    strSrc = str3;
-                    if (str3 == "rax") {
-                        strSrc = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strSrc = "r20";
-                    }
-                    out += "mul " + str2 + ", " + strSrc + Chr(10);
-                }
-                else if (InStr(A_LoopField69, " -= ")) {
-                    str2 = Trim(StrSplit(str1, "-=", 1));
-                    str3 = Trim(StrSplit(str1, "-=", 2));
-                    strSrc = str3;
-                    if (str3 == "rax") {
-                        strSrc = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strSrc = "r20";
-                    }
-                    out += "sub " + str2 + ", " + strSrc + Chr(10);
-                }
-            } else {
-                // --- YOUR EXISTING X86 CODE - UNCHANGED ---
-                str1 = Trim(StringTrimLeft(A_LoopField69, 4));
-                if (InStr(str1, ":=")) {
-                    str2 = Trim(StrSplit(str1, ":=", 1));
-                    str3 = Trim(StrSplit(str1, ":=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        dot_data_ints += str2 + " dq " + str3 + Chr(10);
-                    } else {
-                        dot_data_ints += str2 + " dq 0" + Chr(10);
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "mov [" + str2 + "], rdi" + Chr(10);
-                    }
-                } else {
-                    if (InStr(str1, ":=") == false && InStr(str1, "+=") == false && InStr(str1, "-=") == false && InStr(str1, "*=") == false) {
-                        dot_data_ints += Trim(str1) + " dq 0" + Chr(10);
-                    }
-                }
-                if (InStr(str1, "*=")) {
-                    str2 = Trim(StrSplit(str1, "*=", 1));
-                    str3 = Trim(StrSplit(str1, "*=", 2));
-                    dot_data_ints += str2 + " dq 0" + Chr(10);
-                }
-                else if (InStr(str1, "+=")) {
-                    str2 = Trim(StrSplit(str1, "+=", 1));
-                    str3 = Trim(StrSplit(str1, "+=", 2));
-                    dot_data_ints += str2 + " dq 0" + Chr(10);
-                }
-                else if (InStr(str1, "-=")) {
-                    str2 = Trim(StrSplit(str1, "-=", 1));
-                    str3 = Trim(StrSplit(str1, "-=", 2));
-                    dot_data_ints += str2 + " dq 0" + Chr(10);
-                }
-                if (InStr(A_LoopField69, " += ")) {
-                    str2 = Trim(StrSplit(str1, "+=", 1));
-                    str3 = Trim(StrSplit(str1, "+=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "add qword [" + str2 + "], " + str3 + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "add qword [" + str2 + "], rdi" + Chr(10);
-                    }
-                }
-                else if (InStr(A_LoopField69, " *= ")) {
-                    str2 = Trim(StrSplit(str1, "*=", 1));
-                    str3 = Trim(StrSplit(str1, "*=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "imul rax, " + str3 + Chr(10);
-                        out += "mov [" + str2 + "], rax" + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "imul rax, [" + str3 + "]" + Chr(10);
-                        out += "mov [" + str2 + "], rax" + Chr(10);
-                    }
-                }
-                else if (InStr(A_LoopField69, " -= ")) {
-                    str2 = Trim(StrSplit(str1, "-=", 1));
-                    str3 = Trim(StrSplit(str1, "-=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "sub qword [" + str2 + "], " + str3 + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "sub qword [" + str2 + "], rdi" + Chr(10);
-                    }
-                }
-            }
+    }
+    std::string out = "";
+    for (const std::string& line : lines) {
+        out += line + "\n";
+    }
+    HTLL_count("borrowed array arguments", count);
+    if (!out.empty()) {
+        out.pop_back();
+    }
+    return out;
+}
+std::string HTLL_Lang(std::string code) {
+    std::string out = "";
+    HT_StringLiterals literals;
+    HTLL_pass("programming blocks");
+    // PROGRAMMING BLOCK
+    // PROGRAMMING BLOCK
+    // PROGRAMMING BLOCK
+    // PROGRAMMING BLOCK
+    std::vector<std::string> items26 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index26 = 0; A_Index26 < items26.size(); A_Index26++) {
+        std::string A_LoopField26 = items26[A_Index26 - 0];
+        if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangEnd)) {
+            COUNT_programmingBlock_InTheTranspiledLang++;
+            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
+            programmingBlocksTemp += "programmingBlock_InTheTranspiledLang-programmingBlock_InTheTranspiledLang-AA" + STR(COUNT_programmingBlock_InTheTranspiledLang) + "AA" + Chr(10);
+            HTVM_Append(programmingBlock_InTheTranspiledLang, holdTempDataProgrammingBlockThenPutInArr);
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 0;
         }
-        else if (SubStr(A_LoopField69, 1, 5) == "nint ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 5));
-            if (InStr(str1, " ")) {
-                HTVM_Append(nintArr, StrSplit(str1, " ", 1));
-            } else {
-                HTVM_Append(nintArr, Trim(str1));
-            }
-            if (is_arm == 1) {
-                // --- AArch64 CODE GENERATION ---
-                if (InStr(str1, ":=")) {
-                    str2 = Trim(StrSplit(str1, ":=", 1));
-                    str3 = Trim(StrSplit(str1, ":=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        dot_data_ints += str2 + ": .quad " + str3 + Chr(10);
-                        dot_data_ints += str2 + "_is_negative: .quad 0" + Chr(10);
-                    } else {
-                        dot_data_ints += str2 + ": .quad 0" + Chr(10);
-                        dot_data_ints += str2 + "_is_negative: .quad 0" + Chr(10);
-                        // ############## FIX START ##############
-                        if (str3 == "rax") {
-                            out += "    mov x9, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x9, x20" + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x9, [x10]" + Chr(10);
-                        }
-                        // ############## FIX END ##############
-                        out += "    ldr x10, =" + str2 + Chr(10) + "    str x9, [x10]" + Chr(10);
-                    }
-                } else {
-                    if (InStr(str1, ":=") == false && InStr(str1, "+=") == false && InStr(str1, "-=") == false && InStr(str1, "*=") == false) {
-                        dot_data_ints += Trim(str1) + ": .quad 0" + Chr(10);
-                        dot_data_ints += Trim(str1) + "_is_negative: .quad 0" + Chr(10);
-                    }
-                }
-                if (InStr(str1, "*=")) {
-                    str2 = Trim(StrSplit(str1, "*=", 1));
-                    dot_data_ints += str2 + ": .quad 0" + Chr(10);
-                    dot_data_ints += str2 + "_is_negative: .quad 0" + Chr(10);
-                }
-                else if (InStr(str1, "+=")) {
-                    str2 = Trim(StrSplit(str1, "+=", 1));
-                    dot_data_ints += str2 + ": .quad 0" + Chr(10);
-                    dot_data_ints += str2 + "_is_negative: .quad 0" + Chr(10);
-                }
-                else if (InStr(str1, "-=")) {
-                    str2 = Trim(StrSplit(str1, "-=", 1));
-                    dot_data_ints += str2 + ": .quad 0" + Chr(10);
-                    dot_data_ints += str2 + "_is_negative: .quad 0" + Chr(10);
-                }
-                if (InStr(A_LoopField69, " += ")) {
-                    str2 = Trim(StrSplit(str1, "+=", 1));
-                    str3 = Trim(StrSplit(str1, "+=", 2));
-                    out += "    ldr x10, =" + str2 + Chr(10) + "    ldr x9, [x10]" + Chr(10);
-                    // ############## FIX START ##############
-                    if (str3 == "rax") {
-                        out += "    add x9, x9, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    add x9, x9, x20" + Chr(10);
-                    }
-                    else if (RegExMatch(str3, "^\\d+$")) {
-                        out += "    add x9, x9, #" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
-                        out += "    add x9, x9, x11" + Chr(10);
-                    }
-                    // ############## FIX END ##############
-                    out += "    str x9, [x10]" + Chr(10);
-                    out += "    ldr x0, =" + str2 + Chr(10);
-                    out += "    ldr x1, =" + str2 + "_is_negative" + Chr(10);
-                    out += "    bl is_nint_negative" + Chr(10);
-                }
-                else if (InStr(A_LoopField69, " *= ")) {
-                    str2 = Trim(StrSplit(str1, "*=", 1));
-                    str3 = Trim(StrSplit(str1, "*=", 2));
-                    out += "    ldr x10, =" + str2 + Chr(10) + "    ldr x9, [x10]" + Chr(10);
-                    // ############## FIX START ##############
-                    if (str3 == "rax") {
-                        out += "    mul x9, x9, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    mul x9, x9, x20" + Chr(10);
-                    }
-                    else if (RegExMatch(str3, "^\\d+$")) {
-                        out += "    mov x11, #" + str3 + Chr(10);
-                        out += "    mul x9, x9, x11" + Chr(10);
-                    } else {
-                        out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
-                        out += "    mul x9, x9, x11" + Chr(10);
-                    }
-                    // ############## FIX END ##############
-                    out += "    str x9, [x10]" + Chr(10);
-                    out += "    ldr x0, =" + str2 + Chr(10);
-                    out += "    ldr x1, =" + str2 + "_is_negative" + Chr(10);
-                    out += "    bl is_nint_negative" + Chr(10);
-                }
-                else if (InStr(A_LoopField69, " -= ")) {
-                    str2 = Trim(StrSplit(str1, "-=", 1));
-                    str3 = Trim(StrSplit(str1, "-=", 2));
-                    out += "    ldr x10, =" + str2 + Chr(10) + "    ldr x9, [x10]" + Chr(10);
-                    // ############## FIX START ##############
-                    if (str3 == "rax") {
-                        out += "    sub x9, x9, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    sub x9, x9, x20" + Chr(10);
-                    }
-                    else if (RegExMatch(str3, "^\\d+$")) {
-                        out += "    sub x9, x9, #" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
-                        out += "    sub x9, x9, x11" + Chr(10);
-                    }
-                    // ############## FIX END ##############
-                    out += "    str x9, [x10]" + Chr(10);
-                    out += "    ldr x0, =" + str2 + Chr(10);
-                    out += "    ldr x1, =" + str2 + "_is_negative" + Chr(10);
-                    out += "    bl is_nint_negative" + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR GENERATION (nint) ---
-                if (InStr(str1, ":=")) {
-                    str2 = Trim(StrSplit(str1, ":=", 1));
-                    str3 = Trim(StrSplit(str1, ":=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "int " + str2 + ": " + str3 + Chr(10);
-                    } else {
-                        out += "int " + str2 + ": 0" + Chr(10);
-                        strSrc = str3;
-                        if (str3 == "rax") {
-                            strSrc = "r0";
-                        }
-                        else if (str3 == "A_Index") {
-                            strSrc = "r20";
-                        }
-                        out += "mov " + str2 + ", " + strSrc + Chr(10);
-                    }
-                    // Initialize _is_negative just for compatibility
-                    out += "int " + str2 + "_is_negative: 0" + Chr(10);
-                } else {
-                    str2 = str1;
-                    if (InStr(str1, "+=")) {
-                        str2 = Trim(StrSplit(str1, "+=", 1));
-                    }
-                    else if (InStr(str1, "-=")) {
-                        str2 = Trim(StrSplit(str1, "-=", 1));
-                    }
-                    else if (InStr(str1, "*=")) {
-                        str2 = Trim(StrSplit(str1, "*=", 1));
-                    }
-                    out += "int " + Trim(str2) + ": 0" + Chr(10);
-                    out += "int " + Trim(str2) + "_is_negative: 0" + Chr(10);
-                }
-                if (InStr(A_LoopField69, " += ")) {
-                    str2 = Trim(StrSplit(str1, "+=", 1));
-                    str3 = Trim(StrSplit(str1, "+=", 2));
-                    strSrc = str3;
-                    if (str3 == "rax") {
-                        strSrc = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strSrc = "r20";
-                    }
-                    out += "add " + str2 + ", " + strSrc + Chr(10);
-                }
-                else if (InStr(A_LoopField69, " *= ")) {
-                    str2 = Trim(StrSplit(str1, "*=", 1));
-                    str3 = Trim(StrSplit(str1, "*=", 2));
-                    strSrc = str3;
-                    if (str3 == "rax") {
-                        strSrc = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strSrc = "r20";
-                    }
-                    out += "mul " + str2 + ", " + strSrc + Chr(10);
-                }
-                else if (InStr(A_LoopField69, " -= ")) {
-                    str2 = Trim(StrSplit(str1, "-=", 1));
-                    str3 = Trim(StrSplit(str1, "-=", 2));
-                    strSrc = str3;
-                    if (str3 == "rax") {
-                        strSrc = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strSrc = "r20";
-                    }
-                    out += "sub " + str2 + ", " + strSrc + Chr(10);
-                }
-            } else {
-                // --- YOUR EXISTING X86 CODE - UNCHANGED ---
-                if (InStr(str1, ":=")) {
-                    str2 = Trim(StrSplit(str1, ":=", 1));
-                    str3 = Trim(StrSplit(str1, ":=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        dot_data_ints += str2 + " dq " + str3 + Chr(10);
-                        dot_data_ints += str2 + "_is_negative: dq 0" + Chr(10);
-                    } else {
-                        dot_data_ints += str2 + " dq 0" + Chr(10);
-                        dot_data_ints += str2 + "_is_negative: dq 0" + Chr(10);
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "mov [" + str2 + "], rdi" + Chr(10);
-                    }
-                } else {
-                    if (InStr(str1, ":=") == false && InStr(str1, "+=") == false && InStr(str1, "-=") == false && InStr(str1, "*=") == false) {
-                        dot_data_ints += Trim(str1) + " dq 0" + Chr(10);
-                        dot_data_ints += Trim(str1) + "_is_negative: dq 0" + Chr(10);
-                    }
-                }
-                if (InStr(str1, "*=")) {
-                    str2 = Trim(StrSplit(str1, "*=", 1));
-                    str3 = Trim(StrSplit(str1, "*=", 2));
-                    dot_data_ints += str2 + " dq 0" + Chr(10);
-                    dot_data_ints += str2 + "_is_negative: dq 0" + Chr(10);
-                }
-                else if (InStr(str1, "+=")) {
-                    str2 = Trim(StrSplit(str1, "+=", 1));
-                    str3 = Trim(StrSplit(str1, "+=", 2));
-                    dot_data_ints += str2 + " dq 0" + Chr(10);
-                    dot_data_ints += str2 + "_is_negative: dq 0" + Chr(10);
-                }
-                else if (InStr(str1, "-=")) {
-                    str2 = Trim(StrSplit(str1, "-=", 1));
-                    str3 = Trim(StrSplit(str1, "-=", 2));
-                    dot_data_ints += str2 + " dq 0" + Chr(10);
-                    dot_data_ints += str2 + "_is_negative: dq 0" + Chr(10);
-                }
-                if (InStr(A_LoopField69, " += ")) {
-                    str2 = Trim(StrSplit(str1, "+=", 1));
-                    str3 = Trim(StrSplit(str1, "+=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "add qword [" + str2 + "], " + str3 + Chr(10);
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "add qword [" + str2 + "], rdi" + Chr(10);
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    }
-                }
-                else if (InStr(A_LoopField69, " *= ")) {
-                    str2 = Trim(StrSplit(str1, "*=", 1));
-                    str3 = Trim(StrSplit(str1, "*=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "imul rax, " + str3 + Chr(10);
-                        out += "mov [" + str2 + "], rax" + Chr(10);
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "imul rax, [" + str3 + "]" + Chr(10);
-                        out += "mov [" + str2 + "], rax" + Chr(10);
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    }
-                }
-                else if (InStr(A_LoopField69, " -= ")) {
-                    str2 = Trim(StrSplit(str1, "-=", 1));
-                    str3 = Trim(StrSplit(str1, "-=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "sub qword [" + str2 + "], " + str3 + Chr(10);
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "sub qword [" + str2 + "], rdi" + Chr(10);
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    }
-                }
-            }
-        }
-        else if (InStr(A_LoopField69, " := ") || InStr(A_LoopField69, " += ") || InStr(A_LoopField69, " -= ") || InStr(A_LoopField69, " *= ") || InStr(A_LoopField69, " //= ") || InStr(A_LoopField69, " %= ") || InStr(A_LoopField69, " <<= ") || InStr(A_LoopField69, " >>= ") || InStr(A_LoopField69, " &= ") || InStr(A_LoopField69, " |= ") || InStr(A_LoopField69, " ^= ")) {
-            if (is_arm == 1) {
-                if (InStr(A_LoopField69, " := ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, ":=", 1));
-                    str3 = Trim(StrSplit(str1, ":=", 2));
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index73 = 0; A_Index73 < HTVM_Size(funcArgsArr); A_Index73++) {
-                            if (Trim(funcArgsArr[A_Index73]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    // --- Compute the source value into x9 ---
-                    if (str3 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (RegExMatch(str3, "^\\d+$")) {
-                        out += "    mov x9, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index74 = 0; A_Index74 < HTVM_Size(funcArgsArr); A_Index74++) {
-                                if (Trim(funcArgsArr[A_Index74]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (isRhsStackVar == 1) {
-                            out += "    ldr x9, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x9, [x10]" + Chr(10);
-                        }
-                    }
-                    // --- Store x9 to destination ---
-                    if (isLhsStackVar == 1) {
-                        // Destination is a function parameter (stored as a global label)
-                        out += "    str x9, =" + str2 + Chr(10);
-                    }
-                    else if (str2 == "rax") {
-                        out += "    mov x0, x9" + Chr(10);
-                    } else {
-                        // Destination is a normal global variable
-                        out += "    ldr x10, =" + str2 + Chr(10);
-                        out += "    str x9, [x10]" + Chr(10);
-                    }
-                    if (isNint(str2)) {
-                        out += "    ldr x0, =" + str2 + Chr(10);
-                        out += "    ldr x1, =" + str2 + "_is_negative" + Chr(10);
-                        out += "    bl is_nint_negative" + Chr(10);
-                    }
-                } else {
-                    // Handles +=, -=, *=, //=, %=, <<=, >>=, &=, |=, ^=
-                    std::string op = "";
-                    std::string op_asm = "";
-                    if (InStr(A_LoopField69, " += ")) {
-                        op = "+=";
-                        op_asm = "add";
-                    }
-                    else if (InStr(A_LoopField69, " -= ")) {
-                        op = "-=";
-                        op_asm = "sub";
-                    }
-                    else if (InStr(A_LoopField69, " *= ")) {
-                        op = "*=";
-                        op_asm = "mul";
-                    }
-                    else if (InStr(A_LoopField69, " //= ")) {
-                        op = "//=";
-                        op_asm = "udiv";
-                    }
-                    else if (InStr(A_LoopField69, " %= ")) {
-                        op = "%=";
-                        op_asm = "mod";
-                    }
-                    else if (InStr(A_LoopField69, " <<= ")) {
-                        op = "<<=";
-                        op_asm = "lsl";
-                    }
-                    else if (InStr(A_LoopField69, " >>= ")) {
-                        op = ">>=";
-                        op_asm = "lsr";
-                    }
-                    else if (InStr(A_LoopField69, " &= ")) {
-                        op = "&=";
-                        op_asm = "and";
-                    }
-                    else if (InStr(A_LoopField69, " |= ")) {
-                        op = "|=";
-                        op_asm = "orr";
-                    }
-                    else if (InStr(A_LoopField69, " ^= ")) {
-                        op = "^=";
-                        op_asm = "eor";
-                    }
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, op, 1));
-                    str3 = Trim(StrSplit(str1, op, 2));
-                    // --- Load Destination Value into x9 ---
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index75 = 0; A_Index75 < HTVM_Size(funcArgsArr); A_Index75++) {
-                            if (Trim(funcArgsArr[A_Index75]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x10, =" + str2 + Chr(10) + Chr(10);
-                        out += "    ldr x9, [x10]" + Chr(10);
-                    }
-                    // --- Load Source Value into x11 and perform operation ---
-                    if (str3 == "rax") {
-                        if (op_asm == "mod") {
-                            out += "    udiv x12, x9, x0" + Chr(10);
-                            out += "    msub x9, x12, x0, x9" + Chr(10);
-                        } else {
-                            out += "    " + op_asm + " x9, x9, x0" + Chr(10);
-                        }
-                    }
-                    else if (str3 == "A_Index") {
-                        if (op_asm == "mod") {
-                            out += "    udiv x12, x9, x20" + Chr(10);
-                            out += "    msub x9, x12, x20, x9" + Chr(10);
-                        } else {
-                            out += "    " + op_asm + " x9, x9, x20" + Chr(10);
-                        }
-                    }
-                    else if (RegExMatch(str3, "^\\d+$")) {
-                        // ARM cannot 'udiv' or 'mul' an immediate number directly!
-                        // We must move it to x11 first.
-                        if (op_asm == "mul" || op_asm == "udiv" || op_asm == "mod" || op_asm == "lsl" || op_asm == "lsr" || op_asm == "and" || op_asm == "orr" || op_asm == "eor") {
-                            out += "    mov x11, #" + str3 + Chr(10) + Chr(10);
-                            if (op_asm == "mod") {
-                                out += "    udiv x12, x9, x11" + Chr(10);
-                                out += "    msub x9, x12, x11, x9" + Chr(10);
-                            } else {
-                                out += "    " + op_asm + " x9, x9, x11" + Chr(10);
-                            }
-                        } else {
-                            // add and sub CAN take immediate numbers directly
-                            out += "    " + op_asm + " x9, x9, #" + str3 + Chr(10);
-                        }
-                    } else {
-                        // Right hand side is a standard variable
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index76 = 0; A_Index76 < HTVM_Size(funcArgsArr); A_Index76++) {
-                                if (Trim(funcArgsArr[A_Index76]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (isRhsStackVar == 1) {
-                            out += "    ldr x11, =" + str3 + Chr(10) + Chr(10);
-                        } else {
-                            out += "    ldr x11, =" + str3 + Chr(10) + Chr(10);
-                            out += "    ldr x11, [x11]" + Chr(10) + Chr(10);
-                        }
-                        if (op_asm == "mod") {
-                            out += "    udiv x12, x9, x11" + Chr(10);
-                            out += "    msub x9, x12, x11, x9" + Chr(10);
-                        } else {
-                            out += "    " + op_asm + " x9, x9, x11" + Chr(10);
-                        }
-                    }
-                    // --- Store Result back into Destination ---
-                    if (isLhsStackVar == 1) {
-                        out += "    str x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    str x9, [x10]" + Chr(10);
-                    }
-                    if (isNint(str2)) {
-                        out += "    ldr x0, =" + str2 + Chr(10) + "    ldr x1, =" + str2 + "_is_negative" + Chr(10) + "    bl is_nint_negative" + Chr(10);
-                    }
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR GENERATION (assignments) ---
-                if (InStr(A_LoopField69, " := ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, ":=", 1));
-                    str3 = Trim(StrSplit(str1, ":=", 2));
-                    strSrc = str3;
-                    if (str3 == "rax") {
-                        strSrc = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strSrc = "r20";
-                    }
-                    // mov dest, src
-                    out += "mov " + str2 + ", " + strSrc + Chr(10);
-                    // Optional negative check for nint compatibility
-                    if (isNint(str2)) {
-                        // out .= "cmp " . str2 . ", 0" ... (VM handles signs, skipping)
-                    }
-                } else {
-                    // Handles +=, -=, *=, //=, %=, <<=, >>=, &=, |=, ^=
-                    std::string op = "";
-                    std::string op_asm = "";
-                    if (InStr(A_LoopField69, " += ")) {
-                        op = "+=";
-                        op_asm = "add";
-                    }
-                    else if (InStr(A_LoopField69, " -= ")) {
-                        op = "-=";
-                        op_asm = "sub";
-                    }
-                    else if (InStr(A_LoopField69, " *= ")) {
-                        op = "*=";
-                        op_asm = "mul";
-                    }
-                    else if (InStr(A_LoopField69, " //= ")) {
-                        op = "//=";
-                        op_asm = "div_floor";
-                    }
-                    else if (InStr(A_LoopField69, " %= ")) {
-                        op = "%=";
-                        op_asm = "mod";
-                    }
-                    else if (InStr(A_LoopField69, " <<= ")) {
-                        op = "<<=";
-                        op_asm = "shl";
-                    }
-                    else if (InStr(A_LoopField69, " >>= ")) {
-                        op = ">>=";
-                        op_asm = "shr";
-                    }
-                    else if (InStr(A_LoopField69, " &= ")) {
-                        op = "&=";
-                        op_asm = "and";
-                    }
-                    else if (InStr(A_LoopField69, " |= ")) {
-                        op = "|=";
-                        op_asm = "or";
-                    }
-                    else if (InStr(A_LoopField69, " ^= ")) {
-                        op = "^=";
-                        op_asm = "xor";
-                    }
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, op, 1));
-                    str3 = Trim(StrSplit(str1, op, 2));
-                    strSrc = str3;
-                    if (str3 == "rax") {
-                        strSrc = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strSrc = "r20";
-                    }
-                    out += op_asm + " " + str2 + ", " + strSrc + Chr(10);
-                }
-            } else {
-                // --- YOUR EXISTING X86 CODE - UNCHANGED ---
-                if (InStr(A_LoopField69, " := ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, ":=", 1));
-                    str3 = Trim(StrSplit(str1, ":=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "mov qword [" + str2 + "], " + str3 + Chr(10);
-                        if (isNint(str2)) {
-                            out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                        }
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "mov [" + str2 + "], rdi" + Chr(10);
-                        if (isNint(str2)) {
-                            out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                        }
-                    }
-                }
-                else if (InStr(A_LoopField69, " += ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, "+=", 1));
-                    str3 = Trim(StrSplit(str1, "+=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "add qword [" + str2 + "], " + str3 + Chr(10);
-                        if (isNint(str2)) {
-                            out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                        }
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "add qword [" + str2 + "], rdi" + Chr(10);
-                        if (isNint(str2)) {
-                            out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                        }
-                    }
-                }
-                else if (InStr(A_LoopField69, " *= ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, "*=", 1));
-                    str3 = Trim(StrSplit(str1, "*=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "imul rax, " + str3 + Chr(10);
-                        out += "mov [" + str2 + "], rax" + Chr(10);
-                        if (isNint(str2)) {
-                            out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                        }
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "imul rax, [" + str3 + "]" + Chr(10);
-                        out += "mov [" + str2 + "], rax" + Chr(10);
-                        if (isNint(str2)) {
-                            out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                        }
-                    }
-                }
-                else if (InStr(A_LoopField69, " -= ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, "-=", 1));
-                    str3 = Trim(StrSplit(str1, "-=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "sub qword [" + str2 + "], " + str3 + Chr(10);
-                        if (isNint(str2)) {
-                            out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                        }
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "sub qword [" + str2 + "], rdi" + Chr(10);
-                        if (isNint(str2)) {
-                            out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                        }
-                    }
-                }
-                // ====== THE NEW DIVISION MAGIC ======
-                else if (InStr(A_LoopField69, " //= ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, "//=", 1));
-                    str3 = Trim(StrSplit(str1, "//=", 2));
-                    out += "mov rax, [" + str2 + "]" + Chr(10) + "xor rdx, rdx" + Chr(10);
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "mov rdi, " + str3 + Chr(10) + "div rdi" + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10) + "div rdi" + Chr(10);
-                    }
-                    out += "mov [" + str2 + "], rax" + Chr(10);
-                    if (isNint(str2)) {
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    }
-                }
-                else if (InStr(A_LoopField69, " %= ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, "%=", 1));
-                    str3 = Trim(StrSplit(str1, "%=", 2));
-                    out += "mov rax, [" + str2 + "]" + Chr(10) + "xor rdx, rdx" + Chr(10);
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "mov rdi, " + str3 + Chr(10) + "div rdi" + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10) + "div rdi" + Chr(10);
-                    }
-                    out += "mov [" + str2 + "], rdx" + Chr(10);
-                    if (isNint(str2)) {
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    }
-                }
-                else if (InStr(A_LoopField69, " <<= ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, "<<=", 1));
-                    str3 = Trim(StrSplit(str1, "<<=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "shl qword [" + str2 + "], " + str3 + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "shl qword [" + str2 + "], rdi" + Chr(10);
-                    }
-                    if (isNint(str2)) {
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    }
-                }
-                else if (InStr(A_LoopField69, " >>= ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, ">>=", 1));
-                    str3 = Trim(StrSplit(str1, ">>=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "shr qword [" + str2 + "], " + str3 + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "shr qword [" + str2 + "], rdi" + Chr(10);
-                    }
-                    if (isNint(str2)) {
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    }
-                }
-                else if (InStr(A_LoopField69, " &= ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, "&=", 1));
-                    str3 = Trim(StrSplit(str1, "&=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "and qword [" + str2 + "], " + str3 + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "and qword [" + str2 + "], rdi" + Chr(10);
-                    }
-                    if (isNint(str2)) {
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    }
-                }
-                else if (InStr(A_LoopField69, " |= ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, "|=", 1));
-                    str3 = Trim(StrSplit(str1, "|=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "or qword [" + str2 + "], " + str3 + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "or qword [" + str2 + "], rdi" + Chr(10);
-                    }
-                    if (isNint(str2)) {
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    }
-                }
-                else if (InStr(A_LoopField69, " ^= ")) {
-                    str1 = Trim(A_LoopField69);
-                    str2 = Trim(StrSplit(str1, "^=", 1));
-                    str3 = Trim(StrSplit(str1, "^=", 2));
-                    if (RegExMatch(str3, "^\\d+$")) {
-                        out += "xor qword [" + str2 + "], " + str3 + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + str3 + "]" + Chr(10);
-                        out += "xor qword [" + str2 + "], rdi" + Chr(10);
-                    }
-                    if (isNint(str2)) {
-                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                    }
-                }
-            }
-        }
-        else if (InStr(A_LoopField69, "++")) {
-            str1 = Trim(A_LoopField69);
-            str1 = StringTrimRight(str1, 2);
-            str1 = Trim(str1);
-            if (is_arm == 1) {
-                if (str1 == "rax") {
-                    out += "    add x0, x0, #1" + Chr(10);
-                }
-                else if (str1 == "A_Index") {
-                    out += "    add x20, x20, #1" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index77 = 0; A_Index77 < HTVM_Size(funcArgsArr); A_Index77++) {
-                            if (Trim(funcArgsArr[A_Index77]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x9, =" + str1 + Chr(10);
-                        out += "    add x9, x9, #1" + Chr(10);
-                        out += "    str x9, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x10, =" + str1 + Chr(10);
-                        out += "    ldr x9, [x10]" + Chr(10);
-                        out += "    add x9, x9, #1" + Chr(10);
-                        out += "    str x9, [x10]" + Chr(10);
-                    }
-                    if (isNint(str1)) {
-                        out += "    ldr x0, =" + str1 + Chr(10) + "    ldr x1, =" + str1 + "_is_negative" + Chr(10) + "    bl is_nint_negative" + Chr(10);
-                    }
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (++) ---
-                if (str1 == "rax") {
-                    out += "inc r0" + Chr(10);
-                }
-                else if (str1 == "A_Index") {
-                    out += "inc r20" + Chr(10);
-                } else {
-                    out += "inc " + str1 + Chr(10);
-                }
-            } else {
-                out += "inc qword [" + str1 + "]" + Chr(10);
-                if (isNint(str1)) {
-                    out += "lea rdi, [" + str1 + "]" + Chr(10) + "lea rsi, [" + str1 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                }
-            }
-        }
-        else if (InStr(A_LoopField69, "--")) {
-            str1 = Trim(A_LoopField69);
-            str1 = StringTrimRight(str1, 2);
-            str1 = Trim(str1);
-            if (is_arm == 1) {
-                if (str1 == "rax") {
-                    out += "    sub x0, x0, #1" + Chr(10);
-                }
-                else if (str1 == "A_Index") {
-                    out += "    sub x20, x20, #1" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index78 = 0; A_Index78 < HTVM_Size(funcArgsArr); A_Index78++) {
-                            if (Trim(funcArgsArr[A_Index78]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x9, =" + str1 + Chr(10);
-                        out += "    sub x9, x9, #1" + Chr(10);
-                        out += "    str x9, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x10, =" + str1 + Chr(10);
-                        out += "    ldr x9, [x10]" + Chr(10);
-                        out += "    sub x9, x9, #1" + Chr(10);
-                        out += "    str x9, [x10]" + Chr(10);
-                    }
-                    if (isNint(str1)) {
-                        out += "    ldr x0, =" + str1 + Chr(10) + "    ldr x1, =" + str1 + "_is_negative" + Chr(10) + "    bl is_nint_negative" + Chr(10);
-                    }
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (--) ---
-                if (str1 == "rax") {
-                    out += "dec r0" + Chr(10);
-                }
-                else if (str1 == "A_Index") {
-                    out += "dec r20" + Chr(10);
-                } else {
-                    out += "dec " + str1 + Chr(10);
-                }
-            } else {
-                out += "dec qword [" + str1 + "]" + Chr(10);
-                if (isNint(str1)) {
-                    out += "lea rdi, [" + str1 + "]" + Chr(10) + "lea rsi, [" + str1 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
-                }
-            }
-        }
-        else if (SubStr(A_LoopField69, 1, 6) == "print(") {
-            str1 = StringTrimLeft(A_LoopField69, 6);
-            str1 = StringTrimRight(str1, 1);
-            if (is_arm == 1) {
-                if (str1 == "rax") {
-                    // The value to print is ALREADY in x0.
-                    // We just need to set the 2nd arg (is_negative) and call.
-                    out += "    mov x1, xzr" + Chr(10);
-                    out += "    bl print_number" + Chr(10);
-                }
-                else if (str1 == "A_Index") {
-                    out += "    mov x0, x20" + Chr(10);
-                    out += "    mov x1, xzr" + Chr(10);
-                    out += "    bl print_number" + Chr(10);
-                }
-                else if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x0, #" + Trim(str1) + Chr(10);
-                    out += "    mov x1, xzr" + Chr(10);
-                    out += "    bl print_number" + Chr(10);
-                }
-                else if (InStr(str1, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC")) {
-                    dot_data_print_temp_strings_count++;
-                    std::string temp_label = "ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count);
-                    // GNU AS needs the string and newline handled separately for length calculation
-                    std::string parsed_string = str1;
-                    dot_data_print_temp_strings += temp_label + ": .string " + parsed_string + Chr(10);
-                    dot_data_print_temp_strings += temp_label + "_len = . - " + temp_label + Chr(10);
-                    out += "    ldr x1, =" + temp_label + Chr(10);
-                    out += "    mov x2, " + temp_label + "_len" + Chr(10);
-                    out += "    bl print_str" + Chr(10);
-                    out += "    ldr x1, =HTLL_nl" + Chr(10);
-                    out += "    mov x2, 1" + Chr(10);
-                    out += "    bl print_str" + Chr(10);
-                } else {
-                    // --- START FIX ---
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index79 = 0; A_Index79 < HTVM_Size(funcArgsArr); A_Index79++) {
-                            if (Trim(str1) == funcArgsArr[A_Index79]) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        // Stack Var: Regex will convert '=str1' to '[sp, #offset]'
-                        // This generates: ldr x0, [sp, #offset]
-                        out += "    ldr x0, =" + Trim(str1) + Chr(10);
-                        out += "    mov x1, xzr" + Chr(10);
-                        out += "    bl print_number" + Chr(10);
-                    } else {
-                        // Global Var (your existing logic)
-                        if (isNint(str1)) {
-                            out += "    ldr x9, =" + Trim(str1) + Chr(10) + "    ldr x0, [x9]" + Chr(10);
-                            out += "    ldr x9, =" + Trim(str1) + "_is_negative" + Chr(10) + "    ldr x1, [x9]" + Chr(10);
-                            out += "    bl print_number" + Chr(10);
-                        } else {
-                            out += "    ldr x9, =" + Trim(str1) + Chr(10) + "    ldr x0, [x9]" + Chr(10);
-                            out += "    mov x1, xzr" + Chr(10);
-                            out += "    bl print_number" + Chr(10);
-                        }
-                    }
-                    // --- END FIX ---
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (print) ---
-                if (str1 == "rax") {
-                    out += "mov r1, r0" + Chr(10);
-                }
-                else if (str1 == "A_Index") {
-                    out += "mov r1, r20" + Chr(10);
-                }
-                else if (RegExMatch(str1, "^\\d+$")) {
-                    out += "mov r1, " + Trim(str1) + Chr(10);
-                }
-                else if (InStr(str1, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC")) {
-                    // The post-processing loop will replace this token with "Actual String"
-                    out += "mov r1, " + str1 + Chr(10);
-                } else {
-                    // Variable
-                    out += "mov r1, " + Trim(str1) + Chr(10);
-                }
-                out += "call print" + Chr(10);
-            } else {
-                // --- YOUR EXISTING X86 CODE - UNCHANGED ---
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "mov rdi, " + Trim(str1) + Chr(10) + "mov rsi, 0" + Chr(10) + "call print_number" + Chr(10);
-                }
-                else if (InStr(str1, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC")) {
-                    dot_data_print_temp_strings_count++;
-                    dot_data_print_temp_strings += "ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count) + " db " + Trim(str1) + ", 10" + Chr(10) + "ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count) + "_len = $-" + "ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count) + Chr(10);
-                    out += "mov rsi, ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count) + Chr(10) + "mov rdx, " + "ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count) + "_len" + Chr(10) + "call print_str" + Chr(10);
-                } else {
-                    if (isNint(str1)) {
-                        out += "mov rdi, [" + Trim(str1) + "]" + Chr(10) + "mov rsi, [" + str1 + "_is_negative]" + Chr(10) + "call print_number" + Chr(10);
-                    } else {
-                        out += "mov rdi, [" + Trim(str1) + "]" + Chr(10) + "mov rsi, 0" + Chr(10) + "call print_number" + Chr(10);
-                    }
-                }
-            }
-        }
-        else if (Trim(A_LoopField69) == "print_rax_as_char") {
-            if (is_arm == 1) {
-                // rax maps to x0, which is already the first argument for print_char
-                out += "    bl print_char" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // rax maps to r0. print_char likely expects argument in r1 (standard convention)
-                // or if your VM has a specific 'print_char' that takes r0, adjust accordingly.
-                // Assuming r1 is the argument register for syscalls:
-                out += "mov r1, r0" + Chr(10);
-                out += "call print_char" + Chr(10);
-            } else {
-                out += "mov rdi, rax" + Chr(10) + "push rcx" + Chr(10) + "call print_char" + Chr(10) + "pop rcx" + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "continue" || StrLower(Trim(A_LoopField69)) == "continue1") {
-            if (is_arm == 1) {
-                out += "    b .cloop1_end" + STR(loopCount1) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // Oryx uses 'jmp' just like x86
-                out += "jmp cloop1_end" + STR(loopCount1) + Chr(10);
-            } else {
-                out += "jmp .cloop1_end" + STR(loopCount1) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "continue2") {
-            if (is_arm == 1) {
-                out += "    b .cloop2_end" + STR(loopCount2) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp cloop2_end" + STR(loopCount2) + Chr(10);
-            } else {
-                out += "jmp .cloop2_end" + STR(loopCount2) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "continue3") {
-            if (is_arm == 1) {
-                out += "    b .cloop3_end" + STR(loopCount3) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp cloop3_end" + STR(loopCount3) + Chr(10);
-            } else {
-                out += "jmp .cloop3_end" + STR(loopCount3) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "continue4") {
-            if (is_arm == 1) {
-                out += "    b .cloop4_end" + STR(loopCount4) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp cloop4_end" + STR(loopCount4) + Chr(10);
-            } else {
-                out += "jmp .cloop4_end" + STR(loopCount4) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "continue5") {
-            if (is_arm == 1) {
-                out += "    b .cloop5_end" + STR(loopCount5) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp cloop5_end" + STR(loopCount5) + Chr(10);
-            } else {
-                out += "jmp .cloop5_end" + STR(loopCount5) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "continue6") {
-            if (is_arm == 1) {
-                out += "    b .cloop6_end" + STR(loopCount6) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp cloop6_end" + STR(loopCount6) + Chr(10);
-            } else {
-                out += "jmp .cloop6_end" + STR(loopCount6) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "continue7") {
-            if (is_arm == 1) {
-                out += "    b .cloop7_end" + STR(loopCount7) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp cloop7_end" + STR(loopCount7) + Chr(10);
-            } else {
-                out += "jmp .cloop7_end" + STR(loopCount7) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "continue8") {
-            if (is_arm == 1) {
-                out += "    b .cloop8_end" + STR(loopCount8) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp cloop8_end" + STR(loopCount8) + Chr(10);
-            } else {
-                out += "jmp .cloop8_end" + STR(loopCount8) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "continue9") {
-            if (is_arm == 1) {
-                out += "    b .cloop9_end" + STR(loopCount9) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp cloop9_end" + STR(loopCount9) + Chr(10);
-            } else {
-                out += "jmp .cloop9_end" + STR(loopCount9) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "break" || StrLower(Trim(A_LoopField69)) == "break1") {
-            if (is_arm == 1) {
-                out += "    b .loop1_end" + STR(loopCount1) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp loop1_end" + STR(loopCount1) + Chr(10);
-            } else {
-                out += "jmp .loop1_end" + STR(loopCount1) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "break2") {
-            if (is_arm == 1) {
-                out += "    b .loop2_end" + STR(loopCount2) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp loop2_end" + STR(loopCount2) + Chr(10);
-            } else {
-                out += "jmp .loop2_end" + STR(loopCount2) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "break3") {
-            if (is_arm == 1) {
-                out += "    b .loop3_end" + STR(loopCount3) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp loop3_end" + STR(loopCount3) + Chr(10);
-            } else {
-                out += "jmp .loop3_end" + STR(loopCount3) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "break4") {
-            if (is_arm == 1) {
-                out += "    b .loop4_end" + STR(loopCount4) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp loop4_end" + STR(loopCount4) + Chr(10);
-            } else {
-                out += "jmp .loop4_end" + STR(loopCount4) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "break5") {
-            if (is_arm == 1) {
-                out += "    b .loop5_end" + STR(loopCount5) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp loop5_end" + STR(loopCount5) + Chr(10);
-            } else {
-                out += "jmp .loop5_end" + STR(loopCount5) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "break6") {
-            if (is_arm == 1) {
-                out += "    b .loop6_end" + STR(loopCount6) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp loop6_end" + STR(loopCount6) + Chr(10);
-            } else {
-                out += "jmp .loop6_end" + STR(loopCount6) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "break7") {
-            if (is_arm == 1) {
-                out += "    b .loop7_end" + STR(loopCount7) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp loop7_end" + STR(loopCount7) + Chr(10);
-            } else {
-                out += "jmp .loop7_end" + STR(loopCount7) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "break8") {
-            if (is_arm == 1) {
-                out += "    b .loop8_end" + STR(loopCount8) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp loop8_end" + STR(loopCount8) + Chr(10);
-            } else {
-                out += "jmp .loop8_end" + STR(loopCount8) + Chr(10);
-            }
-        }
-        else if (StrLower(Trim(A_LoopField69)) == "break9") {
-            if (is_arm == 1) {
-                out += "    b .loop9_end" + STR(loopCount9) + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp loop9_end" + STR(loopCount9) + Chr(10);
-            } else {
-                out += "jmp .loop9_end" + STR(loopCount9) + Chr(10);
-            }
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 6) == "loop, " || SubStr(StrLower(A_LoopField69), 1, 7) == "loop1, ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 6));
-            is_inf_loop = 0;
-            if (is_arm == 1) {
-                out += "    stp x19, x20, [sp, #-16]!" + Chr(10);
-                out += "    mov x20, xzr" + Chr(10);
-                if (Trim(str1) == "rax") {
-                    out += "    mov x19, x0" + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                    out += "    mov x19, #0" + Chr(10);
-                }
-                else if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x19, #" + str1 + Chr(10);
-                }
-                else if (Trim(str1) == "A_Index") {
-                    out += "    mov x19, x20" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index80 = 0; A_Index80 < HTVM_Size(funcArgsArr); A_Index80++) {
-                            if (Trim(funcArgsArr[A_Index80]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x19, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x19, [x9]" + Chr(10);
-                    }
-                }
-                if (is_inf_loop == 1) {
-                    out += ".loop1_" + STR(loopCount1) + ":" + Chr(10);
-                } else {
-                    out += ".loop1_" + STR(loopCount1) + ":" + Chr(10) + "    cmp x19, #0" + Chr(10) + "    b.eq .loop1_end" + STR(loopCount1) + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Loop 1) ---
-                out += "push r90" + Chr(10);
-                out += "push r91" + Chr(10);
-                strSrc = str1;
-                if (str1 == "rax") {
-                    strSrc = "r0";
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                }
-                else if (str1 == "A_Index") {
-                    strSrc = "r20";
-                }
-                out += "mov r90, " + strSrc + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "loop1_" + STR(loopCount1) + ":" + Chr(10);
-                if (is_inf_loop != 1) {
-                    out += "cmp r91, r90" + Chr(10);
-                    out += "jge loop1_end" + STR(loopCount1) + Chr(10);
-                }
-                // Update A_Index alias (r20) to current loop iterator (r91)
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, " + str1 + Chr(10) + ".loop1_" + STR(loopCount1) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop1_end" + STR(loopCount1) + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, 0" + Chr(10) + ".loop1_" + STR(loopCount1) + ":" + Chr(10);
-                } else {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, [" + str1 + "]" + Chr(10) + ".loop1_" + STR(loopCount1) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop1_end" + STR(loopCount1) + Chr(10);
-                }
-            }
-        }
-        else if (Trim(A_LoopField69) == "loopend" || Trim(A_LoopField69) == "endloop" || Trim(A_LoopField69) == "loopend1" || Trim(A_LoopField69) == "endloop1") {
-            if (is_arm == 1) {
-                out += ".cloop1_end" + STR(loopCount1) + ":" + Chr(10) + "    add x20, x20, #1" + Chr(10) + "    sub x19, x19, #1" + Chr(10) + "    b .loop1_" + STR(loopCount1) + Chr(10) + ".loop1_end" + STR(loopCount1) + ":" + Chr(10) + "    ldp x19, x20, [sp], #16" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Loop 1 End) ---
-                out += "cloop1_end" + STR(loopCount1) + ":" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp loop1_" + STR(loopCount1) + Chr(10);
-                out += "loop1_end" + STR(loopCount1) + ":" + Chr(10);
-                out += "pop r91" + Chr(10);
-                out += "pop r90" + Chr(10);
-            } else {
-                out += ".cloop1_end" + STR(loopCount1) + ":" + Chr(10) + "inc r13" + Chr(10) + "dec r12" + Chr(10) + "jmp .loop1_" + STR(loopCount1) + Chr(10) + ".loop1_end" + STR(loopCount1) + ":" + Chr(10) + "pop r13" + Chr(10) + "pop r12" + Chr(10);
-            }
-            loopCount1++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 7) == "loop2, ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 7));
-            is_inf_loop = 0;
-            if (is_arm == 1) {
-                out += "    stp x19, x20, [sp, #-16]!" + Chr(10);
-                out += "    mov x20, xzr" + Chr(10);
-                if (Trim(str1) == "rax") {
-                    out += "    mov x19, x0" + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                    out += "    mov x19, #0" + Chr(10);
-                }
-                else if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x19, #" + str1 + Chr(10);
-                }
-                else if (Trim(str1) == "A_Index") {
-                    out += "    mov x19, x20" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index81 = 0; A_Index81 < HTVM_Size(funcArgsArr); A_Index81++) {
-                            if (Trim(funcArgsArr[A_Index81]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x19, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x19, [x9]" + Chr(10);
-                    }
-                }
-                if (is_inf_loop == 1) {
-                    out += ".loop2_" + STR(loopCount2) + ":" + Chr(10);
-                } else {
-                    out += ".loop2_" + STR(loopCount2) + ":" + Chr(10) + "    cmp x19, #0" + Chr(10) + "    b.eq .loop2_end" + STR(loopCount2) + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "push r90" + Chr(10);
-                out += "push r91" + Chr(10);
-                strSrc = str1;
-                if (str1 == "rax") {
-                    strSrc = "r0";
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                }
-                else if (str1 == "A_Index") {
-                    strSrc = "r20";
-                }
-                out += "mov r90, " + strSrc + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "loop2_" + STR(loopCount2) + ":" + Chr(10);
-                if (is_inf_loop != 1) {
-                    out += "cmp r91, r90" + Chr(10);
-                    out += "jge loop2_end" + STR(loopCount2) + Chr(10);
-                }
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, " + str1 + Chr(10) + ".loop2_" + STR(loopCount2) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop2_end" + STR(loopCount2) + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, 0" + Chr(10) + ".loop2_" + STR(loopCount2) + ":" + Chr(10);
-                } else {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, [" + str1 + "]" + Chr(10) + ".loop2_" + STR(loopCount2) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop2_end" + STR(loopCount2) + Chr(10);
-                }
-            }
-        }
-        else if (Trim(A_LoopField69) == "loopend2" || Trim(A_LoopField69) == "endloop2") {
-            if (is_arm == 1) {
-                out += ".cloop2_end" + STR(loopCount2) + ":" + Chr(10) + "    add x20, x20, #1" + Chr(10) + "    sub x19, x19, #1" + Chr(10) + "    b .loop2_" + STR(loopCount2) + Chr(10) + ".loop2_end" + STR(loopCount2) + ":" + Chr(10) + "    ldp x19, x20, [sp], #16" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Loop 2 End) ---
-                out += "cloop2_end" + STR(loopCount2) + ":" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp loop2_" + STR(loopCount2) + Chr(10);
-                out += "loop2_end" + STR(loopCount2) + ":" + Chr(10);
-                out += "pop r91" + Chr(10);
-                out += "pop r90" + Chr(10);
-                // Restore A_Index alias (r20) to the outer loop's iterator (r91)
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                out += ".cloop2_end" + STR(loopCount2) + ":" + Chr(10) + "inc r13" + Chr(10) + "dec r12" + Chr(10) + "jmp .loop2_" + STR(loopCount2) + Chr(10) + ".loop2_end" + STR(loopCount2) + ":" + Chr(10) + "pop r13" + Chr(10) + "pop r12" + Chr(10);
-            }
-            loopCount2++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 7) == "loop3, ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 7));
-            is_inf_loop = 0;
-            if (is_arm == 1) {
-                out += "    stp x19, x20, [sp, #-16]!" + Chr(10);
-                out += "    mov x20, xzr" + Chr(10);
-                if (Trim(str1) == "rax") {
-                    out += "    mov x19, x0" + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                    out += "    mov x19, #0" + Chr(10);
-                }
-                else if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x19, #" + str1 + Chr(10);
-                }
-                else if (Trim(str1) == "A_Index") {
-                    out += "    mov x19, x20" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index82 = 0; A_Index82 < HTVM_Size(funcArgsArr); A_Index82++) {
-                            if (Trim(funcArgsArr[A_Index82]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x19, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x19, [x9]" + Chr(10);
-                    }
-                }
-                if (is_inf_loop == 1) {
-                    out += ".loop3_" + STR(loopCount3) + ":" + Chr(10);
-                } else {
-                    out += ".loop3_" + STR(loopCount3) + ":" + Chr(10) + "    cmp x19, #0" + Chr(10) + "    b.eq .loop3_end" + STR(loopCount3) + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "push r90" + Chr(10);
-                out += "push r91" + Chr(10);
-                strSrc = str1;
-                if (str1 == "rax") {
-                    strSrc = "r0";
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                }
-                else if (str1 == "A_Index") {
-                    strSrc = "r20";
-                }
-                out += "mov r90, " + strSrc + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "loop3_" + STR(loopCount3) + ":" + Chr(10);
-                if (is_inf_loop != 1) {
-                    out += "cmp r91, r90" + Chr(10);
-                    out += "jge loop3_end" + STR(loopCount3) + Chr(10);
-                }
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, " + str1 + Chr(10) + ".loop3_" + STR(loopCount3) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop3_end" + STR(loopCount3) + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, 0" + Chr(10) + ".loop3_" + STR(loopCount3) + ":" + Chr(10);
-                } else {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, [" + str1 + "]" + Chr(10) + ".loop3_" + STR(loopCount3) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop3_end" + STR(loopCount3) + Chr(10);
-                }
-            }
-        }
-        else if (Trim(A_LoopField69) == "loopend3" || Trim(A_LoopField69) == "endloop3") {
-            if (is_arm == 1) {
-                out += ".cloop3_end" + STR(loopCount3) + ":" + Chr(10) + "    add x20, x20, #1" + Chr(10) + "    sub x19, x19, #1" + Chr(10) + "    b .loop3_" + STR(loopCount3) + Chr(10) + ".loop3_end" + STR(loopCount3) + ":" + Chr(10) + "    ldp x19, x20, [sp], #16" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Loop 3 End) ---
-                out += "cloop3_end" + STR(loopCount3) + ":" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp loop3_" + STR(loopCount3) + Chr(10);
-                out += "loop3_end" + STR(loopCount3) + ":" + Chr(10);
-                out += "pop r91" + Chr(10);
-                out += "pop r90" + Chr(10);
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                out += ".cloop3_end" + STR(loopCount3) + ":" + Chr(10) + "inc r13" + Chr(10) + "dec r12" + Chr(10) + "jmp .loop3_" + STR(loopCount3) + Chr(10) + ".loop3_end" + STR(loopCount3) + ":" + Chr(10) + "pop r13" + Chr(10) + "pop r12" + Chr(10);
-            }
-            loopCount3++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 7) == "loop4, ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 7));
-            is_inf_loop = 0;
-            if (is_arm == 1) {
-                out += "    stp x19, x20, [sp, #-16]!" + Chr(10);
-                out += "    mov x20, xzr" + Chr(10);
-                if (Trim(str1) == "rax") {
-                    out += "    mov x19, x0" + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                    out += "    mov x19, #0" + Chr(10);
-                }
-                else if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x19, #" + str1 + Chr(10);
-                }
-                else if (Trim(str1) == "A_Index") {
-                    out += "    mov x19, x20" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index83 = 0; A_Index83 < HTVM_Size(funcArgsArr); A_Index83++) {
-                            if (Trim(funcArgsArr[A_Index83]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x19, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x19, [x9]" + Chr(10);
-                    }
-                }
-                if (is_inf_loop == 1) {
-                    out += ".loop4_" + STR(loopCount4) + ":" + Chr(10);
-                } else {
-                    out += ".loop4_" + STR(loopCount4) + ":" + Chr(10) + "    cmp x19, #0" + Chr(10) + "    b.eq .loop4_end" + STR(loopCount4) + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "push r90" + Chr(10);
-                out += "push r91" + Chr(10);
-                strSrc = str1;
-                if (str1 == "rax") {
-                    strSrc = "r0";
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                }
-                else if (str1 == "A_Index") {
-                    strSrc = "r20";
-                }
-                out += "mov r90, " + strSrc + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "loop4_" + STR(loopCount4) + ":" + Chr(10);
-                if (is_inf_loop != 1) {
-                    out += "cmp r91, r90" + Chr(10);
-                    out += "jge loop4_end" + STR(loopCount4) + Chr(10);
-                }
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, " + str1 + Chr(10) + ".loop4_" + STR(loopCount4) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop4_end" + STR(loopCount4) + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, 0" + Chr(10) + ".loop4_" + STR(loopCount4) + ":" + Chr(10);
-                } else {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, [" + str1 + "]" + Chr(10) + ".loop4_" + STR(loopCount4) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop4_end" + STR(loopCount4) + Chr(10);
-                }
-            }
-        }
-        else if (Trim(A_LoopField69) == "loopend4" || Trim(A_LoopField69) == "endloop4") {
-            if (is_arm == 1) {
-                out += ".cloop4_end" + STR(loopCount4) + ":" + Chr(10) + "    add x20, x20, #1" + Chr(10) + "    sub x19, x19, #1" + Chr(10) + "    b .loop4_" + STR(loopCount4) + Chr(10) + ".loop4_end" + STR(loopCount4) + ":" + Chr(10) + "    ldp x19, x20, [sp], #16" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Loop 4 End) ---
-                out += "cloop4_end" + STR(loopCount4) + ":" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp loop4_" + STR(loopCount4) + Chr(10);
-                out += "loop4_end" + STR(loopCount4) + ":" + Chr(10);
-                out += "pop r91" + Chr(10);
-                out += "pop r90" + Chr(10);
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                out += ".cloop4_end" + STR(loopCount4) + ":" + Chr(10) + "inc r13" + Chr(10) + "dec r12" + Chr(10) + "jmp .loop4_" + STR(loopCount4) + Chr(10) + ".loop4_end" + STR(loopCount4) + ":" + Chr(10) + "pop r13" + Chr(10) + "pop r12" + Chr(10);
-            }
-            loopCount4++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 7) == "loop5, ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 7));
-            is_inf_loop = 0;
-            if (is_arm == 1) {
-                out += "    stp x19, x20, [sp, #-16]!" + Chr(10);
-                out += "    mov x20, xzr" + Chr(10);
-                if (Trim(str1) == "rax") {
-                    out += "    mov x19, x0" + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                    out += "    mov x19, #0" + Chr(10);
-                }
-                else if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x19, #" + str1 + Chr(10);
-                }
-                else if (Trim(str1) == "A_Index") {
-                    out += "    mov x19, x20" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index84 = 0; A_Index84 < HTVM_Size(funcArgsArr); A_Index84++) {
-                            if (Trim(funcArgsArr[A_Index84]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x19, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x19, [x9]" + Chr(10);
-                    }
-                }
-                if (is_inf_loop == 1) {
-                    out += ".loop5_" + STR(loopCount5) + ":" + Chr(10);
-                } else {
-                    out += ".loop5_" + STR(loopCount5) + ":" + Chr(10) + "    cmp x19, #0" + Chr(10) + "    b.eq .loop5_end" + STR(loopCount5) + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "push r90" + Chr(10);
-                out += "push r91" + Chr(10);
-                strSrc = str1;
-                if (str1 == "rax") {
-                    strSrc = "r0";
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                }
-                else if (str1 == "A_Index") {
-                    strSrc = "r20";
-                }
-                out += "mov r90, " + strSrc + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "loop5_" + STR(loopCount5) + ":" + Chr(10);
-                if (is_inf_loop != 1) {
-                    out += "cmp r91, r90" + Chr(10);
-                    out += "jge loop5_end" + STR(loopCount5) + Chr(10);
-                }
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, " + str1 + Chr(10) + ".loop5_" + STR(loopCount5) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop5_end" + STR(loopCount5) + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, 0" + Chr(10) + ".loop5_" + STR(loopCount5) + ":" + Chr(10);
-                } else {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, [" + str1 + "]" + Chr(10) + ".loop5_" + STR(loopCount5) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop5_end" + STR(loopCount5) + Chr(10);
-                }
-            }
-        }
-        else if (Trim(A_LoopField69) == "loopend5" || Trim(A_LoopField69) == "endloop5") {
-            if (is_arm == 1) {
-                out += ".cloop5_end" + STR(loopCount5) + ":" + Chr(10) + "    add x20, x20, #1" + Chr(10) + "    sub x19, x19, #1" + Chr(10) + "    b .loop5_" + STR(loopCount5) + Chr(10) + ".loop5_end" + STR(loopCount5) + ":" + Chr(10) + "    ldp x19, x20, [sp], #16" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Loop 5 End) ---
-                out += "cloop5_end" + STR(loopCount5) + ":" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp loop5_" + STR(loopCount5) + Chr(10);
-                out += "loop5_end" + STR(loopCount5) + ":" + Chr(10);
-                out += "pop r91" + Chr(10);
-                out += "pop r90" + Chr(10);
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                out += ".cloop5_end" + STR(loopCount5) + ":" + Chr(10) + "inc r13" + Chr(10) + "dec r12" + Chr(10) + "jmp .loop5_" + STR(loopCount5) + Chr(10) + ".loop5_end" + STR(loopCount5) + ":" + Chr(10) + "pop r13" + Chr(10) + "pop r12" + Chr(10);
-            }
-            loopCount5++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 7) == "loop6, ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 7));
-            is_inf_loop = 0;
-            if (is_arm == 1) {
-                out += "    stp x19, x20, [sp, #-16]!" + Chr(10);
-                out += "    mov x20, xzr" + Chr(10);
-                if (Trim(str1) == "rax") {
-                    out += "    mov x19, x0" + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                    out += "    mov x19, #0" + Chr(10);
-                }
-                else if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x19, #" + str1 + Chr(10);
-                }
-                else if (Trim(str1) == "A_Index") {
-                    out += "    mov x19, x20" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index85 = 0; A_Index85 < HTVM_Size(funcArgsArr); A_Index85++) {
-                            if (Trim(funcArgsArr[A_Index85]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x19, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x19, [x9]" + Chr(10);
-                    }
-                }
-                if (is_inf_loop == 1) {
-                    out += ".loop6_" + STR(loopCount6) + ":" + Chr(10);
-                } else {
-                    out += ".loop6_" + STR(loopCount6) + ":" + Chr(10) + "    cmp x19, #0" + Chr(10) + "    b.eq .loop6_end" + STR(loopCount6) + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "push r90" + Chr(10);
-                out += "push r91" + Chr(10);
-                strSrc = str1;
-                if (str1 == "rax") {
-                    strSrc = "r0";
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                }
-                else if (str1 == "A_Index") {
-                    strSrc = "r20";
-                }
-                out += "mov r90, " + strSrc + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "loop6_" + STR(loopCount6) + ":" + Chr(10);
-                if (is_inf_loop != 1) {
-                    out += "cmp r91, r90" + Chr(10);
-                    out += "jge loop6_end" + STR(loopCount6) + Chr(10);
-                }
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, " + str1 + Chr(10) + ".loop6_" + STR(loopCount6) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop6_end" + STR(loopCount6) + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, 0" + Chr(10) + ".loop6_" + STR(loopCount6) + ":" + Chr(10);
-                } else {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, [" + str1 + "]" + Chr(10) + ".loop6_" + STR(loopCount6) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop6_end" + STR(loopCount6) + Chr(10);
-                }
-            }
-        }
-        else if (Trim(A_LoopField69) == "loopend6" || Trim(A_LoopField69) == "endloop6") {
-            if (is_arm == 1) {
-                out += ".cloop6_end" + STR(loopCount6) + ":" + Chr(10) + "    add x20, x20, #1" + Chr(10) + "    sub x19, x19, #1" + Chr(10) + "    b .loop6_" + STR(loopCount6) + Chr(10) + ".loop6_end" + STR(loopCount6) + ":" + Chr(10) + "    ldp x19, x20, [sp], #16" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Loop 6 End) ---
-                out += "cloop6_end" + STR(loopCount6) + ":" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp loop6_" + STR(loopCount6) + Chr(10);
-                out += "loop6_end" + STR(loopCount6) + ":" + Chr(10);
-                out += "pop r91" + Chr(10);
-                out += "pop r90" + Chr(10);
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                out += ".cloop6_end" + STR(loopCount6) + ":" + Chr(10) + "inc r13" + Chr(10) + "dec r12" + Chr(10) + "jmp .loop6_" + STR(loopCount6) + Chr(10) + ".loop6_end" + STR(loopCount6) + ":" + Chr(10) + "pop r13" + Chr(10) + "pop r12" + Chr(10);
-            }
-            loopCount6++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 7) == "loop7, ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 7));
-            is_inf_loop = 0;
-            if (is_arm == 1) {
-                out += "    stp x19, x20, [sp, #-16]!" + Chr(10);
-                out += "    mov x20, xzr" + Chr(10);
-                if (Trim(str1) == "rax") {
-                    out += "    mov x19, x0" + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                    out += "    mov x19, #0" + Chr(10);
-                }
-                else if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x19, #" + str1 + Chr(10);
-                }
-                else if (Trim(str1) == "A_Index") {
-                    out += "    mov x19, x20" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index86 = 0; A_Index86 < HTVM_Size(funcArgsArr); A_Index86++) {
-                            if (Trim(funcArgsArr[A_Index86]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x19, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x19, [x9]" + Chr(10);
-                    }
-                }
-                if (is_inf_loop == 1) {
-                    out += ".loop7_" + STR(loopCount7) + ":" + Chr(10);
-                } else {
-                    out += ".loop7_" + STR(loopCount7) + ":" + Chr(10) + "    cmp x19, #0" + Chr(10) + "    b.eq .loop7_end" + STR(loopCount7) + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "push r90" + Chr(10);
-                out += "push r91" + Chr(10);
-                strSrc = str1;
-                if (str1 == "rax") {
-                    strSrc = "r0";
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                }
-                else if (str1 == "A_Index") {
-                    strSrc = "r20";
-                }
-                out += "mov r90, " + strSrc + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "loop7_" + STR(loopCount7) + ":" + Chr(10);
-                if (is_inf_loop != 1) {
-                    out += "cmp r91, r90" + Chr(10);
-                    out += "jge loop7_end" + STR(loopCount7) + Chr(10);
-                }
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, " + str1 + Chr(10) + ".loop7_" + STR(loopCount7) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop7_end" + STR(loopCount7) + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, 0" + Chr(10) + ".loop7_" + STR(loopCount7) + ":" + Chr(10);
-                } else {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, [" + str1 + "]" + Chr(10) + ".loop7_" + STR(loopCount7) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop7_end" + STR(loopCount7) + Chr(10);
-                }
-            }
-        }
-        else if (Trim(A_LoopField69) == "loopend7" || Trim(A_LoopField69) == "endloop7") {
-            if (is_arm == 1) {
-                out += ".cloop7_end" + STR(loopCount7) + ":" + Chr(10) + "    add x20, x20, #1" + Chr(10) + "    sub x19, x19, #1" + Chr(10) + "    b .loop7_" + STR(loopCount7) + Chr(10) + ".loop7_end" + STR(loopCount7) + ":" + Chr(10) + "    ldp x19, x20, [sp], #16" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Loop 7 End) ---
-                out += "cloop7_end" + STR(loopCount7) + ":" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp loop7_" + STR(loopCount7) + Chr(10);
-                out += "loop7_end" + STR(loopCount7) + ":" + Chr(10);
-                out += "pop r91" + Chr(10);
-                out += "pop r90" + Chr(10);
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                out += ".cloop7_end" + STR(loopCount7) + ":" + Chr(10) + "inc r13" + Chr(10) + "dec r12" + Chr(10) + "jmp .loop7_" + STR(loopCount7) + Chr(10) + ".loop7_end" + STR(loopCount7) + ":" + Chr(10) + "pop r13" + Chr(10) + "pop r12" + Chr(10);
-            }
-            loopCount7++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 7) == "loop8, ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 7));
-            is_inf_loop = 0;
-            if (is_arm == 1) {
-                out += "    stp x19, x20, [sp, #-16]!" + Chr(10);
-                out += "    mov x20, xzr" + Chr(10);
-                if (Trim(str1) == "rax") {
-                    out += "    mov x19, x0" + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                    out += "    mov x19, #0" + Chr(10);
-                }
-                else if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x19, #" + str1 + Chr(10);
-                }
-                else if (Trim(str1) == "A_Index") {
-                    out += "    mov x19, x20" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index87 = 0; A_Index87 < HTVM_Size(funcArgsArr); A_Index87++) {
-                            if (Trim(funcArgsArr[A_Index87]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x19, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x19, [x9]" + Chr(10);
-                    }
-                }
-                if (is_inf_loop == 1) {
-                    out += ".loop8_" + STR(loopCount8) + ":" + Chr(10);
-                } else {
-                    out += ".loop8_" + STR(loopCount8) + ":" + Chr(10) + "    cmp x19, #0" + Chr(10) + "    b.eq .loop8_end" + STR(loopCount8) + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "push r90" + Chr(10);
-                out += "push r91" + Chr(10);
-                strSrc = str1;
-                if (str1 == "rax") {
-                    strSrc = "r0";
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                }
-                else if (str1 == "A_Index") {
-                    strSrc = "r20";
-                }
-                out += "mov r90, " + strSrc + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "loop8_" + STR(loopCount8) + ":" + Chr(10);
-                if (is_inf_loop != 1) {
-                    out += "cmp r91, r90" + Chr(10);
-                    out += "jge loop8_end" + STR(loopCount8) + Chr(10);
-                }
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, " + str1 + Chr(10) + ".loop8_" + STR(loopCount8) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop8_end" + STR(loopCount8) + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, 0" + Chr(10) + ".loop8_" + STR(loopCount8) + ":" + Chr(10);
-                } else {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, [" + str1 + "]" + Chr(10) + ".loop8_" + STR(loopCount8) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop8_end" + STR(loopCount8) + Chr(10);
-                }
-            }
-        }
-        else if (Trim(A_LoopField69) == "loopend8" || Trim(A_LoopField69) == "endloop8") {
-            if (is_arm == 1) {
-                out += ".cloop8_end" + STR(loopCount8) + ":" + Chr(10) + "    add x20, x20, #1" + Chr(10) + "    sub x19, x19, #1" + Chr(10) + "    b .loop8_" + STR(loopCount8) + Chr(10) + ".loop8_end" + STR(loopCount8) + ":" + Chr(10) + "    ldp x19, x20, [sp], #16" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Loop 8 End) ---
-                out += "cloop8_end" + STR(loopCount8) + ":" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp loop8_" + STR(loopCount8) + Chr(10);
-                out += "loop8_end" + STR(loopCount8) + ":" + Chr(10);
-                out += "pop r91" + Chr(10);
-                out += "pop r90" + Chr(10);
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                out += ".cloop8_end" + STR(loopCount8) + ":" + Chr(10) + "inc r13" + Chr(10) + "dec r12" + Chr(10) + "jmp .loop8_" + STR(loopCount8) + Chr(10) + ".loop8_end" + STR(loopCount8) + ":" + Chr(10) + "pop r13" + Chr(10) + "pop r12" + Chr(10);
-            }
-            loopCount8++;
+        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangEndCPP)) {
+            COUNT_programmingBlock_CPP++;
+            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
+            programmingBlocksTemp += "programmingBlock_CPP-programmingBlock_CPP-AA" + STR(COUNT_programmingBlock_CPP) + "AA" + Chr(10);
+            HTVM_Append(programmingBlock_CPP, holdTempDataProgrammingBlockThenPutInArr);
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 0;
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 7) == "loop9, ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 7));
-            is_inf_loop = 0;
-            if (is_arm == 1) {
-                out += "    stp x19, x20, [sp, #-16]!" + Chr(10);
-                out += "    mov x20, xzr" + Chr(10);
-                if (Trim(str1) == "rax") {
-                    out += "    mov x19, x0" + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                    out += "    mov x19, #0" + Chr(10);
-                }
-                else if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x19, #" + str1 + Chr(10);
-                }
-                else if (Trim(str1) == "A_Index") {
-                    out += "    mov x19, x20" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index88 = 0; A_Index88 < HTVM_Size(funcArgsArr); A_Index88++) {
-                            if (Trim(funcArgsArr[A_Index88]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x19, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x19, [x9]" + Chr(10);
-                    }
-                }
-                if (is_inf_loop == 1) {
-                    out += ".loop9_" + STR(loopCount9) + ":" + Chr(10);
-                } else {
-                    out += ".loop9_" + STR(loopCount9) + ":" + Chr(10) + "    cmp x19, #0" + Chr(10) + "    b.eq .loop9_end" + STR(loopCount9) + Chr(10);
-                }
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "push r90" + Chr(10);
-                out += "push r91" + Chr(10);
-                strSrc = str1;
-                if (str1 == "rax") {
-                    strSrc = "r0";
-                }
-                else if (str1 == "-1") {
-                    is_inf_loop = 1;
-                }
-                else if (str1 == "A_Index") {
-                    strSrc = "r20";
-                }
-                out += "mov r90, " + strSrc + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "loop9_" + STR(loopCount9) + ":" + Chr(10);
-                if (is_inf_loop != 1) {
-                    out += "cmp r91, r90" + Chr(10);
-                    out += "jge loop9_end" + STR(loopCount9) + Chr(10);
-                }
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, " + str1 + Chr(10) + ".loop9_" + STR(loopCount9) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop9_end" + STR(loopCount9) + Chr(10);
-                }
-                else if (str1 == "-1") {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, 0" + Chr(10) + ".loop9_" + STR(loopCount9) + ":" + Chr(10);
-                } else {
-                    out += "push r12" + Chr(10) + "push r13" + Chr(10) + "xor r13, r13" + Chr(10) + "mov r12, [" + str1 + "]" + Chr(10) + ".loop9_" + STR(loopCount9) + ":" + Chr(10) + "cmp r12, 0" + Chr(10) + "je .loop9_end" + STR(loopCount9) + Chr(10);
-                }
-            }
+        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangEndPY)) {
+            COUNT_programmingBlock_PY++;
+            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
+            programmingBlocksTemp += "programmingBlock_PY-programmingBlock_PY-AA" + STR(COUNT_programmingBlock_PY) + "AA" + Chr(10);
+            HTVM_Append(programmingBlock_PY, holdTempDataProgrammingBlockThenPutInArr);
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 0;
         }
-        else if (Trim(A_LoopField69) == "loopend9" || Trim(A_LoopField69) == "endloop9") {
-            if (is_arm == 1) {
-                out += ".cloop9_end" + STR(loopCount9) + ":" + Chr(10) + "    add x20, x20, #1" + Chr(10) + "    sub x19, x19, #1" + Chr(10) + "    b .loop9_" + STR(loopCount9) + Chr(10) + ".loop9_end" + STR(loopCount9) + ":" + Chr(10) + "    ldp x19, x20, [sp], #16" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Loop 9 End) ---
-                out += "cloop9_end" + STR(loopCount9) + ":" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp loop9_" + STR(loopCount9) + Chr(10);
-                out += "loop9_end" + STR(loopCount9) + ":" + Chr(10);
-                out += "pop r91" + Chr(10);
-                out += "pop r90" + Chr(10);
-                out += "mov r20, r91" + Chr(10);
-            } else {
-                out += ".cloop9_end" + STR(loopCount9) + ":" + Chr(10) + "inc r13" + Chr(10) + "dec r12" + Chr(10) + "jmp .loop9_" + STR(loopCount9) + Chr(10) + ".loop9_end" + STR(loopCount9) + ":" + Chr(10) + "pop r13" + Chr(10) + "pop r12" + Chr(10);
-            }
-            loopCount9++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 3) == "if " || SubStr(StrLower(A_LoopField69), 1, 4) == "if1 ") {
-            isNum = 0;
-            str1 = Trim(StringTrimLeft(A_LoopField69, 3));
-            str1 = StringTrimLeft(str1, 1);
-            str1 = StringTrimRight(str1, 1);
-            if (InStr(str1, " = ")) {
-                str2 = Trim(StrSplit(str1, " = ", 1));
-                str3 = Trim(StrSplit(str1, " = ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    // --- LHS (str2) ---
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index89 = 0; A_Index89 < HTVM_Size(funcArgsArr); A_Index89++) {
-                            if (Trim(funcArgsArr[A_Index89]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    // --- RHS (str3) ---
-                    int isRhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index90 = 0; A_Index90 < HTVM_Size(funcArgsArr); A_Index90++) {
-                            if (Trim(funcArgsArr[A_Index90]) == str3) {
-                                isRhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str3 == "rax") {
-                        out += "    mov x10, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    mov x10, x20" + Chr(10);
-                    }
-                    else if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    }
-                    else if (isRhsStackVar == 1) {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.ne .end_if1_" + STR(ifCount1) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if = -> jne) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jne end_if1_" + STR(ifCount1) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jne .end_if1_" + STR(ifCount1) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jne .end_if1_" + STR(ifCount1) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " != ")) {
-                str2 = Trim(StrSplit(str1, " != ", 1));
-                str3 = Trim(StrSplit(str1, " != ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index91 = 0; A_Index91 < HTVM_Size(funcArgsArr); A_Index91++) {
-                            if (Trim(funcArgsArr[A_Index91]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index92 = 0; A_Index92 < HTVM_Size(funcArgsArr); A_Index92++) {
-                                if (Trim(funcArgsArr[A_Index92]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.eq .end_if1_" + STR(ifCount1) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if != -> je) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "je end_if1_" + STR(ifCount1) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "je .end_if1_" + STR(ifCount1) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "je .end_if1_" + STR(ifCount1) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " > ")) {
-                str2 = Trim(StrSplit(str1, " > ", 1));
-                str3 = Trim(StrSplit(str1, " > ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index93 = 0; A_Index93 < HTVM_Size(funcArgsArr); A_Index93++) {
-                            if (Trim(funcArgsArr[A_Index93]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index94 = 0; A_Index94 < HTVM_Size(funcArgsArr); A_Index94++) {
-                                if (Trim(funcArgsArr[A_Index94]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.le .end_if1_" + STR(ifCount1) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if > -> jle) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jle end_if1_" + STR(ifCount1) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jle .end_if1_" + STR(ifCount1) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jle .end_if1_" + STR(ifCount1) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " < ")) {
-                str2 = Trim(StrSplit(str1, " < ", 1));
-                str3 = Trim(StrSplit(str1, " < ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index95 = 0; A_Index95 < HTVM_Size(funcArgsArr); A_Index95++) {
-                            if (Trim(funcArgsArr[A_Index95]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index96 = 0; A_Index96 < HTVM_Size(funcArgsArr); A_Index96++) {
-                                if (Trim(funcArgsArr[A_Index96]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.ge .end_if1_" + STR(ifCount1) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if < -> jge) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jge end_if1_" + STR(ifCount1) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jge .end_if1_" + STR(ifCount1) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jge .end_if1_" + STR(ifCount1) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " >= ")) {
-                str2 = Trim(StrSplit(str1, " >= ", 1));
-                str3 = Trim(StrSplit(str1, " >= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index97 = 0; A_Index97 < HTVM_Size(funcArgsArr); A_Index97++) {
-                            if (Trim(funcArgsArr[A_Index97]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index98 = 0; A_Index98 < HTVM_Size(funcArgsArr); A_Index98++) {
-                                if (Trim(funcArgsArr[A_Index98]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.lt .end_if1_" + STR(ifCount1) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if >= -> jl) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jl end_if1_" + STR(ifCount1) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jl .end_if1_" + STR(ifCount1) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jl .end_if1_" + STR(ifCount1) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " <= ")) {
-                str2 = Trim(StrSplit(str1, " <= ", 1));
-                str3 = Trim(StrSplit(str1, " <= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index99 = 0; A_Index99 < HTVM_Size(funcArgsArr); A_Index99++) {
-                            if (Trim(funcArgsArr[A_Index99]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index100 = 0; A_Index100 < HTVM_Size(funcArgsArr); A_Index100++) {
-                                if (Trim(funcArgsArr[A_Index100]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.gt .end_if1_" + STR(ifCount1) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if <= -> jg) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jg end_if1_" + STR(ifCount1) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jg .end_if1_" + STR(ifCount1) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jg .end_if1_" + STR(ifCount1) + Chr(10);
-                    }
-                }
-            }
+        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangEndJS)) {
+            COUNT_programmingBlock_JS++;
+            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
+            programmingBlocksTemp += "programmingBlock_JS-programmingBlock_JS-AA" + STR(COUNT_programmingBlock_JS) + "AA" + Chr(10);
+            HTVM_Append(programmingBlock_JS, holdTempDataProgrammingBlockThenPutInArr);
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 0;
         }
-        else if (Trim(A_LoopField69) == "ifend" || Trim(A_LoopField69) == "endif" || Trim(A_LoopField69) == "ifend1" || Trim(A_LoopField69) == "endif1") {
-            if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "end_if1_" + STR(ifCount1) + ":" + Chr(10);
-            } else {
-                out += ".end_if1_" + STR(ifCount1) + ":" + Chr(10);
-            }
-            ifCount1++;
+        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangEndGO)) {
+            COUNT_programmingBlock_GO++;
+            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
+            programmingBlocksTemp += "programmingBlock_GO-programmingBlock_GO-AA" + STR(COUNT_programmingBlock_GO) + "AA" + Chr(10);
+            HTVM_Append(programmingBlock_GO, holdTempDataProgrammingBlockThenPutInArr);
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 0;
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 4) == "if2 ") {
-            isNum = 0;
-            str1 = Trim(StringTrimLeft(A_LoopField69, 4));
-            str1 = StringTrimLeft(str1, 1);
-            str1 = StringTrimRight(str1, 1);
-            if (InStr(str1, " = ")) {
-                str2 = Trim(StrSplit(str1, " = ", 1));
-                str3 = Trim(StrSplit(str1, " = ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    // --- LHS (str2) ---
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index101 = 0; A_Index101 < HTVM_Size(funcArgsArr); A_Index101++) {
-                            if (Trim(funcArgsArr[A_Index101]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    // --- RHS (str3) ---
-                    int isRhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index102 = 0; A_Index102 < HTVM_Size(funcArgsArr); A_Index102++) {
-                            if (Trim(funcArgsArr[A_Index102]) == str3) {
-                                isRhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str3 == "rax") {
-                        out += "    mov x10, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    mov x10, x20" + Chr(10);
-                    }
-                    else if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    }
-                    else if (isRhsStackVar == 1) {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.ne .end_if2_" + STR(ifCount2) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if2 = -> jne) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jne end_if2_" + STR(ifCount2) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jne .end_if2_" + STR(ifCount2) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jne .end_if2_" + STR(ifCount2) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " != ")) {
-                str2 = Trim(StrSplit(str1, " != ", 1));
-                str3 = Trim(StrSplit(str1, " != ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index103 = 0; A_Index103 < HTVM_Size(funcArgsArr); A_Index103++) {
-                            if (Trim(funcArgsArr[A_Index103]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index104 = 0; A_Index104 < HTVM_Size(funcArgsArr); A_Index104++) {
-                                if (Trim(funcArgsArr[A_Index104]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.eq .end_if2_" + STR(ifCount2) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if2 != -> je) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "je end_if2_" + STR(ifCount2) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "je .end_if2_" + STR(ifCount2) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "je .end_if2_" + STR(ifCount2) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " > ")) {
-                str2 = Trim(StrSplit(str1, " > ", 1));
-                str3 = Trim(StrSplit(str1, " > ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index105 = 0; A_Index105 < HTVM_Size(funcArgsArr); A_Index105++) {
-                            if (Trim(funcArgsArr[A_Index105]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index106 = 0; A_Index106 < HTVM_Size(funcArgsArr); A_Index106++) {
-                                if (Trim(funcArgsArr[A_Index106]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.le .end_if2_" + STR(ifCount2) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if2 > -> jle) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jle end_if2_" + STR(ifCount2) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jle .end_if2_" + STR(ifCount2) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jle .end_if2_" + STR(ifCount2) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " < ")) {
-                str2 = Trim(StrSplit(str1, " < ", 1));
-                str3 = Trim(StrSplit(str1, " < ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index107 = 0; A_Index107 < HTVM_Size(funcArgsArr); A_Index107++) {
-                            if (Trim(funcArgsArr[A_Index107]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index108 = 0; A_Index108 < HTVM_Size(funcArgsArr); A_Index108++) {
-                                if (Trim(funcArgsArr[A_Index108]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.ge .end_if2_" + STR(ifCount2) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if2 < -> jge) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jge end_if2_" + STR(ifCount2) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jge .end_if2_" + STR(ifCount2) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jge .end_if2_" + STR(ifCount2) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " >= ")) {
-                str2 = Trim(StrSplit(str1, " >= ", 1));
-                str3 = Trim(StrSplit(str1, " >= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index109 = 0; A_Index109 < HTVM_Size(funcArgsArr); A_Index109++) {
-                            if (Trim(funcArgsArr[A_Index109]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index110 = 0; A_Index110 < HTVM_Size(funcArgsArr); A_Index110++) {
-                                if (Trim(funcArgsArr[A_Index110]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.lt .end_if2_" + STR(ifCount2) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if2 >= -> jl) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jl end_if2_" + STR(ifCount2) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jl .end_if2_" + STR(ifCount2) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jl .end_if2_" + STR(ifCount2) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " <= ")) {
-                str2 = Trim(StrSplit(str1, " <= ", 1));
-                str3 = Trim(StrSplit(str1, " <= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index111 = 0; A_Index111 < HTVM_Size(funcArgsArr); A_Index111++) {
-                            if (Trim(funcArgsArr[A_Index111]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index112 = 0; A_Index112 < HTVM_Size(funcArgsArr); A_Index112++) {
-                                if (Trim(funcArgsArr[A_Index112]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.gt .end_if2_" + STR(ifCount2) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if2 <= -> jg) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jg end_if2_" + STR(ifCount2) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jg .end_if2_" + STR(ifCount2) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jg .end_if2_" + STR(ifCount2) + Chr(10);
-                    }
-                }
-            }
+        else if (inProgarmmingBlock == 1) {
+            holdTempDataProgrammingBlockThenPutInArr += A_LoopField26 + Chr(10);
+        }
+        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangStart)) {
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 1;
+        }
+        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangStartCPP)) {
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 1;
+        }
+        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangStartPY)) {
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 1;
+        }
+        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangStartJS)) {
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 1;
+        }
+        else if (Trim(StrLower(A_LoopField26)) == StrLower(keyWordCodeInTheTranspiledLangStartGO)) {
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 1;
+        } else {
+            programmingBlocksTemp += A_LoopField26 + Chr(10);
+        }
+    }
+    code = StringTrimRight(programmingBlocksTemp, 1);
+    //programmingBlock_InTheTranspiledLang
+    //programmingBlock_CPP
+    //programmingBlock_PY
+    //programmingBlock_JS
+    //programmingBlock_GO
+    // PROGRAMMING BLOCK
+    // PROGRAMMING BLOCK
+    // PROGRAMMING BLOCK
+    // PROGRAMMING BLOCK
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    // this is the start of include
+    // this is the start of include
+    // this is the start of include
+    // this is the start of include
+    HTLL_pass("include resolution");
+    if (doseHaveInclude(code)) {
+        // Walk the include graph once; each file is read and lexed at most once per process.
+        code = HTLL_resolveIncludes(code);
+    }
+    // this is the end of include
+    //;;;;;;;;;;;;;;;;;;;;;;;
+    //;;;;;;;;;;;;;;;;;;;;;;;
+    //;;;;;;;;;;;;;;;;;;;;;;;
+    HTLL_pass("programming blocks");
+    programmingBlocksTemp = "";
+    inProgarmmingBlock = 0;
+    holdTempDataProgrammingBlockThenPutInArr = "";
+    std::vector<std::string> items30 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index30 = 0; A_Index30 < items30.size(); A_Index30++) {
+        std::string A_LoopField30 = items30[A_Index30 - 0];
+        if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangEnd)) {
+            COUNT_programmingBlock_InTheTranspiledLang++;
+            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
+            programmingBlocksTemp += "programmingBlock_InTheTranspiledLang-programmingBlock_InTheTranspiledLang-AA" + STR(COUNT_programmingBlock_InTheTranspiledLang) + "AA" + Chr(10);
+            HTVM_Append(programmingBlock_InTheTranspiledLang, holdTempDataProgrammingBlockThenPutInArr);
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 0;
         }
-        else if (Trim(A_LoopField69) == "ifend2" || Trim(A_LoopField69) == "endif2") {
-            if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "end_if2_" + STR(ifCount2) + ":" + Chr(10);
-            } else {
-                out += ".end_if2_" + STR(ifCount2) + ":" + Chr(10);
-            }
-            ifCount2++;
+        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangEndCPP)) {
+            COUNT_programmingBlock_CPP++;
+            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
+            programmingBlocksTemp += "programmingBlock_CPP-programmingBlock_CPP-AA" + STR(COUNT_programmingBlock_CPP) + "AA" + Chr(10);
+            HTVM_Append(programmingBlock_CPP, holdTempDataProgrammingBlockThenPutInArr);
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 0;
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 4) == "if3 ") {
-            isNum = 0;
-            str1 = Trim(StringTrimLeft(A_LoopField69, 4));
-            str1 = StringTrimLeft(str1, 1);
-            str1 = StringTrimRight(str1, 1);
-            if (InStr(str1, " = ")) {
-                str2 = Trim(StrSplit(str1, " = ", 1));
-                str3 = Trim(StrSplit(str1, " = ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index113 = 0; A_Index113 < HTVM_Size(funcArgsArr); A_Index113++) {
-                            if (Trim(funcArgsArr[A_Index113]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    int isRhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index114 = 0; A_Index114 < HTVM_Size(funcArgsArr); A_Index114++) {
-                            if (Trim(funcArgsArr[A_Index114]) == str3) {
-                                isRhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str3 == "rax") {
-                        out += "    mov x10, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    mov x10, x20" + Chr(10);
-                    }
-                    else if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    }
-                    else if (isRhsStackVar == 1) {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.ne .end_if3_" + STR(ifCount3) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if3 = -> jne) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jne end_if3_" + STR(ifCount3) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jne .end_if3_" + STR(ifCount3) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jne .end_if3_" + STR(ifCount3) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " != ")) {
-                str2 = Trim(StrSplit(str1, " != ", 1));
-                str3 = Trim(StrSplit(str1, " != ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index115 = 0; A_Index115 < HTVM_Size(funcArgsArr); A_Index115++) {
-                            if (Trim(funcArgsArr[A_Index115]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index116 = 0; A_Index116 < HTVM_Size(funcArgsArr); A_Index116++) {
-                                if (Trim(funcArgsArr[A_Index116]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.eq .end_if3_" + STR(ifCount3) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if3 != -> je) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "je end_if3_" + STR(ifCount3) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "je .end_if3_" + STR(ifCount3) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "je .end_if3_" + STR(ifCount3) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " > ")) {
-                str2 = Trim(StrSplit(str1, " > ", 1));
-                str3 = Trim(StrSplit(str1, " > ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index117 = 0; A_Index117 < HTVM_Size(funcArgsArr); A_Index117++) {
-                            if (Trim(funcArgsArr[A_Index117]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index118 = 0; A_Index118 < HTVM_Size(funcArgsArr); A_Index118++) {
-                                if (Trim(funcArgsArr[A_Index118]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.le .end_if3_" + STR(ifCount3) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if3 > -> jle) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jle end_if3_" + STR(ifCount3) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jle .end_if3_" + STR(ifCount3) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jle .end_if3_" + STR(ifCount3) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " < ")) {
-                str2 = Trim(StrSplit(str1, " < ", 1));
-                str3 = Trim(StrSplit(str1, " < ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index119 = 0; A_Index119 < HTVM_Size(funcArgsArr); A_Index119++) {
-                            if (Trim(funcArgsArr[A_Index119]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index120 = 0; A_Index120 < HTVM_Size(funcArgsArr); A_Index120++) {
-                                if (Trim(funcArgsArr[A_Index120]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.ge .end_if3_" + STR(ifCount3) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if3 < -> jge) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jge end_if3_" + STR(ifCount3) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jge .end_if3_" + STR(ifCount3) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jge .end_if3_" + STR(ifCount3) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " >= ")) {
-                str2 = Trim(StrSplit(str1, " >= ", 1));
-                str3 = Trim(StrSplit(str1, " >= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index121 = 0; A_Index121 < HTVM_Size(funcArgsArr); A_Index121++) {
-                            if (Trim(funcArgsArr[A_Index121]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index122 = 0; A_Index122 < HTVM_Size(funcArgsArr); A_Index122++) {
-                                if (Trim(funcArgsArr[A_Index122]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.lt .end_if3_" + STR(ifCount3) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if3 >= -> jl) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jl end_if3_" + STR(ifCount3) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jl .end_if3_" + STR(ifCount3) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jl .end_if3_" + STR(ifCount3) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " <= ")) {
-                str2 = Trim(StrSplit(str1, " <= ", 1));
-                str3 = Trim(StrSplit(str1, " <= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index123 = 0; A_Index123 < HTVM_Size(funcArgsArr); A_Index123++) {
-                            if (Trim(funcArgsArr[A_Index123]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index124 = 0; A_Index124 < HTVM_Size(funcArgsArr); A_Index124++) {
-                                if (Trim(funcArgsArr[A_Index124]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10) + "    b.gt .end_if3_" + STR(ifCount3) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    // --- ORYX IR (if3 <= -> jg) ---
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jg end_if3_" + STR(ifCount3) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jg .end_if3_" + STR(ifCount3) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jg .end_if3_" + STR(ifCount3) + Chr(10);
-                    }
+        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangEndPY)) {
+            COUNT_programmingBlock_PY++;
+            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
+            programmingBlocksTemp += "programmingBlock_PY-programmingBlock_PY-AA" + STR(COUNT_programmingBlock_PY) + "AA" + Chr(10);
+            HTVM_Append(programmingBlock_PY, holdTempDataProgrammingBlockThenPutInArr);
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 0;
+        }
+        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangEndJS)) {
+            COUNT_programmingBlock_JS++;
+            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
+            programmingBlocksTemp += "programmingBlock_JS-programmingBlock_JS-AA" + STR(COUNT_programmingBlock_JS) + "AA" + Chr(10);
+            HTVM_Append(programmingBlock_JS, holdTempDataProgrammingBlockThenPutInArr);
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 0;
+        }
+        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangEndGO)) {
+            COUNT_programmingBlock_GO++;
+            holdTempDataProgrammingBlockThenPutInArr = StringTrimRight(holdTempDataProgrammingBlockThenPutInArr, 1);
+            programmingBlocksTemp += "programmingBlock_GO-programmingBlock_GO-AA" + STR(COUNT_programmingBlock_GO) + "AA" + Chr(10);
+            HTVM_Append(programmingBlock_GO, holdTempDataProgrammingBlockThenPutInArr);
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 0;
+        }
+        else if (inProgarmmingBlock == 1) {
+            holdTempDataProgrammingBlockThenPutInArr += A_LoopField30 + Chr(10);
+        }
+        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangStart)) {
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 1;
+        }
+        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangStartCPP)) {
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 1;
+        }
+        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangStartPY)) {
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 1;
+        }
+        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangStartJS)) {
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 1;
+        }
+        else if (Trim(StrLower(A_LoopField30)) == StrLower(keyWordCodeInTheTranspiledLangStartGO)) {
+            holdTempDataProgrammingBlockThenPutInArr = "";
+            inProgarmmingBlock = 1;
+        } else {
+            programmingBlocksTemp += A_LoopField30 + Chr(10);
+        }
+    }
+    code = StringTrimRight(programmingBlocksTemp, 1);
+    //programmingBlock_InTheTranspiledLang
+    //programmingBlock_CPP
+    //programmingBlock_PY
+    //programmingBlock_JS
+    //programmingBlock_GO
+    // PROGRAMMING BLOCK
+    // PROGRAMMING BLOCK
+    // PROGRAMMING BLOCK
+    // PROGRAMMING BLOCK
+    HTLL_pass("cleanUpFirst");
+    code = cleanUpFirst(code);
+    HTLL_pass("preserveStrings");
+    code = preserveStrings(code, literals);
+    HTLL_pass("handleComments");
+    code = handleComments(code);
+    HTLL_pass("brace formatting");
+    code = formatCurlyBracesForParsing(code);
+    HTLL_pass("expression lowering");
+    out = "";
+    std::vector<std::string> items31 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index31 = 0; A_Index31 < items31.size(); A_Index31++) {
+        std::string A_LoopField31 = items31[A_Index31 - 0];
+        if (InStr(A_LoopField31, " := ") || InStr(A_LoopField31, " += ") || InStr(A_LoopField31, " -= ") || InStr(A_LoopField31, " *= ") || InStr(A_LoopField31, " //= ") || InStr(A_LoopField31, " %= ") || InStr(A_LoopField31, " <<= ") || InStr(A_LoopField31, " >>= ") || InStr(A_LoopField31, " &= ") || InStr(A_LoopField31, " |= ") || InStr(A_LoopField31, " ^= ")) {
+            str1 = Trim(A_LoopField31);
+            if (InStr(A_LoopField31, " + ") || InStr(A_LoopField31, " - ") || InStr(A_LoopField31, " * ") || InStr(A_LoopField31, " // ") || InStr(A_LoopField31, " % ") || InStr(A_LoopField31, " << ") || InStr(A_LoopField31, " >> ") || InStr(A_LoopField31, " & ") || InStr(A_LoopField31, " | ") || InStr(A_LoopField31, " ^ ")) {
+                if (InStr(A_LoopField31, " := ")) {
+                    str10 = ":=";
                 }
-            }
-        }
-        else if (Trim(A_LoopField69) == "ifend3" || Trim(A_LoopField69) == "endif3") {
-            if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "end_if3_" + STR(ifCount3) + ":" + Chr(10);
-            } else {
-                out += ".end_if3_" + STR(ifCount3) + ":" + Chr(10);
-            }
-            ifCount3++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 4) == "if4 ") {
-            isNum = 0;
-            str1 = Trim(StringTrimLeft(A_LoopField69, 4));
-            str1 = StringTrimLeft(str1, 1);
-            str1 = StringTrimRight(str1, 1);
-            if (InStr(str1, " = ")) {
-                str2 = Trim(StrSplit(str1, " = ", 1));
-                str3 = Trim(StrSplit(str1, " = ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index125 = 0; A_Index125 < HTVM_Size(funcArgsArr); A_Index125++) {
-                            if (Trim(funcArgsArr[A_Index125]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    int isRhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index126 = 0; A_Index126 < HTVM_Size(funcArgsArr); A_Index126++) {
-                            if (Trim(funcArgsArr[A_Index126]) == str3) {
-                                isRhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str3 == "rax") {
-                        out += "    mov x10, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    mov x10, x20" + Chr(10);
-                    }
-                    else if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    }
-                    else if (isRhsStackVar == 1) {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                        out += "    ldr x10, [x10]" + Chr(10);
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ne .end_if4_" + STR(ifCount4) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jne end_if4_" + STR(ifCount4) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jne .end_if4_" + STR(ifCount4) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jne .end_if4_" + STR(ifCount4) + Chr(10);
-                    }
+                else if (InStr(A_LoopField31, " += ")) {
+                    str10 = "+=";
                 }
-            }
-            else if (InStr(str1, " != ")) {
-                str2 = Trim(StrSplit(str1, " != ", 1));
-                str3 = Trim(StrSplit(str1, " != ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index127 = 0; A_Index127 < HTVM_Size(funcArgsArr); A_Index127++) {
-                            if (Trim(funcArgsArr[A_Index127]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index128 = 0; A_Index128 < HTVM_Size(funcArgsArr); A_Index128++) {
-                                if (Trim(funcArgsArr[A_Index128]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.eq .end_if4_" + STR(ifCount4) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "je end_if4_" + STR(ifCount4) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "je .end_if4_" + STR(ifCount4) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "je .end_if4_" + STR(ifCount4) + Chr(10);
-                    }
+                else if (InStr(A_LoopField31, " -= ")) {
+                    str10 = "-=";
                 }
-            }
-            else if (InStr(str1, " > ")) {
-                str2 = Trim(StrSplit(str1, " > ", 1));
-                str3 = Trim(StrSplit(str1, " > ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index129 = 0; A_Index129 < HTVM_Size(funcArgsArr); A_Index129++) {
-                            if (Trim(funcArgsArr[A_Index129]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index130 = 0; A_Index130 < HTVM_Size(funcArgsArr); A_Index130++) {
-                                if (Trim(funcArgsArr[A_Index130]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.le .end_if4_" + STR(ifCount4) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jle end_if4_" + STR(ifCount4) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jle .end_if4_" + STR(ifCount4) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jle .end_if4_" + STR(ifCount4) + Chr(10);
-                    }
+                else if (InStr(A_LoopField31, " *= ")) {
+                    str10 = "*=";
                 }
-            }
-            else if (InStr(str1, " < ")) {
-                str2 = Trim(StrSplit(str1, " < ", 1));
-                str3 = Trim(StrSplit(str1, " < ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index131 = 0; A_Index131 < HTVM_Size(funcArgsArr); A_Index131++) {
-                            if (Trim(funcArgsArr[A_Index131]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index132 = 0; A_Index132 < HTVM_Size(funcArgsArr); A_Index132++) {
-                                if (Trim(funcArgsArr[A_Index132]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ge .end_if4_" + STR(ifCount4) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jge end_if4_" + STR(ifCount4) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jge .end_if4_" + STR(ifCount4) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jge .end_if4_" + STR(ifCount4) + Chr(10);
-                    }
+                else if (InStr(A_LoopField31, " //= ")) {
+                    str10 = "//=";
                 }
-            }
-            else if (InStr(str1, " >= ")) {
-                str2 = Trim(StrSplit(str1, " >= ", 1));
-                str3 = Trim(StrSplit(str1, " >= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index133 = 0; A_Index133 < HTVM_Size(funcArgsArr); A_Index133++) {
-                            if (Trim(funcArgsArr[A_Index133]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index134 = 0; A_Index134 < HTVM_Size(funcArgsArr); A_Index134++) {
-                                if (Trim(funcArgsArr[A_Index134]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.lt .end_if4_" + STR(ifCount4) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jl end_if4_" + STR(ifCount4) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jl .end_if4_" + STR(ifCount4) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jl .end_if4_" + STR(ifCount4) + Chr(10);
-                    }
+                else if (InStr(A_LoopField31, " %= ")) {
+                    str10 = "%=";
                 }
-            }
-            else if (InStr(str1, " <= ")) {
-                str2 = Trim(StrSplit(str1, " <= ", 1));
-                str3 = Trim(StrSplit(str1, " <= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index135 = 0; A_Index135 < HTVM_Size(funcArgsArr); A_Index135++) {
-                            if (Trim(funcArgsArr[A_Index135]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index136 = 0; A_Index136 < HTVM_Size(funcArgsArr); A_Index136++) {
-                                if (Trim(funcArgsArr[A_Index136]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.gt .end_if4_" + STR(ifCount4) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jg end_if4_" + STR(ifCount4) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jg .end_if4_" + STR(ifCount4) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jg .end_if4_" + STR(ifCount4) + Chr(10);
-                    }
+                else if (InStr(A_LoopField31, " <<= ")) {
+                    str10 = "<<=";
                 }
-            }
-        }
-        else if (Trim(A_LoopField69) == "ifend4" || Trim(A_LoopField69) == "endif4") {
-            if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "end_if4_" + STR(ifCount4) + ":" + Chr(10);
-            } else {
-                out += ".end_if4_" + STR(ifCount4) + ":" + Chr(10);
-            }
-            ifCount4++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 4) == "if5 ") {
-            isNum = 0;
-            str1 = Trim(StringTrimLeft(A_LoopField69, 4));
-            str1 = StringTrimLeft(str1, 1);
-            str1 = StringTrimRight(str1, 1);
-            if (InStr(str1, " = ")) {
-                str2 = Trim(StrSplit(str1, " = ", 1));
-                str3 = Trim(StrSplit(str1, " = ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index137 = 0; A_Index137 < HTVM_Size(funcArgsArr); A_Index137++) {
-                            if (Trim(funcArgsArr[A_Index137]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    int isRhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index138 = 0; A_Index138 < HTVM_Size(funcArgsArr); A_Index138++) {
-                            if (Trim(funcArgsArr[A_Index138]) == str3) {
-                                isRhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str3 == "rax") {
-                        out += "    mov x10, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    mov x10, x20" + Chr(10);
-                    }
-                    else if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    }
-                    else if (isRhsStackVar == 1) {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                        out += "    ldr x10, [x10]" + Chr(10);
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ne .end_if5_" + STR(ifCount5) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jne end_if5_" + STR(ifCount5) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jne .end_if5_" + STR(ifCount5) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jne .end_if5_" + STR(ifCount5) + Chr(10);
-                    }
+                else if (InStr(A_LoopField31, " >>= ")) {
+                    str10 = ">>=";
                 }
-            }
-            else if (InStr(str1, " != ")) {
-                str2 = Trim(StrSplit(str1, " != ", 1));
-                str3 = Trim(StrSplit(str1, " != ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index139 = 0; A_Index139 < HTVM_Size(funcArgsArr); A_Index139++) {
-                            if (Trim(funcArgsArr[A_Index139]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index140 = 0; A_Index140 < HTVM_Size(funcArgsArr); A_Index140++) {
-                                if (Trim(funcArgsArr[A_Index140]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.eq .end_if5_" + STR(ifCount5) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "je end_if5_" + STR(ifCount5) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "je .end_if5_" + STR(ifCount5) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "je .end_if5_" + STR(ifCount5) + Chr(10);
-                    }
+                else if (InStr(A_LoopField31, " &= ")) {
+                    str10 = "&=";
                 }
-            }
-            else if (InStr(str1, " > ")) {
-                str2 = Trim(StrSplit(str1, " > ", 1));
-                str3 = Trim(StrSplit(str1, " > ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index141 = 0; A_Index141 < HTVM_Size(funcArgsArr); A_Index141++) {
-                            if (Trim(funcArgsArr[A_Index141]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index142 = 0; A_Index142 < HTVM_Size(funcArgsArr); A_Index142++) {
-                                if (Trim(funcArgsArr[A_Index142]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.le .end_if5_" + STR(ifCount5) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jle end_if5_" + STR(ifCount5) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jle .end_if5_" + STR(ifCount5) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jle .end_if5_" + STR(ifCount5) + Chr(10);
-                    }
+                else if (InStr(A_LoopField31, " |= ")) {
+                    str10 = "|=";
                 }
-            }
-            else if (InStr(str1, " < ")) {
-                str2 = Trim(StrSplit(str1, " < ", 1));
-                str3 = Trim(StrSplit(str1, " < ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index143 = 0; A_Index143 < HTVM_Size(funcArgsArr); A_Index143++) {
-                            if (Trim(funcArgsArr[A_Index143]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index144 = 0; A_Index144 < HTVM_Size(funcArgsArr); A_Index144++) {
-                                if (Trim(funcArgsArr[A_Index144]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ge .end_if5_" + STR(ifCount5) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jge end_if5_" + STR(ifCount5) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jge .end_if5_" + STR(ifCount5) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jge .end_if5_" + STR(ifCount5) + Chr(10);
+                else if (InStr(A_LoopField31, " ^= ")) {
+                    str10 = "^=";
+                }
+                //;;;; code here
+                //;;;; code here
+                // x := x + 5 * 7 // var1
+                // becomes one statement that the back end evaluates in registers (HTLL_lowerExpression)
+                // ___HTLL_expr___ x := x + 5 * 7 // var1
+                str2 = Trim(StrSplit(str1, str10, 1));
+                str3 = Trim(StrSplit(str1, str10, 2));
+                if (SubStr(StrLower(str2), 1, 4) == "int " || SubStr(StrLower(str2), 1, 5) == "nint ") {
+                    out += str2 + " := 0" + Chr(10);
+                    str2 = Trim(StrSplit(str2, " ", 2));
+                }
+                str4 = "";
+                std::vector<std::string> items32 = LoopParseFunc(str3, " ");
+                for (size_t A_Index32 = 0; A_Index32 < items32.size(); A_Index32++) {
+                    std::string A_LoopField32 = items32[A_Index32 - 0];
+                    if (Trim(A_LoopField32) != "") {
+                        str4 += " " + Trim(A_LoopField32);
                     }
                 }
+                out += "___HTLL_expr___ " + str2 + " " + str10 + str4 + Chr(10);
+                //;;;; code here
+                //;;;; code here
+            } else {
+                out += A_LoopField31 + Chr(10);
             }
-            else if (InStr(str1, " >= ")) {
-                str2 = Trim(StrSplit(str1, " >= ", 1));
-                str3 = Trim(StrSplit(str1, " >= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index145 = 0; A_Index145 < HTVM_Size(funcArgsArr); A_Index145++) {
-                            if (Trim(funcArgsArr[A_Index145]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index146 = 0; A_Index146 < HTVM_Size(funcArgsArr); A_Index146++) {
-                                if (Trim(funcArgsArr[A_Index146]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.lt .end_if5_" + STR(ifCount5) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jl end_if5_" + STR(ifCount5) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jl .end_if5_" + STR(ifCount5) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jl .end_if5_" + STR(ifCount5) + Chr(10);
+        }
+        else if (SubStr(StrLower(Trim(A_LoopField31)), 1, 7) == "return ") {
+            //;;;;;;;;;;;;; return
+            str1 = Trim(StringTrimLeft(Trim(A_LoopField31), 7));
+            if (InStr(A_LoopField31, " + ") || InStr(A_LoopField31, " - ") || InStr(A_LoopField31, " * ") || InStr(A_LoopField31, " // ") || InStr(A_LoopField31, " % ") || InStr(A_LoopField31, " << ") || InStr(A_LoopField31, " >> ") || InStr(A_LoopField31, " & ") || InStr(A_LoopField31, " | ") || InStr(A_LoopField31, " ^ ")) {
+                //;;;;;;;;;;;;; return return
+                //;;;;;;;;;;;;; return return
+                str4 = "";
+                std::vector<std::string> items33 = LoopParseFunc(str1, " ");
+                for (size_t A_Index33 = 0; A_Index33 < items33.size(); A_Index33++) {
+                    std::string A_LoopField33 = items33[A_Index33 - 0];
+                    if (Trim(A_LoopField33) != "") {
+                        str4 += " " + Trim(A_LoopField33);
                     }
                 }
+                out += "___HTLL_expr___ rax :=" + str4 + Chr(10) + "return rax" + Chr(10);
+                //;;;;;;;;;;;;; return return
+                //;;;;;;;;;;;;; return return
+            } else {
+                out += A_LoopField31 + Chr(10);
             }
-            else if (InStr(str1, " <= ")) {
-                str2 = Trim(StrSplit(str1, " <= ", 1));
-                str3 = Trim(StrSplit(str1, " <= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index147 = 0; A_Index147 < HTVM_Size(funcArgsArr); A_Index147++) {
-                            if (Trim(funcArgsArr[A_Index147]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index148 = 0; A_Index148 < HTVM_Size(funcArgsArr); A_Index148++) {
-                                if (Trim(funcArgsArr[A_Index148]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
+            //;;;;;;;;;;;;; return
+        } else {
+            out += A_LoopField31 + Chr(10);
+        }
+    }
+    code = StringTrimRight(out, 1);
+    out = "";
+    std::vector<std::string> items34 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index34 = 0; A_Index34 < items34.size(); A_Index34++) {
+        std::string A_LoopField34 = items34[A_Index34 - 0];
+        if (SubStr(StrLower(Trim(A_LoopField34)), 1, 6) == "loop, ") {
+            str1 = Trim(A_LoopField34);
+            str2 = Trim(StrSplit(str1, ",", 2));
+            if (InStr(str2, ".size")) {
+                out += Trim(str2) + Chr(10) + "Loop, rax" + Chr(10);
+            } else {
+                out += A_LoopField34 + Chr(10);
+            }
+        }
+        else if (StrLower(Trim(A_LoopField34)) == "loop") {
+            out += "Loop, -1" + Chr(10);
+        } else {
+            out += A_LoopField34 + Chr(10);
+        }
+    }
+    code = StringTrimRight(out, 1);
+    out = "";
+    HTLL_pass("brace formatting");
+    if (InStr(code, "{")) {
+        code = transformBracesToHTLL(code);
+    }
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    HTLL_pass("function and array lowering");
+    code = HTLL_takeNoinline(code);
+    int dose_func_exist = 0;
+    std::vector<std::string> items35 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index35 = 0; A_Index35 < items35.size(); A_Index35++) {
+        std::string A_LoopField35 = items35[A_Index35 - 0];
+        if (SubStr(StrLower(Trim(A_LoopField35)), 1, 5) == "func ") {
+            dose_func_exist = 1;
+            break;
+        }
+    }
+    int is_in_func = 0;
+    int is_in_main = 0;
+    std::vector<std::string> arrays_from_global_scope;
+    std::vector<std::string> func_arrs_params;
+    std::vector<std::string> func_arrs_params_ORIGINAL_NAME;
+    std::vector<std::string> func_vars_and_arrs;
+    std::vector<std::string> main_vars_and_arrs;
+    std::vector<std::string> funcs_and_what_types;
+    std::string ALoopField = "";
+    int AIndex = 0;
+    int AAIndex = 0;
+    int it_macth_arr_name = 0;
+    out = "";
+    std::vector<std::string> items36 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index36 = 0; A_Index36 < items36.size(); A_Index36++) {
+        std::string A_LoopField36 = items36[A_Index36 - 0];
+        if (SubStr(StrLower(Trim(A_LoopField36)), 1, 5) == "func ") {
+            str1 = Trim(StringTrimLeft(Trim(A_LoopField36), 5));
+            is_in_func = 1;
+            str2 = "";
+            str3 = "";
+            str4 = "";
+            str5 = "";
+            str6 = "";
+            str7 = "";
+            str8 = "";
+            str9 = "";
+            func_arrs_params = {};
+            str2 = Trim(StrSplit(str1, "(", 1));
+            str4 = Trim(StrSplit(str1, "(", 2));
+            str4 = StringTrimRight(str4, 1);
+            if (InStr(str2, " ")) {
+                // is an array func return
+                // get name of func
+                str3 = Trim(StrSplit(str2, " ", 2));
+                str8 = "";
+                str6 += "arr __HTLL_ret_" + str3 + Chr(10);
+                str5 = "";
+                if (InStr(str1, "()") == false) {
+                    std::vector<std::string> items37 = LoopParseFunc(str4, ",");
+                    for (size_t A_Index37 = 0; A_Index37 < items37.size(); A_Index37++) {
+                        std::string A_LoopField37 = items37[A_Index37 - 0];
+                        if (InStr(Trim(A_LoopField37), " ")) {
+                            // its an array param
+                            HTVM_Append(func_arrs_params, "__HTLL_param_" + str3 + "_" + Trim(StrSplit(Trim(A_LoopField37), " ", 2)));
+                            str8 += Trim(StrSplit(Trim(A_LoopField37), " ", 2)) + ",";
+                            HTVM_Append(func_arrs_params_ORIGINAL_NAME, Trim(StrSplit(Trim(A_LoopField37), " ", 2)));
                         } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
+                            str8 += "__000_NOT-ARRAY_000__,";
+                            str5 += Trim(A_LoopField37) + ", ";
                         }
                     }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.gt .end_if5_" + STR(ifCount5) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jg end_if5_" + STR(ifCount5) + Chr(10);
+                    str8 = StringTrimRight(str8, 1);
+                    HTVM_Append(funcs_and_what_types, "yes|" + str3 + "|" + Trim(str8));
+                    str5 = Trim(str5);
+                    str5 = StringTrimRight(str5, 1);
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jg .end_if5_" + STR(ifCount5) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jg .end_if5_" + STR(ifCount5) + Chr(10);
-                    }
+                    str5 = "";
+                    HTVM_Append(funcs_and_what_types, "yes|" + str3 + "|");
                 }
-            }
-        }
-        else if (Trim(A_LoopField69) == "ifend5" || Trim(A_LoopField69) == "endif5") {
-            if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "end_if5_" + STR(ifCount5) + ":" + Chr(10);
             } else {
-                out += ".end_if5_" + STR(ifCount5) + ":" + Chr(10);
-            }
-            ifCount5++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 4) == "if6 ") {
-            isNum = 0;
-            str1 = Trim(StringTrimLeft(A_LoopField69, 4));
-            str1 = StringTrimLeft(str1, 1);
-            str1 = StringTrimRight(str1, 1);
-            if (InStr(str1, " = ")) {
-                str2 = Trim(StrSplit(str1, " = ", 1));
-                str3 = Trim(StrSplit(str1, " = ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index149 = 0; A_Index149 < HTVM_Size(funcArgsArr); A_Index149++) {
-                            if (Trim(funcArgsArr[A_Index149]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    int isRhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index150 = 0; A_Index150 < HTVM_Size(funcArgsArr); A_Index150++) {
-                            if (Trim(funcArgsArr[A_Index150]) == str3) {
-                                isRhsStackVar = 1;
-                                break;
-                            }
+                // get name of func
+                str3 = Trim(str2);
+                str8 = "";
+                str5 = "";
+                if (InStr(str1, "()") == false) {
+                    std::vector<std::string> items38 = LoopParseFunc(str4, ",");
+                    for (size_t A_Index38 = 0; A_Index38 < items38.size(); A_Index38++) {
+                        std::string A_LoopField38 = items38[A_Index38 - 0];
+                        if (InStr(Trim(A_LoopField38), " ")) {
+                            // its an array param
+                            HTVM_Append(func_arrs_params, "__HTLL_param_" + str3 + "_" + Trim(StrSplit(Trim(A_LoopField38), " ", 2)));
+                            str8 += Trim(StrSplit(Trim(A_LoopField38), " ", 2)) + ",";
+                            HTVM_Append(func_arrs_params_ORIGINAL_NAME, Trim(StrSplit(Trim(A_LoopField38), " ", 2)));
+                        } else {
+                            str8 += "__000_NOT-ARRAY_000__,";
+                            str5 += Trim(A_LoopField38) + ", ";
                         }
                     }
-                    if (str3 == "rax") {
-                        out += "    mov x10, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    mov x10, x20" + Chr(10);
-                    }
-                    else if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    }
-                    else if (isRhsStackVar == 1) {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                        out += "    ldr x10, [x10]" + Chr(10);
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ne .end_if6_" + STR(ifCount6) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jne end_if6_" + STR(ifCount6) + Chr(10);
+                    str8 = StringTrimRight(str8, 1);
+                    HTVM_Append(funcs_and_what_types, "no|" + str3 + "|" + Trim(str8));
+                    str5 = Trim(str5);
+                    str5 = StringTrimRight(str5, 1);
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jne .end_if6_" + STR(ifCount6) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jne .end_if6_" + STR(ifCount6) + Chr(10);
-                    }
+                    str5 = "";
+                    HTVM_Append(funcs_and_what_types, "no|" + str3 + "|");
                 }
             }
-            else if (InStr(str1, " != ")) {
-                str2 = Trim(StrSplit(str1, " != ", 1));
-                str3 = Trim(StrSplit(str1, " != ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index151 = 0; A_Index151 < HTVM_Size(funcArgsArr); A_Index151++) {
-                            if (Trim(funcArgsArr[A_Index151]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
+            for (int A_Index39 = 0; A_Index39 < HTVM_Size(func_arrs_params); A_Index39++) {
+                str6 += "arr " + func_arrs_params[A_Index39] + Chr(10);
+            }
+            str6 += "func " + str3 + "(" + str5 + ")";
+            out += str6 + Chr(10);
+            str14 = str3;
+        }
+        else if (Trim(A_LoopField36) == "funcend") {
+            is_in_func = 0;
+            str1 = "";
+            str2 = "";
+            str3 = "";
+            str4 = "";
+            str5 = "";
+            out += A_LoopField36 + Chr(10);
+        }
+        else if (Trim(A_LoopField36) == "main") {
+            is_in_main = 1;
+            str1 = "";
+            str2 = "";
+            str3 = "";
+            str4 = "";
+            str5 = "";
+            out += A_LoopField36 + Chr(10);
+        } else {
+            if (is_in_func == 1 && is_in_main == 0) {
+                // in a func
+                str1 = "";
+                str2 = "";
+                str4 = "";
+                str5 = "";
+                str1 = A_LoopField36;
+                if (SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "arr " || SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "int ") {
+                    if (SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "arr ") {
+                        out += "__HTLL_flocal_" + str3 + "_" + Trim(StringTrimLeft(Trim(A_LoopField36), 4)) + ".clear" + Chr(10);
                     }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
+                    if (InStr(A_LoopField36, " := ")) {
+                        str2 = Trim(StrSplit(A_LoopField36, ":=", 1));
+                        str4 = Trim(StrSplit(A_LoopField36, " ", 2));
                     } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
+                        str2 = Trim(A_LoopField36);
+                        str4 = Trim(StrSplit(A_LoopField36, " ", 2));
                     }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index152 = 0; A_Index152 < HTVM_Size(funcArgsArr); A_Index152++) {
-                                if (Trim(funcArgsArr[A_Index152]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
+                    HTVM_Append(func_vars_and_arrs, str4);
+                }
+                for (int A_Index40 = 0; A_Index40 < HTVM_Size(func_arrs_params_ORIGINAL_NAME); A_Index40++) {
+                    str1 = RegExReplace(str1, "\\b" + func_arrs_params_ORIGINAL_NAME[A_Index40] + "\\b", "__HTLL_param_" + str14 + "_" + func_arrs_params_ORIGINAL_NAME[A_Index40]);
+                }
+                for (int A_Index41 = 0; A_Index41 < HTVM_Size(func_vars_and_arrs); A_Index41++) {
+                    str1 = RegExReplace(str1, "\\b" + func_vars_and_arrs[A_Index41] + "\\b", "__HTLL_flocal_" + str14 + "_" + func_vars_and_arrs[A_Index41]);
+                }
+                //::::::::::::::::::::::
+                //::::::::::::::::::::::
+                //::::::::::::::::::::::
+                //::::::::::::::::::::::
+                //::::::::::::::::::::::
+                //::::::::::::::::::::::
+                str6 = str1;
+                for (int A_Index42 = 0; A_Index42 < HTVM_Size(funcs_and_what_types); A_Index42++) {
+                    if (InStr(A_LoopField36, ")") && RegExMatch(A_LoopField36, "\\b" + StrSplit(funcs_and_what_types[A_Index42], "|", 2) + "\\b")) {
+                        if (InStr(A_LoopField36, " := ")) {
+                            if (StrSplit(funcs_and_what_types[A_Index42], "|", 1) == "no") {
+                                throw std::runtime_error("ERROR You cannot use the assignment operator and save the function " + StrSplit(funcs_and_what_types[A_Index42], "|", 2) + " please use rax.");
+                            }
+                            // for arrays
+                            // for arrays
+                            str1 = Trim(StrSplit(str6, " := ", 1));
+                            str2 = Trim(StrSplit(str6, " := ", 2));
+                            str3 = Trim(StrSplit(str2, "(", 1));
+                            str4 = Trim(StrSplit(str2, "(", 2));
+                            str4 = StringTrimRight(str4, 1);
+                            // str1 = arrName
+                            // str2 WE DONT CARE
+                            // str3 = func name
+                            // str4 = all params if any
+                            if (Trim(str4) == "") {
+                                // no param handle here
+                                str5 = StrSplit(funcs_and_what_types[A_Index42], "|", 2) + "()" + Chr(10);
+                                str5 += str1 + ".swap __HTLL_ret_" + StrSplit(funcs_and_what_types[A_Index42], "|", 2) + Chr(10);
+                            } else {
+                                // there are params so handle here
+                                str7 = "";
+                                str5 = "";
+                                str8 = StrSplit(funcs_and_what_types[A_Index42], "|", 3);
+                                AAIndex = A_Index42;
+                                std::vector<std::string> items43 = LoopParseFunc(str4, ",");
+                                for (size_t A_Index43 = 0; A_Index43 < items43.size(); A_Index43++) {
+                                    std::string A_LoopField43 = items43[A_Index43 - 0];
+                                    ALoopField = Trim(A_LoopField43);
+                                    AIndex = A_Index43;
+                                    it_macth_arr_name = 0;
+                                    std::vector<std::string> items44 = LoopParseFunc(str8, ",");
+                                    for (size_t A_Index44 = 0; A_Index44 < items44.size(); A_Index44++) {
+                                        std::string A_LoopField44 = items44[A_Index44 - 0];
+                                        if (Trim(A_LoopField44) != "__000_NOT-ARRAY_000__" && AIndex == A_Index44) {
+                                            ALoopField = Trim(A_LoopField44);
+                                            if (Trim(ALoopField) != "") {
+                                                it_macth_arr_name = 1;
+                                            }
+                                            break;
+                                        }
+                                    }
+                                    if (it_macth_arr_name == 1) {
+                                        str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy " + HTLL_arrayArgument(Trim(A_LoopField43), "__HTLL_flocal_" + str14 + "_", func_vars_and_arrs, arrays_from_global_scope, "__HTLL_param_" + str14 + "_", func_arrs_params) + Chr(10);
+                                    } else {
+                                        if (RegExMatch(Trim(A_LoopField43), "^\\d+$")) {
+                                            str7 += Trim(A_LoopField43) + ", ";
+                                        } else {
+                                            if (InStr(A_LoopField43, "__HTLL_flocal_")) {
+                                                str7 += "__HTLL_flocal_" + str14 + "_" + Trim(A_LoopField43) + ", ";
+                                            } else {
+                                                str7 += "__HTLL_flocal_" + str14 + "_" + Trim(A_LoopField43) + ", ";
+                                            }
+                                        }
+                                    }
                                 }
+                                str5 += StrSplit(funcs_and_what_types[A_Index42], "|", 2) + "(" + StringTrimRight(Trim(str7), 1) + ")" + Chr(10);
+                                str5 += str1 + ".swap __HTLL_ret_" + StrSplit(funcs_and_what_types[A_Index42], "|", 2) + Chr(10);
+                                // there are params so handle here
                             }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
+                            str6 = str5;
+                            // for arrays
+                            // for arrays
                         } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.eq .end_if6_" + STR(ifCount6) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "je end_if6_" + STR(ifCount6) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "je .end_if6_" + STR(ifCount6) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "je .end_if6_" + STR(ifCount6) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " > ")) {
-                str2 = Trim(StrSplit(str1, " > ", 1));
-                str3 = Trim(StrSplit(str1, " > ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index153 = 0; A_Index153 < HTVM_Size(funcArgsArr); A_Index153++) {
-                            if (Trim(funcArgsArr[A_Index153]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
+                            if (StrSplit(funcs_and_what_types[A_Index42], "|", 1) == "yes") {
+                                throw std::runtime_error("ERROR You must use the assignment operator and save the function " + StrSplit(funcs_and_what_types[A_Index42], "|", 2) + " to an array.");
                             }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index154 = 0; A_Index154 < HTVM_Size(funcArgsArr); A_Index154++) {
-                                if (Trim(funcArgsArr[A_Index154]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
+                            // for not arays returned
+                            // for not arays returned
+                            str1 = Trim(A_LoopField36);
+                            str2 = str1;
+                            str3 = Trim(StrSplit(str2, "(", 1));
+                            str4 = Trim(StrSplit(str2, "(", 2));
+                            str4 = StringTrimRight(str4, 1);
+                            // str2 WE DONT CARE
+                            // str3 = func name
+                            // str4 = all params if any
+                            if (Trim(str4) == "") {
+                                // no param handle here
+                                str5 = StrSplit(funcs_and_what_types[A_Index42], "|", 2) + "()" + Chr(10);
+                            } else {
+                                // there are params so handle here
+                                str7 = "";
+                                str5 = "";
+                                str8 = StrSplit(funcs_and_what_types[A_Index42], "|", 3);
+                                AAIndex = A_Index42;
+                                std::vector<std::string> items45 = LoopParseFunc(str4, ",");
+                                for (size_t A_Index45 = 0; A_Index45 < items45.size(); A_Index45++) {
+                                    std::string A_LoopField45 = items45[A_Index45 - 0];
+                                    ALoopField = Trim(A_LoopField45);
+                                    AIndex = A_Index45;
+                                    it_macth_arr_name = 0;
+                                    std::vector<std::string> items46 = LoopParseFunc(str8, ",");
+                                    for (size_t A_Index46 = 0; A_Index46 < items46.size(); A_Index46++) {
+                                        std::string A_LoopField46 = items46[A_Index46 - 0];
+                                        if (Trim(A_LoopField46) != "__000_NOT-ARRAY_000__" && AIndex == A_Index46) {
+                                            ALoopField = Trim(A_LoopField46);
+                                            if (Trim(ALoopField) != "") {
+                                                it_macth_arr_name = 1;
+                                            }
+                                            break;
+                                        }
+                                    }
+                                    if (it_macth_arr_name == 1) {
+                                        str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy " + HTLL_arrayArgument(Trim(A_LoopField45), "__HTLL_flocal_" + str14 + "_", func_vars_and_arrs, arrays_from_global_scope, "__HTLL_param_" + str14 + "_", func_arrs_params) + Chr(10);
+                                    } else {
+                                        if (RegExMatch(Trim(A_LoopField45), "^\\d+$")) {
+                                            str7 += Trim(A_LoopField45) + ", ";
+                                        } else {
+                                            if (InStr(A_LoopField45, "__HTLL_flocal_")) {
+                                                str7 += "__HTLL_flocal_" + str14 + "_" + Trim(A_LoopField45) + ", ";
+                                            } else {
+                                                str7 += "__HTLL_flocal_" + str14 + "_" + Trim(A_LoopField45) + ", ";
+                                            }
+                                        }
+                                    }
                                 }
+                                str5 += StrSplit(funcs_and_what_types[A_Index42], "|", 2) + "(" + StringTrimRight(Trim(str7), 1) + ")" + Chr(10);
+                                // there are params so handle here
                             }
+                            str6 = str5;
+                            // for not arays returned
+                            // for not arays returned
                         }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.le .end_if6_" + STR(ifCount6) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jle end_if6_" + STR(ifCount6) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jle .end_if6_" + STR(ifCount6) + Chr(10);
+                        break;
                     } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jle .end_if6_" + STR(ifCount6) + Chr(10);
+                        str6 = str1;
                     }
                 }
+                out += str6 + Chr(10);
+                //::::::::::::::::::::::
+                //::::::::::::::::::::::
+                //::::::::::::::::::::::
+                //::::::::::::::::::::::
+                //::::::::::::::::::::::
+                //::::::::::::::::::::::
             }
-            else if (InStr(str1, " < ")) {
-                str2 = Trim(StrSplit(str1, " < ", 1));
-                str3 = Trim(StrSplit(str1, " < ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index155 = 0; A_Index155 < HTVM_Size(funcArgsArr); A_Index155++) {
-                            if (Trim(funcArgsArr[A_Index155]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index156 = 0; A_Index156 < HTVM_Size(funcArgsArr); A_Index156++) {
-                                if (Trim(funcArgsArr[A_Index156]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ge .end_if6_" + STR(ifCount6) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jge end_if6_" + STR(ifCount6) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jge .end_if6_" + STR(ifCount6) + Chr(10);
+            else if (is_in_main == 1) {
+                // in main
+                str1 = "";
+                str2 = "";
+                str3 = "";
+                str4 = "";
+                str5 = "";
+                str6 = "";
+                str7 = "";
+                str11 = A_LoopField36;
+                if (SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "arr " || SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "int ") {
+                    if (InStr(A_LoopField36, " := ")) {
+                        str2 = Trim(StrSplit(A_LoopField36, ":=", 1));
+                        str3 = Trim(StrSplit(A_LoopField36, " ", 2));
                     } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jge .end_if6_" + STR(ifCount6) + Chr(10);
+                        str2 = Trim(A_LoopField36);
+                        str3 = Trim(StrSplit(A_LoopField36, " ", 2));
                     }
+                    HTVM_Append(main_vars_and_arrs, str3);
                 }
-            }
-            else if (InStr(str1, " >= ")) {
-                str2 = Trim(StrSplit(str1, " >= ", 1));
-                str3 = Trim(StrSplit(str1, " >= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index157 = 0; A_Index157 < HTVM_Size(funcArgsArr); A_Index157++) {
-                            if (Trim(funcArgsArr[A_Index157]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
+                for (int A_Index47 = 0; A_Index47 < HTVM_Size(main_vars_and_arrs); A_Index47++) {
+                    str11 = RegExReplace(str11, "\\b" + main_vars_and_arrs[A_Index47] + "\\b", "__HTLL_mlocal_" + main_vars_and_arrs[A_Index47]);
+                }
+                str6 = str11;
+                for (int A_Index48 = 0; A_Index48 < HTVM_Size(funcs_and_what_types); A_Index48++) {
+                    if (InStr(A_LoopField36, ")") && RegExMatch(A_LoopField36, "\\b" + StrSplit(funcs_and_what_types[A_Index48], "|", 2) + "\\b")) {
+                        if (InStr(A_LoopField36, " := ")) {
+                            if (StrSplit(funcs_and_what_types[A_Index48], "|", 1) == "no") {
+                                throw std::runtime_error("ERROR You cannot use the assignment operator and save the function " + StrSplit(funcs_and_what_types[A_Index48], "|", 2) + " please use rax.");
                             }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index158 = 0; A_Index158 < HTVM_Size(funcArgsArr); A_Index158++) {
-                                if (Trim(funcArgsArr[A_Index158]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
+                            // for arrays
+                            // for arrays
+                            str1 = Trim(StrSplit(str6, " := ", 1));
+                            str2 = Trim(StrSplit(str6, " := ", 2));
+                            str3 = Trim(StrSplit(str2, "(", 1));
+                            str4 = Trim(StrSplit(str2, "(", 2));
+                            str4 = StringTrimRight(str4, 1);
+                            // str1 = arrName
+                            // str2 WE DONT CARE
+                            // str3 = func name
+                            // str4 = all params if any
+                            if (Trim(str4) == "") {
+                                // no param handle here
+                                str5 = StrSplit(funcs_and_what_types[A_Index48], "|", 2) + "()" + Chr(10);
+                                str5 += str1 + ".swap __HTLL_ret_" + StrSplit(funcs_and_what_types[A_Index48], "|", 2) + Chr(10);
+                            } else {
+                                // there are params so handle here
+                                str7 = "";
+                                str5 = "";
+                                str8 = StrSplit(funcs_and_what_types[A_Index48], "|", 3);
+                                AAIndex = A_Index48;
+                                std::vector<std::string> items49 = LoopParseFunc(str4, ",");
+                                for (size_t A_Index49 = 0; A_Index49 < items49.size(); A_Index49++) {
+                                    std::string A_LoopField49 = items49[A_Index49 - 0];
+                                    ALoopField = Trim(A_LoopField49);
+                                    AIndex = A_Index49;
+                                    it_macth_arr_name = 0;
+                                    std::vector<std::string> items50 = LoopParseFunc(str8, ",");
+                                    for (size_t A_Index50 = 0; A_Index50 < items50.size(); A_Index50++) {
+                                        std::string A_LoopField50 = items50[A_Index50 - 0];
+                                        if (Trim(A_LoopField50) != "__000_NOT-ARRAY_000__" && AIndex == A_Index50) {
+                                            ALoopField = Trim(A_LoopField50);
+                                            if (Trim(ALoopField) != "") {
+                                                it_macth_arr_name = 1;
+                                            }
+                                            break;
+                                        }
+                                    }
+                                    if (it_macth_arr_name == 1) {
+                                        str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy " + HTLL_arrayArgument(Trim(A_LoopField49), "__HTLL_mlocal_", main_vars_and_arrs, arrays_from_global_scope) + Chr(10);
+                                    } else {
+                                        if (RegExMatch(Trim(A_LoopField49), "^\\d+$")) {
+                                            str7 += Trim(A_LoopField49) + ", ";
+                                        } else {
+                                            if (InStr(A_LoopField49, "__HTLL_mlocal_")) {
+                                                str7 += Trim(A_LoopField49) + ", ";
+                                            } else {
+                                                str7 += "__HTLL_mlocal_" + Trim(A_LoopField49) + ", ";
+                                            }
+                                        }
+                                    }
                                 }
+                                str5 += StrSplit(funcs_and_what_types[A_Index48], "|", 2) + "(" + StringTrimRight(Trim(str7), 1) + ")" + Chr(10);
+                                str5 += str1 + ".swap __HTLL_ret_" + StrSplit(funcs_and_what_types[A_Index48], "|", 2) + Chr(10);
+                                // there are params so handle here
                             }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
+                            str6 = str5;
+                            // for arrays
+                            // for arrays
                         } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.lt .end_if6_" + STR(ifCount6) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jl end_if6_" + STR(ifCount6) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jl .end_if6_" + STR(ifCount6) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jl .end_if6_" + STR(ifCount6) + Chr(10);
-                    }
-                }
-            }
-            else if (InStr(str1, " <= ")) {
-                str2 = Trim(StrSplit(str1, " <= ", 1));
-                str3 = Trim(StrSplit(str1, " <= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index159 = 0; A_Index159 < HTVM_Size(funcArgsArr); A_Index159++) {
-                            if (Trim(funcArgsArr[A_Index159]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
+                            if (StrSplit(funcs_and_what_types[A_Index48], "|", 1) == "yes") {
+                                throw std::runtime_error("ERROR You must use the assignment operator and save the function " + StrSplit(funcs_and_what_types[A_Index48], "|", 2) + " to an array.");
                             }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index160 = 0; A_Index160 < HTVM_Size(funcArgsArr); A_Index160++) {
-                                if (Trim(funcArgsArr[A_Index160]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
+                            // for not arays returned
+                            // for not arays returned
+                            str1 = Trim(A_LoopField36);
+                            str2 = str1;
+                            str3 = Trim(StrSplit(str2, "(", 1));
+                            str4 = Trim(StrSplit(str2, "(", 2));
+                            str4 = StringTrimRight(str4, 1);
+                            // str2 WE DONT CARE
+                            // str3 = func name
+                            // str4 = all params if any
+                            if (Trim(str4) == "") {
+                                // no param handle here
+                                str5 = StrSplit(funcs_and_what_types[A_Index48], "|", 2) + "()" + Chr(10);
+                            } else {
+                                // there are params so handle here
+                                str7 = "";
+                                str5 = "";
+                                str8 = StrSplit(funcs_and_what_types[A_Index48], "|", 3);
+                                AAIndex = A_Index48;
+                                std::vector<std::string> items51 = LoopParseFunc(str4, ",");
+                                for (size_t A_Index51 = 0; A_Index51 < items51.size(); A_Index51++) {
+                                    std::string A_LoopField51 = items51[A_Index51 - 0];
+                                    ALoopField = Trim(A_LoopField51);
+                                    AIndex = A_Index51;
+                                    it_macth_arr_name = 0;
+                                    std::vector<std::string> items52 = LoopParseFunc(str8, ",");
+                                    for (size_t A_Index52 = 0; A_Index52 < items52.size(); A_Index52++) {
+                                        std::string A_LoopField52 = items52[A_Index52 - 0];
+                                        if (Trim(A_LoopField52) != "__000_NOT-ARRAY_000__" && AIndex == A_Index52) {
+                                            ALoopField = Trim(A_LoopField52);
+                                            if (Trim(ALoopField) != "") {
+                                                it_macth_arr_name = 1;
+                                            }
+                                            break;
+                                        }
+                                    }
+                                    if (it_macth_arr_name == 1) {
+                                        str5 += "__HTLL_param_" + StrSplit(funcs_and_what_types[AAIndex], "|", 2) + "_" + ALoopField + ".copy " + HTLL_arrayArgument(Trim(A_LoopField51), "__HTLL_mlocal_", main_vars_and_arrs, arrays_from_global_scope) + Chr(10);
+                                    } else {
+                                        if (RegExMatch(Trim(A_LoopField51), "^\\d+$")) {
+                                            str7 += Trim(A_LoopField51) + ", ";
+                                        } else {
+                                            if (InStr(A_LoopField51, "__HTLL_mlocal_")) {
+                                                str7 += Trim(A_LoopField51) + ", ";
+                                            } else {
+                                                str7 += "__HTLL_mlocal_" + Trim(A_LoopField51) + ", ";
+                                            }
+                                        }
+                                    }
                                 }
+                                str5 += StrSplit(funcs_and_what_types[A_Index48], "|", 2) + "(" + StringTrimRight(Trim(str7), 1) + ")" + Chr(10);
+                                // there are params so handle here
                             }
+                            str6 = str5;
+                            // for not arays returned
+                            // for not arays returned
                         }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.gt .end_if6_" + STR(ifCount6) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jg end_if6_" + STR(ifCount6) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jg .end_if6_" + STR(ifCount6) + Chr(10);
+                        break;
                     } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jg .end_if6_" + STR(ifCount6) + Chr(10);
+                        str6 = str11;
                     }
                 }
+                out += str6 + Chr(10);
+            } else {
+                // get all array names
+                if (SubStr(StrLower(Trim(A_LoopField36)), 1, 4) == "arr ") {
+                    HTVM_Append(arrays_from_global_scope, Trim(StringTrimLeft(Trim(A_LoopField36), 4)));
+                }
+                out += A_LoopField36 + Chr(10);
             }
         }
-        else if (Trim(A_LoopField69) == "ifend6" || Trim(A_LoopField69) == "endif6") {
-            if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "end_if6_" + STR(ifCount6) + ":" + Chr(10);
+    }
+    code = StringTrimRight(out, 1);
+    out = "";
+    int doWeReturnARR = 0;
+    std::vector<std::string> items53 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index53 = 0; A_Index53 < items53.size(); A_Index53++) {
+        std::string A_LoopField53 = items53[A_Index53 - 0];
+        if (SubStr(StrLower(Trim(A_LoopField53)), 1, 5) == "func ") {
+            str1 = Trim(StringTrimLeft(Trim(A_LoopField53), 5));
+            str2 = "";
+            str3 = "";
+            str4 = "";
+            str6 = "";
+            doWeReturnARR = 0;
+            str2 = Trim(StrSplit(str1, "(", 1));
+            str4 = Trim(StrSplit(str1, "(", 2));
+            str4 = StringTrimRight(str4, 1);
+            if (InStr(str2, " ")) {
+                // is an array func return
+                // get name of func
+                str3 = Trim(StrSplit(str2, " ", 2));
             } else {
-                out += ".end_if6_" + STR(ifCount6) + ":" + Chr(10);
+                // get name of func
+                str3 = Trim(str2);
             }
-            ifCount6++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 4) == "if7 ") {
-            isNum = 0;
-            str1 = Trim(StringTrimLeft(A_LoopField69, 4));
-            str1 = StringTrimLeft(str1, 1);
-            str1 = StringTrimRight(str1, 1);
-            if (InStr(str1, " = ")) {
-                str2 = Trim(StrSplit(str1, " = ", 1));
-                str3 = Trim(StrSplit(str1, " = ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index161 = 0; A_Index161 < HTVM_Size(funcArgsArr); A_Index161++) {
-                            if (Trim(funcArgsArr[A_Index161]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    int isRhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index162 = 0; A_Index162 < HTVM_Size(funcArgsArr); A_Index162++) {
-                            if (Trim(funcArgsArr[A_Index162]) == str3) {
-                                isRhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str3 == "rax") {
-                        out += "    mov x10, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    mov x10, x20" + Chr(10);
-                    }
-                    else if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    }
-                    else if (isRhsStackVar == 1) {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                        out += "    ldr x10, [x10]" + Chr(10);
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ne .end_if7_" + STR(ifCount7) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jne end_if7_" + STR(ifCount7) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jne .end_if7_" + STR(ifCount7) + Chr(10);
+            for (int A_Index54 = 0; A_Index54 < HTVM_Size(funcs_and_what_types); A_Index54++) {
+                if (StrSplit(funcs_and_what_types[A_Index54], "|", 2) == str3) {
+                    if (StrSplit(funcs_and_what_types[A_Index54], "|", 1) == "yes") {
+                        doWeReturnARR = 1;
                     } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jne .end_if7_" + STR(ifCount7) + Chr(10);
+                        doWeReturnARR = 0;
                     }
+                    break;
                 }
             }
-            else if (InStr(str1, " != ")) {
-                str2 = Trim(StrSplit(str1, " != ", 1));
-                str3 = Trim(StrSplit(str1, " != ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index163 = 0; A_Index163 < HTVM_Size(funcArgsArr); A_Index163++) {
-                            if (Trim(funcArgsArr[A_Index163]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index164 = 0; A_Index164 < HTVM_Size(funcArgsArr); A_Index164++) {
-                                if (Trim(funcArgsArr[A_Index164]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.eq .end_if7_" + STR(ifCount7) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "je end_if7_" + STR(ifCount7) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "je .end_if7_" + STR(ifCount7) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "je .end_if7_" + STR(ifCount7) + Chr(10);
-                    }
-                }
+            out += A_LoopField53 + Chr(10);
+        }
+        else if (SubStr(StrLower(Trim(A_LoopField53)), 1, 7) == "return " && isFuncRetARR(A_LoopField53) && doWeReturnARR == 1) {
+            str1 = Trim(StringTrimLeft(Trim(A_LoopField53), 21 + StrLen(Trim(str3))));
+            str2 = "__HTLL_ret_" + str3 + ".copy __HTLL_param_" + str3 + "_" + str1 + "";
+            out += str2 + Chr(10);
+            out += "return 0" + Chr(10);
+        }
+        else if (SubStr(StrLower(Trim(A_LoopField53)), 1, 7) == "return " && isFuncRetARR2(A_LoopField53) && doWeReturnARR == 1) {
+            str1 = Trim(StringTrimLeft(Trim(A_LoopField53), 7 ));
+            // a local is cleared on every call, so its buffer can be handed over instead of copied
+            str2 = "__HTLL_ret_" + str3 + ".swap " + str1;
+            out += str2 + Chr(10);
+            out += "return 0" + Chr(10);
+        }
+        else if (SubStr(StrLower(Trim(A_LoopField53)), 1, 7) == "return " && isFuncRetARR3(A_LoopField53, arrays_from_global_scope) && doWeReturnARR == 1) {
+            str1 = Trim(StringTrimLeft(Trim(A_LoopField53), 7 ));
+            str2 = "__HTLL_ret_" + str3 + ".copy " + str1;
+            out += str2 + Chr(10);
+            out += "return 0" + Chr(10);
+        } else {
+            out += A_LoopField53 + Chr(10);
+        }
+    }
+    out = RegExReplace(out, "__HTLL_[^ \\n\\],]*?___HTLL", "__HTLL");
+    code = StringTrimRight(out, 1);
+    out = "";
+    HTLL_pass("array parameters");
+    code = HTLL_borrowArrayParams(code);
+    if (HTLL_optLevel >= 1) {
+        HTLL_pass("inlining");
+        code = HTLL_inlineFunctions(code);
+        HTLL_pass("constant propagation");
+        code = HTLL_propagateConstants(code);
+    }
+    HTLL_pass("string restoration");
+    out = restoreStrings(code, literals);
+    return out;
+}
+//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+//;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+// Symbol table of the function being compiled: name -> kind, storage class, slot and the
+// operand the current target addresses it with. Parameters sit in the frame on x86-64 (the
+// caller pushes them, so the first is highest above rbp) and on AArch64 (the prologue spills
+// x0..x7 to [sp, #8*slot]), and in r50 onwards on Oryx. Locals were hoisted by the front end
+// to __HTLL_flocal_ statics, so they are static storage addressed by their label.
+enum HTLL_SymbolKind { HTLL_SYM_PARAM = 0, HTLL_SYM_LOCAL };
+enum HTLL_SymbolStorage { HTLL_STORE_FRAME = 0, HTLL_STORE_REGISTER, HTLL_STORE_STATIC };
+struct HTLL_Symbol {
+    int kind;
+    int storage;
+    int slot;
+    std::string operand;
+};
+thread_local std::unordered_map<std::string, HTLL_Symbol> HTLL_symbols;
+thread_local int HTLL_symbolParams = 0;
+thread_local int HTLL_symbolLocals = 0;
+void HTLL_beginFunction(const std::vector<std::string>& params) {
+    HTLL_symbols.clear();
+    HTLL_symbolParams = 0;
+    HTLL_symbolLocals = 0;
+    int count = (int)params.size();
+    for (int i = 0; i < count; i++) {
+        std::string name = Trim(params[i]);
+        if (name == "") {
+            continue;
+        }
+        HTLL_Symbol symbol;
+        symbol.kind = HTLL_SYM_PARAM;
+        symbol.slot = i;
+        if (is_arm == 1) {
+            symbol.storage = HTLL_STORE_FRAME;
+            symbol.operand = "[sp, #" + STR(i * 8) + "]";
+        } else if (is_oryx == 1) {
+            symbol.storage = HTLL_STORE_REGISTER;
+            symbol.operand = "r" + STR(50 + i);
+        } else {
+            symbol.storage = HTLL_STORE_FRAME;
+            symbol.operand = "rbp + " + STR(8 + (count - i) * 8);
+        }
+        if (HTLL_symbols.emplace(name, symbol).second) {
+            HTLL_symbolParams++;
+        }
+    }
+}
+void HTLL_endFunction() {
+    HTLL_beginFunction({});
+}
+// Enters the variable an int/arr declaration names, when it is a local of the function.
+void HTLL_declareLocal(const std::string& declaration) {
+    std::string name = Trim(declaration);
+    name = Trim(name.substr(0, name.find_first_of(" \t:+-*/%<>&|^")));
+    if (name.rfind("__HTLL_flocal_", 0) != 0) {
+        return;
+    }
+    HTLL_Symbol symbol;
+    symbol.kind = HTLL_SYM_LOCAL;
+    symbol.storage = HTLL_STORE_STATIC;
+    symbol.slot = HTLL_symbolLocals;
+    symbol.operand = name;
+    if (HTLL_symbols.emplace(name, symbol).second) {
+        HTLL_symbolLocals++;
+    }
+}
+const HTLL_Symbol* HTLL_lookupSymbol(const std::string& name) {
+    auto it = HTLL_symbols.find(name);
+    return it == HTLL_symbols.end() ? nullptr : &it->second;
+}
+bool HTLL_isFuncParam(const std::string& name) {
+    const HTLL_Symbol* symbol = HTLL_lookupSymbol(Trim(name));
+    return symbol != nullptr && symbol->kind == HTLL_SYM_PARAM;
+}
+std::string HTLL_symbolOperand(const std::string& name) {
+    const HTLL_Symbol* symbol = HTLL_lookupSymbol(Trim(name));
+    return symbol == nullptr ? name : symbol->operand;
+}
+static bool HTLL_isWordChar(char c) {
+    return std::isalnum((unsigned char)c) || c == '_';
+}
+// Binds the code one statement emitted to the symbol table: every frame or register symbol
+// is replaced by its operand, so "[p]" becomes "[rbp + 24]" on x86-64 and "p" becomes "r51"
+// on Oryx. AArch64 handlers load a parameter with "ldr xN, =p" where a static would be
+// "=label", so there the '=' goes too and the load reads the frame slot. One scan of the
+// statement and a hash lookup per identifier; static symbols keep their label.
+std::string HTLL_bindSymbols(const std::string& code) {
+    std::string bound;
+    bound.reserve(code.size() + 16);
+    size_t i = 0;
+    while (i < code.size()) {
+        if (!HTLL_isWordChar(code[i])) {
+            bound += code[i];
+            i++;
+            continue;
+        }
+        size_t start = i;
+        while (i < code.size() && HTLL_isWordChar(code[i])) {
+            i++;
+        }
+        const HTLL_Symbol* symbol = HTLL_lookupSymbol(code.substr(start, i - start));
+        if (symbol == nullptr || symbol->storage == HTLL_STORE_STATIC || (is_arm == 1 && (bound.empty() || bound.back() != '='))) {
+            bound.append(code, start, i - start);
+            continue;
+        }
+        if (is_arm == 1) {
+            bound.pop_back();
+        }
+        bound += symbol->operand;
+    }
+    return bound;
+}
+// Finishes the statement whose code starts at out[start]: binds its symbols and, on x86-64
+// and Oryx, drops the brackets the handlers put around char literals and empty pushes.
+void HTLL_bindStatement(std::string& out, size_t start) {
+    if (start >= out.size() || (HTLL_symbolParams == 0 && is_arm == 1)) {
+        return;
+    }
+    std::string code = out.substr(start);
+    if (HTLL_symbolParams > 0) {
+        code = HTLL_bindSymbols(code);
+    }
+    if (is_arm == 0) {
+        code = StrReplace(code, "']", "'");
+        code = StrReplace(code, "['", "'");
+        code = StrReplace(code, "push qword []", "");
+        code = StrReplace(code, "[A_Index]", "r13");
+    }
+    out.replace(start, std::string::npos, code);
+}
+// Adds the routines the code calls or jumps to (bl/b on AArch64, call/jmp elsewhere) to calls,
+// so the runtime library routines they name can be pulled in.
+void HTLL_collectCalls(const std::string& code, std::vector<std::string>& calls) {
+    std::vector<std::string> items215 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index215 = 0; A_Index215 < items215.size(); A_Index215++) {
+        std::string A_LoopField215 = items215[A_Index215 - 0];
+        if (is_arm == 1) {
+            if (SubStr(Trim(A_LoopField215), 1, 3) == "bl " || SubStr(Trim(A_LoopField215), 1, 2) == "b ") {
+                HTVM_Append(calls, Trim(StringTrimLeft(Trim(A_LoopField215), 2)));
             }
-            else if (InStr(str1, " > ")) {
-                str2 = Trim(StrSplit(str1, " > ", 1));
-                str3 = Trim(StrSplit(str1, " > ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index165 = 0; A_Index165 < HTVM_Size(funcArgsArr); A_Index165++) {
-                            if (Trim(funcArgsArr[A_Index165]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index166 = 0; A_Index166 < HTVM_Size(funcArgsArr); A_Index166++) {
-                                if (Trim(funcArgsArr[A_Index166]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.le .end_if7_" + STR(ifCount7) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jle end_if7_" + STR(ifCount7) + Chr(10);
+        } else {
+            if (SubStr(Trim(A_LoopField215), 1, 5) == "call " || SubStr(Trim(A_LoopField215), 1, 4) == "jmp ") {
+                HTVM_Append(calls, Trim(StringTrimLeft(Trim(A_LoopField215), 4)));
+            }
+        }
+    }
+}
+// Label counters of loop/if blocks, one per nesting level and grown on demand. Blocks at
+// the same level never overlap, so the level and the counter name a block's labels.
+int HTLL_blockCount(std::vector<int>& counts, int level) {
+    if ((int)counts.size() <= level) {
+        counts.resize(level + 1, 0);
+    }
+    return counts[level];
+}
+void HTLL_nextBlock(std::vector<int>& counts, int level) {
+    HTLL_blockCount(counts, level);
+    counts[level]++;
+}
+bool isNint(std::string name) {
+    for (int A_Index55 = 0; A_Index55 < HTVM_Size(nintArr); A_Index55++) {
+        if (Trim(name) == Trim(nintArr[A_Index55])) {
+            return true;
+        }
+    }
+    return false;
+}
+// Strength reduction of reg *= d, reg //= d and reg %= d for a literal d, with the unsigned
+// division HTLL uses. A power of two multiplies and divides by shifting and takes the
+// remainder with a mask. Any other divisor multiplies by a magic reciprocal and keeps the
+// high half (Granlund and Montgomery's round-up method): n / d is mulhi(n, magic) >> shift,
+// or (((n - hi) >> 1) + hi) >> shift when the magic needs a 65th bit, and n % d is
+// n - (n / d) * d. Returns "" where the generic imul/div or mul/udiv code stays: other
+// multipliers, d = 0 (so the division still faults) and d = 1 for * and //.
+// Clobbers rax, rdx and rcx on x86-64 and x11 and x12 on AArch64.
+std::string HTLL_reduceByConstant(std::string op, const std::string& reg, const std::string& literal, int isArm) {
+    if (!op.empty() && op.back() == '=') {
+        op.pop_back();
+    }
+    if (literal.empty() || literal.size() > 20 || literal.find_first_not_of("0123456789") != std::string::npos) {
+        return "";
+    }
+    unsigned long long d = 0;
+    for (char c : literal) {
+        unsigned long long next = d * 10 + (unsigned long long)(c - '0');
+        if (next / 10 != d) {
+            return "";
+        }
+        d = next;
+    }
+    if (d == 0 || (d == 1 && op != "%")) {
+        return "";
+    }
+    // Literals up to 65535 are a mov on AArch64 and up to 2^31 - 1 an immediate on x86-64.
+    auto load = [&](const std::string& target, unsigned long long value) -> std::string {
+        if (isArm == 1) {
+            return value <= 65535 ? "    mov " + target + ", #" + std::to_string(value) + "\n" : "    ldr " + target + ", =" + std::to_string(value) + "\n";
+        }
+        return "mov " + target + ", " + std::to_string(value) + "\n";
+    };
+    int log2 = 63 - __builtin_clzll(d);
+    std::string k = std::to_string(log2);
+    if ((d & (d - 1)) == 0) {
+        if (op == "*") {
+            return isArm == 1 ? "    lsl " + reg + ", " + reg + ", #" + k + "\n" : "shl " + reg + ", " + k + "\n";
+        }
+        if (op == "//") {
+            return isArm == 1 ? "    lsr " + reg + ", " + reg + ", #" + k + "\n" : "shr " + reg + ", " + k + "\n";
+        }
+        if (op == "%") {
+            if (d == 1) {
+                return isArm == 1 ? "    mov " + reg + ", xzr\n" : "xor " + reg + ", " + reg + "\n";
+            }
+            if (isArm == 1) {
+                return "    and " + reg + ", " + reg + ", #" + std::to_string(d - 1) + "\n";
+            }
+            if (d - 1 <= 2147483647ULL) {
+                return "and " + reg + ", " + std::to_string(d - 1) + "\n";
+            }
+            return load("rcx", d - 1) + "and " + reg + ", rcx\n";
+        }
+        return "";
+    }
+    if (op != "//" && op != "%") {
+        return "";
+    }
+    unsigned __int128 scaled = (unsigned __int128)1 << (64 + log2);
+    unsigned long long magic = (unsigned long long)(scaled / d);
+    unsigned long long rem = (unsigned long long)(scaled % d);
+    bool add = false;
+    if (d - rem >= (1ULL << log2)) {
+        unsigned long long twice = rem + rem;
+        magic += magic;
+        if (twice >= d || twice < rem) {
+            magic += 1;
+        }
+        add = true;
+    }
+    magic += 1;
+    std::string out = "";
+    if (isArm == 1) {
+        out += load("x11", magic);
+        out += "    umulh x11, " + reg + ", x11\n";
+        if (add) {
+            out += "    sub x12, " + reg + ", x11\n";
+            out += "    add x11, x11, x12, lsr #1\n";
+        }
+        if (log2 > 0) {
+            out += "    lsr x11, x11, #" + k + "\n";
+        }
+        if (op == "//") {
+            out += "    mov " + reg + ", x11\n";
+        } else {
+            out += load("x12", d);
+            out += "    msub " + reg + ", x11, x12, " + reg + "\n";
+        }
+        return out;
+    }
+    out += load("rax", magic);
+    out += "mul " + reg + "\n";
+    if (add) {
+        out += "mov rcx, " + reg + "\nsub rcx, rdx\nshr rcx, 1\nadd rdx, rcx\n";
+    }
+    if (log2 > 0) {
+        out += "shr rdx, " + k + "\n";
+    }
+    if (op == "//") {
+        out += "mov " + reg + ", rdx\n";
+    }
+    else if (d <= 2147483647ULL) {
+        out += "imul rdx, rdx, " + std::to_string(d) + "\nsub " + reg + ", rdx\n";
+    } else {
+        out += load("rax", d) + "imul rdx, rax\nsub " + reg + ", rdx\n";
+    }
+    return out;
+}
+// Lowers one expression statement, "<dest> <op> <a> <op> <b> ...", as the expression pass
+// writes it after the ___HTLL_expr___ marker; op is ":=" or a compound operator ("+=", ...).
+// There are no parentheses and evaluation is strictly left to right, so the expression
+// parses into a left-leaning chain: one accumulator register holds the running value, each
+// operand is used straight from its variable, immediate, rax or A_Index, and no temporary
+// ever spills. x86-64 accumulates in rdi, AArch64 in x9 and Oryx in r94.
+std::string HTLL_lowerExpression(const std::string& line, int isArm, int isOryx, int inFunc) {
+    static const char* const ops[] = {"+", "-", "*", "//", "%", "<<", ">>", "&", "|", "^"};
+    static const char* const x86Ops[] = {"add", "sub", "imul", "div", "div", "shl", "shr", "and", "or", "xor"};
+    static const char* const armOps[] = {"add", "sub", "mul", "udiv", "mod", "lsl", "lsr", "and", "orr", "eor"};
+    static const char* const oryxOps[] = {"add", "sub", "mul", "div_floor", "mod", "shl", "shr", "and", "or", "xor"};
+    auto opIndex = [&](const std::string& token) {
+        for (int i = 0; i < (int)(sizeof(ops) / sizeof(ops[0])); i++) {
+            if (token == ops[i]) {
+                return i;
+            }
+        }
+        return -1;
+    };
+    auto isNumber = [](const std::string& token) {
+        if (token.empty()) {
+            return false;
+        }
+        for (char c : token) {
+            if (c < '0' || c > '9') {
+                return false;
+            }
+        }
+        return true;
+    };
+    // Numbers that do not fit the instruction's immediate field go through a register.
+    auto fits = [&](const std::string& token, unsigned long long limit) {
+        return isNumber(token) && token.size() <= 10 && std::stoull(token) <= limit;
+    };
+    std::vector<std::string> tokens;
+    std::stringstream stream(line);
+    std::string token;
+    while (stream >> token) {
+        tokens.push_back(token);
+    }
+    bool valid = tokens.size() >= 3 && tokens.size() % 2 == 1 && tokens[1].size() >= 2 && tokens[1].back() == '=';
+    int assignOp = -1;
+    if (valid && tokens[1] != ":=") {
+        assignOp = opIndex(tokens[1].substr(0, tokens[1].size() - 1));
+        valid = assignOp != -1;
+    }
+    for (size_t i = 2; valid && i < tokens.size(); i++) {
+        valid = (opIndex(tokens[i]) != -1) == (i % 2 == 1);
+    }
+    if (!valid) {
+        throw std::runtime_error("ERROR invalid expression: " + line);
+    }
+    const std::string& dest = tokens[0];
+    std::string out = "";
+    if (isOryx == 1) {
+        auto value = [](const std::string& operand) -> std::string {
+            if (operand == "rax") {
+                return "r0";
+            }
+            if (operand == "A_Index") {
+                return "r20";
+            }
+            return operand;
+        };
+        out += "meta " + line + "\n";
+        out += "mov r94, " + value(tokens[2]) + "\n";
+        for (size_t i = 3; i < tokens.size(); i += 2) {
+            out += std::string(oryxOps[opIndex(tokens[i])]) + " r94, " + value(tokens[i + 1]) + "\n";
+        }
+        out += std::string(assignOp == -1 ? "mov" : oryxOps[assignOp]) + " " + value(dest) + ", r94\n";
+        return out;
+    }
+    if (isArm == 1) {
+        auto isParam = [&](const std::string& name) {
+            return inFunc == 1 && HTLL_isFuncParam(name);
+        };
+        // Returns the register holding operand, loading it into reg unless it is rax or A_Index.
+        auto load = [&](const std::string& reg, const std::string& operand) -> std::string {
+            if (operand == "rax") {
+                return "x0";
+            }
+            if (operand == "A_Index") {
+                return "x20";
+            }
+            if (isNumber(operand)) {
+                if (fits(operand, 65535)) {
+                    out += "    mov " + reg + ", #" + operand + "\n";
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jle .end_if7_" + STR(ifCount7) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jle .end_if7_" + STR(ifCount7) + Chr(10);
-                    }
+                    out += "    ldr " + reg + ", =" + operand + "\n";
                 }
             }
-            else if (InStr(str1, " < ")) {
-                str2 = Trim(StrSplit(str1, " < ", 1));
-                str3 = Trim(StrSplit(str1, " < ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index167 = 0; A_Index167 < HTVM_Size(funcArgsArr); A_Index167++) {
-                            if (Trim(funcArgsArr[A_Index167]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index168 = 0; A_Index168 < HTVM_Size(funcArgsArr); A_Index168++) {
-                                if (Trim(funcArgsArr[A_Index168]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ge .end_if7_" + STR(ifCount7) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jge end_if7_" + STR(ifCount7) + Chr(10);
+            else if (isParam(operand)) {
+                out += "    ldr " + reg + ", =" + operand + "\n";
+            } else {
+                out += "    ldr " + reg + ", =" + operand + "\n";
+                out += "    ldr " + reg + ", [" + reg + "]\n";
+            }
+            return reg;
+        };
+        // x9 := left <op> right
+        auto apply = [&](int op, const std::string& left, const std::string& right) {
+            if (op == 4) {
+                out += "    udiv x12, " + left + ", " + right + "\n";
+                out += "    msub x9, x12, " + right + ", " + left + "\n";
+            } else {
+                out += "    " + std::string(armOps[op]) + " x9, " + left + ", " + right + "\n";
+            }
+        };
+        std::string first = load("x9", tokens[2]);
+        if (first != "x9") {
+            out += "    mov x9, " + first + "\n";
+        }
+        for (size_t i = 3; i < tokens.size(); i += 2) {
+            int op = opIndex(tokens[i]);
+            const std::string& operand = tokens[i + 1];
+            std::string reduced = HTLL_reduceByConstant(tokens[i], "x9", operand, 1);
+            if (op <= 1 && fits(operand, 4095)) {
+                out += "    " + std::string(armOps[op]) + " x9, x9, #" + operand + "\n";
+            }
+            else if (reduced != "") {
+                out += reduced;
+            } else {
+                apply(op, "x9", load("x11", operand));
+            }
+        }
+        bool haveAddress = false;
+        if (assignOp != -1) {
+            std::string current = "x0";
+            if (dest != "rax") {
+                current = "x11";
+                if (isParam(dest)) {
+                    out += "    ldr x11, =" + dest + "\n";
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jge .end_if7_" + STR(ifCount7) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jge .end_if7_" + STR(ifCount7) + Chr(10);
-                    }
+                    out += "    ldr x10, =" + dest + "\n";
+                    out += "    ldr x11, [x10]\n";
+                    haveAddress = true;
                 }
             }
-            else if (InStr(str1, " >= ")) {
-                str2 = Trim(StrSplit(str1, " >= ", 1));
-                str3 = Trim(StrSplit(str1, " >= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index169 = 0; A_Index169 < HTVM_Size(funcArgsArr); A_Index169++) {
-                            if (Trim(funcArgsArr[A_Index169]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index170 = 0; A_Index170 < HTVM_Size(funcArgsArr); A_Index170++) {
-                                if (Trim(funcArgsArr[A_Index170]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.lt .end_if7_" + STR(ifCount7) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jl end_if7_" + STR(ifCount7) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jl .end_if7_" + STR(ifCount7) + Chr(10);
+            apply(assignOp, current, "x9");
+        }
+        if (dest == "rax") {
+            out += "    mov x0, x9\n";
+        }
+        else if (isParam(dest)) {
+            out += "    str x9, =" + dest + "\n";
+        } else {
+            if (!haveAddress) {
+                out += "    ldr x10, =" + dest + "\n";
+            }
+            out += "    str x9, [x10]\n";
+        }
+        if (isNint(dest)) {
+            out += "    ldr x0, =" + dest + "\n    ldr x1, =" + dest + "_is_negative\n    bl is_nint_negative\n";
+        }
+        return out;
+    }
+    // div leaves its results in rax and rdx, so when the chain divides, rax is copied to rsi
+    // first and later "rax" operands still see the value it had before the statement.
+    bool divides = false;
+    for (size_t i = 3; i < tokens.size(); i += 2) {
+        divides = divides || tokens[i] == "//" || tokens[i] == "%";
+    }
+    bool readsRax = false;
+    for (size_t i = 2; i < tokens.size(); i += 2) {
+        readsRax = readsRax || tokens[i] == "rax";
+    }
+    auto operandText = [&](const std::string& operand) -> std::string {
+        if (isNumber(operand)) {
+            return operand;
+        }
+        if (operand == "rax") {
+            return divides ? "rsi" : "rax";
+        }
+        return "[" + operand + "]";
+    };
+    if (divides && readsRax) {
+        out += "mov rsi, rax\n";
+    }
+    out += "mov rdi, " + operandText(tokens[2]) + "\n";
+    for (size_t i = 3; i < tokens.size(); i += 2) {
+        int op = opIndex(tokens[i]);
+        std::string operand = operandText(tokens[i + 1]);
+        std::string reduced = HTLL_reduceByConstant(tokens[i], "rdi", tokens[i + 1], 0);
+        if (reduced != "") {
+            out += reduced;
+        }
+        else if (op == 3 || op == 4) {
+            if (operand != "rsi") {
+                out += "mov rcx, " + operand + "\n";
+                operand = "rcx";
+            }
+            out += "mov rax, rdi\nxor rdx, rdx\ndiv " + operand + "\n";
+            out += std::string("mov rdi, ") + (op == 3 ? "rax" : "rdx") + "\n";
+        }
+        else if (op == 5 || op == 6) {
+            if (!isNumber(tokens[i + 1])) {
+                out += "mov rcx, " + operand + "\n";
+                operand = "cl";
+            }
+            out += std::string(x86Ops[op]) + " rdi, " + operand + "\n";
+        } else {
+            if (isNumber(tokens[i + 1]) && !fits(tokens[i + 1], 2147483647ULL)) {
+                out += "mov rcx, " + operand + "\n";
+                operand = "rcx";
+            }
+            out += std::string(x86Ops[op]) + " rdi, " + operand + "\n";
+        }
+    }
+    std::string target = dest == "rax" ? "rax" : "qword [" + dest + "]";
+    if (assignOp == -1) {
+        out += "mov " + target + ", rdi\n";
+    }
+    else if (assignOp == 2) {
+        out += "imul rdi, " + target + "\nmov " + target + ", rdi\n";
+    }
+    else if (assignOp == 3 || assignOp == 4) {
+        if (dest != "rax") {
+            out += "mov rax, " + target + "\n";
+        }
+        out += "xor rdx, rdx\ndiv rdi\n";
+        if (assignOp == 4 || dest != "rax") {
+            out += std::string("mov ") + target + ", " + (assignOp == 3 ? "rax" : "rdx") + "\n";
+        }
+    }
+    else if (assignOp == 5 || assignOp == 6) {
+        out += "mov rcx, rdi\n" + std::string(x86Ops[assignOp]) + " " + target + ", cl\n";
+    } else {
+        out += std::string(x86Ops[assignOp]) + " " + target + ", rdi\n";
+    }
+    if (isNint(dest)) {
+        out += "lea rdi, [" + dest + "]\nlea rsi, [" + dest + "_is_negative]\ncall is_nint_negative\n";
+    }
+    return out;
+}
+// --watch keeps the code each function compiled to, so that a rebuild only runs the statement
+// handlers for the functions that changed. An entry is keyed on the target, the function's
+// lowered statements and the back-end state they read on the way in (label counters, the temp
+// string count, the nint globals, ...), and holds the function's code together with what it
+// appended to or left in that state.
+struct HTLL_FunctionCode {
+    std::string code;
+    std::string dataInts;
+    std::string tempStrings;
+    std::string arrBss;
+    std::vector<std::string> nints;
+    std::vector<int> loopCounts;
+    std::vector<int> ifCounts;
+    int fixInt = 0;
+    int tempStringCount = 0;
+    int isDotCompile = 0;
+    std::string funcName;
+    std::vector<std::string> funcArgsArr;
+    int funcArgsCount = 0;
+    int localVarNum = 0;
+};
+int HTLL_reuseFunctions = 0; // set by --watch
+std::mutex HTLL_functionCodesMutex;
+std::unordered_map<std::string, HTLL_FunctionCode> HTLL_functionCodes;
+bool HTLL_findFunctionCode(const std::string& key, HTLL_FunctionCode& code) {
+    std::lock_guard<std::mutex> lock(HTLL_functionCodesMutex);
+    auto found = HTLL_functionCodes.find(key);
+    if (found == HTLL_functionCodes.end()) {
+        return false;
+    }
+    code = found->second;
+    return true;
+}
+void HTLL_storeFunctionCode(const std::string& key, HTLL_FunctionCode code) {
+    std::lock_guard<std::mutex> lock(HTLL_functionCodesMutex);
+    // a long session starts over now and then instead of growing without bound
+    if (HTLL_functionCodes.size() >= 65536) {
+        HTLL_functionCodes.clear();
+    }
+    HTLL_functionCodes[key] = std::move(code);
+}
+HTLL_Output HTLL_backEnd(std::string code) {
+    HTLL_pass("statement preparation");
+    std::string out = "";
+    std::string main_syntax = "";
+    if (is_arm == 1) {
+        if (RegExMatch(code, "\\bargs_array\\b")) {
+            main_syntax = "_start:" + Chr(10);
+            // FIXED: Removed parens and comments that confuse the parser
+            main_syntax += "    ldr x19, [sp]" + Chr(10);
+            main_syntax += "    stp x29, x30, [sp, #-32]!" + Chr(10);
+            main_syntax += "    mov x29, sp" + Chr(10);
+            main_syntax += "    ldr x0, =args_array" + Chr(10);
+            main_syntax += "    bl array_clear" + Chr(10);
+            main_syntax += "    add x20, sp, #40" + Chr(10);
+            main_syntax += "    mov x21, #1" + Chr(10);
+            main_syntax += ".arg_loop:" + Chr(10);
+            main_syntax += "    cmp x21, x19" + Chr(10);
+            main_syntax += "    b.ge .args_done" + Chr(10);
+            // Load argv[x21]
+            main_syntax += "    ldr x22, [x20, x21, lsl #3]" + Chr(10);
+            main_syntax += ".unpack_byte_loop:" + Chr(10);
+            main_syntax += "    ldrb w1, [x22], #1" + Chr(10);
+            main_syntax += "    cmp w1, #0" + Chr(10);
+            main_syntax += "    b.eq .unpack_byte_done" + Chr(10);
+            main_syntax += "    ldr x0, =args_array" + Chr(10);
+            main_syntax += "    bl array_append" + Chr(10);
+            main_syntax += "    b .unpack_byte_loop" + Chr(10);
+            main_syntax += ".unpack_byte_done:" + Chr(10);
+            main_syntax += "    mov x1, #10" + Chr(10);
+            main_syntax += "    ldr x0, =args_array" + Chr(10);
+            main_syntax += "    bl array_append" + Chr(10);
+            main_syntax += "    add x21, x21, #1" + Chr(10);
+            main_syntax += "    b .arg_loop" + Chr(10);
+            main_syntax += ".args_done:" + Chr(10) + Chr(10);
+        } else {
+            // --- THE FIX IS HERE ---
+            main_syntax = "_start:" + Chr(10);
+            main_syntax += "    stp x29, x30, [sp, #-16]!" + Chr(10);
+            main_syntax += "    mov x29, sp" + Chr(10) + Chr(10);
+        }
+    }
+    else if (is_oryx == 1) {
+        // --- ORYX IR ENTRY ---
+        // Oryx is a VM, so it handles stack alignment automatically.
+        // We just need the entry label to tell the VM where to begin.
+        main_syntax = "_start:" + Chr(10);
+        if (RegExMatch(code, "\\bargs_array\\b")) {
+            // In Oryx IR, we assume the VM environment populates 'args_array'
+            // automatically if it exists, or we add a specific sys-call later.
+            // We don't need manual stack walking code here.
+            main_syntax += "    ; args_array handling" + Chr(10);
+        }
+    } else {
+        // --- YOUR EXISTING X86 CODE - UNCHANGED AND CORRECT ---
+        if (RegExMatch(code, "\\bargs_array\\b")) {
+            main_syntax = Chr(10) + "_start:" + Chr(10) + "push rbp" + Chr(10) + "mov rbp, rsp" + Chr(10) + "and rsp, -16" + Chr(10) + "mov rdi, args_array" + Chr(10) + "call array_clear" + Chr(10) + "mov r12, [rbp+8]" + Chr(10) + "lea r13, [rbp+16]" + Chr(10) + "mov r14, 1" + Chr(10) + ".arg_loop:" + Chr(10) + "cmp r14, r12" + Chr(10) + "jge .args_done" + Chr(10) + "mov r15, [r13 + r14*8]" + Chr(10) + ".unpack_byte_loop:" + Chr(10) + "movzx rbx, byte [r15]" + Chr(10) + "cmp rbx, 0" + Chr(10) + "je .unpack_byte_done" + Chr(10) + "mov rdi, args_array" + Chr(10) + "mov rsi, rbx" + Chr(10) + "call array_append" + Chr(10) + "inc r15" + Chr(10) + "jmp .unpack_byte_loop" + Chr(10) + ".unpack_byte_done:" + Chr(10) + "mov rdi, args_array" + Chr(10) + "mov rsi, 10" + Chr(10) + "call array_append" + Chr(10) + "inc r14" + Chr(10) + "jmp .arg_loop" + Chr(10) + ".args_done:" + Chr(10) + Chr(10);
+        } else {
+            main_syntax = Chr(10) + "_start:" + Chr(10) + "push rbp" + Chr(10) + "mov rbp, rsp" + Chr(10) + "and rsp, -16 " + Chr(10) + Chr(10);
+        }
+    }
+    std::string HTLL_Libs_file = "HTLL_Libs_x86.txt";
+    if (ring0 == 1) {
+        HTLL_Libs_file = "HTLL_Libs_ring0.txt";
+    }
+    if (is_arm == 1) {
+        HTLL_Libs_file = "HTLL_Libs_AArch64.txt";
+    }
+    if (is_oryx == 1) {
+        HTLL_Libs_file = "";
+    }
+    int isDotCompile = 0;
+    std::string dot_data = Chr(10);
+    std::string dot_data_print_temp_strings = Chr(10);
+    int dot_data_print_temp_strings_count = 0;
+    std::string dot_data_ints = Chr(10);
+    std::string path_label = "";
+    std::string dot_bss = Chr(10);
+    std::string dot_bss_str = Chr(10);
+    std::string arrBss = "";
+    std::vector<std::string> theIdNumOfThe34theVar;
+    std::vector<std::string> getAllCharForTheFurtureSoIcanAddEscapeChar;
+    std::string ReplaceFixWhitOutFixDoubleQuotesInsideDoubleQuotes = "";
+    std::string str21 = "";
+    std::string htCodeOUT754754 = "";
+    std::string OutFixDoubleQuotesInsideDoubleQuotes = "";
+    std::string keyWordEscpaeChar = "\\";
+    int fixOutFixDoubleQuotesInsideDoubleQuotesFIXok = 0;
+    int removeNexFixkeyWordEscpaeChar = 0;
+    int theIdNumOfThe34 = 0;
+    int areWEinSome34sNum = 0;
+    int loopCount = 0;
+    std::vector<int> loopCounts;
+    int ifCount = 0;
+    std::vector<int> ifCounts;
+    int funcCount = 0;
+    int isNum = 0;
+    int localVarNum = 1;
+    int inFunc = 0;
+    int funcArgsCount = 0;
+    std::vector<std::string> funcArgsArr;
+    HTLL_beginFunction(funcArgsArr);
+    std::string funcName = "";
+    std::string str_index = "";
+    std::string str_value = "";
+    int int1 = 0;
+    int int2 = 0;
+    int int3 = 0;
+    int int4 = 0;
+    int int5 = 0;
+    int int6 = 0;
+    int isOryxFuncFirst = 0;
+    int HTLL_fix_int = 0;
+    std::string strSrc = "";
+    std::string strLhs = "";
+    std::string strRhs = "";
+    std::string strVal = "";
+    std::string strIndex = "";
+    std::string idxSrc = "";
+    std::string valSrc = "";
+    std::string strArg = "";
+    int is_inf_loop = 0;
+    std::vector<std::string> items56 = LoopParseFunc(code);
+    for (size_t A_Index56 = 0; A_Index56 < items56.size(); A_Index56++) {
+        std::string A_LoopField56 = items56[A_Index56 - 0];
+        HTVM_Append(theIdNumOfThe34theVar, "");
+        HTVM_Append(theIdNumOfThe34theVar, "");
+    }
+    std::vector<std::string> items57 = LoopParseFunc(code);
+    for (size_t A_Index57 = 0; A_Index57 < items57.size(); A_Index57++) {
+        std::string A_LoopField57 = items57[A_Index57 - 0];
+        theIdNumOfThe34theVar[A_Index57] = theIdNumOfThe34theVar[A_Index57] + Chr(34);
+        HTVM_Append(getAllCharForTheFurtureSoIcanAddEscapeChar, A_LoopField57);
+    }
+    HTVM_Append(getAllCharForTheFurtureSoIcanAddEscapeChar, " ");
+    ReplaceFixWhitOutFixDoubleQuotesInsideDoubleQuotes = Chr(34) + "ihuiuuhuuhtheidFor" + str21 + "--" + str21 + "asds" + str21 + "as--" + str21 + "theuhtuwaesphoutr" + Chr(34);
+    std::vector<std::string> items58 = LoopParseFunc(code);
+    for (size_t A_Index58 = 0; A_Index58 < items58.size(); A_Index58++) {
+        std::string A_LoopField58 = items58[A_Index58 - 0];
+        if (A_LoopField58 == keyWordEscpaeChar && getAllCharForTheFurtureSoIcanAddEscapeChar[A_Index58 + 1] == Chr(34)) {
+            fixOutFixDoubleQuotesInsideDoubleQuotesFIXok = 1;
+            OutFixDoubleQuotesInsideDoubleQuotes += ReplaceFixWhitOutFixDoubleQuotesInsideDoubleQuotes;
+        } else {
+            if (fixOutFixDoubleQuotesInsideDoubleQuotesFIXok != 1) {
+                OutFixDoubleQuotesInsideDoubleQuotes += A_LoopField58;
+            } else {
+                fixOutFixDoubleQuotesInsideDoubleQuotesFIXok = 0;
+            }
+        }
+    }
+    code = OutFixDoubleQuotesInsideDoubleQuotes;
+    if (keyWordEscpaeChar != Chr(92)) {
+        code = StrReplace(code, Chr(92), Chr(92) + Chr(92));
+    }
+    if (keyWordEscpaeChar == Chr(92)) {
+        std::vector<std::string> items59 = LoopParseFunc(code);
+        for (size_t A_Index59 = 0; A_Index59 < items59.size(); A_Index59++) {
+            std::string A_LoopField59 = items59[A_Index59 - 0];
+            if (A_LoopField59 == Chr(34)) {
+                areWEinSome34sNum++;
+            }
+            if (areWEinSome34sNum == 1) {
+                if (A_LoopField59 != Chr(34)) {
+                    if (A_LoopField59 == keyWordEscpaeChar) {
+                        theIdNumOfThe34theVar[theIdNumOfThe34] = theIdNumOfThe34theVar[theIdNumOfThe34] + Chr(92);
                     } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jl .end_if7_" + STR(ifCount7) + Chr(10);
+                        theIdNumOfThe34theVar[theIdNumOfThe34] = theIdNumOfThe34theVar[theIdNumOfThe34] + A_LoopField59;
                     }
+                } else {
+                    theIdNumOfThe34++;
+                    htCodeOUT754754 += "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(theIdNumOfThe34) + Chr(65) + Chr(65);
                 }
             }
-            else if (InStr(str1, " <= ")) {
-                str2 = Trim(StrSplit(str1, " <= ", 1));
-                str3 = Trim(StrSplit(str1, " <= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index171 = 0; A_Index171 < HTVM_Size(funcArgsArr); A_Index171++) {
-                            if (Trim(funcArgsArr[A_Index171]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
+            if (areWEinSome34sNum == 2 || areWEinSome34sNum == 0) {
+                if (A_LoopField59 != Chr(34)) {
+                    htCodeOUT754754 += A_LoopField59;
+                }
+                areWEinSome34sNum = 0;
+            }
+        }
+    } else {
+        std::vector<std::string> items60 = LoopParseFunc(code);
+        for (size_t A_Index60 = 0; A_Index60 < items60.size(); A_Index60++) {
+            std::string A_LoopField60 = items60[A_Index60 - 0];
+            if (A_LoopField60 == Chr(34)) {
+                areWEinSome34sNum++;
+            }
+            if (areWEinSome34sNum == 1) {
+                if (A_LoopField60 != Chr(34)) {
+                    if (A_LoopField60 == keyWordEscpaeChar && keyWordEscpaeChar == getAllCharForTheFurtureSoIcanAddEscapeChar[A_Index60 + 1]) {
+                        theIdNumOfThe34theVar[theIdNumOfThe34] = theIdNumOfThe34theVar[theIdNumOfThe34] + keyWordEscpaeChar;
+                        removeNexFixkeyWordEscpaeChar = 1;
                     }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index172 = 0; A_Index172 < HTVM_Size(funcArgsArr); A_Index172++) {
-                                if (Trim(funcArgsArr[A_Index172]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
+                    else if (A_LoopField60 == keyWordEscpaeChar) {
+                        if (removeNexFixkeyWordEscpaeChar != 1) {
+                            theIdNumOfThe34theVar[theIdNumOfThe34] = theIdNumOfThe34theVar[theIdNumOfThe34] + Chr(92);
                         } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
+                            removeNexFixkeyWordEscpaeChar = 0;
                         }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.gt .end_if7_" + STR(ifCount7) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jg end_if7_" + STR(ifCount7) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jg .end_if7_" + STR(ifCount7) + Chr(10);
                     } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jg .end_if7_" + STR(ifCount7) + Chr(10);
+                        theIdNumOfThe34theVar[theIdNumOfThe34] = theIdNumOfThe34theVar[theIdNumOfThe34] + A_LoopField60;
                     }
+                } else {
+                    theIdNumOfThe34++;
+                    htCodeOUT754754 += "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(theIdNumOfThe34) + Chr(65) + Chr(65);
                 }
             }
+            if (areWEinSome34sNum == 2 || areWEinSome34sNum == 0) {
+                if (A_LoopField60 != Chr(34)) {
+                    htCodeOUT754754 += A_LoopField60;
+                }
+                areWEinSome34sNum = 0;
+            }
         }
-        else if (Trim(A_LoopField69) == "ifend7" || Trim(A_LoopField69) == "endif7") {
-            if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "end_if7_" + STR(ifCount7) + ":" + Chr(10);
+    }
+    code = htCodeOUT754754;
+    for (int A_Index61 = 0; A_Index61 < theIdNumOfThe34; A_Index61++) {
+        theIdNumOfThe34theVar[A_Index61] = theIdNumOfThe34theVar[A_Index61] + Chr(34);
+    }
+    // The literals are found; the two slots per character of the program and the
+    // per-character copies of it go before the statements are lowered and emitted.
+    theIdNumOfThe34theVar.resize(theIdNumOfThe34 + 1);
+    theIdNumOfThe34theVar.shrink_to_fit();
+    for (std::vector<std::string>* chars : {&items56, &items57, &items58, &getAllCharForTheFurtureSoIcanAddEscapeChar}) {
+        std::vector<std::string>().swap(*chars);
+    }
+    std::string().swap(OutFixDoubleQuotesInsideDoubleQuotes);
+    std::string().swap(htCodeOUT754754);
+    HTVM_Append(theIdNumOfThe34theVar, Chr(34));
+    code = StrReplace(code, "{", Chr(10) + "{" + Chr(10));
+    code = StrReplace(code, "}", Chr(10) + "}" + Chr(10));
+    std::vector<std::string> items62 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index62 = 0; A_Index62 < items62.size(); A_Index62++) {
+        std::string A_LoopField62 = items62[A_Index62 - 0];
+        out += Trim(A_LoopField62) + Chr(10);
+    }
+    code = StringTrimRight(out, 1);
+    str1 = "";
+    out = "";
+    std::vector<std::string> items63 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index63 = 0; A_Index63 < items63.size(); A_Index63++) {
+        std::string A_LoopField63 = items63[A_Index63 - 0];
+        std::vector<std::string> items64 = LoopParseFunc(A_LoopField63);
+        for (size_t A_Index64 = 0; A_Index64 < items64.size(); A_Index64++) {
+            std::string A_LoopField64 = items64[A_Index64 - 0];
+            if (A_LoopField64 != ";") {
+                str1 += A_LoopField64;
             } else {
-                out += ".end_if7_" + STR(ifCount7) + ":" + Chr(10);
+                break;
             }
-            ifCount7++;
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 4) == "if8 ") {
-            isNum = 0;
-            str1 = Trim(StringTrimLeft(A_LoopField69, 4));
-            str1 = StringTrimLeft(str1, 1);
-            str1 = StringTrimRight(str1, 1);
-            if (InStr(str1, " = ")) {
-                str2 = Trim(StrSplit(str1, " = ", 1));
-                str3 = Trim(StrSplit(str1, " = ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index173 = 0; A_Index173 < HTVM_Size(funcArgsArr); A_Index173++) {
-                            if (Trim(funcArgsArr[A_Index173]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    int isRhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index174 = 0; A_Index174 < HTVM_Size(funcArgsArr); A_Index174++) {
-                            if (Trim(funcArgsArr[A_Index174]) == str3) {
-                                isRhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str3 == "rax") {
-                        out += "    mov x10, x0" + Chr(10);
-                    }
-                    else if (str3 == "A_Index") {
-                        out += "    mov x10, x20" + Chr(10);
-                    }
-                    else if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    }
-                    else if (isRhsStackVar == 1) {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                    } else {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                        out += "    ldr x10, [x10]" + Chr(10);
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ne .end_if8_" + STR(ifCount8) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jne end_if8_" + STR(ifCount8) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jne .end_if8_" + STR(ifCount8) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jne .end_if8_" + STR(ifCount8) + Chr(10);
-                    }
+        out += Trim(str1) + Chr(10);
+        str1 = "";
+    }
+    code = StringTrimRight(out, 1);
+    int seenMain = 0;
+    out = "";
+    std::vector<std::string> items65 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index65 = 0; A_Index65 < items65.size(); A_Index65++) {
+        std::string A_LoopField65 = items65[A_Index65 - 0];
+        if (Trim(A_LoopField65) == "main") {
+            seenMain = 1;
+            out += main_syntax + Chr(10);
+        } else {
+            out += A_LoopField65 + Chr(10);
+        }
+    }
+    code = StringTrimRight(out, 1);
+    int fix_func_temp_int = 0;
+    std::vector<std::string> fix_func_temp_arr;
+    out = "";
+    std::vector<std::string> items66 = LoopParseFunc(code, "\n", "\r");
+    for (size_t A_Index66 = 0; A_Index66 < items66.size(); A_Index66++) {
+        std::string A_LoopField66 = items66[A_Index66 - 0];
+        if (SubStr(Trim(A_LoopField66), 1, 5) == "func ") {
+            //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+            //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+            str1 = Trim(StringTrimLeft(A_LoopField66, 5));
+            str2 = Trim(StrSplit(str1, "(", 1));
+            str3 = StrSplit(str1, "(", 2);
+            str3 = Trim(StrReplace(str3, ")", ""));
+            str4 = "";
+            if (Trim(str3) != "") {
+                fix_func_temp_arr = {};
+                fix_func_temp_int = 1;
+                std::vector<std::string> items67 = LoopParseFunc(str3, ",");
+                for (size_t A_Index67 = 0; A_Index67 < items67.size(); A_Index67++) {
+                    std::string A_LoopField67 = items67[A_Index67 - 0];
+                    str4 += "_jhkjli_HTLL_HTLL_HTLL_" + Trim(A_LoopField67) + ", ";
+                    HTVM_Append(fix_func_temp_arr, Trim(A_LoopField67));
                 }
+                str4 = StringTrimRight(str4, 2);
+                out += "func " + str2 + "(" + str4 + ")" + Chr(10);
+            } else {
+                out += A_LoopField66 + Chr(10);
             }
-            else if (InStr(str1, " != ")) {
-                str2 = Trim(StrSplit(str1, " != ", 1));
-                str3 = Trim(StrSplit(str1, " != ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index175 = 0; A_Index175 < HTVM_Size(funcArgsArr); A_Index175++) {
-                            if (Trim(funcArgsArr[A_Index175]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index176 = 0; A_Index176 < HTVM_Size(funcArgsArr); A_Index176++) {
-                                if (Trim(funcArgsArr[A_Index176]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.eq .end_if8_" + STR(ifCount8) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "je end_if8_" + STR(ifCount8) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "je .end_if8_" + STR(ifCount8) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "je .end_if8_" + STR(ifCount8) + Chr(10);
-                    }
+            //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+            //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+        }
+        else if (Trim(A_LoopField66) == "funcend" || Trim(A_LoopField66) == "endfunc") {
+            fix_func_temp_int = 0;
+            fix_func_temp_arr = {};
+            out += A_LoopField66 + Chr(10);
+        } else {
+            if (fix_func_temp_int == 1) {
+                str1 = A_LoopField66;
+                for (int A_Index68 = 0; A_Index68 < HTVM_Size(fix_func_temp_arr); A_Index68++) {
+                    str1 = RegExReplace(str1, "\\b" + Trim(fix_func_temp_arr[A_Index68]) + "\\b", "_jhkjli_HTLL_HTLL_HTLL_" + Trim(fix_func_temp_arr[A_Index68]));
                 }
+                out += str1 + Chr(10);
+            } else {
+                out += A_LoopField66 + Chr(10);
             }
-            else if (InStr(str1, " > ")) {
-                str2 = Trim(StrSplit(str1, " > ", 1));
-                str3 = Trim(StrSplit(str1, " > ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index177 = 0; A_Index177 < HTVM_Size(funcArgsArr); A_Index177++) {
-                            if (Trim(funcArgsArr[A_Index177]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index178 = 0; A_Index178 < HTVM_Size(funcArgsArr); A_Index178++) {
-                                if (Trim(funcArgsArr[A_Index178]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.le .end_if8_" + STR(ifCount8) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
+        }
+    }
+    code = StringTrimRight(out, 1);
+    out = "";
+    HTLL_pass("statement codegen");
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    // main loop main loop main loop main loop
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    // main loop main loop main loop main loop
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    // main loop main loop main loop main loop
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    // main loop main loop main loop main loop
+    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    std::vector<std::string> items69 = LoopParseFunc(code, "\n", "\r");
+    std::string().swap(code);
+    // Every statement is classified up front, which also gives the deepest loop of each
+    // function (for the loop registers its prologue saves) and of the whole program.
+    std::vector<int> stmtKinds(items69.size());
+    std::vector<int> stmtLevels(items69.size(), 1);
+    std::vector<int> funcLoopDepths;
+    int funcLoopDepth = 0;
+    HTLL_loopDepth = 0;
+    for (size_t i = 0; i < items69.size(); i++) {
+        stmtKinds[i] = HTLL_statementKind(items69[i], stmtLevels[i]);
+        if (stmtKinds[i] == HTLL_STMT_LOOP) {
+            funcLoopDepth = std::max(funcLoopDepth, stmtLevels[i]);
+            HTLL_loopDepth = std::max(HTLL_loopDepth, stmtLevels[i]);
+        }
+        else if (stmtKinds[i] == HTLL_STMT_FUNC) {
+            funcLoopDepth = 0;
+        }
+        else if (stmtKinds[i] == HTLL_STMT_FUNCEND) {
+            funcLoopDepths.push_back(funcLoopDepth);
+            funcLoopDepth = 0;
+        }
+    }
+    // Statement handlers indexed by HTLL_STMT_* kind. The main loop classifies each line and
+    // calls the handler of its kind; a kind without one is copied through unchanged.
+    std::string A_LoopField69;
+    int stmtLevel = 1;
+    std::vector<std::string> loopRegs;
+    std::function<void()> stmtHandlers[HTLL_STMT_COUNT];
+    stmtHandlers[HTLL_STMT_ARRADD] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 7));
+        str2 = StrSplit(str1, " ", 1);
+        str3 = StringTrimLeft(str1, StrLen(str2) + 1);
+        str4 = "";
+        if (is_arm == 1) {
+            // --- AArch64 CODE GENERATION ---
+            std::vector<std::string> items70 = LoopParseFunc(str3);
+            for (size_t A_Index70 = 0; A_Index70 < items70.size(); A_Index70++) {
+                std::string A_LoopField70 = items70[A_Index70 - 0];
+                // For each character, we call array_append(array_ptr, char_value)
+                // Arg 1 (array_ptr) goes in x0
+                // Arg 2 (char_value) goes in x1
+                str4 += "    ldr x0, =" + str2 + Chr(10);
+                str4 += "    mov x1, #" + Chr(39) + A_LoopField70 + Chr(39) + Chr(10);
+                str4 += "    bl array_append" + Chr(10);
+            }
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR GENERATION ---
+            std::vector<std::string> items71 = LoopParseFunc(str3);
+            for (size_t A_Index71 = 0; A_Index71 < items71.size(); A_Index71++) {
+                std::string A_LoopField71 = items71[A_Index71 - 0];
+                // arr.add arrayName, charValue
+                str4 += "    arr.add " + str2 + ", " + STR(Asc(A_LoopField71)) + Chr(10);
+            }
+        } else {
+            // --- YOUR EXISTING X86 CODE - UNCHANGED ---
+            std::vector<std::string> items72 = LoopParseFunc(str3);
+            for (size_t A_Index72 = 0; A_Index72 < items72.size(); A_Index72++) {
+                std::string A_LoopField72 = items72[A_Index72 - 0];
+                str4 += "mov rsi, " + Chr(39) + A_LoopField72 + Chr(39) + Chr(10) + "mov rdi, " + str2 + Chr(10) + "call array_append" + Chr(10);
+            }
+        }
+        out += str4 + Chr(10);
+    };
+    stmtHandlers[HTLL_STMT_INT] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 4));
+        HTLL_declareLocal(str1);
+        if (is_arm == 1) {
+            // --- AArch64 CODE GENERATION ---
+            if (InStr(str1, ":=")) {
+                str2 = Trim(StrSplit(str1, ":=", 1));
+                str3 = Trim(StrSplit(str1, ":=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    dot_data_ints += str2 + ": .quad " + str3 + Chr(10);
+                } else {
+                    dot_data_ints += str2 + ": .quad 0" + Chr(10);
+                    // ############## FIX START ##############
                     if (str3 == "rax") {
-                        strRhs = "r0";
+                        out += "    mov x9, x0" + Chr(10);
                     }
                     else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jle end_if8_" + STR(ifCount8) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jle .end_if8_" + STR(ifCount8) + Chr(10);
+                        out += "    mov x9, x20" + Chr(10);
                     } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jle .end_if8_" + STR(ifCount8) + Chr(10);
+                        out += "    ldr x10, =" + str3 + Chr(10);
+                        out += "    ldr x9, [x10]" + Chr(10);
                     }
+                    // ############## FIX END ##############
+                    out += "    ldr x10, =" + str2 + Chr(10);
+                    out += "    str x9, [x10]" + Chr(10);
+                }
+            } else {
+                if (InStr(str1, ":=") == false && InStr(str1, "+=") == false && InStr(str1, "-=") == false && InStr(str1, "*=") == false) {
+                    dot_data_ints += Trim(str1) + ": .quad 0" + Chr(10);
                 }
             }
-            else if (InStr(str1, " < ")) {
-                str2 = Trim(StrSplit(str1, " < ", 1));
-                str3 = Trim(StrSplit(str1, " < ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index179 = 0; A_Index179 < HTVM_Size(funcArgsArr); A_Index179++) {
-                            if (Trim(funcArgsArr[A_Index179]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index180 = 0; A_Index180 < HTVM_Size(funcArgsArr); A_Index180++) {
-                                if (Trim(funcArgsArr[A_Index180]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ge .end_if8_" + STR(ifCount8) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jge end_if8_" + STR(ifCount8) + Chr(10);
+            if (InStr(str1, "*=")) {
+                str2 = Trim(StrSplit(str1, "*=", 1));
+                dot_data_ints += str2 + ": .quad 0" + Chr(10);
+            }
+            else if (InStr(str1, "+=")) {
+                str2 = Trim(StrSplit(str1, "+=", 1));
+                dot_data_ints += str2 + ": .quad 0" + Chr(10);
+            }
+            else if (InStr(str1, "-=")) {
+                str2 = Trim(StrSplit(str1, "-=", 1));
+                dot_data_ints += str2 + ": .quad 0" + Chr(10);
+            }
+            if (InStr(A_LoopField69, " += ")) {
+                str2 = Trim(StrSplit(str1, "+=", 1));
+                str3 = Trim(StrSplit(str1, "+=", 2));
+                out += "    ldr x10, =" + str2 + Chr(10);
+                out += "    ldr x9, [x10]" + Chr(10);
+                // ############## FIX START ##############
+                if (str3 == "rax") {
+                    out += "    add x9, x9, x0" + Chr(10);
+                }
+                else if (str3 == "A_Index") {
+                    out += "    add x9, x9, x20" + Chr(10);
+                }
+                else if (RegExMatch(str3, "^\\d+$")) {
+                    out += "    add x9, x9, #" + str3 + Chr(10);
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jge .end_if8_" + STR(ifCount8) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jge .end_if8_" + STR(ifCount8) + Chr(10);
-                    }
+                    out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
+                    out += "    add x9, x9, x11" + Chr(10);
+                }
+                // ############## FIX END ##############
+                out += "    str x9, [x10]" + Chr(10);
+            }
+            else if (InStr(A_LoopField69, " *= ")) {
+                str2 = Trim(StrSplit(str1, "*=", 1));
+                str3 = Trim(StrSplit(str1, "*=", 2));
+                out += "    ldr x10, =" + str2 + Chr(10);
+                out += "    ldr x9, [x10]" + Chr(10);
+                // ############## FIX START ##############
+                if (str3 == "rax") {
+                    out += "    mul x9, x9, x0" + Chr(10);
+                }
+                else if (str3 == "A_Index") {
+                    out += "    mul x9, x9, x20" + Chr(10);
+                }
+                else if (RegExMatch(str3, "^\\d+$")) {
+                    out += "    mov x11, #" + str3 + Chr(10);
+                    out += "    mul x9, x9, x11" + Chr(10);
+                } else {
+                    out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
+                    out += "    mul x9, x9, x11" + Chr(10);
+                }
+                // ############## FIX END ##############
+                out += "    str x9, [x10]" + Chr(10);
+            }
+            else if (InStr(A_LoopField69, " -= ")) {
+                str2 = Trim(StrSplit(str1, "-=", 1));
+                str3 = Trim(StrSplit(str1, "-=", 2));
+                out += "    ldr x10, =" + str2 + Chr(10);
+                out += "    ldr x9, [x10]" + Chr(10);
+                // ############## FIX START ##############
+                if (str3 == "rax") {
+                    out += "    sub x9, x9, x0" + Chr(10);
+                }
+                else if (str3 == "A_Index") {
+                    out += "    sub x9, x9, x20" + Chr(10);
+                }
+                else if (RegExMatch(str3, "^\\d+$")) {
+                    out += "    sub x9, x9, #" + str3 + Chr(10);
+                } else {
+                    out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
+                    out += "    sub x9, x9, x11" + Chr(10);
                 }
+                // ############## FIX END ##############
+                out += "    str x9, [x10]" + Chr(10);
             }
-            else if (InStr(str1, " >= ")) {
-                str2 = Trim(StrSplit(str1, " >= ", 1));
-                str3 = Trim(StrSplit(str1, " >= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index181 = 0; A_Index181 < HTVM_Size(funcArgsArr); A_Index181++) {
-                            if (Trim(funcArgsArr[A_Index181]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index182 = 0; A_Index182 < HTVM_Size(funcArgsArr); A_Index182++) {
-                                if (Trim(funcArgsArr[A_Index182]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.lt .end_if8_" + STR(ifCount8) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR GENERATION ---
+            if (InStr(str1, ":=")) {
+                str2 = Trim(StrSplit(str1, ":=", 1));
+                str3 = Trim(StrSplit(str1, ":=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "int " + str2 + ": " + str3 + Chr(10);
+                } else {
+                    out += "int " + str2 + ": 0" + Chr(10);
+                    strSrc = str3;
                     if (str3 == "rax") {
-                        strRhs = "r0";
+                        strSrc = "r0";
                     }
                     else if (str3 == "A_Index") {
-                        strRhs = "r20";
+                        strSrc = "r20";
                     }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jl end_if8_" + STR(ifCount8) + Chr(10);
+                    out += "mov " + str2 + ", " + strSrc + Chr(10);
+                }
+            } else {
+                // Handle pure declaration or declaration with math
+                str2 = str1;
+                if (InStr(str1, "+=")) {
+                    str2 = Trim(StrSplit(str1, "+=", 1));
+                }
+                else if (InStr(str1, "-=")) {
+                    str2 = Trim(StrSplit(str1, "-=", 1));
+                }
+                else if (InStr(str1, "*=")) {
+                    str2 = Trim(StrSplit(str1, "*=", 1));
+                }
+                out += "int " + Trim(str2) + ": 0" + Chr(10);
+            }
+            if (InStr(A_LoopField69, " += ")) {
+                str2 = Trim(StrSplit(str1, "+=", 1));
+                str3 = Trim(StrSplit(str1, "+=", 2));
+                strSrc = str3;
+                if (str3 == "rax") {
+                    strSrc = "r0";
+                }
+                else if (str3 == "A_Index") {
+                    strSrc = "r20";
+                }
+                out += "add " + str2 + ", " + strSrc + Chr(10);
+            }
+            else if (InStr(A_LoopField69, " *= ")) {
+                str2 = Trim(StrSplit(str1, "*=", 1));
+                str3 = Trim(StrSplit(str1, "*=", 2));
+                strSrc = str3;
+                if (str3 == "rax") {
+                    strSrc = "r0";
+                }
+                else if (str3 == "A_Index") {
+                    strSrc = "r20";
+                }
+                out += "mul " + str2 + ", " + strSrc + Chr(10);
+            }
+            else if (InStr(A_LoopField69, " -= ")) {
+                str2 = Trim(StrSplit(str1, "-=", 1));
+                str3 = Trim(StrSplit(str1, "-=", 2));
+                strSrc = str3;
+                if (str3 == "rax") {
+                    strSrc = "r0";
+                }
+                else if (str3 == "A_Index") {
+                    strSrc = "r20";
+                }
+                out += "sub " + str2 + ", " + strSrc + Chr(10);
+            }
+        } else {
+            // --- YOUR EXISTING X86 CODE - UNCHANGED ---
+            str1 = Trim(StringTrimLeft(A_LoopField69, 4));
+            if (InStr(str1, ":=")) {
+                str2 = Trim(StrSplit(str1, ":=", 1));
+                str3 = Trim(StrSplit(str1, ":=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    dot_data_ints += str2 + " dq " + str3 + Chr(10);
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jl .end_if8_" + STR(ifCount8) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jl .end_if8_" + STR(ifCount8) + Chr(10);
-                    }
+                    dot_data_ints += str2 + " dq 0" + Chr(10);
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "mov [" + str2 + "], rdi" + Chr(10);
+                }
+            } else {
+                if (InStr(str1, ":=") == false && InStr(str1, "+=") == false && InStr(str1, "-=") == false && InStr(str1, "*=") == false) {
+                    dot_data_ints += Trim(str1) + " dq 0" + Chr(10);
+                }
+            }
+            if (InStr(str1, "*=")) {
+                str2 = Trim(StrSplit(str1, "*=", 1));
+                str3 = Trim(StrSplit(str1, "*=", 2));
+                dot_data_ints += str2 + " dq 0" + Chr(10);
+            }
+            else if (InStr(str1, "+=")) {
+                str2 = Trim(StrSplit(str1, "+=", 1));
+                str3 = Trim(StrSplit(str1, "+=", 2));
+                dot_data_ints += str2 + " dq 0" + Chr(10);
+            }
+            else if (InStr(str1, "-=")) {
+                str2 = Trim(StrSplit(str1, "-=", 1));
+                str3 = Trim(StrSplit(str1, "-=", 2));
+                dot_data_ints += str2 + " dq 0" + Chr(10);
+            }
+            if (InStr(A_LoopField69, " += ")) {
+                str2 = Trim(StrSplit(str1, "+=", 1));
+                str3 = Trim(StrSplit(str1, "+=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "add qword [" + str2 + "], " + str3 + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "add qword [" + str2 + "], rdi" + Chr(10);
                 }
             }
-            else if (InStr(str1, " <= ")) {
-                str2 = Trim(StrSplit(str1, " <= ", 1));
-                str3 = Trim(StrSplit(str1, " <= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index183 = 0; A_Index183 < HTVM_Size(funcArgsArr); A_Index183++) {
-                            if (Trim(funcArgsArr[A_Index183]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index184 = 0; A_Index184 < HTVM_Size(funcArgsArr); A_Index184++) {
-                                if (Trim(funcArgsArr[A_Index184]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.gt .end_if8_" + STR(ifCount8) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jg end_if8_" + STR(ifCount8) + Chr(10);
+            else if (InStr(A_LoopField69, " *= ")) {
+                str2 = Trim(StrSplit(str1, "*=", 1));
+                str3 = Trim(StrSplit(str1, "*=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "mov rax, [" + str2 + "]" + Chr(10);
+                    out += "imul rax, " + str3 + Chr(10);
+                    out += "mov [" + str2 + "], rax" + Chr(10);
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jg .end_if8_" + STR(ifCount8) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jg .end_if8_" + STR(ifCount8) + Chr(10);
-                    }
+                    out += "mov rax, [" + str2 + "]" + Chr(10);
+                    out += "imul rax, [" + str3 + "]" + Chr(10);
+                    out += "mov [" + str2 + "], rax" + Chr(10);
                 }
             }
-        }
-        else if (Trim(A_LoopField69) == "ifend8" || Trim(A_LoopField69) == "endif8") {
-            if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "end_if8_" + STR(ifCount8) + ":" + Chr(10);
-            } else {
-                out += ".end_if8_" + STR(ifCount8) + ":" + Chr(10);
+            else if (InStr(A_LoopField69, " -= ")) {
+                str2 = Trim(StrSplit(str1, "-=", 1));
+                str3 = Trim(StrSplit(str1, "-=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "sub qword [" + str2 + "], " + str3 + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "sub qword [" + str2 + "], rdi" + Chr(10);
+                }
             }
-            ifCount8++;
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 4) == "if9 ") {
-            isNum = 0;
-            str1 = Trim(StringTrimLeft(A_LoopField69, 4));
-            str1 = StringTrimLeft(str1, 1);
-            str1 = StringTrimRight(str1, 1);
-            if (InStr(str1, " = ")) {
-                str2 = Trim(StrSplit(str1, " = ", 1));
-                str3 = Trim(StrSplit(str1, " = ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index185 = 0; A_Index185 < HTVM_Size(funcArgsArr); A_Index185++) {
-                            if (Trim(funcArgsArr[A_Index185]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    int isRhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index186 = 0; A_Index186 < HTVM_Size(funcArgsArr); A_Index186++) {
-                            if (Trim(funcArgsArr[A_Index186]) == str3) {
-                                isRhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
+    };
+    stmtHandlers[HTLL_STMT_NINT] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 5));
+        if (InStr(str1, " ")) {
+            HTVM_Append(nintArr, StrSplit(str1, " ", 1));
+        } else {
+            HTVM_Append(nintArr, Trim(str1));
+        }
+        if (is_arm == 1) {
+            // --- AArch64 CODE GENERATION ---
+            if (InStr(str1, ":=")) {
+                str2 = Trim(StrSplit(str1, ":=", 1));
+                str3 = Trim(StrSplit(str1, ":=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    dot_data_ints += str2 + ": .quad " + str3 + Chr(10);
+                    dot_data_ints += str2 + "_is_negative: .quad 0" + Chr(10);
+                } else {
+                    dot_data_ints += str2 + ": .quad 0" + Chr(10);
+                    dot_data_ints += str2 + "_is_negative: .quad 0" + Chr(10);
+                    // ############## FIX START ##############
                     if (str3 == "rax") {
-                        out += "    mov x10, x0" + Chr(10);
+                        out += "    mov x9, x0" + Chr(10);
                     }
                     else if (str3 == "A_Index") {
-                        out += "    mov x10, x20" + Chr(10);
-                    }
-                    else if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    }
-                    else if (isRhsStackVar == 1) {
-                        out += "    ldr x10, =" + str3 + Chr(10);
+                        out += "    mov x9, x20" + Chr(10);
                     } else {
-                        out += "    ldr x10, =" + str3 + Chr(10);
-                        out += "    ldr x10, [x10]" + Chr(10);
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ne .end_if9_" + STR(ifCount9) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
+                        out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x9, [x10]" + Chr(10);
                     }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
+                    // ############## FIX END ##############
+                    out += "    ldr x10, =" + str2 + Chr(10) + "    str x9, [x10]" + Chr(10);
+                }
+            } else {
+                if (InStr(str1, ":=") == false && InStr(str1, "+=") == false && InStr(str1, "-=") == false && InStr(str1, "*=") == false) {
+                    dot_data_ints += Trim(str1) + ": .quad 0" + Chr(10);
+                    dot_data_ints += Trim(str1) + "_is_negative: .quad 0" + Chr(10);
+                }
+            }
+            if (InStr(str1, "*=")) {
+                str2 = Trim(StrSplit(str1, "*=", 1));
+                dot_data_ints += str2 + ": .quad 0" + Chr(10);
+                dot_data_ints += str2 + "_is_negative: .quad 0" + Chr(10);
+            }
+            else if (InStr(str1, "+=")) {
+                str2 = Trim(StrSplit(str1, "+=", 1));
+                dot_data_ints += str2 + ": .quad 0" + Chr(10);
+                dot_data_ints += str2 + "_is_negative: .quad 0" + Chr(10);
+            }
+            else if (InStr(str1, "-=")) {
+                str2 = Trim(StrSplit(str1, "-=", 1));
+                dot_data_ints += str2 + ": .quad 0" + Chr(10);
+                dot_data_ints += str2 + "_is_negative: .quad 0" + Chr(10);
+            }
+            if (InStr(A_LoopField69, " += ")) {
+                str2 = Trim(StrSplit(str1, "+=", 1));
+                str3 = Trim(StrSplit(str1, "+=", 2));
+                out += "    ldr x10, =" + str2 + Chr(10) + "    ldr x9, [x10]" + Chr(10);
+                // ############## FIX START ##############
+                if (str3 == "rax") {
+                    out += "    add x9, x9, x0" + Chr(10);
+                }
+                else if (str3 == "A_Index") {
+                    out += "    add x9, x9, x20" + Chr(10);
+                }
+                else if (RegExMatch(str3, "^\\d+$")) {
+                    out += "    add x9, x9, #" + str3 + Chr(10);
+                } else {
+                    out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
+                    out += "    add x9, x9, x11" + Chr(10);
+                }
+                // ############## FIX END ##############
+                out += "    str x9, [x10]" + Chr(10);
+                out += "    ldr x0, =" + str2 + Chr(10);
+                out += "    ldr x1, =" + str2 + "_is_negative" + Chr(10);
+                out += "    bl is_nint_negative" + Chr(10);
+            }
+            else if (InStr(A_LoopField69, " *= ")) {
+                str2 = Trim(StrSplit(str1, "*=", 1));
+                str3 = Trim(StrSplit(str1, "*=", 2));
+                out += "    ldr x10, =" + str2 + Chr(10) + "    ldr x9, [x10]" + Chr(10);
+                // ############## FIX START ##############
+                if (str3 == "rax") {
+                    out += "    mul x9, x9, x0" + Chr(10);
+                }
+                else if (str3 == "A_Index") {
+                    out += "    mul x9, x9, x20" + Chr(10);
+                }
+                else if (RegExMatch(str3, "^\\d+$")) {
+                    out += "    mov x11, #" + str3 + Chr(10);
+                    out += "    mul x9, x9, x11" + Chr(10);
+                } else {
+                    out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
+                    out += "    mul x9, x9, x11" + Chr(10);
+                }
+                // ############## FIX END ##############
+                out += "    str x9, [x10]" + Chr(10);
+                out += "    ldr x0, =" + str2 + Chr(10);
+                out += "    ldr x1, =" + str2 + "_is_negative" + Chr(10);
+                out += "    bl is_nint_negative" + Chr(10);
+            }
+            else if (InStr(A_LoopField69, " -= ")) {
+                str2 = Trim(StrSplit(str1, "-=", 1));
+                str3 = Trim(StrSplit(str1, "-=", 2));
+                out += "    ldr x10, =" + str2 + Chr(10) + "    ldr x9, [x10]" + Chr(10);
+                // ############## FIX START ##############
+                if (str3 == "rax") {
+                    out += "    sub x9, x9, x0" + Chr(10);
+                }
+                else if (str3 == "A_Index") {
+                    out += "    sub x9, x9, x20" + Chr(10);
+                }
+                else if (RegExMatch(str3, "^\\d+$")) {
+                    out += "    sub x9, x9, #" + str3 + Chr(10);
+                } else {
+                    out += "    ldr x11, =" + str3 + Chr(10) + "    ldr x11, [x11]" + Chr(10);
+                    out += "    sub x9, x9, x11" + Chr(10);
+                }
+                // ############## FIX END ##############
+                out += "    str x9, [x10]" + Chr(10);
+                out += "    ldr x0, =" + str2 + Chr(10);
+                out += "    ldr x1, =" + str2 + "_is_negative" + Chr(10);
+                out += "    bl is_nint_negative" + Chr(10);
+            }
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR GENERATION (nint) ---
+            if (InStr(str1, ":=")) {
+                str2 = Trim(StrSplit(str1, ":=", 1));
+                str3 = Trim(StrSplit(str1, ":=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "int " + str2 + ": " + str3 + Chr(10);
+                } else {
+                    out += "int " + str2 + ": 0" + Chr(10);
+                    strSrc = str3;
                     if (str3 == "rax") {
-                        strRhs = "r0";
+                        strSrc = "r0";
                     }
                     else if (str3 == "A_Index") {
-                        strRhs = "r20";
+                        strSrc = "r20";
                     }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jne end_if9_" + STR(ifCount9) + Chr(10);
+                    out += "mov " + str2 + ", " + strSrc + Chr(10);
+                }
+                // Initialize _is_negative just for compatibility
+                out += "int " + str2 + "_is_negative: 0" + Chr(10);
+            } else {
+                str2 = str1;
+                if (InStr(str1, "+=")) {
+                    str2 = Trim(StrSplit(str1, "+=", 1));
+                }
+                else if (InStr(str1, "-=")) {
+                    str2 = Trim(StrSplit(str1, "-=", 1));
+                }
+                else if (InStr(str1, "*=")) {
+                    str2 = Trim(StrSplit(str1, "*=", 1));
+                }
+                out += "int " + Trim(str2) + ": 0" + Chr(10);
+                out += "int " + Trim(str2) + "_is_negative: 0" + Chr(10);
+            }
+            if (InStr(A_LoopField69, " += ")) {
+                str2 = Trim(StrSplit(str1, "+=", 1));
+                str3 = Trim(StrSplit(str1, "+=", 2));
+                strSrc = str3;
+                if (str3 == "rax") {
+                    strSrc = "r0";
+                }
+                else if (str3 == "A_Index") {
+                    strSrc = "r20";
+                }
+                out += "add " + str2 + ", " + strSrc + Chr(10);
+            }
+            else if (InStr(A_LoopField69, " *= ")) {
+                str2 = Trim(StrSplit(str1, "*=", 1));
+                str3 = Trim(StrSplit(str1, "*=", 2));
+                strSrc = str3;
+                if (str3 == "rax") {
+                    strSrc = "r0";
+                }
+                else if (str3 == "A_Index") {
+                    strSrc = "r20";
+                }
+                out += "mul " + str2 + ", " + strSrc + Chr(10);
+            }
+            else if (InStr(A_LoopField69, " -= ")) {
+                str2 = Trim(StrSplit(str1, "-=", 1));
+                str3 = Trim(StrSplit(str1, "-=", 2));
+                strSrc = str3;
+                if (str3 == "rax") {
+                    strSrc = "r0";
+                }
+                else if (str3 == "A_Index") {
+                    strSrc = "r20";
+                }
+                out += "sub " + str2 + ", " + strSrc + Chr(10);
+            }
+        } else {
+            // --- YOUR EXISTING X86 CODE - UNCHANGED ---
+            if (InStr(str1, ":=")) {
+                str2 = Trim(StrSplit(str1, ":=", 1));
+                str3 = Trim(StrSplit(str1, ":=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    dot_data_ints += str2 + " dq " + str3 + Chr(10);
+                    dot_data_ints += str2 + "_is_negative: dq 0" + Chr(10);
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jne .end_if9_" + STR(ifCount9) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jne .end_if9_" + STR(ifCount9) + Chr(10);
-                    }
+                    dot_data_ints += str2 + " dq 0" + Chr(10);
+                    dot_data_ints += str2 + "_is_negative: dq 0" + Chr(10);
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "mov [" + str2 + "], rdi" + Chr(10);
+                }
+            } else {
+                if (InStr(str1, ":=") == false && InStr(str1, "+=") == false && InStr(str1, "-=") == false && InStr(str1, "*=") == false) {
+                    dot_data_ints += Trim(str1) + " dq 0" + Chr(10);
+                    dot_data_ints += Trim(str1) + "_is_negative: dq 0" + Chr(10);
+                }
+            }
+            if (InStr(str1, "*=")) {
+                str2 = Trim(StrSplit(str1, "*=", 1));
+                str3 = Trim(StrSplit(str1, "*=", 2));
+                dot_data_ints += str2 + " dq 0" + Chr(10);
+                dot_data_ints += str2 + "_is_negative: dq 0" + Chr(10);
+            }
+            else if (InStr(str1, "+=")) {
+                str2 = Trim(StrSplit(str1, "+=", 1));
+                str3 = Trim(StrSplit(str1, "+=", 2));
+                dot_data_ints += str2 + " dq 0" + Chr(10);
+                dot_data_ints += str2 + "_is_negative: dq 0" + Chr(10);
+            }
+            else if (InStr(str1, "-=")) {
+                str2 = Trim(StrSplit(str1, "-=", 1));
+                str3 = Trim(StrSplit(str1, "-=", 2));
+                dot_data_ints += str2 + " dq 0" + Chr(10);
+                dot_data_ints += str2 + "_is_negative: dq 0" + Chr(10);
+            }
+            if (InStr(A_LoopField69, " += ")) {
+                str2 = Trim(StrSplit(str1, "+=", 1));
+                str3 = Trim(StrSplit(str1, "+=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "add qword [" + str2 + "], " + str3 + Chr(10);
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "add qword [" + str2 + "], rdi" + Chr(10);
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
                 }
             }
-            else if (InStr(str1, " != ")) {
-                str2 = Trim(StrSplit(str1, " != ", 1));
-                str3 = Trim(StrSplit(str1, " != ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index187 = 0; A_Index187 < HTVM_Size(funcArgsArr); A_Index187++) {
-                            if (Trim(funcArgsArr[A_Index187]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
+            else if (InStr(A_LoopField69, " *= ")) {
+                str2 = Trim(StrSplit(str1, "*=", 1));
+                str3 = Trim(StrSplit(str1, "*=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "mov rax, [" + str2 + "]" + Chr(10);
+                    out += "imul rax, " + str3 + Chr(10);
+                    out += "mov [" + str2 + "], rax" + Chr(10);
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+                } else {
+                    out += "mov rax, [" + str2 + "]" + Chr(10);
+                    out += "imul rax, [" + str3 + "]" + Chr(10);
+                    out += "mov [" + str2 + "], rax" + Chr(10);
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+                }
+            }
+            else if (InStr(A_LoopField69, " -= ")) {
+                str2 = Trim(StrSplit(str1, "-=", 1));
+                str3 = Trim(StrSplit(str1, "-=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "sub qword [" + str2 + "], " + str3 + Chr(10);
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "sub qword [" + str2 + "], rdi" + Chr(10);
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+                }
+            }
+        }
+    };
+    stmtHandlers[HTLL_STMT_EXPR] = [&]() {
+        out += HTLL_lowerExpression(Trim(StringTrimLeft(Trim(A_LoopField69), 16)), is_arm, is_oryx, inFunc);
+    };
+    stmtHandlers[HTLL_STMT_ASSIGN] = [&]() {
+        if (is_arm == 1) {
+            if (InStr(A_LoopField69, " := ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, ":=", 1));
+                str3 = Trim(StrSplit(str1, ":=", 2));
+                int isLhsStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str2)) {
+                    isLhsStackVar = 1;
+                }
+                // --- Compute the source value into x9 ---
+                if (str3 == "rax") {
+                    out += "    mov x9, x0" + Chr(10);
+                }
+                else if (str3 == "A_Index") {
+                    out += "    mov x9, x20" + Chr(10);
+                }
+                else if (RegExMatch(str3, "^\\d+$")) {
+                    out += "    mov x9, #" + str3 + Chr(10);
+                } else {
+                    int isRhsStackVar = 0;
+                    if (inFunc == 1 && HTLL_isFuncParam(str3)) {
+                        isRhsStackVar = 1;
                     }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
+                    if (isRhsStackVar == 1) {
+                        out += "    ldr x9, =" + str3 + Chr(10);
                     } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index188 = 0; A_Index188 < HTVM_Size(funcArgsArr); A_Index188++) {
-                                if (Trim(funcArgsArr[A_Index188]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.eq .end_if9_" + STR(ifCount9) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
+                        out += "    ldr x10, =" + str3 + Chr(10);
+                        out += "    ldr x9, [x10]" + Chr(10);
                     }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "je end_if9_" + STR(ifCount9) + Chr(10);
+                }
+                // --- Store x9 to destination ---
+                if (isLhsStackVar == 1) {
+                    // Destination is a function parameter (stored as a global label)
+                    out += "    str x9, =" + str2 + Chr(10);
+                }
+                else if (str2 == "rax") {
+                    out += "    mov x0, x9" + Chr(10);
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "je .end_if9_" + STR(ifCount9) + Chr(10);
+                    // Destination is a normal global variable
+                    out += "    ldr x10, =" + str2 + Chr(10);
+                    out += "    str x9, [x10]" + Chr(10);
+                }
+                if (isNint(str2)) {
+                    out += "    ldr x0, =" + str2 + Chr(10);
+                    out += "    ldr x1, =" + str2 + "_is_negative" + Chr(10);
+                    out += "    bl is_nint_negative" + Chr(10);
+                }
+            } else {
+                // Handles +=, -=, *=, //=, %=, <<=, >>=, &=, |=, ^=
+                std::string op = "";
+                std::string op_asm = "";
+                if (InStr(A_LoopField69, " += ")) {
+                    op = "+=";
+                    op_asm = "add";
+                }
+                else if (InStr(A_LoopField69, " -= ")) {
+                    op = "-=";
+                    op_asm = "sub";
+                }
+                else if (InStr(A_LoopField69, " *= ")) {
+                    op = "*=";
+                    op_asm = "mul";
+                }
+                else if (InStr(A_LoopField69, " //= ")) {
+                    op = "//=";
+                    op_asm = "udiv";
+                }
+                else if (InStr(A_LoopField69, " %= ")) {
+                    op = "%=";
+                    op_asm = "mod";
+                }
+                else if (InStr(A_LoopField69, " <<= ")) {
+                    op = "<<=";
+                    op_asm = "lsl";
+                }
+                else if (InStr(A_LoopField69, " >>= ")) {
+                    op = ">>=";
+                    op_asm = "lsr";
+                }
+                else if (InStr(A_LoopField69, " &= ")) {
+                    op = "&=";
+                    op_asm = "and";
+                }
+                else if (InStr(A_LoopField69, " |= ")) {
+                    op = "|=";
+                    op_asm = "orr";
+                }
+                else if (InStr(A_LoopField69, " ^= ")) {
+                    op = "^=";
+                    op_asm = "eor";
+                }
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, op, 1));
+                str3 = Trim(StrSplit(str1, op, 2));
+                // --- Load Destination Value into x9 ---
+                int isLhsStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str2)) {
+                    isLhsStackVar = 1;
+                }
+                if (isLhsStackVar == 1) {
+                    out += "    ldr x9, =" + str2 + Chr(10);
+                } else {
+                    out += "    ldr x10, =" + str2 + Chr(10) + Chr(10);
+                    out += "    ldr x9, [x10]" + Chr(10);
+                }
+                // --- Load Source Value into x11 and perform operation ---
+                if (str3 == "rax") {
+                    if (op_asm == "mod") {
+                        out += "    udiv x12, x9, x0" + Chr(10);
+                        out += "    msub x9, x12, x0, x9" + Chr(10);
                     } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "je .end_if9_" + STR(ifCount9) + Chr(10);
+                        out += "    " + op_asm + " x9, x9, x0" + Chr(10);
                     }
                 }
-            }
-            else if (InStr(str1, " > ")) {
-                str2 = Trim(StrSplit(str1, " > ", 1));
-                str3 = Trim(StrSplit(str1, " > ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index189 = 0; A_Index189 < HTVM_Size(funcArgsArr); A_Index189++) {
-                            if (Trim(funcArgsArr[A_Index189]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
+                else if (str3 == "A_Index") {
+                    if (op_asm == "mod") {
+                        out += "    udiv x12, x9, x20" + Chr(10);
+                        out += "    msub x9, x12, x20, x9" + Chr(10);
                     } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
+                        out += "    " + op_asm + " x9, x9, x20" + Chr(10);
                     }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index190 = 0; A_Index190 < HTVM_Size(funcArgsArr); A_Index190++) {
-                                if (Trim(funcArgsArr[A_Index190]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
+                }
+                else if (RegExMatch(str3, "^\\d+$")) {
+                    str4 = HTLL_reduceByConstant(op, "x9", str3, 1);
+                    if (str4 != "") {
+                        out += str4;
+                    }
+                    // ARM cannot 'udiv' or 'mul' an immediate number directly!
+                    // We must move it to x11 first.
+                    else if (op_asm == "mul" || op_asm == "udiv" || op_asm == "mod" || op_asm == "lsl" || op_asm == "lsr" || op_asm == "and" || op_asm == "orr" || op_asm == "eor") {
+                        if (StrLen(str3) > 4) {
+                            out += "    ldr x11, =" + str3 + Chr(10) + Chr(10);
+                        } else {
+                            out += "    mov x11, #" + str3 + Chr(10) + Chr(10);
                         }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
+                        if (op_asm == "mod") {
+                            out += "    udiv x12, x9, x11" + Chr(10);
+                            out += "    msub x9, x12, x11, x9" + Chr(10);
                         } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
+                            out += "    " + op_asm + " x9, x9, x11" + Chr(10);
                         }
+                    } else {
+                        // add and sub CAN take immediate numbers directly
+                        out += "    " + op_asm + " x9, x9, #" + str3 + Chr(10);
                     }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.le .end_if9_" + STR(ifCount9) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
+                } else {
+                    // Right hand side is a standard variable
+                    int isRhsStackVar = 0;
+                    if (inFunc == 1 && HTLL_isFuncParam(str3)) {
+                        isRhsStackVar = 1;
                     }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
+                    if (isRhsStackVar == 1) {
+                        out += "    ldr x11, =" + str3 + Chr(10) + Chr(10);
+                    } else {
+                        out += "    ldr x11, =" + str3 + Chr(10) + Chr(10);
+                        out += "    ldr x11, [x11]" + Chr(10) + Chr(10);
                     }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jle end_if9_" + STR(ifCount9) + Chr(10);
-                } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jle .end_if9_" + STR(ifCount9) + Chr(10);
+                    if (op_asm == "mod") {
+                        out += "    udiv x12, x9, x11" + Chr(10);
+                        out += "    msub x9, x12, x11, x9" + Chr(10);
                     } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jle .end_if9_" + STR(ifCount9) + Chr(10);
+                        out += "    " + op_asm + " x9, x9, x11" + Chr(10);
                     }
                 }
+                // --- Store Result back into Destination ---
+                if (isLhsStackVar == 1) {
+                    out += "    str x9, =" + str2 + Chr(10);
+                } else {
+                    out += "    str x9, [x10]" + Chr(10);
+                }
+                if (isNint(str2)) {
+                    out += "    ldr x0, =" + str2 + Chr(10) + "    ldr x1, =" + str2 + "_is_negative" + Chr(10) + "    bl is_nint_negative" + Chr(10);
+                }
             }
-            else if (InStr(str1, " < ")) {
-                str2 = Trim(StrSplit(str1, " < ", 1));
-                str3 = Trim(StrSplit(str1, " < ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index191 = 0; A_Index191 < HTVM_Size(funcArgsArr); A_Index191++) {
-                            if (Trim(funcArgsArr[A_Index191]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR GENERATION (assignments) ---
+            if (InStr(A_LoopField69, " := ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, ":=", 1));
+                str3 = Trim(StrSplit(str1, ":=", 2));
+                strSrc = str3;
+                if (str3 == "rax") {
+                    strSrc = "r0";
+                }
+                else if (str3 == "A_Index") {
+                    strSrc = "r20";
+                }
+                // mov dest, src
+                out += "mov " + str2 + ", " + strSrc + Chr(10);
+                // Optional negative check for nint compatibility
+                if (isNint(str2)) {
+                    // out .= "cmp " . str2 . ", 0" ... (VM handles signs, skipping)
+                }
+            } else {
+                // Handles +=, -=, *=, //=, %=, <<=, >>=, &=, |=, ^=
+                std::string op = "";
+                std::string op_asm = "";
+                if (InStr(A_LoopField69, " += ")) {
+                    op = "+=";
+                    op_asm = "add";
+                }
+                else if (InStr(A_LoopField69, " -= ")) {
+                    op = "-=";
+                    op_asm = "sub";
+                }
+                else if (InStr(A_LoopField69, " *= ")) {
+                    op = "*=";
+                    op_asm = "mul";
+                }
+                else if (InStr(A_LoopField69, " //= ")) {
+                    op = "//=";
+                    op_asm = "div_floor";
+                }
+                else if (InStr(A_LoopField69, " %= ")) {
+                    op = "%=";
+                    op_asm = "mod";
+                }
+                else if (InStr(A_LoopField69, " <<= ")) {
+                    op = "<<=";
+                    op_asm = "shl";
+                }
+                else if (InStr(A_LoopField69, " >>= ")) {
+                    op = ">>=";
+                    op_asm = "shr";
+                }
+                else if (InStr(A_LoopField69, " &= ")) {
+                    op = "&=";
+                    op_asm = "and";
+                }
+                else if (InStr(A_LoopField69, " |= ")) {
+                    op = "|=";
+                    op_asm = "or";
+                }
+                else if (InStr(A_LoopField69, " ^= ")) {
+                    op = "^=";
+                    op_asm = "xor";
+                }
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, op, 1));
+                str3 = Trim(StrSplit(str1, op, 2));
+                strSrc = str3;
+                if (str3 == "rax") {
+                    strSrc = "r0";
+                }
+                else if (str3 == "A_Index") {
+                    strSrc = "r20";
+                }
+                out += op_asm + " " + str2 + ", " + strSrc + Chr(10);
+            }
+        } else {
+            // --- YOUR EXISTING X86 CODE - UNCHANGED ---
+            if (InStr(A_LoopField69, " := ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, ":=", 1));
+                str3 = Trim(StrSplit(str1, ":=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "mov qword [" + str2 + "], " + str3 + Chr(10);
+                    if (isNint(str2)) {
+                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
                     }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "mov [" + str2 + "], rdi" + Chr(10);
+                    if (isNint(str2)) {
+                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
                     }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
+                }
+            }
+            else if (InStr(A_LoopField69, " += ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, "+=", 1));
+                str3 = Trim(StrSplit(str1, "+=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "add qword [" + str2 + "], " + str3 + Chr(10);
+                    if (isNint(str2)) {
+                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
                     }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "add qword [" + str2 + "], rdi" + Chr(10);
+                    if (isNint(str2)) {
+                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
                     }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
+                }
+            }
+            else if (InStr(A_LoopField69, " *= ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, "*=", 1));
+                str3 = Trim(StrSplit(str1, "*=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    str4 = HTLL_reduceByConstant("*", "rdi", str3, 0);
+                    if (str4 != "") {
+                        out += "mov rdi, [" + str2 + "]" + Chr(10) + str4 + "mov [" + str2 + "], rdi" + Chr(10);
                     } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index192 = 0; A_Index192 < HTVM_Size(funcArgsArr); A_Index192++) {
-                                if (Trim(funcArgsArr[A_Index192]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
+                        out += "mov rax, [" + str2 + "]" + Chr(10);
+                        if (StrLen(str3) > 9) {
+                            out += "mov rcx, " + str3 + Chr(10) + "imul rax, rcx" + Chr(10);
                         } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
+                            out += "imul rax, " + str3 + Chr(10);
                         }
+                        out += "mov [" + str2 + "], rax" + Chr(10);
                     }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.ge .end_if9_" + STR(ifCount9) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
+                    if (isNint(str2)) {
+                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
                     }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jge end_if9_" + STR(ifCount9) + Chr(10);
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jge .end_if9_" + STR(ifCount9) + Chr(10);
-                    } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jge .end_if9_" + STR(ifCount9) + Chr(10);
+                    out += "mov rax, [" + str2 + "]" + Chr(10);
+                    out += "imul rax, [" + str3 + "]" + Chr(10);
+                    out += "mov [" + str2 + "], rax" + Chr(10);
+                    if (isNint(str2)) {
+                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
                     }
                 }
             }
-            else if (InStr(str1, " >= ")) {
-                str2 = Trim(StrSplit(str1, " >= ", 1));
-                str3 = Trim(StrSplit(str1, " >= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index193 = 0; A_Index193 < HTVM_Size(funcArgsArr); A_Index193++) {
-                            if (Trim(funcArgsArr[A_Index193]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
+            else if (InStr(A_LoopField69, " -= ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, "-=", 1));
+                str3 = Trim(StrSplit(str1, "-=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "sub qword [" + str2 + "], " + str3 + Chr(10);
+                    if (isNint(str2)) {
+                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
                     }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "sub qword [" + str2 + "], rdi" + Chr(10);
+                    if (isNint(str2)) {
+                        out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
                     }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
+                }
+            }
+            // ====== THE NEW DIVISION MAGIC ======
+            else if (InStr(A_LoopField69, " //= ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, "//=", 1));
+                str3 = Trim(StrSplit(str1, "//=", 2));
+                str4 = HTLL_reduceByConstant("//", "rdi", str3, 0);
+                if (str4 != "") {
+                    out += "mov rdi, [" + str2 + "]" + Chr(10) + str4 + "mov [" + str2 + "], rdi" + Chr(10);
+                } else {
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "xor rdx, rdx" + Chr(10);
+                    if (RegExMatch(str3, "^\\d+$")) {
+                        out += "mov rdi, " + str3 + Chr(10) + "div rdi" + Chr(10);
                     } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index194 = 0; A_Index194 < HTVM_Size(funcArgsArr); A_Index194++) {
-                                if (Trim(funcArgsArr[A_Index194]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.lt .end_if9_" + STR(ifCount9) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
+                        out += "mov rdi, [" + str3 + "]" + Chr(10) + "div rdi" + Chr(10);
                     }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jl end_if9_" + STR(ifCount9) + Chr(10);
+                    out += "mov [" + str2 + "], rax" + Chr(10);
+                }
+                if (isNint(str2)) {
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+                }
+            }
+            else if (InStr(A_LoopField69, " %= ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, "%=", 1));
+                str3 = Trim(StrSplit(str1, "%=", 2));
+                str4 = HTLL_reduceByConstant("%", "rdi", str3, 0);
+                if (str4 != "") {
+                    out += "mov rdi, [" + str2 + "]" + Chr(10) + str4 + "mov [" + str2 + "], rdi" + Chr(10);
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jl .end_if9_" + STR(ifCount9) + Chr(10);
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "xor rdx, rdx" + Chr(10);
+                    if (RegExMatch(str3, "^\\d+$")) {
+                        out += "mov rdi, " + str3 + Chr(10) + "div rdi" + Chr(10);
                     } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jl .end_if9_" + STR(ifCount9) + Chr(10);
+                        out += "mov rdi, [" + str3 + "]" + Chr(10) + "div rdi" + Chr(10);
                     }
+                    out += "mov [" + str2 + "], rdx" + Chr(10);
+                }
+                if (isNint(str2)) {
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+                }
+            }
+            else if (InStr(A_LoopField69, " <<= ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, "<<=", 1));
+                str3 = Trim(StrSplit(str1, "<<=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "shl qword [" + str2 + "], " + str3 + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "shl qword [" + str2 + "], rdi" + Chr(10);
+                }
+                if (isNint(str2)) {
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+                }
+            }
+            else if (InStr(A_LoopField69, " >>= ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, ">>=", 1));
+                str3 = Trim(StrSplit(str1, ">>=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "shr qword [" + str2 + "], " + str3 + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "shr qword [" + str2 + "], rdi" + Chr(10);
+                }
+                if (isNint(str2)) {
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+                }
+            }
+            else if (InStr(A_LoopField69, " &= ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, "&=", 1));
+                str3 = Trim(StrSplit(str1, "&=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "and qword [" + str2 + "], " + str3 + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "and qword [" + str2 + "], rdi" + Chr(10);
+                }
+                if (isNint(str2)) {
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+                }
+            }
+            else if (InStr(A_LoopField69, " |= ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, "|=", 1));
+                str3 = Trim(StrSplit(str1, "|=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "or qword [" + str2 + "], " + str3 + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "or qword [" + str2 + "], rdi" + Chr(10);
+                }
+                if (isNint(str2)) {
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+                }
+            }
+            else if (InStr(A_LoopField69, " ^= ")) {
+                str1 = Trim(A_LoopField69);
+                str2 = Trim(StrSplit(str1, "^=", 1));
+                str3 = Trim(StrSplit(str1, "^=", 2));
+                if (RegExMatch(str3, "^\\d+$")) {
+                    out += "xor qword [" + str2 + "], " + str3 + Chr(10);
+                } else {
+                    out += "mov rdi, [" + str3 + "]" + Chr(10);
+                    out += "xor qword [" + str2 + "], rdi" + Chr(10);
+                }
+                if (isNint(str2)) {
+                    out += "lea rdi, [" + str2 + "]" + Chr(10) + "lea rsi, [" + str2 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
                 }
             }
-            else if (InStr(str1, " <= ")) {
-                str2 = Trim(StrSplit(str1, " <= ", 1));
-                str3 = Trim(StrSplit(str1, " <= ", 2));
-                isNum = RegExMatch(str3, "^\\d+$");
-                if (is_arm == 1) {
-                    int isLhsStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index195 = 0; A_Index195 < HTVM_Size(funcArgsArr); A_Index195++) {
-                            if (Trim(funcArgsArr[A_Index195]) == str2) {
-                                isLhsStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (str2 == "rax") {
-                        out += "    mov x9, x0" + Chr(10);
-                    }
-                    else if (str2 == "A_Index") {
-                        out += "    mov x9, x20" + Chr(10);
-                    }
-                    else if (isLhsStackVar == 1) {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str2 + Chr(10);
-                        out += "    ldr x9, [x9]" + Chr(10);
-                    }
-                    if (isNum == 1) {
-                        out += "    mov x10, #" + str3 + Chr(10);
-                    } else {
-                        int isRhsStackVar = 0;
-                        if (inFunc == 1) {
-                            for (int A_Index196 = 0; A_Index196 < HTVM_Size(funcArgsArr); A_Index196++) {
-                                if (Trim(funcArgsArr[A_Index196]) == str3) {
-                                    isRhsStackVar = 1;
-                                    break;
-                                }
-                            }
-                        }
-                        if (str3 == "rax") {
-                            out += "    mov x10, x0" + Chr(10);
-                        }
-                        else if (str3 == "A_Index") {
-                            out += "    mov x10, x20" + Chr(10);
-                        }
-                        else if (isRhsStackVar == 1) {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                        } else {
-                            out += "    ldr x10, =" + str3 + Chr(10);
-                            out += "    ldr x10, [x10]" + Chr(10);
-                        }
-                    }
-                    out += "    cmp x9, x10" + Chr(10);
-                    out += "    b.gt .end_if9_" + STR(ifCount9) + Chr(10);
-                }
-                else if (is_oryx == 1) {
-                    out += "meta " + A_LoopField69 + Chr(10);
-                    strLhs = str2;
-                    if (str2 == "rax") {
-                        strLhs = "r0";
-                    }
-                    else if (str2 == "A_Index") {
-                        strLhs = "r20";
-                    }
-                    strRhs = str3;
-                    if (str3 == "rax") {
-                        strRhs = "r0";
-                    }
-                    else if (str3 == "A_Index") {
-                        strRhs = "r20";
-                    }
-                    out += "cmp " + strLhs + ", " + strRhs + Chr(10);
-                    out += "jg end_if9_" + STR(ifCount9) + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_INC] = [&]() {
+        str1 = Trim(A_LoopField69);
+        str1 = StringTrimRight(str1, 2);
+        str1 = Trim(str1);
+        if (is_arm == 1) {
+            if (str1 == "rax") {
+                out += "    add x0, x0, #1" + Chr(10);
+            }
+            else if (str1 == "A_Index") {
+                out += "    add x20, x20, #1" + Chr(10);
+            } else {
+                int isStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str1)) {
+                    isStackVar = 1;
+                }
+                if (isStackVar == 1) {
+                    out += "    ldr x9, =" + str1 + Chr(10);
+                    out += "    add x9, x9, #1" + Chr(10);
+                    out += "    str x9, =" + str1 + Chr(10);
+                } else {
+                    out += "    ldr x10, =" + str1 + Chr(10);
+                    out += "    ldr x9, [x10]" + Chr(10);
+                    out += "    add x9, x9, #1" + Chr(10);
+                    out += "    str x9, [x10]" + Chr(10);
+                }
+                if (isNint(str1)) {
+                    out += "    ldr x0, =" + str1 + Chr(10) + "    ldr x1, =" + str1 + "_is_negative" + Chr(10) + "    bl is_nint_negative" + Chr(10);
+                }
+            }
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR (++) ---
+            if (str1 == "rax") {
+                out += "inc r0" + Chr(10);
+            }
+            else if (str1 == "A_Index") {
+                out += "inc r20" + Chr(10);
+            } else {
+                out += "inc " + str1 + Chr(10);
+            }
+        } else {
+            out += "inc qword [" + str1 + "]" + Chr(10);
+            if (isNint(str1)) {
+                out += "lea rdi, [" + str1 + "]" + Chr(10) + "lea rsi, [" + str1 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+            }
+        }
+    };
+    stmtHandlers[HTLL_STMT_DEC] = [&]() {
+        str1 = Trim(A_LoopField69);
+        str1 = StringTrimRight(str1, 2);
+        str1 = Trim(str1);
+        if (is_arm == 1) {
+            if (str1 == "rax") {
+                out += "    sub x0, x0, #1" + Chr(10);
+            }
+            else if (str1 == "A_Index") {
+                out += "    sub x20, x20, #1" + Chr(10);
+            } else {
+                int isStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str1)) {
+                    isStackVar = 1;
+                }
+                if (isStackVar == 1) {
+                    out += "    ldr x9, =" + str1 + Chr(10);
+                    out += "    sub x9, x9, #1" + Chr(10);
+                    out += "    str x9, =" + str1 + Chr(10);
+                } else {
+                    out += "    ldr x10, =" + str1 + Chr(10);
+                    out += "    ldr x9, [x10]" + Chr(10);
+                    out += "    sub x9, x9, #1" + Chr(10);
+                    out += "    str x9, [x10]" + Chr(10);
+                }
+                if (isNint(str1)) {
+                    out += "    ldr x0, =" + str1 + Chr(10) + "    ldr x1, =" + str1 + "_is_negative" + Chr(10) + "    bl is_nint_negative" + Chr(10);
+                }
+            }
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR (--) ---
+            if (str1 == "rax") {
+                out += "dec r0" + Chr(10);
+            }
+            else if (str1 == "A_Index") {
+                out += "dec r20" + Chr(10);
+            } else {
+                out += "dec " + str1 + Chr(10);
+            }
+        } else {
+            out += "dec qword [" + str1 + "]" + Chr(10);
+            if (isNint(str1)) {
+                out += "lea rdi, [" + str1 + "]" + Chr(10) + "lea rsi, [" + str1 + "_is_negative]" + Chr(10) + "call is_nint_negative" + Chr(10);
+            }
+        }
+    };
+    stmtHandlers[HTLL_STMT_PRINT] = [&]() {
+        str1 = StringTrimLeft(A_LoopField69, 6);
+        str1 = StringTrimRight(str1, 1);
+        if (is_arm == 1) {
+            if (str1 == "rax") {
+                // The value to print is ALREADY in x0.
+                // We just need to set the 2nd arg (is_negative) and call.
+                out += "    mov x1, xzr" + Chr(10);
+                out += "    bl print_number" + Chr(10);
+            }
+            else if (str1 == "A_Index") {
+                out += "    mov x0, x20" + Chr(10);
+                out += "    mov x1, xzr" + Chr(10);
+                out += "    bl print_number" + Chr(10);
+            }
+            else if (RegExMatch(str1, "^\\d+$")) {
+                out += "    mov x0, #" + Trim(str1) + Chr(10);
+                out += "    mov x1, xzr" + Chr(10);
+                out += "    bl print_number" + Chr(10);
+            }
+            else if (InStr(str1, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC")) {
+                dot_data_print_temp_strings_count++;
+                std::string temp_label = "ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count);
+                // GNU AS needs the string and newline handled separately for length calculation
+                std::string parsed_string = str1;
+                dot_data_print_temp_strings += temp_label + ": .string " + parsed_string + Chr(10);
+                dot_data_print_temp_strings += temp_label + "_len = . - " + temp_label + Chr(10);
+                out += "    ldr x1, =" + temp_label + Chr(10);
+                out += "    mov x2, " + temp_label + "_len" + Chr(10);
+                out += "    bl print_str" + Chr(10);
+                out += "    ldr x1, =HTLL_nl" + Chr(10);
+                out += "    mov x2, 1" + Chr(10);
+                out += "    bl print_str" + Chr(10);
+            } else {
+                // --- START FIX ---
+                int isStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str1)) {
+                    isStackVar = 1;
+                }
+                if (isStackVar == 1) {
+                    // Stack Var: Regex will convert '=str1' to '[sp, #offset]'
+                    // This generates: ldr x0, [sp, #offset]
+                    out += "    ldr x0, =" + Trim(str1) + Chr(10);
+                    out += "    mov x1, xzr" + Chr(10);
+                    out += "    bl print_number" + Chr(10);
                 } else {
-                    if (isNum == 1) {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, " + str3 + Chr(10);
-                        out += "jg .end_if9_" + STR(ifCount9) + Chr(10);
+                    // Global Var (your existing logic)
+                    if (isNint(str1)) {
+                        out += "    ldr x9, =" + Trim(str1) + Chr(10) + "    ldr x0, [x9]" + Chr(10);
+                        out += "    ldr x9, =" + Trim(str1) + "_is_negative" + Chr(10) + "    ldr x1, [x9]" + Chr(10);
+                        out += "    bl print_number" + Chr(10);
                     } else {
-                        out += "mov rax, [" + str2 + "]" + Chr(10);
-                        out += "cmp rax, [" + str3 + "]" + Chr(10);
-                        out += "jg .end_if9_" + STR(ifCount9) + Chr(10);
+                        out += "    ldr x9, =" + Trim(str1) + Chr(10) + "    ldr x0, [x9]" + Chr(10);
+                        out += "    mov x1, xzr" + Chr(10);
+                        out += "    bl print_number" + Chr(10);
                     }
                 }
+                // --- END FIX ---
             }
         }
-        else if (Trim(A_LoopField69) == "ifend9" || Trim(A_LoopField69) == "endif9") {
-            if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "end_if9_" + STR(ifCount9) + ":" + Chr(10);
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR (print) ---
+            if (str1 == "rax") {
+                out += "mov r1, r0" + Chr(10);
+            }
+            else if (str1 == "A_Index") {
+                out += "mov r1, r20" + Chr(10);
+            }
+            else if (RegExMatch(str1, "^\\d+$")) {
+                out += "mov r1, " + Trim(str1) + Chr(10);
+            }
+            else if (InStr(str1, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC")) {
+                // The post-processing loop will replace this token with "Actual String"
+                out += "mov r1, " + str1 + Chr(10);
             } else {
-                out += ".end_if9_" + STR(ifCount9) + ":" + Chr(10);
+                // Variable
+                out += "mov r1, " + Trim(str1) + Chr(10);
             }
-            ifCount9++;
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 5) == "func ") {
-            // --- YOUR PARSING LOGIC IS UNCHANGED ---
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 5));
-            str2 = "";
-            std::vector<std::string> items197 = LoopParseFunc(str1);
-            for (size_t A_Index197 = 0; A_Index197 < items197.size(); A_Index197++) {
-                std::string A_LoopField197 = items197[A_Index197 - 0];
-                if (A_LoopField197 == "(") {
-                    break;
+            out += "call print" + Chr(10);
+        } else {
+            // --- YOUR EXISTING X86 CODE - UNCHANGED ---
+            if (RegExMatch(str1, "^\\d+$")) {
+                out += "mov rdi, " + Trim(str1) + Chr(10) + "mov rsi, 0" + Chr(10) + "call print_number" + Chr(10);
+            }
+            else if (InStr(str1, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC")) {
+                dot_data_print_temp_strings_count++;
+                dot_data_print_temp_strings += "ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count) + " db " + Trim(str1) + ", 10" + Chr(10) + "ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count) + "_len = $-" + "ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count) + Chr(10);
+                out += "mov rsi, ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count) + Chr(10) + "mov rdx, " + "ASM_STR_TEMP_PRINT_" + STR(dot_data_print_temp_strings_count) + "_len" + Chr(10) + "call print_str" + Chr(10);
+            } else {
+                if (isNint(str1)) {
+                    out += "mov rdi, [" + Trim(str1) + "]" + Chr(10) + "mov rsi, [" + str1 + "_is_negative]" + Chr(10) + "call print_number" + Chr(10);
                 } else {
-                    str2 += A_LoopField197;
-                }
-            }
-            str2 = Trim(str2);
-            localVarNum = 1;
-            inFunc = 1;
-            funcArgsCount = (countChars(str1, ",") + 1);
-            int1 = 0;
-            int2 = 0;
-            if (InStr(str1, ",") || InStr(str1, "()") == false) {
-                funcArgsArr = {};
-                std::vector<std::string> items198 = LoopParseFunc(str1);
-                for (size_t A_Index198 = 0; A_Index198 < items198.size(); A_Index198++) {
-                    std::string A_LoopField198 = items198[A_Index198 - 0];
-                    if (A_LoopField198 == ")") {
-                        break;
-                    }
-                    if (int1 == 1 && A_LoopField198 != "," && A_LoopField198 != " ") {
-                        funcArgsArr[int2] = funcArgsArr[int2] + A_LoopField198;
-                    }
-                    if (A_LoopField198 == ",") {
-                        HTVM_Append(funcArgsArr, "");
-                        int2++;
-                    }
-                    if (A_LoopField198 == "(") {
-                        HTVM_Append(funcArgsArr, "");
-                        int1 = 1;
-                    }
+                    out += "mov rdi, [" + Trim(str1) + "]" + Chr(10) + "mov rsi, 0" + Chr(10) + "call print_number" + Chr(10);
                 }
             }
-            funcName = str2;
-            // --- ARCHITECTURE-SPECIFIC CODE GENERATION ---
-            if (is_arm == 1) {
-                out += funcName + ":" + Chr(10);
-                out += "    stp x29, x30, [sp, #-16]!" + Chr(10);
-                out += "    mov x29, sp" + Chr(10);
-                // --- NEW REQUIRED LOGIC FOR ARM ---
-                // Calculate space needed for local vars AND for saving register arguments
-                int args_to_save = HTVM_Size(funcArgsArr) > 8 ? 8 : HTVM_Size(funcArgsArr);
-                int total_space = ( (localVarNum * 8) + (args_to_save * 8) + 15 ) & ~15;
-                out += "    sub sp, sp, #" + STR(total_space) + Chr(10);
-                // Save the incoming register arguments to the stack
-                for (int A_Index199 = 0; A_Index199 < args_to_save; A_Index199++) {
-                    int offset = (A_Index199 * 8);
-                    out += "    str x" + STR(A_Index199) + ", [sp, #" + STR(offset) + "]" + Chr(10);
-                }
-                // --- END NEW LOGIC ---
+        }
+    };
+    stmtHandlers[HTLL_STMT_PRINT_RAX_AS_CHAR] = [&]() {
+        if (is_arm == 1) {
+            // rax maps to x0, which is already the first argument for print_char
+            out += "    bl print_char" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // rax maps to r0. print_char likely expects argument in r1 (standard convention)
+            // or if your VM has a specific 'print_char' that takes r0, adjust accordingly.
+            // Assuming r1 is the argument register for syscalls:
+            out += "mov r1, r0" + Chr(10);
+            out += "call print_char" + Chr(10);
+        } else {
+            out += "mov rdi, rax" + Chr(10) + "push rcx" + Chr(10) + "call print_char" + Chr(10) + "pop rcx" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_CONTINUE] = [&]() {
+        std::string blockLevel = STR(stmtLevel);
+        std::string blockCount = STR(HTLL_blockCount(loopCounts, stmtLevel));
+        if (is_arm == 1) {
+            out += "    b .cloop" + blockLevel + "_end" + blockCount + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "jmp cloop" + blockLevel + "_end" + blockCount + Chr(10);
+        } else {
+            out += "jmp .cloop" + blockLevel + "_end" + blockCount + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_BREAK] = [&]() {
+        std::string blockLevel = STR(stmtLevel);
+        std::string blockCount = STR(HTLL_blockCount(loopCounts, stmtLevel));
+        if (is_arm == 1) {
+            out += "    b .loop" + blockLevel + "_end" + blockCount + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "jmp loop" + blockLevel + "_end" + blockCount + Chr(10);
+        } else {
+            out += "jmp .loop" + blockLevel + "_end" + blockCount + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_LOOP] = [&]() {
+        std::string blockLevel = STR(stmtLevel);
+        std::string blockCount = STR(HTLL_blockCount(loopCounts, stmtLevel));
+        str1 = Trim(StringTrimLeft(Trim(A_LoopField69), InStr(Trim(A_LoopField69), ",")));
+        is_inf_loop = 0;
+        // the count is read before A_Index is reset, so "Loop, A_Index" sees the outer one
+        bool spilled = stmtLevel > HTLL_loopRegisterDepths(is_arm);
+        std::string countReg = HTLL_loopCountRegister(spilled ? 1 : stmtLevel, is_arm);
+        std::string savedReg = HTLL_loopSavedRegister(spilled ? 1 : stmtLevel, is_arm);
+        if (is_arm == 1) {
+            if (spilled) {
+                out += "    stp x19, x20, [sp, #-16]!" + Chr(10);
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                isOryxFuncFirst++;
-                if (isOryxFuncFirst == 1) {
-                    out += "jmp _start" + Chr(10);
-                }
-                // --- ORYX IR (Function Definition with R50+ Convention) ---
-                // Clear the map for the new function
-                oryx_param_map = {};
-                out += "jmp " + funcName + "_end_skip_def" + Chr(10);
-                out += funcName + ":" + Chr(10);
-                // Build the map: "param_name" -> "r(50+N)"
-                for (int A_Index200 = 0; A_Index200 < HTVM_Size(funcArgsArr); A_Index200++) {
-                    std::string param_name = Trim(funcArgsArr[A_Index200]);
-                    // Arg1 -> r50, Arg2 -> r51, etc.
-                    int non_volatile_reg_num = 50 + A_Index200;
-                    std::string safe_reg_name = "r" + STR(non_volatile_reg_num);
-                    HTVM_Append(oryx_param_map, param_name + Chr(254) + safe_reg_name);
-                    // Copy the argument from the volatile register (r1, r2...) into the safe register
-                    int arg_reg_num = A_Index200 + 1;
-                    out += "mov " + safe_reg_name + ", r" + STR(arg_reg_num) + Chr(10);
+            if (Trim(str1) == "rax") {
+                out += "    mov " + countReg + ", x0" + Chr(10);
+            }
+            else if (str1 == "-1") {
+                is_inf_loop = 1;
+                out += "    mov " + countReg + ", #0" + Chr(10);
+            }
+            else if (RegExMatch(str1, "^\\d+$")) {
+                out += "    mov " + countReg + ", #" + str1 + Chr(10);
+            }
+            else if (Trim(str1) == "A_Index") {
+                out += "    mov " + countReg + ", x20" + Chr(10);
+            } else {
+                int isStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str1)) {
+                    isStackVar = 1;
+                }
+                if (isStackVar == 1) {
+                    out += "    ldr " + countReg + ", =" + str1 + Chr(10);
+                } else {
+                    out += "    ldr x9, =" + str1 + Chr(10) + "    ldr " + countReg + ", [x9]" + Chr(10);
                 }
+            }
+            if (savedReg != "x20") {
+                out += "    mov " + savedReg + ", x20" + Chr(10);
+            }
+            out += "    mov x20, xzr" + Chr(10);
+            if (is_inf_loop == 1) {
+                out += ".loop" + blockLevel + "_" + blockCount + ":" + Chr(10);
             } else {
-                out += str2 + ":" + Chr(10) + "push rbp" + Chr(10) + "mov rbp, rsp" + Chr(10) + "sub rsp, " + STR(8 + (localVarNum * 8)) + Chr(10);
+                out += ".loop" + blockLevel + "_" + blockCount + ":" + Chr(10) + "    cmp " + countReg + ", #0" + Chr(10) + "    b.eq .loop" + blockLevel + "_end" + blockCount + Chr(10);
             }
         }
-        else if (Trim(A_LoopField69) == "funcend" || Trim(A_LoopField69) == "endfunc") {
-            if (is_arm == 1) {
-                out += "." + funcName + "_return:" + Chr(10);
-                out += "    mov sp, x29" + Chr(10);
-                out += "    ldp x29, x30, [sp], #16" + Chr(10);
-                out += "    ret" + Chr(10);
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "push r90" + Chr(10);
+            out += "push r91" + Chr(10);
+            strSrc = str1;
+            if (str1 == "rax") {
+                strSrc = "r0";
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                oryx_param_map = {};
-                // --- ORYX IR (Function End) ---
-                out += funcName + "_return:" + Chr(10);
-                out += "ret" + Chr(10);
-                out += funcName + "_end_skip_def:" + Chr(10);
+            else if (str1 == "-1") {
+                is_inf_loop = 1;
+            }
+            else if (str1 == "A_Index") {
+                strSrc = "r20";
+            }
+            out += "mov r90, " + strSrc + Chr(10);
+            out += "mov r91, 0" + Chr(10);
+            out += "loop" + blockLevel + "_" + blockCount + ":" + Chr(10);
+            if (is_inf_loop != 1) {
+                out += "cmp r91, r90" + Chr(10);
+                out += "jge loop" + blockLevel + "_end" + blockCount + Chr(10);
+            }
+            out += "mov r20, r91" + Chr(10);
+        } else {
+            if (spilled) {
+                out += "push r12" + Chr(10) + "push r13" + Chr(10);
+            }
+            if (RegExMatch(str1, "^\\d+$")) {
+                out += "mov " + countReg + ", " + str1 + Chr(10);
+            }
+            else if (str1 == "-1") {
+                is_inf_loop = 1;
+                out += "mov " + countReg + ", 0" + Chr(10);
             } else {
-                out += "." + funcName + "_return:" + Chr(10) + "add rsp, " + STR(8 + (localVarNum * 8)) + Chr(10) + "pop rbp" + Chr(10) + "ret" + Chr(10);
+                out += "mov " + countReg + ", [" + str1 + "]" + Chr(10);
+            }
+            if (savedReg != "r13") {
+                out += "mov " + savedReg + ", r13" + Chr(10);
+            }
+            out += "xor r13, r13" + Chr(10) + ".loop" + blockLevel + "_" + blockCount + ":" + Chr(10);
+            if (is_inf_loop == 0) {
+                out += "cmp " + countReg + ", 0" + Chr(10) + "je .loop" + blockLevel + "_end" + blockCount + Chr(10);
             }
-            funcCount++;
         }
-        else if (Trim(A_LoopField69) == "return") {
+    };
+    stmtHandlers[HTLL_STMT_LOOPEND] = [&]() {
+        std::string blockLevel = STR(stmtLevel);
+        std::string blockCount = STR(HTLL_blockCount(loopCounts, stmtLevel));
+        bool spilled = stmtLevel > HTLL_loopRegisterDepths(is_arm);
+        std::string countReg = HTLL_loopCountRegister(spilled ? 1 : stmtLevel, is_arm);
+        std::string savedReg = HTLL_loopSavedRegister(spilled ? 1 : stmtLevel, is_arm);
+        if (is_arm == 1) {
+            out += ".cloop" + blockLevel + "_end" + blockCount + ":" + Chr(10) + "    add x20, x20, #1" + Chr(10) + "    sub " + countReg + ", " + countReg + ", #1" + Chr(10) + "    b .loop" + blockLevel + "_" + blockCount + Chr(10) + ".loop" + blockLevel + "_end" + blockCount + ":" + Chr(10);
+            if (spilled) {
+                out += "    ldp x19, x20, [sp], #16" + Chr(10);
+            }
+            else if (savedReg != "x20") {
+                out += "    mov x20, " + savedReg + Chr(10);
+            }
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR (Loop End) ---
+            out += "cloop" + blockLevel + "_end" + blockCount + ":" + Chr(10);
+            out += "inc r91" + Chr(10);
+            out += "jmp loop" + blockLevel + "_" + blockCount + Chr(10);
+            out += "loop" + blockLevel + "_end" + blockCount + ":" + Chr(10);
+            out += "pop r91" + Chr(10);
+            out += "pop r90" + Chr(10);
+            if (stmtLevel > 1) {
+                // Restore A_Index alias (r20) to the outer loop's iterator (r91)
+                out += "mov r20, r91" + Chr(10);
+            }
+        } else {
+            out += ".cloop" + blockLevel + "_end" + blockCount + ":" + Chr(10) + "inc r13" + Chr(10) + "dec " + countReg + Chr(10) + "jmp .loop" + blockLevel + "_" + blockCount + Chr(10) + ".loop" + blockLevel + "_end" + blockCount + ":" + Chr(10);
+            if (spilled) {
+                out += "pop r13" + Chr(10) + "pop r12" + Chr(10);
+            }
+            else if (savedReg != "r13") {
+                out += "mov r13, " + savedReg + Chr(10);
+            }
+        }
+        HTLL_nextBlock(loopCounts, stmtLevel);
+    };
+    stmtHandlers[HTLL_STMT_IF] = [&]() {
+        std::string blockLevel = STR(stmtLevel);
+        std::string blockCount = STR(HTLL_blockCount(ifCounts, stmtLevel));
+        isNum = 0;
+        str1 = Trim(StringTrimLeft(A_LoopField69, InStr(A_LoopField69, " ")));
+        str1 = StringTrimLeft(str1, 1);
+        str1 = StringTrimRight(str1, 1);
+        if (InStr(str1, " = ")) {
+            str2 = Trim(StrSplit(str1, " = ", 1));
+            str3 = Trim(StrSplit(str1, " = ", 2));
+            isNum = RegExMatch(str3, "^\\d+$");
             if (is_arm == 1) {
-                out += "    b ." + funcName + "_return" + Chr(10);
+                // --- LHS (str2) ---
+                int isLhsStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str2)) {
+                    isLhsStackVar = 1;
+                }
+                if (str2 == "rax") {
+                    out += "    mov x9, x0" + Chr(10);
+                }
+                else if (str2 == "A_Index") {
+                    out += "    mov x9, x20" + Chr(10);
+                }
+                else if (isLhsStackVar == 1) {
+                    out += "    ldr x9, =" + str2 + Chr(10);
+                } else {
+                    out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
+                }
+                // --- RHS (str3) ---
+                int isRhsStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str3)) {
+                    isRhsStackVar = 1;
+                }
+                if (str3 == "rax") {
+                    out += "    mov x10, x0" + Chr(10);
+                }
+                else if (str3 == "A_Index") {
+                    out += "    mov x10, x20" + Chr(10);
+                }
+                else if (isNum == 1) {
+                    out += "    mov x10, #" + str3 + Chr(10);
+                }
+                else if (isRhsStackVar == 1) {
+                    out += "    ldr x10, =" + str3 + Chr(10);
+                } else {
+                    out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
+                }
+                out += "    cmp x9, x10" + Chr(10) + "    b.ne .end_if" + blockLevel + "_" + blockCount + Chr(10);
             }
             else if (is_oryx == 1) {
                 out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp " + funcName + "_return" + Chr(10);
+                // --- ORYX IR (if = -> jne) ---
+                strLhs = str2;
+                if (str2 == "rax") {
+                    strLhs = "r0";
+                }
+                else if (str2 == "A_Index") {
+                    strLhs = "r20";
+                }
+                strRhs = str3;
+                if (str3 == "rax") {
+                    strRhs = "r0";
+                }
+                else if (str3 == "A_Index") {
+                    strRhs = "r20";
+                }
+                out += "cmp " + strLhs + ", " + strRhs + Chr(10);
+                out += "jne end_if" + blockLevel + "_" + blockCount + Chr(10);
             } else {
-                out += "jmp ." + funcName + "_return" + Chr(10);
+                if (isNum == 1) {
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jne .end_if" + blockLevel + "_" + blockCount + Chr(10);
+                } else {
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jne .end_if" + blockLevel + "_" + blockCount + Chr(10);
+                }
             }
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 7) == "return ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 7));
+        else if (InStr(str1, " != ")) {
+            str2 = Trim(StrSplit(str1, " != ", 1));
+            str3 = Trim(StrSplit(str1, " != ", 2));
+            isNum = RegExMatch(str3, "^\\d+$");
             if (is_arm == 1) {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x0, #" + str1 + Chr(10);
+                int isLhsStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str2)) {
+                    isLhsStackVar = 1;
+                }
+                if (str2 == "rax") {
+                    out += "    mov x9, x0" + Chr(10);
                 }
-                else if (str1 == "rax") {
-                    // Value is already in x0, no instruction needed.
+                else if (str2 == "A_Index") {
+                    out += "    mov x9, x20" + Chr(10);
                 }
-                else if (str1 == "A_Index") {
-                    out += "    mov x0, x20" + Chr(10);
+                else if (isLhsStackVar == 1) {
+                    out += "    ldr x9, =" + str2 + Chr(10);
                 } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index201 = 0; A_Index201 < HTVM_Size(funcArgsArr); A_Index201++) {
-                            if (Trim(funcArgsArr[A_Index201]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
+                    out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
+                }
+                if (isNum == 1) {
+                    out += "    mov x10, #" + str3 + Chr(10);
+                } else {
+                    int isRhsStackVar = 0;
+                    if (inFunc == 1 && HTLL_isFuncParam(str3)) {
+                        isRhsStackVar = 1;
+                    }
+                    if (str3 == "rax") {
+                        out += "    mov x10, x0" + Chr(10);
+                    }
+                    else if (str3 == "A_Index") {
+                        out += "    mov x10, x20" + Chr(10);
                     }
-                    if (isStackVar == 1) {
-                        out += "    ldr x0, =" + str1 + Chr(10);
+                    else if (isRhsStackVar == 1) {
+                        out += "    ldr x10, =" + str3 + Chr(10);
                     } else {
-                        out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x0, [x9]" + Chr(10);
+                        out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
                     }
                 }
-                out += "    b ." + funcName + "_return" + Chr(10);
+                out += "    cmp x9, x10" + Chr(10) + "    b.eq .end_if" + blockLevel + "_" + blockCount + Chr(10);
             }
             else if (is_oryx == 1) {
                 out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (return value) ---
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "mov r0, " + str1 + Chr(10);
+                // --- ORYX IR (if != -> je) ---
+                strLhs = str2;
+                if (str2 == "rax") {
+                    strLhs = "r0";
                 }
-                else if (str1 == "rax") {
-                    // Already in r0
+                else if (str2 == "A_Index") {
+                    strLhs = "r20";
                 }
-                else if (str1 == "A_Index") {
-                    out += "mov r0, r20" + Chr(10);
-                } else {
-                    // Variable
-                    out += "mov r0, " + str1 + Chr(10);
+                strRhs = str3;
+                if (str3 == "rax") {
+                    strRhs = "r0";
                 }
-                out += "jmp " + funcName + "_return" + Chr(10);
+                else if (str3 == "A_Index") {
+                    strRhs = "r20";
+                }
+                out += "cmp " + strLhs + ", " + strRhs + Chr(10);
+                out += "je end_if" + blockLevel + "_" + blockCount + Chr(10);
             } else {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "mov rax, " + str1 + Chr(10) + "jmp ." + funcName + "_return" + Chr(10);
+                if (isNum == 1) {
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "je .end_if" + blockLevel + "_" + blockCount + Chr(10);
                 } else {
-                    out += "mov rax, [" + str1 + "]" + Chr(10) + "jmp ." + funcName + "_return" + Chr(10);
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "je .end_if" + blockLevel + "_" + blockCount + Chr(10);
                 }
             }
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 4) == "arr ") {
-            str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 4));
-            if (is_arm == 1) {
-                // A struct of 3 quadwords is 24 bytes
-                arrBss += ".lcomm " + Trim(str1) + ", 24" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Array Declaration) ---
-                out += "arr " + Trim(str1) + Chr(10);
-            } else {
-                arrBss += "    " + Trim(str1) + " rq 3" + Chr(10);
-            }
-        }
-        else if (InStr(A_LoopField69, ".add ")) {
-            str1 = Trim(StrSplit(A_LoopField69, ".", 1));
-            str2 = Trim(StrSplit(A_LoopField69, ".add", 2));
+        else if (InStr(str1, " > ")) {
+            str2 = Trim(StrSplit(str1, " > ", 1));
+            str3 = Trim(StrSplit(str1, " > ", 2));
+            isNum = RegExMatch(str3, "^\\d+$");
             if (is_arm == 1) {
-                out += "    ldr x0, =" + str1 + Chr(10);
-                if (RegExMatch(str2, "^\\d+$")) {
-                    out += "    mov x1, #" + str2 + Chr(10);
+                int isLhsStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str2)) {
+                    isLhsStackVar = 1;
                 }
-                else if (SubStr(str2, 1, 1) == "'") {
-                    out += "    mov x1, #" + str2 + Chr(10);
-                }
-                else if (str2 == "rax") {
-                    out += "    mov x1, x0" + Chr(10);
+                if (str2 == "rax") {
+                    out += "    mov x9, x0" + Chr(10);
                 }
                 else if (str2 == "A_Index") {
-                    out += "    mov x1, x20" + Chr(10);
+                    out += "    mov x9, x20" + Chr(10);
+                }
+                else if (isLhsStackVar == 1) {
+                    out += "    ldr x9, =" + str2 + Chr(10);
                 } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index202 = 0; A_Index202 < HTVM_Size(funcArgsArr); A_Index202++) {
-                            if (Trim(funcArgsArr[A_Index202]) == str2) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
+                    out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
+                }
+                if (isNum == 1) {
+                    out += "    mov x10, #" + str3 + Chr(10);
+                } else {
+                    int isRhsStackVar = 0;
+                    if (inFunc == 1 && HTLL_isFuncParam(str3)) {
+                        isRhsStackVar = 1;
                     }
-                    if (isStackVar == 1) {
-                        out += "    ldr x1, =" + str2 + Chr(10);
+                    if (str3 == "rax") {
+                        out += "    mov x10, x0" + Chr(10);
+                    }
+                    else if (str3 == "A_Index") {
+                        out += "    mov x10, x20" + Chr(10);
+                    }
+                    else if (isRhsStackVar == 1) {
+                        out += "    ldr x10, =" + str3 + Chr(10);
                     } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x1, [x9]" + Chr(10);
+                        out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
                     }
                 }
-                out += "    bl array_append" + Chr(10);
+                out += "    cmp x9, x10" + Chr(10) + "    b.le .end_if" + blockLevel + "_" + blockCount + Chr(10);
             }
             else if (is_oryx == 1) {
                 out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (arr.add) ---
-                strVal = str2;
+                // --- ORYX IR (if > -> jle) ---
+                strLhs = str2;
                 if (str2 == "rax") {
-                    strVal = "r0";
+                    strLhs = "r0";
                 }
                 else if (str2 == "A_Index") {
-                    strVal = "r20";
+                    strLhs = "r20";
+                }
+                strRhs = str3;
+                if (str3 == "rax") {
+                    strRhs = "r0";
                 }
-                else if (SubStr(str2, 1, 1) == "'") {
-                    // Character literal 'A' -> "A" for Oryx
-                    strVal = Chr(34) + SubStr(str2, 2, 1) + Chr(34);
+                else if (str3 == "A_Index") {
+                    strRhs = "r20";
                 }
-                out += "arr.add " + str1 + ", " + strVal + Chr(10);
+                out += "cmp " + strLhs + ", " + strRhs + Chr(10);
+                out += "jle end_if" + blockLevel + "_" + blockCount + Chr(10);
             } else {
-                if (RegExMatch(str2, "^\\d+$")) {
-                    str3 = "mov rsi, " + str2 + Chr(10) + "mov rdi, " + str1 + Chr(10);
+                if (isNum == 1) {
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jle .end_if" + blockLevel + "_" + blockCount + Chr(10);
                 } else {
-                    str3 = "mov rsi, [" + str2 + "]" + Chr(10) + "mov rdi, " + str1 + Chr(10);
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jle .end_if" + blockLevel + "_" + blockCount + Chr(10);
                 }
-                out += str3 + Chr(10) + "call array_append" + Chr(10);
-            }
-        }
-        else if (InStr(A_LoopField69, ".pop")) {
-            str1 = Trim(StrSplit(A_LoopField69, ".", 1));
-            if (is_arm == 1) {
-                out += "    ldr x0, =" + str1 + Chr(10);
-                out += "    bl array_pop" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // Oryx doesn't have explicit .pop in your spec, but let's assume it does or map it
-                // If not, we skip or use a custom VM call. Assuming arr.pop exists:
-                out += "arr.pop " + str1 + Chr(10);
-            } else {
-                out += "mov rdi, " + str1 + Chr(10) + "call array_pop" + Chr(10);
-            }
-        }
-        else if (InStr(A_LoopField69, ".clear")) {
-            str1 = Trim(StrSplit(A_LoopField69, ".", 1));
-            if (is_arm == 1) {
-                out += "    ldr x0, =" + str1 + Chr(10);
-                out += "    bl array_clear" + Chr(10);
-            }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "arr.clear " + str1 + Chr(10);
-            } else {
-                out += "mov rdi, " + str1 + Chr(10) + "call array_clear" + Chr(10);
             }
         }
-        else if (InStr(A_LoopField69, ".copy ")) {
-            str1 = Trim(StrSplit(A_LoopField69, ".", 1));
-            str2 = Trim(StrSplit(A_LoopField69, ".copy", 2));
+        else if (InStr(str1, " < ")) {
+            str2 = Trim(StrSplit(str1, " < ", 1));
+            str3 = Trim(StrSplit(str1, " < ", 2));
+            isNum = RegExMatch(str3, "^\\d+$");
             if (is_arm == 1) {
-                out += "    ldr x0, =" + str1 + Chr(10);
-                out += "    ldr x1, =" + str2 + Chr(10);
-                out += "    bl array_copy" + Chr(10);
+                int isLhsStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str2)) {
+                    isLhsStackVar = 1;
+                }
+                if (str2 == "rax") {
+                    out += "    mov x9, x0" + Chr(10);
+                }
+                else if (str2 == "A_Index") {
+                    out += "    mov x9, x20" + Chr(10);
+                }
+                else if (isLhsStackVar == 1) {
+                    out += "    ldr x9, =" + str2 + Chr(10);
+                } else {
+                    out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
+                }
+                if (isNum == 1) {
+                    out += "    mov x10, #" + str3 + Chr(10);
+                } else {
+                    int isRhsStackVar = 0;
+                    if (inFunc == 1 && HTLL_isFuncParam(str3)) {
+                        isRhsStackVar = 1;
+                    }
+                    if (str3 == "rax") {
+                        out += "    mov x10, x0" + Chr(10);
+                    }
+                    else if (str3 == "A_Index") {
+                        out += "    mov x10, x20" + Chr(10);
+                    }
+                    else if (isRhsStackVar == 1) {
+                        out += "    ldr x10, =" + str3 + Chr(10);
+                    } else {
+                        out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
+                    }
+                }
+                out += "    cmp x9, x10" + Chr(10) + "    b.ge .end_if" + blockLevel + "_" + blockCount + Chr(10);
             }
             else if (is_oryx == 1) {
                 out += "meta " + A_LoopField69 + Chr(10);
-                out += "arr.copy " + str2 + ", " + str1 + Chr(10);
+                // --- ORYX IR (if < -> jge) ---
+                strLhs = str2;
+                if (str2 == "rax") {
+                    strLhs = "r0";
+                }
+                else if (str2 == "A_Index") {
+                    strLhs = "r20";
+                }
+                strRhs = str3;
+                if (str3 == "rax") {
+                    strRhs = "r0";
+                }
+                else if (str3 == "A_Index") {
+                    strRhs = "r20";
+                }
+                out += "cmp " + strLhs + ", " + strRhs + Chr(10);
+                out += "jge end_if" + blockLevel + "_" + blockCount + Chr(10);
             } else {
-                out += "mov rdi, " + str1 + Chr(10) + "mov rsi, " + str2 + Chr(10) + "call array_copy" + Chr(10);
+                if (isNum == 1) {
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jge .end_if" + blockLevel + "_" + blockCount + Chr(10);
+                } else {
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jge .end_if" + blockLevel + "_" + blockCount + Chr(10);
+                }
             }
         }
-        else if (InStr(A_LoopField69, ".size")) {
-            str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        else if (InStr(str1, " >= ")) {
+            str2 = Trim(StrSplit(str1, " >= ", 1));
+            str3 = Trim(StrSplit(str1, " >= ", 2));
+            isNum = RegExMatch(str3, "^\\d+$");
             if (is_arm == 1) {
-                out += "    ldr x9, =" + str1 + Chr(10);
-                out += "    ldr x0, [x9, #DynamicArray_size]" + Chr(10);
+                int isLhsStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str2)) {
+                    isLhsStackVar = 1;
+                }
+                if (str2 == "rax") {
+                    out += "    mov x9, x0" + Chr(10);
+                }
+                else if (str2 == "A_Index") {
+                    out += "    mov x9, x20" + Chr(10);
+                }
+                else if (isLhsStackVar == 1) {
+                    out += "    ldr x9, =" + str2 + Chr(10);
+                } else {
+                    out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
+                }
+                if (isNum == 1) {
+                    out += "    mov x10, #" + str3 + Chr(10);
+                } else {
+                    int isRhsStackVar = 0;
+                    if (inFunc == 1 && HTLL_isFuncParam(str3)) {
+                        isRhsStackVar = 1;
+                    }
+                    if (str3 == "rax") {
+                        out += "    mov x10, x0" + Chr(10);
+                    }
+                    else if (str3 == "A_Index") {
+                        out += "    mov x10, x20" + Chr(10);
+                    }
+                    else if (isRhsStackVar == 1) {
+                        out += "    ldr x10, =" + str3 + Chr(10);
+                    } else {
+                        out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
+                    }
+                }
+                out += "    cmp x9, x10" + Chr(10) + "    b.lt .end_if" + blockLevel + "_" + blockCount + Chr(10);
             }
             else if (is_oryx == 1) {
                 out += "meta " + A_LoopField69 + Chr(10);
-                // arr.size <array>, <dest_reg>
-                out += "arr.size " + str1 + ", r0" + Chr(10);
+                // --- ORYX IR (if >= -> jl) ---
+                strLhs = str2;
+                if (str2 == "rax") {
+                    strLhs = "r0";
+                }
+                else if (str2 == "A_Index") {
+                    strLhs = "r20";
+                }
+                strRhs = str3;
+                if (str3 == "rax") {
+                    strRhs = "r0";
+                }
+                else if (str3 == "A_Index") {
+                    strRhs = "r20";
+                }
+                out += "cmp " + strLhs + ", " + strRhs + Chr(10);
+                out += "jl end_if" + blockLevel + "_" + blockCount + Chr(10);
             } else {
-                out += "mov rax, [" + str1 + " + DynamicArray.size]" + Chr(10);
+                if (isNum == 1) {
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jl .end_if" + blockLevel + "_" + blockCount + Chr(10);
+                } else {
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jl .end_if" + blockLevel + "_" + blockCount + Chr(10);
+                }
             }
         }
-        else if (InStr(A_LoopField69, ".index ")) {
-            str1 = Trim(StrSplit(A_LoopField69, ".", 1));
-            str2 = Trim(StrSplit(A_LoopField69, ".index", 2));
+        else if (InStr(str1, " <= ")) {
+            str2 = Trim(StrSplit(str1, " <= ", 1));
+            str3 = Trim(StrSplit(str1, " <= ", 2));
+            isNum = RegExMatch(str3, "^\\d+$");
             if (is_arm == 1) {
-                if (RegExMatch(str2, "^\\d+$")) {
-                    out += "    mov x10, #" + str2 + Chr(10);
+                int isLhsStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str2)) {
+                    isLhsStackVar = 1;
+                }
+                if (str2 == "rax") {
+                    out += "    mov x9, x0" + Chr(10);
                 }
                 else if (str2 == "A_Index") {
-                    out += "    mov x10, x20" + Chr(10);
+                    out += "    mov x9, x20" + Chr(10);
                 }
-                else if (str2 == "rax") {
-                    out += "    mov x10, x0" + Chr(10);
+                else if (isLhsStackVar == 1) {
+                    out += "    ldr x9, =" + str2 + Chr(10);
                 } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index203 = 0; A_Index203 < HTVM_Size(funcArgsArr); A_Index203++) {
-                            if (Trim(funcArgsArr[A_Index203]) == str2) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
+                    out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x9, [x9]" + Chr(10);
+                }
+                if (isNum == 1) {
+                    out += "    mov x10, #" + str3 + Chr(10);
+                } else {
+                    int isRhsStackVar = 0;
+                    if (inFunc == 1 && HTLL_isFuncParam(str3)) {
+                        isRhsStackVar = 1;
                     }
-                    if (isStackVar == 1) {
-                        out += "    ldr x10, =" + str2 + Chr(10);
+                    if (str3 == "rax") {
+                        out += "    mov x10, x0" + Chr(10);
+                    }
+                    else if (str3 == "A_Index") {
+                        out += "    mov x10, x20" + Chr(10);
+                    }
+                    else if (isRhsStackVar == 1) {
+                        out += "    ldr x10, =" + str3 + Chr(10);
                     } else {
-                        out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x10, [x9]" + Chr(10);
+                        out += "    ldr x10, =" + str3 + Chr(10) + "    ldr x10, [x10]" + Chr(10);
                     }
                 }
-                out += "    ldr x9, =" + str1 + Chr(10);
-                out += "    ldr x9, [x9, #DynamicArray_pointer]" + Chr(10);
-                out += "    ldr x0, [x9, x10, lsl #3]" + Chr(10);
+                out += "    cmp x9, x10" + Chr(10) + "    b.gt .end_if" + blockLevel + "_" + blockCount + Chr(10);
             }
             else if (is_oryx == 1) {
                 out += "meta " + A_LoopField69 + Chr(10);
-                // arr.get <array>, <index_src>, <dest_reg>
-                strIndex = str2;
+                // --- ORYX IR (if <= -> jg) ---
+                strLhs = str2;
                 if (str2 == "rax") {
-                    strIndex = "r0";
+                    strLhs = "r0";
                 }
                 else if (str2 == "A_Index") {
-                    strIndex = "r20";
+                    strLhs = "r20";
+                }
+                strRhs = str3;
+                if (str3 == "rax") {
+                    strRhs = "r0";
                 }
-                // If index is a variable, Oryx handles it.
-                // If it's a raw number, Oryx handles it.
-                out += "arr.get " + str1 + ", " + strIndex + ", r0" + Chr(10);
+                else if (str3 == "A_Index") {
+                    strRhs = "r20";
+                }
+                out += "cmp " + strLhs + ", " + strRhs + Chr(10);
+                out += "jg end_if" + blockLevel + "_" + blockCount + Chr(10);
             } else {
-                if (RegExMatch(str2, "^\\d+$")) {
-                    str3 = "mov rcx, " + str2 + Chr(10);
+                if (isNum == 1) {
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, " + str3 + Chr(10) + "jg .end_if" + blockLevel + "_" + blockCount + Chr(10);
                 } else {
-                    str3 = "mov rcx, [" + str2 + "]" + Chr(10);
+                    out += "mov rax, [" + str2 + "]" + Chr(10) + "cmp rax, [" + str3 + "]" + Chr(10) + "jg .end_if" + blockLevel + "_" + blockCount + Chr(10);
                 }
-                out += str3 + Chr(10) + "mov rbx, [" + str1 + " + DynamicArray.pointer]" + Chr(10) + "mov rax, [rbx + rcx*8]" + Chr(10);
             }
         }
-        else if (InStr(A_LoopField69, ".compile ")) {
-            // arrName.compile outArr
-            str1 = Trim(StrSplit(A_LoopField69, ".", 1));
-            str2 = Trim(StrSplit(A_LoopField69, ".compile", 2));
-            isDotCompile = 1;
-            out += "mov rdi, " + str1 + Chr(10) + "call array_pack_to_bytes" + Chr(10) + "mov [source_ptr], rax" + Chr(10) + "mov rdi, [source_ptr]" + Chr(10) + "call compiler_c" + Chr(10) + "mov [asm_code_ptr], rax" + Chr(10) + "mov rdi, " + str2 + Chr(10) + "mov rsi, [asm_code_ptr]" + Chr(10) + "call array_unpack_from_bytes" + Chr(10) + "mov rdi, [source_ptr]" + Chr(10) + "mov rsi, [source_ptr_size]" + Chr(10) + "call free_packed_string" + Chr(10) + "mov rdi, [asm_code_ptr]" + Chr(10) + "call free_string_c" + Chr(10);
+    };
+    stmtHandlers[HTLL_STMT_IFEND] = [&]() {
+        std::string blockLevel = STR(stmtLevel);
+        std::string blockCount = STR(HTLL_blockCount(ifCounts, stmtLevel));
+        if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "end_if" + blockLevel + "_" + blockCount + ":" + Chr(10);
+        } else {
+            out += ".end_if" + blockLevel + "_" + blockCount + ":" + Chr(10);
+        }
+        HTLL_nextBlock(ifCounts, stmtLevel);
+    };
+    stmtHandlers[HTLL_STMT_FUNC] = [&]() {
+        // --- YOUR PARSING LOGIC IS UNCHANGED ---
+        str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 5));
+        str2 = "";
+        std::vector<std::string> items197 = LoopParseFunc(str1);
+        for (size_t A_Index197 = 0; A_Index197 < items197.size(); A_Index197++) {
+            std::string A_LoopField197 = items197[A_Index197 - 0];
+            if (A_LoopField197 == "(") {
+                break;
+            } else {
+                str2 += A_LoopField197;
+            }
+        }
+        str2 = Trim(str2);
+        localVarNum = 1;
+        inFunc = 1;
+        funcArgsCount = (countChars(str1, ",") + 1);
+        int1 = 0;
+        int2 = 0;
+        if (InStr(str1, ",") || InStr(str1, "()") == false) {
+            funcArgsArr = {};
+            std::vector<std::string> items198 = LoopParseFunc(str1);
+            for (size_t A_Index198 = 0; A_Index198 < items198.size(); A_Index198++) {
+                std::string A_LoopField198 = items198[A_Index198 - 0];
+                if (A_LoopField198 == ")") {
+                    break;
+                }
+                if (int1 == 1 && A_LoopField198 != "," && A_LoopField198 != " ") {
+                    funcArgsArr[int2] = funcArgsArr[int2] + A_LoopField198;
+                }
+                if (A_LoopField198 == ",") {
+                    HTVM_Append(funcArgsArr, "");
+                    int2++;
+                }
+                if (A_LoopField198 == "(") {
+                    HTVM_Append(funcArgsArr, "");
+                    int1 = 1;
+                }
+            }
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 5) == "goto ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 5));
-            if (is_arm == 1) {
-                out += "    b .__HTLL_HTLL_" + str1 + Chr(10);
+        HTLL_beginFunction(funcArgsArr);
+        funcName = str2;
+        // the loop registers this function's loops use; its callers' loops may be using them
+        loopRegs = HTLL_loopRegisters(funcLoopDepths[funcCount], is_arm);
+        // --- ARCHITECTURE-SPECIFIC CODE GENERATION ---
+        if (is_arm == 1) {
+            out += funcName + ":" + Chr(10);
+            out += "    stp x29, x30, [sp, #-16]!" + Chr(10);
+            out += "    mov x29, sp" + Chr(10);
+            for (size_t i = 0; i < loopRegs.size(); i += 2) {
+                out += "    stp " + loopRegs[i] + ", " + loopRegs[i + 1] + ", [sp, #-16]!" + Chr(10);
+            }
+            // --- NEW REQUIRED LOGIC FOR ARM ---
+            // Calculate space needed for local vars AND for saving register arguments
+            int args_to_save = HTVM_Size(funcArgsArr) > 8 ? 8 : HTVM_Size(funcArgsArr);
+            int total_space = ( (localVarNum * 8) + (args_to_save * 8) + 15 ) & ~15;
+            out += "    sub sp, sp, #" + STR(total_space) + Chr(10);
+            // Save the incoming register arguments to the stack
+            for (int A_Index199 = 0; A_Index199 < args_to_save; A_Index199++) {
+                int offset = (A_Index199 * 8);
+                out += "    str x" + STR(A_Index199) + ", [sp, #" + STR(offset) + "]" + Chr(10);
+            }
+            // --- END NEW LOGIC ---
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            isOryxFuncFirst++;
+            if (isOryxFuncFirst == 1) {
+                out += "jmp _start" + Chr(10);
+            }
+            // --- ORYX IR (Function Definition with R50+ Convention) ---
+            out += "jmp " + funcName + "_end_skip_def" + Chr(10);
+            out += funcName + ":" + Chr(10);
+            // Arg1 -> r50, Arg2 -> r51, etc., as the symbol table placed them
+            for (int A_Index200 = 0; A_Index200 < HTVM_Size(funcArgsArr); A_Index200++) {
+                std::string safe_reg_name = HTLL_symbolOperand(funcArgsArr[A_Index200]);
+                // Copy the argument from the volatile register (r1, r2...) into the safe register
+                int arg_reg_num = A_Index200 + 1;
+                out += "mov " + safe_reg_name + ", r" + STR(arg_reg_num) + Chr(10);
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "jmp __HTLL_HTLL_" + str1 + Chr(10);
-            } else {
-                out += "jmp .__HTLL_HTLL_" + str1 + Chr(10);
+        } else {
+            out += str2 + ":" + Chr(10) + "push rbp" + Chr(10) + "mov rbp, rsp" + Chr(10);
+            for (const std::string& reg : loopRegs) {
+                out += "push " + reg + Chr(10);
             }
+            out += "sub rsp, " + STR(8 + (localVarNum * 8)) + Chr(10);
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 5) == "togo ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 5));
-            if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "__HTLL_HTLL_" + str1 + ":" + Chr(10);
-            } else {
-                out += ".__HTLL_HTLL_" + str1 + ":" + Chr(10);
+    };
+    stmtHandlers[HTLL_STMT_FUNCEND] = [&]() {
+        if (is_arm == 1) {
+            out += "." + funcName + "_return:" + Chr(10);
+            for (size_t i = 0; i < loopRegs.size(); i += 2) {
+                out += "    ldp " + loopRegs[i] + ", " + loopRegs[i + 1] + ", [x29, #-" + STR(8 * (i + 2)) + "]" + Chr(10);
+            }
+            out += "    mov sp, x29" + Chr(10);
+            out += "    ldp x29, x30, [sp], #16" + Chr(10);
+            out += "    ret" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR (Function End) ---
+            out += funcName + "_return:" + Chr(10);
+            out += "ret" + Chr(10);
+            out += funcName + "_end_skip_def:" + Chr(10);
+        }
+        else if (loopRegs.empty()) {
+            out += "." + funcName + "_return:" + Chr(10) + "add rsp, " + STR(8 + (localVarNum * 8)) + Chr(10) + "pop rbp" + Chr(10) + "ret" + Chr(10);
+        } else {
+            out += "." + funcName + "_return:" + Chr(10);
+            for (size_t i = 0; i < loopRegs.size(); i++) {
+                out += "mov " + loopRegs[i] + ", [rbp - " + STR(8 * (i + 1)) + "]" + Chr(10);
             }
+            out += "mov rsp, rbp" + Chr(10) + "pop rbp" + Chr(10) + "ret" + Chr(10);
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 7) == "sleep, ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 7));
-            if (is_arm == 1) {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "    mov x0, #" + str1 + Chr(10);
-                }
-                else if (str1 == "A_Index") {
-                    out += "    mov x0, x20" + Chr(10);
-                } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index204 = 0; A_Index204 < HTVM_Size(funcArgsArr); A_Index204++) {
-                            if (Trim(funcArgsArr[A_Index204]) == str1) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x0, =" + str1 + Chr(10);
-                    } else {
-                        out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x0, [x9]" + Chr(10);
-                    }
-                }
-                out += "    bl sleep_ms" + Chr(10);
+        loopRegs.clear();
+        HTLL_endFunction();
+        funcCount++;
+    };
+    stmtHandlers[HTLL_STMT_RETURN_VOID] = [&]() {
+        if (is_arm == 1) {
+            out += "    b ." + funcName + "_return" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "jmp " + funcName + "_return" + Chr(10);
+        } else {
+            out += "jmp ." + funcName + "_return" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_RETURN] = [&]() {
+        str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 7));
+        if (is_arm == 1) {
+            if (RegExMatch(str1, "^\\d+$")) {
+                out += "    mov x0, #" + str1 + Chr(10);
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "mov r1, " + str1 + Chr(10);
-                }
-                else if (str1 == "rax") {
-                    out += "mov r1, r0" + Chr(10);
-                }
-                else if (str1 == "A_Index") {
-                    out += "mov r1, r20" + Chr(10);
-                } else {
-                    out += "mov r1, " + str1 + Chr(10);
-                }
-                out += "call sleep" + Chr(10);
+            else if (str1 == "rax") {
+                // Value is already in x0, no instruction needed.
+            }
+            else if (str1 == "A_Index") {
+                out += "    mov x0, x20" + Chr(10);
             } else {
-                if (RegExMatch(str1, "^\\d+$")) {
-                    out += "mov rdi, " + str1 + Chr(10);
+                int isStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str1)) {
+                    isStackVar = 1;
                 }
-                else if (str1 == "rax") {
-                    out += "mov rdi, rax" + Chr(10);
-                }
-                else if (str1 == "A_Index") {
-                    out += "mov rdi, r13" + Chr(10);
+                if (isStackVar == 1) {
+                    out += "    ldr x0, =" + str1 + Chr(10);
                 } else {
-                    out += "mov rdi, [" + str1 + "]" + Chr(10);
+                    out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x0, [x9]" + Chr(10);
                 }
-                out += "call sleep_ms" + Chr(10);
             }
+            out += "    b ." + funcName + "_return" + Chr(10);
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 13) == "fileread_arr ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 13));
-            str2 = Trim(StrSplit(str1, ",", 1));
-            str3 = Trim(StrSplit(str1, ",", 2));
-            if (is_arm == 1) {
-                out += "    ldr x0, =" + str3 + Chr(10) + "    bl array_pack_to_bytes" + Chr(10);
-                out += "    ldr x9, =filename_ptr" + Chr(10) + "    str x0, [x9]" + Chr(10);
-                out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    str x1, [x9]" + Chr(10);
-                out += "    ldr x0, =" + str2 + Chr(10);
-                out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x1, [x9]" + Chr(10);
-                out += "    bl fileread_from_ptr" + Chr(10);
-                out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x0, [x9]" + Chr(10);
-                out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    ldr x1, [x9]" + Chr(10);
-                out += "    bl free_packed_string" + Chr(10);
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR (return value) ---
+            if (RegExMatch(str1, "^\\d+$")) {
+                out += "mov r0, " + str1 + Chr(10);
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "; --- INLINE CONVERT " + str3 + " ---" + Chr(10);
-                out += "arr.size " + str3 + ", r90" + Chr(10);
-                out += "mov __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, " + Chr(34) + Chr(34) + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "__HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + ":" + Chr(10);
-                out += "cmp r91, r90" + Chr(10);
-                out += "jge __HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + Chr(10);
-                out += "arr.get " + str3 + ", r91, r92" + Chr(10);
-                out += "num_to_char r92, r93" + Chr(10);
-                out += "add_str __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, r93" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp __HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + Chr(10);
-                out += "__HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + ":" + Chr(10);
-                out += "file.read " + str2 + ", __HTLL_HTLL_HTLL_HTLL_IO_BUFFER" + Chr(10);
-                HTLL_fix_int++;
-            } else {
-                out += "mov rdi, " + str3 + Chr(10) + "call array_pack_to_bytes" + Chr(10);
-                out += "mov [filename_ptr], rax" + Chr(10) + "mov [filename_ptr_size], rdx" + Chr(10);
-                out += "mov rdi, " + str2 + Chr(10) + "mov rsi, [filename_ptr]" + Chr(10) + "call fileread_from_ptr" + Chr(10);
-                out += "mov rdi, [filename_ptr]" + Chr(10) + "mov rsi, [filename_ptr_size]" + Chr(10) + "call free_packed_string" + Chr(10);
+            else if (str1 == "rax") {
+                // Already in r0
             }
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 15) == "fileappend_arr ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 15));
-            str2 = Trim(StrSplit(str1, ",", 1));
-            str3 = Trim(StrSplit(str1, ",", 2));
-            if (is_arm == 1) {
-                out += "    ldr x0, =" + str2 + Chr(10) + "    bl array_pack_to_bytes" + Chr(10);
-                out += "    ldr x9, =filename_ptr" + Chr(10) + "    str x0, [x9]" + Chr(10);
-                out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    str x1, [x9]" + Chr(10);
-                out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x0, [x9]" + Chr(10);
-                out += "    ldr x1, =" + str3 + Chr(10);
-                out += "    bl fileappend_from_ptr" + Chr(10);
-                out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x0, [x9]" + Chr(10);
-                out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    ldr x1, [x9]" + Chr(10);
-                out += "    bl free_packed_string" + Chr(10);
+            else if (str1 == "A_Index") {
+                out += "mov r0, r20" + Chr(10);
+            } else {
+                // Variable
+                out += "mov r0, " + str1 + Chr(10);
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- INLINE CONVERT FILENAME (str2) ---
-                out += "; --- INLINE CONVERT " + str2 + " ---" + Chr(10);
-                out += "arr.size " + str2 + ", r90" + Chr(10);
-                out += "mov __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, " + Chr(34) + Chr(34) + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "__HTLL_HTLL_inline_convA" + STR(HTLL_fix_int) + ":" + Chr(10);
-                out += "cmp r91, r90" + Chr(10);
-                out += "jge __HTLL_HTLL_inline_convA_end" + STR(HTLL_fix_int) + Chr(10);
-                out += "arr.get " + str2 + ", r91, r92" + Chr(10);
-                out += "num_to_char r92, r93" + Chr(10);
-                out += "add_str __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, r93" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp __HTLL_HTLL_inline_convA" + STR(HTLL_fix_int) + Chr(10);
-                out += "__HTLL_HTLL_inline_convA_end" + STR(HTLL_fix_int) + ":" + Chr(10);
-                // --- INLINE CONVERT CONTENT (str3) ---
-                out += "; --- INLINE CONVERT " + str3 + " ---" + Chr(10);
-                out += "arr.size " + str3 + ", r90" + Chr(10);
-                out += "mov __HTLL_HTLL_HTLL_HTLL_CONTENT_BUFFER, " + Chr(34) + Chr(34) + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "__HTLL_HTLL_inline_convB" + STR(HTLL_fix_int) + ":" + Chr(10);
-                out += "cmp r91, r90" + Chr(10);
-                out += "jge __HTLL_HTLL_inline_convB_end" + STR(HTLL_fix_int) + Chr(10);
-                out += "arr.get " + str3 + ", r91, r92" + Chr(10);
-                out += "num_to_char r92, r93" + Chr(10);
-                out += "add_str __HTLL_HTLL_HTLL_HTLL_CONTENT_BUFFER, r93" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp __HTLL_HTLL_inline_convB" + STR(HTLL_fix_int) + Chr(10);
-                out += "__HTLL_HTLL_inline_convB_end" + STR(HTLL_fix_int) + ":" + Chr(10);
-                out += "file.append __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, __HTLL_HTLL_HTLL_HTLL_CONTENT_BUFFER" + Chr(10);
-                HTLL_fix_int++;
+            out += "jmp " + funcName + "_return" + Chr(10);
+        } else {
+            if (RegExMatch(str1, "^\\d+$")) {
+                out += "mov rax, " + str1 + Chr(10) + "jmp ." + funcName + "_return" + Chr(10);
             } else {
-                out += "mov rdi, " + str2 + Chr(10) + "call array_pack_to_bytes" + Chr(10);
-                out += "mov [filename_ptr], rax" + Chr(10) + "mov [filename_ptr_size], rdx" + Chr(10);
-                out += "mov rdi, [filename_ptr]" + Chr(10) + "mov rsi, " + str3 + Chr(10) + "call fileappend_from_ptr" + Chr(10);
-                out += "mov rdi, [filename_ptr]" + Chr(10) + "mov rsi, [filename_ptr_size]" + Chr(10) + "call free_packed_string" + Chr(10);
+                out += "mov rax, [" + str1 + "]" + Chr(10) + "jmp ." + funcName + "_return" + Chr(10);
             }
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 15) == "filedelete_arr ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 15));
-            if (is_arm == 1) {
-                out += "    ldr x0, =" + str1 + Chr(10) + "    bl array_pack_to_bytes" + Chr(10);
-                out += "    ldr x9, =filename_ptr" + Chr(10) + "    str x0, [x9]" + Chr(10);
-                out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    str x1, [x9]" + Chr(10);
-                out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x0, [x9]" + Chr(10);
-                out += "    bl filedelete_from_ptr" + Chr(10);
-                out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x0, [x9]" + Chr(10);
-                out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    ldr x1, [x9]" + Chr(10);
-                out += "    bl free_packed_string" + Chr(10);
+    };
+    stmtHandlers[HTLL_STMT_ARR] = [&]() {
+        str1 = Trim(StringTrimLeft(Trim(A_LoopField69), 4));
+        HTLL_declareLocal(str1);
+        if (is_arm == 1) {
+            // A struct of 3 quadwords is 24 bytes
+            arrBss += ".lcomm " + Trim(str1) + ", 24" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR (Array Declaration) ---
+            out += "arr " + Trim(str1) + Chr(10);
+        } else {
+            arrBss += "    " + Trim(str1) + " rq 3" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_ARR_ADD] = [&]() {
+        str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        str2 = Trim(StrSplit(A_LoopField69, ".add", 2));
+        if (is_arm == 1) {
+            out += "    ldr x0, =" + str1 + Chr(10);
+            if (RegExMatch(str2, "^\\d+$")) {
+                out += "    mov x1, #" + str2 + Chr(10);
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "; --- INLINE CONVERT " + str1 + " ---" + Chr(10);
-                out += "arr.size " + str1 + ", r90" + Chr(10);
-                out += "mov __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, " + Chr(34) + Chr(34) + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "__HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + ":" + Chr(10);
-                out += "cmp r91, r90" + Chr(10);
-                out += "jge __HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + Chr(10);
-                out += "arr.get " + str1 + ", r91, r92" + Chr(10);
-                out += "num_to_char r92, r93" + Chr(10);
-                out += "add_str __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, r93" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp __HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + Chr(10);
-                out += "__HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + ":" + Chr(10);
-                out += "file.delete __HTLL_HTLL_HTLL_HTLL_IO_BUFFER" + Chr(10);
-                HTLL_fix_int++;
-            } else {
-                out += "mov rdi, " + str1 + Chr(10) + "call array_pack_to_bytes" + Chr(10);
-                out += "mov [filename_ptr], rax" + Chr(10) + "mov [filename_ptr_size], rdx" + Chr(10);
-                out += "mov rdi, [filename_ptr]" + Chr(10) + "call filedelete_from_ptr" + Chr(10);
-                out += "mov rdi, [filename_ptr]" + Chr(10) + "mov rsi, [filename_ptr_size]" + Chr(10) + "call free_packed_string" + Chr(10);
-            }
-        }
-        else if (SubStr(StrLower(A_LoopField69), 1, 9) == "fileread ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 9));
-            str2 = Trim(StrSplit(str1, ",", 1));
-            str3 = Trim(StrSplit(str1, ",", 2));
-            dot_data_print_temp_strings_count++;
-            path_label = "FILE_PATH_" + STR(dot_data_print_temp_strings_count);
-            if (is_arm == 1) {
-                dot_data_print_temp_strings += path_label + ": .string " + str3 + Chr(10);
-                out += "    ldr x0, =" + str2 + Chr(10);
-                out += "    ldr x1, =" + path_label + Chr(10);
-                out += "    bl file_read" + Chr(10);
+            else if (SubStr(str2, 1, 1) == "'") {
+                out += "    mov x1, #" + str2 + Chr(10);
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // Oryx: file.read dest, "file.txt"
-                out += "file.read " + str2 + ", " + str3 + Chr(10);
+            else if (str2 == "rax") {
+                out += "    mov x1, x0" + Chr(10);
+            }
+            else if (str2 == "A_Index") {
+                out += "    mov x1, x20" + Chr(10);
             } else {
-                dot_data_print_temp_strings += path_label + " db " + str3 + ", 0" + Chr(10);
-                out += "mov rdi, " + str2 + Chr(10) + "mov rsi, " + path_label + Chr(10) + "call file_read" + Chr(10);
+                int isStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str2)) {
+                    isStackVar = 1;
+                }
+                if (isStackVar == 1) {
+                    out += "    ldr x1, =" + str2 + Chr(10);
+                } else {
+                    out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x1, [x9]" + Chr(10);
+                }
             }
+            out += "    bl array_append" + Chr(10);
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 11) == "fileappend ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 11));
-            str2 = Trim(StrSplit(str1, ",", 1));
-            str3 = Trim(StrSplit(str1, ",", 2));
-            dot_data_print_temp_strings_count++;
-            path_label = "FILE_PATH_" + STR(dot_data_print_temp_strings_count);
-            if (is_arm == 1) {
-                dot_data_print_temp_strings += path_label + ": .string " + str2 + Chr(10);
-                out += "    ldr x0, =" + path_label + Chr(10);
-                out += "    ldr x1, =" + str3 + Chr(10);
-                out += "    bl file_append" + Chr(10);
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR (arr.add) ---
+            strVal = str2;
+            if (str2 == "rax") {
+                strVal = "r0";
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "file.append " + str2 + ", " + str3 + Chr(10);
+            else if (str2 == "A_Index") {
+                strVal = "r20";
+            }
+            else if (SubStr(str2, 1, 1) == "'") {
+                // Character literal 'A' -> "A" for Oryx
+                strVal = Chr(34) + SubStr(str2, 2, 1) + Chr(34);
+            }
+            out += "arr.add " + str1 + ", " + strVal + Chr(10);
+        } else {
+            if (RegExMatch(str2, "^\\d+$")) {
+                str3 = "mov rsi, " + str2 + Chr(10) + "mov rdi, " + str1 + Chr(10);
             } else {
-                dot_data_print_temp_strings += path_label + " db " + str2 + ", 0" + Chr(10);
-                out += "mov rdi, " + path_label + Chr(10) + "mov rsi, " + str3 + Chr(10) + "call file_append" + Chr(10);
+                str3 = "mov rsi, [" + str2 + "]" + Chr(10) + "mov rdi, " + str1 + Chr(10);
             }
+            out += str3 + Chr(10) + "call array_append" + Chr(10);
         }
-        else if (SubStr(StrLower(A_LoopField69), 1, 11) == "filedelete ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 11));
-            dot_data_print_temp_strings_count++;
-            path_label = "FILE_PATH_" + STR(dot_data_print_temp_strings_count);
-            if (is_arm == 1) {
-                dot_data_print_temp_strings += path_label + ": .string " + str1 + Chr(10);
-                out += "    ldr x0, =" + path_label + Chr(10);
-                out += "    bl file_delete" + Chr(10);
+    };
+    stmtHandlers[HTLL_STMT_ARR_POP] = [&]() {
+        str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        if (is_arm == 1) {
+            out += "    ldr x0, =" + str1 + Chr(10);
+            out += "    bl array_pop" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // Oryx doesn't have explicit .pop in your spec, but let's assume it does or map it
+            // If not, we skip or use a custom VM call. Assuming arr.pop exists:
+            out += "arr.pop " + str1 + Chr(10);
+        } else {
+            out += "mov rdi, " + str1 + Chr(10) + "call array_pop" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_ARR_CLEAR] = [&]() {
+        str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        if (is_arm == 1) {
+            out += "    ldr x0, =" + str1 + Chr(10);
+            out += "    bl array_clear" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "arr.clear " + str1 + Chr(10);
+        } else {
+            out += "mov rdi, " + str1 + Chr(10) + "call array_clear" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_ARR_COPY] = [&]() {
+        str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        str2 = Trim(StrSplit(A_LoopField69, ".copy", 2));
+        if (is_arm == 1) {
+            out += "    ldr x0, =" + str1 + Chr(10);
+            out += "    ldr x1, =" + str2 + Chr(10);
+            out += "    bl array_copy" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "arr.copy " + str2 + ", " + str1 + Chr(10);
+        } else {
+            out += "mov rdi, " + str1 + Chr(10) + "mov rsi, " + str2 + Chr(10) + "call array_copy" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_ARR_BORROW] = [&]() {
+        // param.borrow src: the parameter takes over src's pointer, size and capacity.
+        str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        str2 = Trim(StrSplit(A_LoopField69, ".borrow", 2));
+        if (is_arm == 1) {
+            out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x10, =" + str1 + Chr(10);
+            out += "    ldr x11, [x9, #DynamicArray_pointer]" + Chr(10) + "    str x11, [x10, #DynamicArray_pointer]" + Chr(10);
+            out += "    ldr x11, [x9, #DynamicArray_size]" + Chr(10) + "    str x11, [x10, #DynamicArray_size]" + Chr(10);
+            out += "    ldr x11, [x9, #DynamicArray_capacity]" + Chr(10) + "    str x11, [x10, #DynamicArray_capacity]" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "arr.copy " + str2 + ", " + str1 + Chr(10);
+        } else {
+            out += "mov rax, [" + str2 + " + DynamicArray.pointer]" + Chr(10) + "mov [" + str1 + " + DynamicArray.pointer], rax" + Chr(10);
+            out += "mov rax, [" + str2 + " + DynamicArray.size]" + Chr(10) + "mov [" + str1 + " + DynamicArray.size], rax" + Chr(10);
+            out += "mov rax, [" + str2 + " + DynamicArray.capacity]" + Chr(10) + "mov [" + str1 + " + DynamicArray.capacity], rax" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_ARR_SWAP] = [&]() {
+        // dst.swap src: exchanges the pointer, size and capacity of the two arrays, which moves
+        // a returned array into dst and leaves dst's old buffer for the next return to reuse.
+        str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        str2 = Trim(StrSplit(A_LoopField69, ".swap", 2));
+        if (is_arm == 1) {
+            out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x10, =" + str1 + Chr(10);
+            out += "    ldp x11, x12, [x9]" + Chr(10) + "    ldp x13, x14, [x10]" + Chr(10);
+            out += "    stp x13, x14, [x9]" + Chr(10) + "    stp x11, x12, [x10]" + Chr(10);
+            out += "    ldr x11, [x9, #DynamicArray_capacity]" + Chr(10) + "    ldr x13, [x10, #DynamicArray_capacity]" + Chr(10);
+            out += "    str x13, [x9, #DynamicArray_capacity]" + Chr(10) + "    str x11, [x10, #DynamicArray_capacity]" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "arr.copy " + str2 + ", " + str1 + Chr(10);
+        } else {
+            out += "mov rax, [" + str1 + " + DynamicArray.pointer]" + Chr(10) + "mov rcx, [" + str2 + " + DynamicArray.pointer]" + Chr(10);
+            out += "mov [" + str1 + " + DynamicArray.pointer], rcx" + Chr(10) + "mov [" + str2 + " + DynamicArray.pointer], rax" + Chr(10);
+            out += "mov rax, [" + str1 + " + DynamicArray.size]" + Chr(10) + "mov rcx, [" + str2 + " + DynamicArray.size]" + Chr(10);
+            out += "mov [" + str1 + " + DynamicArray.size], rcx" + Chr(10) + "mov [" + str2 + " + DynamicArray.size], rax" + Chr(10);
+            out += "mov rax, [" + str1 + " + DynamicArray.capacity]" + Chr(10) + "mov rcx, [" + str2 + " + DynamicArray.capacity]" + Chr(10);
+            out += "mov [" + str1 + " + DynamicArray.capacity], rcx" + Chr(10) + "mov [" + str2 + " + DynamicArray.capacity], rax" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_ARR_RESERVE] = [&]() {
+        // arr.reserve n: grows the capacity to at least n elements up front, so the appends
+        // that follow never resize. Oryx arrays manage their own storage.
+        str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        str2 = Trim(StrSplit(A_LoopField69, ".reserve", 2));
+        if (is_arm == 1) {
+            if (RegExMatch(str2, "^\\d+$")) {
+                out += "    ldr x1, =" + str2 + Chr(10);
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "file.delete " + str1 + Chr(10);
+            else if (str2 == "rax") {
+                out += "    mov x1, x0" + Chr(10);
+            }
+            else if (str2 == "A_Index") {
+                out += "    mov x1, x20" + Chr(10);
+            }
+            else if (inFunc == 1 && HTLL_isFuncParam(str2)) {
+                out += "    ldr x1, =" + str2 + Chr(10);
             } else {
-                dot_data_print_temp_strings += path_label + " db " + str1 + ", 0" + Chr(10);
-                out += "mov rdi, " + path_label + Chr(10) + "call file_delete" + Chr(10);
+                out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x1, [x9]" + Chr(10);
             }
+            out += "    ldr x0, =" + str1 + Chr(10);
+            out += "    bl array_reserve" + Chr(10);
         }
-        else if (SubStr(A_LoopField69, 1, 6) == "input ") {
-            str1 = Trim(StringTrimLeft(A_LoopField69, 6));
-            str2 = Trim(StrSplit(str1, ",", 1));
-            str3 = Trim(StrSplit(str1, ",", 2));
-            if (is_arm == 1) {
-                out += "    ldr x0, =" + str2 + Chr(10);
-                out += "    ldr x1, =" + str3 + Chr(10);
-                out += "    bl get_user_input" + Chr(10);
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+        } else {
+            if (RegExMatch(str2, "^\\d+$")) {
+                out += "mov rsi, " + str2 + Chr(10);
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "; --- INLINE CONVERT " + str3 + " ---" + Chr(10);
-                out += "arr.size " + str3 + ", r90" + Chr(10);
-                out += "mov __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, " + Chr(34) + Chr(34) + Chr(10);
-                out += "mov r91, 0" + Chr(10);
-                out += "__HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + ":" + Chr(10);
-                out += "cmp r91, r90" + Chr(10);
-                out += "jge __HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + Chr(10);
-                out += "arr.get " + str3 + ", r91, r92" + Chr(10);
-                out += "num_to_char r92, r93" + Chr(10);
-                out += "add_str __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, r93" + Chr(10);
-                out += "inc r91" + Chr(10);
-                out += "jmp __HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + Chr(10);
-                out += "__HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + ":" + Chr(10);
-                out += "input " + str2 + ", __HTLL_HTLL_HTLL_HTLL_IO_BUFFER" + Chr(10);
-                HTLL_fix_int++;
+            else if (str2 == "rax") {
+                out += "mov rsi, rax" + Chr(10);
             } else {
-                out += "mov rdi, " + str2 + Chr(10) + "mov rsi, " + str3 + Chr(10) + "call get_user_input" + Chr(10);
+                out += "mov rsi, [" + str2 + "]" + Chr(10);
             }
+            out += "mov rdi, " + str1 + Chr(10) + "call array_reserve" + Chr(10);
         }
-        else if (InStr(A_LoopField69, ".set ")) {
-            str1 = Trim(StrSplit(A_LoopField69, ".", 1));
-            str2 = Trim(StringTrimLeft(A_LoopField69, StrLen(str1) + 5));
-            str_index = Trim(StrSplit(str2, ",", 1));
-            str_value = Trim(StrSplit(str2, ",", 2));
-            if (is_arm == 1) {
-                // 1. Load Array Pointer into x9
-                out += "    ldr x9, =" + str1 + Chr(10);
-                out += "    ldr x9, [x9, #DynamicArray_pointer]" + Chr(10);
-                // 2. Load INDEX into x10
-                if (str_index == "A_Index") {
-                    out += "    mov x10, x20" + Chr(10);
-                }
-                else if (str_index == "rax") {
-                    out += "    mov x10, x0" + Chr(10);
+    };
+    stmtHandlers[HTLL_STMT_ARR_SIZE] = [&]() {
+        str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        if (is_arm == 1) {
+            out += "    ldr x9, =" + str1 + Chr(10);
+            out += "    ldr x0, [x9, #DynamicArray_size]" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // arr.size <array>, <dest_reg>
+            out += "arr.size " + str1 + ", r0" + Chr(10);
+        } else {
+            out += "mov rax, [" + str1 + " + DynamicArray.size]" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_ARR_INDEX] = [&]() {
+        str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        str2 = Trim(StrSplit(A_LoopField69, ".index", 2));
+        if (is_arm == 1) {
+            if (RegExMatch(str2, "^\\d+$")) {
+                out += "    mov x10, #" + str2 + Chr(10);
+            }
+            else if (str2 == "A_Index") {
+                out += "    mov x10, x20" + Chr(10);
+            }
+            else if (str2 == "rax") {
+                out += "    mov x10, x0" + Chr(10);
+            } else {
+                int isStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str2)) {
+                    isStackVar = 1;
                 }
-                else if (RegExMatch(str_index, "^\\d+$")) {
-                    out += "    mov x10, #" + str_index + Chr(10);
+                if (isStackVar == 1) {
+                    out += "    ldr x10, =" + str2 + Chr(10);
                 } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index205 = 0; A_Index205 < HTVM_Size(funcArgsArr); A_Index205++) {
-                            if (Trim(funcArgsArr[A_Index205]) == str_index) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x10, =" + str_index + Chr(10);
-                    } else {
-                        out += "    ldr x11, =" + str_index + Chr(10);
-                        out += "    ldr x10, [x11]" + Chr(10);
-                    }
-                }
-                // 3. Load VALUE into x11
-                if (str_value == "A_Index") {
-                    out += "    mov x11, x20" + Chr(10);
+                    out += "    ldr x9, =" + str2 + Chr(10) + "    ldr x10, [x9]" + Chr(10);
                 }
-                else if (str_value == "rax") {
-                    out += "    mov x11, x0" + Chr(10);
+            }
+            out += "    ldr x9, =" + str1 + Chr(10);
+            out += "    ldr x9, [x9, #DynamicArray_pointer]" + Chr(10);
+            out += "    ldr x0, [x9, x10, lsl #3]" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // arr.get <array>, <index_src>, <dest_reg>
+            strIndex = str2;
+            if (str2 == "rax") {
+                strIndex = "r0";
+            }
+            else if (str2 == "A_Index") {
+                strIndex = "r20";
+            }
+            // If index is a variable, Oryx handles it.
+            // If it's a raw number, Oryx handles it.
+            out += "arr.get " + str1 + ", " + strIndex + ", r0" + Chr(10);
+        } else {
+            if (RegExMatch(str2, "^\\d+$")) {
+                str3 = "mov rcx, " + str2 + Chr(10);
+            } else {
+                str3 = "mov rcx, [" + str2 + "]" + Chr(10);
+            }
+            out += str3 + Chr(10) + "mov rbx, [" + str1 + " + DynamicArray.pointer]" + Chr(10) + "mov rax, [rbx + rcx*8]" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_ARR_COMPILE] = [&]() {
+        // arrName.compile outArr
+        str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        str2 = Trim(StrSplit(A_LoopField69, ".compile", 2));
+        isDotCompile = 1;
+        out += "mov rdi, " + str1 + Chr(10) + "call array_pack_to_bytes" + Chr(10) + "mov [source_ptr], rax" + Chr(10) + "mov rdi, [source_ptr]" + Chr(10) + "call compiler_c" + Chr(10) + "mov [asm_code_ptr], rax" + Chr(10) + "mov rdi, " + str2 + Chr(10) + "mov rsi, [asm_code_ptr]" + Chr(10) + "call array_unpack_from_bytes" + Chr(10) + "mov rdi, [source_ptr]" + Chr(10) + "mov rsi, [source_ptr_size]" + Chr(10) + "call free_packed_string" + Chr(10) + "mov rdi, [asm_code_ptr]" + Chr(10) + "call free_string_c" + Chr(10);
+    };
+    stmtHandlers[HTLL_STMT_GOTO] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 5));
+        if (is_arm == 1) {
+            out += "    b .__HTLL_HTLL_" + str1 + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "jmp __HTLL_HTLL_" + str1 + Chr(10);
+        } else {
+            out += "jmp .__HTLL_HTLL_" + str1 + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_TOGO] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 5));
+        if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "__HTLL_HTLL_" + str1 + ":" + Chr(10);
+        } else {
+            out += ".__HTLL_HTLL_" + str1 + ":" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_SLEEP] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 7));
+        if (is_arm == 1) {
+            if (RegExMatch(str1, "^\\d+$")) {
+                out += "    mov x0, #" + str1 + Chr(10);
+            }
+            else if (str1 == "A_Index") {
+                out += "    mov x0, x20" + Chr(10);
+            } else {
+                int isStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str1)) {
+                    isStackVar = 1;
                 }
-                else if (RegExMatch(str_value, "^\\d+$")) {
-                    out += "    mov x11, #" + str_value + Chr(10);
+                if (isStackVar == 1) {
+                    out += "    ldr x0, =" + str1 + Chr(10);
                 } else {
-                    int isStackVar = 0;
-                    if (inFunc == 1) {
-                        for (int A_Index206 = 0; A_Index206 < HTVM_Size(funcArgsArr); A_Index206++) {
-                            if (Trim(funcArgsArr[A_Index206]) == str_value) {
-                                isStackVar = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (isStackVar == 1) {
-                        out += "    ldr x11, =" + str_value + Chr(10);
-                    } else {
-                        out += "    ldr x12, =" + str_value + Chr(10);
-                        out += "    ldr x11, [x12]" + Chr(10);
-                    }
+                    out += "    ldr x9, =" + str1 + Chr(10) + "    ldr x0, [x9]" + Chr(10);
                 }
-                // 4. Store x11 into Array[x10]
-                out += "    str x11, [x9, x10, lsl #3]" + Chr(10);
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // arr.set array, index, value
-                // Resolve Index
-                idxSrc = str_index;
-                if (str_index == "rax") {
-                    idxSrc = "r0";
-                }
-                else if (str_index == "A_Index") {
-                    idxSrc = "r20";
-                }
-                // Resolve Value
-                valSrc = str_value;
-                if (str_value == "rax") {
-                    valSrc = "r0";
+            out += "    bl sleep_ms" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            if (RegExMatch(str1, "^\\d+$")) {
+                out += "mov r1, " + str1 + Chr(10);
+            }
+            else if (str1 == "rax") {
+                out += "mov r1, r0" + Chr(10);
+            }
+            else if (str1 == "A_Index") {
+                out += "mov r1, r20" + Chr(10);
+            } else {
+                out += "mov r1, " + str1 + Chr(10);
+            }
+            out += "call sleep" + Chr(10);
+        } else {
+            if (RegExMatch(str1, "^\\d+$")) {
+                out += "mov rdi, " + str1 + Chr(10);
+            }
+            else if (str1 == "rax") {
+                out += "mov rdi, rax" + Chr(10);
+            }
+            else if (str1 == "A_Index") {
+                out += "mov rdi, r13" + Chr(10);
+            } else {
+                out += "mov rdi, [" + str1 + "]" + Chr(10);
+            }
+            out += "call sleep_ms" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_FILEREAD_ARR] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 13));
+        str2 = Trim(StrSplit(str1, ",", 1));
+        str3 = Trim(StrSplit(str1, ",", 2));
+        if (is_arm == 1) {
+            out += "    ldr x0, =" + str3 + Chr(10) + "    bl array_pack_to_bytes" + Chr(10);
+            out += "    ldr x9, =filename_ptr" + Chr(10) + "    str x0, [x9]" + Chr(10);
+            out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    str x1, [x9]" + Chr(10);
+            out += "    ldr x0, =" + str2 + Chr(10);
+            out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x1, [x9]" + Chr(10);
+            out += "    bl fileread_from_ptr" + Chr(10);
+            out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x0, [x9]" + Chr(10);
+            out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    ldr x1, [x9]" + Chr(10);
+            out += "    bl free_packed_string" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "; --- INLINE CONVERT " + str3 + " ---" + Chr(10);
+            out += "arr.size " + str3 + ", r90" + Chr(10);
+            out += "mov __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, " + Chr(34) + Chr(34) + Chr(10);
+            out += "mov r91, 0" + Chr(10);
+            out += "__HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + ":" + Chr(10);
+            out += "cmp r91, r90" + Chr(10);
+            out += "jge __HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + Chr(10);
+            out += "arr.get " + str3 + ", r91, r92" + Chr(10);
+            out += "num_to_char r92, r93" + Chr(10);
+            out += "add_str __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, r93" + Chr(10);
+            out += "inc r91" + Chr(10);
+            out += "jmp __HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + Chr(10);
+            out += "__HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + ":" + Chr(10);
+            out += "file.read " + str2 + ", __HTLL_HTLL_HTLL_HTLL_IO_BUFFER" + Chr(10);
+            HTLL_fix_int++;
+        } else {
+            out += "mov rdi, " + str3 + Chr(10) + "call array_pack_to_bytes" + Chr(10);
+            out += "mov [filename_ptr], rax" + Chr(10) + "mov [filename_ptr_size], rdx" + Chr(10);
+            out += "mov rdi, " + str2 + Chr(10) + "mov rsi, [filename_ptr]" + Chr(10) + "call fileread_from_ptr" + Chr(10);
+            out += "mov rdi, [filename_ptr]" + Chr(10) + "mov rsi, [filename_ptr_size]" + Chr(10) + "call free_packed_string" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_FILEAPPEND_ARR] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 15));
+        str2 = Trim(StrSplit(str1, ",", 1));
+        str3 = Trim(StrSplit(str1, ",", 2));
+        if (is_arm == 1) {
+            out += "    ldr x0, =" + str2 + Chr(10) + "    bl array_pack_to_bytes" + Chr(10);
+            out += "    ldr x9, =filename_ptr" + Chr(10) + "    str x0, [x9]" + Chr(10);
+            out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    str x1, [x9]" + Chr(10);
+            out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x0, [x9]" + Chr(10);
+            out += "    ldr x1, =" + str3 + Chr(10);
+            out += "    bl fileappend_from_ptr" + Chr(10);
+            out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x0, [x9]" + Chr(10);
+            out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    ldr x1, [x9]" + Chr(10);
+            out += "    bl free_packed_string" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- INLINE CONVERT FILENAME (str2) ---
+            out += "; --- INLINE CONVERT " + str2 + " ---" + Chr(10);
+            out += "arr.size " + str2 + ", r90" + Chr(10);
+            out += "mov __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, " + Chr(34) + Chr(34) + Chr(10);
+            out += "mov r91, 0" + Chr(10);
+            out += "__HTLL_HTLL_inline_convA" + STR(HTLL_fix_int) + ":" + Chr(10);
+            out += "cmp r91, r90" + Chr(10);
+            out += "jge __HTLL_HTLL_inline_convA_end" + STR(HTLL_fix_int) + Chr(10);
+            out += "arr.get " + str2 + ", r91, r92" + Chr(10);
+            out += "num_to_char r92, r93" + Chr(10);
+            out += "add_str __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, r93" + Chr(10);
+            out += "inc r91" + Chr(10);
+            out += "jmp __HTLL_HTLL_inline_convA" + STR(HTLL_fix_int) + Chr(10);
+            out += "__HTLL_HTLL_inline_convA_end" + STR(HTLL_fix_int) + ":" + Chr(10);
+            // --- INLINE CONVERT CONTENT (str3) ---
+            out += "; --- INLINE CONVERT " + str3 + " ---" + Chr(10);
+            out += "arr.size " + str3 + ", r90" + Chr(10);
+            out += "mov __HTLL_HTLL_HTLL_HTLL_CONTENT_BUFFER, " + Chr(34) + Chr(34) + Chr(10);
+            out += "mov r91, 0" + Chr(10);
+            out += "__HTLL_HTLL_inline_convB" + STR(HTLL_fix_int) + ":" + Chr(10);
+            out += "cmp r91, r90" + Chr(10);
+            out += "jge __HTLL_HTLL_inline_convB_end" + STR(HTLL_fix_int) + Chr(10);
+            out += "arr.get " + str3 + ", r91, r92" + Chr(10);
+            out += "num_to_char r92, r93" + Chr(10);
+            out += "add_str __HTLL_HTLL_HTLL_HTLL_CONTENT_BUFFER, r93" + Chr(10);
+            out += "inc r91" + Chr(10);
+            out += "jmp __HTLL_HTLL_inline_convB" + STR(HTLL_fix_int) + Chr(10);
+            out += "__HTLL_HTLL_inline_convB_end" + STR(HTLL_fix_int) + ":" + Chr(10);
+            out += "file.append __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, __HTLL_HTLL_HTLL_HTLL_CONTENT_BUFFER" + Chr(10);
+            HTLL_fix_int++;
+        } else {
+            out += "mov rdi, " + str2 + Chr(10) + "call array_pack_to_bytes" + Chr(10);
+            out += "mov [filename_ptr], rax" + Chr(10) + "mov [filename_ptr_size], rdx" + Chr(10);
+            out += "mov rdi, [filename_ptr]" + Chr(10) + "mov rsi, " + str3 + Chr(10) + "call fileappend_from_ptr" + Chr(10);
+            out += "mov rdi, [filename_ptr]" + Chr(10) + "mov rsi, [filename_ptr_size]" + Chr(10) + "call free_packed_string" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_FILEDELETE_ARR] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 15));
+        if (is_arm == 1) {
+            out += "    ldr x0, =" + str1 + Chr(10) + "    bl array_pack_to_bytes" + Chr(10);
+            out += "    ldr x9, =filename_ptr" + Chr(10) + "    str x0, [x9]" + Chr(10);
+            out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    str x1, [x9]" + Chr(10);
+            out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x0, [x9]" + Chr(10);
+            out += "    bl filedelete_from_ptr" + Chr(10);
+            out += "    ldr x9, =filename_ptr" + Chr(10) + "    ldr x0, [x9]" + Chr(10);
+            out += "    ldr x9, =filename_ptr_size" + Chr(10) + "    ldr x1, [x9]" + Chr(10);
+            out += "    bl free_packed_string" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "; --- INLINE CONVERT " + str1 + " ---" + Chr(10);
+            out += "arr.size " + str1 + ", r90" + Chr(10);
+            out += "mov __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, " + Chr(34) + Chr(34) + Chr(10);
+            out += "mov r91, 0" + Chr(10);
+            out += "__HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + ":" + Chr(10);
+            out += "cmp r91, r90" + Chr(10);
+            out += "jge __HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + Chr(10);
+            out += "arr.get " + str1 + ", r91, r92" + Chr(10);
+            out += "num_to_char r92, r93" + Chr(10);
+            out += "add_str __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, r93" + Chr(10);
+            out += "inc r91" + Chr(10);
+            out += "jmp __HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + Chr(10);
+            out += "__HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + ":" + Chr(10);
+            out += "file.delete __HTLL_HTLL_HTLL_HTLL_IO_BUFFER" + Chr(10);
+            HTLL_fix_int++;
+        } else {
+            out += "mov rdi, " + str1 + Chr(10) + "call array_pack_to_bytes" + Chr(10);
+            out += "mov [filename_ptr], rax" + Chr(10) + "mov [filename_ptr_size], rdx" + Chr(10);
+            out += "mov rdi, [filename_ptr]" + Chr(10) + "call filedelete_from_ptr" + Chr(10);
+            out += "mov rdi, [filename_ptr]" + Chr(10) + "mov rsi, [filename_ptr_size]" + Chr(10) + "call free_packed_string" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_FILEREAD] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 9));
+        str2 = Trim(StrSplit(str1, ",", 1));
+        str3 = Trim(StrSplit(str1, ",", 2));
+        dot_data_print_temp_strings_count++;
+        path_label = "FILE_PATH_" + STR(dot_data_print_temp_strings_count);
+        if (is_arm == 1) {
+            dot_data_print_temp_strings += path_label + ": .string " + str3 + Chr(10);
+            out += "    ldr x0, =" + str2 + Chr(10);
+            out += "    ldr x1, =" + path_label + Chr(10);
+            out += "    bl file_read" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // Oryx: file.read dest, "file.txt"
+            out += "file.read " + str2 + ", " + str3 + Chr(10);
+        } else {
+            dot_data_print_temp_strings += path_label + " db " + str3 + ", 0" + Chr(10);
+            out += "mov rdi, " + str2 + Chr(10) + "mov rsi, " + path_label + Chr(10) + "call file_read" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_FILEAPPEND] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 11));
+        str2 = Trim(StrSplit(str1, ",", 1));
+        str3 = Trim(StrSplit(str1, ",", 2));
+        dot_data_print_temp_strings_count++;
+        path_label = "FILE_PATH_" + STR(dot_data_print_temp_strings_count);
+        if (is_arm == 1) {
+            dot_data_print_temp_strings += path_label + ": .string " + str2 + Chr(10);
+            out += "    ldr x0, =" + path_label + Chr(10);
+            out += "    ldr x1, =" + str3 + Chr(10);
+            out += "    bl file_append" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "file.append " + str2 + ", " + str3 + Chr(10);
+        } else {
+            dot_data_print_temp_strings += path_label + " db " + str2 + ", 0" + Chr(10);
+            out += "mov rdi, " + path_label + Chr(10) + "mov rsi, " + str3 + Chr(10) + "call file_append" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_FILEDELETE] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 11));
+        dot_data_print_temp_strings_count++;
+        path_label = "FILE_PATH_" + STR(dot_data_print_temp_strings_count);
+        if (is_arm == 1) {
+            dot_data_print_temp_strings += path_label + ": .string " + str1 + Chr(10);
+            out += "    ldr x0, =" + path_label + Chr(10);
+            out += "    bl file_delete" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "file.delete " + str1 + Chr(10);
+        } else {
+            dot_data_print_temp_strings += path_label + " db " + str1 + ", 0" + Chr(10);
+            out += "mov rdi, " + path_label + Chr(10) + "call file_delete" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_INPUT] = [&]() {
+        str1 = Trim(StringTrimLeft(A_LoopField69, 6));
+        str2 = Trim(StrSplit(str1, ",", 1));
+        str3 = Trim(StrSplit(str1, ",", 2));
+        if (is_arm == 1) {
+            out += "    ldr x0, =" + str2 + Chr(10);
+            out += "    ldr x1, =" + str3 + Chr(10);
+            out += "    bl get_user_input" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "; --- INLINE CONVERT " + str3 + " ---" + Chr(10);
+            out += "arr.size " + str3 + ", r90" + Chr(10);
+            out += "mov __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, " + Chr(34) + Chr(34) + Chr(10);
+            out += "mov r91, 0" + Chr(10);
+            out += "__HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + ":" + Chr(10);
+            out += "cmp r91, r90" + Chr(10);
+            out += "jge __HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + Chr(10);
+            out += "arr.get " + str3 + ", r91, r92" + Chr(10);
+            out += "num_to_char r92, r93" + Chr(10);
+            out += "add_str __HTLL_HTLL_HTLL_HTLL_IO_BUFFER, r93" + Chr(10);
+            out += "inc r91" + Chr(10);
+            out += "jmp __HTLL_HTLL_inline_conv" + STR(HTLL_fix_int) + Chr(10);
+            out += "__HTLL_HTLL_inline_conv_end" + STR(HTLL_fix_int) + ":" + Chr(10);
+            out += "input " + str2 + ", __HTLL_HTLL_HTLL_HTLL_IO_BUFFER" + Chr(10);
+            HTLL_fix_int++;
+        } else {
+            out += "mov rdi, " + str2 + Chr(10) + "mov rsi, " + str3 + Chr(10) + "call get_user_input" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_ARR_SET] = [&]() {
+        str1 = Trim(StrSplit(A_LoopField69, ".", 1));
+        str2 = Trim(StringTrimLeft(A_LoopField69, StrLen(str1) + 5));
+        str_index = Trim(StrSplit(str2, ",", 1));
+        str_value = Trim(StrSplit(str2, ",", 2));
+        if (is_arm == 1) {
+            // 1. Load Array Pointer into x9
+            out += "    ldr x9, =" + str1 + Chr(10);
+            out += "    ldr x9, [x9, #DynamicArray_pointer]" + Chr(10);
+            // 2. Load INDEX into x10
+            if (str_index == "A_Index") {
+                out += "    mov x10, x20" + Chr(10);
+            }
+            else if (str_index == "rax") {
+                out += "    mov x10, x0" + Chr(10);
+            }
+            else if (RegExMatch(str_index, "^\\d+$")) {
+                out += "    mov x10, #" + str_index + Chr(10);
+            } else {
+                int isStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str_index)) {
+                    isStackVar = 1;
                 }
-                else if (str_value == "A_Index") {
-                    valSrc = "r20";
+                if (isStackVar == 1) {
+                    out += "    ldr x10, =" + str_index + Chr(10);
+                } else {
+                    out += "    ldr x11, =" + str_index + Chr(10);
+                    out += "    ldr x10, [x11]" + Chr(10);
                 }
-                out += "arr.set " + str1 + ", " + idxSrc + ", " + valSrc + Chr(10);
+            }
+            // 3. Load VALUE into x11
+            if (str_value == "A_Index") {
+                out += "    mov x11, x20" + Chr(10);
+            }
+            else if (str_value == "rax") {
+                out += "    mov x11, x0" + Chr(10);
+            }
+            else if (RegExMatch(str_value, "^\\d+$")) {
+                out += "    mov x11, #" + str_value + Chr(10);
             } else {
-                // --- EXISTING x86 CODE (Unchanged) ---
-                out += "mov rbx, [" + str1 + " + DynamicArray.pointer]" + Chr(10);
-                if (RegExMatch(str_index, "^\\d+$")) {
-                    out += "mov rcx, " + str_index + Chr(10);
-                } else {
-                    out += "mov rcx, [" + str_index + "]" + Chr(10);
+                int isStackVar = 0;
+                if (inFunc == 1 && HTLL_isFuncParam(str_value)) {
+                    isStackVar = 1;
                 }
-                if (RegExMatch(str_value, "^\\d+$")) {
-                    out += "mov rsi, " + str_value + Chr(10);
+                if (isStackVar == 1) {
+                    out += "    ldr x11, =" + str_value + Chr(10);
                 } else {
-                    out += "mov rsi, [" + str_value + "]" + Chr(10);
+                    out += "    ldr x12, =" + str_value + Chr(10);
+                    out += "    ldr x11, [x12]" + Chr(10);
                 }
-                out += "mov [rbx + rcx*8], rsi" + Chr(10);
             }
+            // 4. Store x11 into Array[x10]
+            out += "    str x11, [x9, x10, lsl #3]" + Chr(10);
         }
-        else if (Trim(A_LoopField69) == "rax++") {
-            if (is_arm == 1) {
-                out += "    add x0, x0, #1" + Chr(10);
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // arr.set array, index, value
+            // Resolve Index
+            idxSrc = str_index;
+            if (str_index == "rax") {
+                idxSrc = "r0";
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "inc r0" + Chr(10);
-            } else {
-                out += "inc rax" + Chr(10);
+            else if (str_index == "A_Index") {
+                idxSrc = "r20";
             }
-        }
-        else if (Trim(A_LoopField69) == "rax--") {
-            if (is_arm == 1) {
-                out += "    sub x0, x0, #1" + Chr(10);
+            // Resolve Value
+            valSrc = str_value;
+            if (str_value == "rax") {
+                valSrc = "r0";
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                out += "dec r0" + Chr(10);
-            } else {
-                out += "dec rax" + Chr(10);
+            else if (str_value == "A_Index") {
+                valSrc = "r20";
             }
-        }
-        else if (SubStrLastChars(Trim(A_LoopField69), 1) == ")") {
-            // --- YOUR PARSING LOGIC IS UNCHANGED ---
-            str1 = StringTrimRight(Trim(A_LoopField69), 1);
-            str2 = StrSplit(str1, "(", 1);
-            std::vector<std::string> items207 = LoopParseFunc(str2, " ");
-            for (size_t A_Index207 = 0; A_Index207 < items207.size(); A_Index207++) {
-                std::string A_LoopField207 = items207[A_Index207 - 0];
-                str3 = A_LoopField207;
+            out += "arr.set " + str1 + ", " + idxSrc + ", " + valSrc + Chr(10);
+        } else {
+            // --- EXISTING x86 CODE (Unchanged) ---
+            out += "mov rbx, [" + str1 + " + DynamicArray.pointer]" + Chr(10);
+            if (RegExMatch(str_index, "^\\d+$")) {
+                out += "mov rcx, " + str_index + Chr(10);
+            } else {
+                out += "mov rcx, [" + str_index + "]" + Chr(10);
             }
-            str2 = str3;
-            str3 = StrSplit(str1, "(", 2);
-            str4 = "";
-            int5 = 0;
-            int1 = 0;
-            if (Trim(str3) == "") {
-                int1 = 1;
+            if (RegExMatch(str_value, "^\\d+$")) {
+                out += "mov rsi, " + str_value + Chr(10);
+            } else {
+                out += "mov rsi, [" + str_value + "]" + Chr(10);
             }
-            if (is_arm == 1) {
-                // --- AArch64 CODE GENERATION ---
-                int stack_arg_count = 0;
-                if (int1 == 0) {
-                    std::vector<std::string> items208 = LoopParseFunc(str3, ", ");
-                    for (size_t A_Index208 = 0; A_Index208 < items208.size(); A_Index208++) {
-                        std::string A_LoopField208 = items208[A_Index208 - 0];
-                        if (A_Index208 > 8) {
-                            stack_arg_count++;
-                        }
-                    }
-                    if (stack_arg_count > 0) {
-                        str4 += "    sub sp, sp, #" + STR(stack_arg_count * 8) + Chr(10);
+            out += "mov [rbx + rcx*8], rsi" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_RAX_INC] = [&]() {
+        if (is_arm == 1) {
+            out += "    add x0, x0, #1" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "inc r0" + Chr(10);
+        } else {
+            out += "inc rax" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_RAX_DEC] = [&]() {
+        if (is_arm == 1) {
+            out += "    sub x0, x0, #1" + Chr(10);
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            out += "dec r0" + Chr(10);
+        } else {
+            out += "dec rax" + Chr(10);
+        }
+    };
+    stmtHandlers[HTLL_STMT_CALL] = [&]() {
+        // --- YOUR PARSING LOGIC IS UNCHANGED ---
+        str1 = StringTrimRight(Trim(A_LoopField69), 1);
+        str2 = StrSplit(str1, "(", 1);
+        std::vector<std::string> items207 = LoopParseFunc(str2, " ");
+        for (size_t A_Index207 = 0; A_Index207 < items207.size(); A_Index207++) {
+            std::string A_LoopField207 = items207[A_Index207 - 0];
+            str3 = A_LoopField207;
+        }
+        str2 = str3;
+        str3 = StrSplit(str1, "(", 2);
+        str4 = "";
+        int5 = 0;
+        int1 = 0;
+        if (Trim(str3) == "") {
+            int1 = 1;
+        }
+        if (is_arm == 1) {
+            // --- AArch64 CODE GENERATION ---
+            int stack_arg_count = 0;
+            if (int1 == 0) {
+                std::vector<std::string> items208 = LoopParseFunc(str3, ", ");
+                for (size_t A_Index208 = 0; A_Index208 < items208.size(); A_Index208++) {
+                    std::string A_LoopField208 = items208[A_Index208 - 0];
+                    if (A_Index208 > 8) {
+                        stack_arg_count++;
                     }
-                    std::vector<std::string> items209 = LoopParseFunc(str3, ", ");
-                    for (size_t A_Index209 = 0; A_Index209 < items209.size(); A_Index209++) {
-                        std::string A_LoopField209 = items209[A_Index209 - 0];
-                        int current_arg_num = A_Index209;
-                        if (current_arg_num < 8) {
-                            if (RegExMatch(A_LoopField209, "^\\d+$")) {
-                                str4 += "    mov x" + STR(current_arg_num) + ", #" + A_LoopField209 + Chr(10);
-                            }
-                            else if (A_LoopField209 == "rax") {
-                                str4 += "    mov x" + STR(current_arg_num) + ", x0" + Chr(10);
-                            }
-                            else if (A_LoopField209 == "A_Index") {
-                                str4 += "    mov x" + STR(current_arg_num) + ", x20" + Chr(10);
-                            } else {
-                                int isStackVar = 0;
-                                if (inFunc == 1) {
-                                    for (int A_Index210 = 0; A_Index210 < HTVM_Size(funcArgsArr); A_Index210++) {
-                                        if (Trim(funcArgsArr[A_Index210]) == A_LoopField69) {
-                                            isStackVar = 1;
-                                            break;
-                                        }
-                                    }
-                                }
-                                if (isStackVar == 1) {
-                                    str4 += "    ldr x" + STR(current_arg_num) + ", =" + A_LoopField209 + Chr(10);
-                                } else {
-                                    str4 += "    ldr x9, =" + A_LoopField209 + Chr(10) + "    ldr x" + STR(current_arg_num) + ", [x9]" + Chr(10);
-                                }
-                            }
+                }
+                if (stack_arg_count > 0) {
+                    str4 += "    sub sp, sp, #" + STR(stack_arg_count * 8) + Chr(10);
+                }
+                std::vector<std::string> items209 = LoopParseFunc(str3, ", ");
+                for (size_t A_Index209 = 0; A_Index209 < items209.size(); A_Index209++) {
+                    std::string A_LoopField209 = items209[A_Index209 - 0];
+                    int current_arg_num = A_Index209;
+                    if (current_arg_num < 8) {
+                        if (RegExMatch(A_LoopField209, "^\\d+$")) {
+                            str4 += "    mov x" + STR(current_arg_num) + ", #" + A_LoopField209 + Chr(10);
+                        }
+                        else if (A_LoopField209 == "rax") {
+                            str4 += "    mov x" + STR(current_arg_num) + ", x0" + Chr(10);
+                        }
+                        else if (A_LoopField209 == "A_Index") {
+                            str4 += "    mov x" + STR(current_arg_num) + ", x20" + Chr(10);
                         } else {
-                            int stack_offset = (current_arg_num - 8) * 8;
-                            if (RegExMatch(A_LoopField209, "^\\d+$")) {
-                                str4 += "    mov x9, #" + A_LoopField209 + Chr(10);
-                            }
-                            else if (A_LoopField209 == "rax") {
-                                str4 += "    mov x9, x0" + Chr(10);
+                            int isStackVar = 0;
+                            if (inFunc == 1 && HTLL_isFuncParam(A_LoopField69)) {
+                                isStackVar = 1;
                             }
-                            else if (A_LoopField209 == "A_Index") {
-                                str4 += "    mov x9, x20" + Chr(10);
+                            if (isStackVar == 1) {
+                                str4 += "    ldr x" + STR(current_arg_num) + ", =" + A_LoopField209 + Chr(10);
                             } else {
-                                int isStackVar = 0;
-                                if (inFunc == 1) {
-                                    for (int A_Index211 = 0; A_Index211 < HTVM_Size(funcArgsArr); A_Index211++) {
-                                        if (Trim(funcArgsArr[A_Index211]) == A_LoopField209) {
-                                            isStackVar = 1;
-                                            break;
-                                        }
-                                    }
-                                }
-                                if (isStackVar == 1) {
-                                    str4 += "    ldr x9, =" + A_LoopField209 + Chr(10);
-                                } else {
-                                    str4 += "    ldr x10, =" + A_LoopField209 + Chr(10) + "    ldr x9, [x10]" + Chr(10);
-                                }
+                                str4 += "    ldr x9, =" + A_LoopField209 + Chr(10) + "    ldr x" + STR(current_arg_num) + ", [x9]" + Chr(10);
+                            }
+                        }
+                    } else {
+                        int stack_offset = (current_arg_num - 8) * 8;
+                        if (RegExMatch(A_LoopField209, "^\\d+$")) {
+                            str4 += "    mov x9, #" + A_LoopField209 + Chr(10);
+                        }
+                        else if (A_LoopField209 == "rax") {
+                            str4 += "    mov x9, x0" + Chr(10);
+                        }
+                        else if (A_LoopField209 == "A_Index") {
+                            str4 += "    mov x9, x20" + Chr(10);
+                        } else {
+                            int isStackVar = 0;
+                            if (inFunc == 1 && HTLL_isFuncParam(A_LoopField209)) {
+                                isStackVar = 1;
+                            }
+                            if (isStackVar == 1) {
+                                str4 += "    ldr x9, =" + A_LoopField209 + Chr(10);
+                            } else {
+                                str4 += "    ldr x10, =" + A_LoopField209 + Chr(10) + "    ldr x9, [x10]" + Chr(10);
                             }
-                            str4 += "    str x9, [sp, #" + STR(stack_offset) + "]" + Chr(10);
                         }
+                        str4 += "    str x9, [sp, #" + STR(stack_offset) + "]" + Chr(10);
                     }
                 }
-                out += str4 + "    bl " + str2 + Chr(10);
-                if (stack_arg_count > 0) {
-                    out += "    add sp, sp, #" + STR(stack_arg_count * 8) + Chr(10);
-                }
             }
-            else if (is_oryx == 1) {
-                out += "meta " + A_LoopField69 + Chr(10);
-                // --- ORYX IR (Function Call) ---
-                if (int1 == 0) {
-                    std::vector<std::string> items212 = LoopParseFunc(str3, ", ");
-                    for (size_t A_Index212 = 0; A_Index212 < items212.size(); A_Index212++) {
-                        std::string A_LoopField212 = items212[A_Index212 - 0];
-                        // Move each argument to the corresponding register (r1, r2, etc.)
-                        strArg = A_LoopField212;
-                        strSrc = strArg;
-                        if (strArg == "rax") {
-                            strSrc = "r0";
-                        }
-                        else if (strArg == "A_Index") {
-                            strSrc = "r20";
-                        }
-                        out += "mov r" + STR(A_Index212 + 1) + ", " + strSrc + Chr(10);
+            out += str4 + "    bl " + str2 + Chr(10);
+            if (stack_arg_count > 0) {
+                out += "    add sp, sp, #" + STR(stack_arg_count * 8) + Chr(10);
+            }
+        }
+        else if (is_oryx == 1) {
+            out += "meta " + A_LoopField69 + Chr(10);
+            // --- ORYX IR (Function Call) ---
+            if (int1 == 0) {
+                std::vector<std::string> items212 = LoopParseFunc(str3, ", ");
+                for (size_t A_Index212 = 0; A_Index212 < items212.size(); A_Index212++) {
+                    std::string A_LoopField212 = items212[A_Index212 - 0];
+                    // Move each argument to the corresponding register (r1, r2, etc.)
+                    strArg = A_LoopField212;
+                    strSrc = strArg;
+                    if (strArg == "rax") {
+                        strSrc = "r0";
                     }
-                }
-                out += "call " + str2 + Chr(10);
-            } else {
-                // --- YOUR EXISTING X86 CODE - UNCHANGED ---
-                std::vector<std::string> items213 = LoopParseFunc(str3, ", ");
-                for (size_t A_Index213 = 0; A_Index213 < items213.size(); A_Index213++) {
-                    std::string A_LoopField213 = items213[A_Index213 - 0];
-                    if (RegExMatch(A_LoopField213, "^\\d+$")) {
-                        str4 += "push " + A_LoopField213 + Chr(10);
-                    } else {
-                        str4 += "push qword [" + A_LoopField213 + "]" + Chr(10);
+                    else if (strArg == "A_Index") {
+                        strSrc = "r20";
                     }
-                    int5++;
+                    out += "mov r" + STR(A_Index212 + 1) + ", " + strSrc + Chr(10);
                 }
-                if (int1 == 0) {
-                    out += str4 + "call " + str2 + Chr(10) + "add rsp, " + STR(8 * int5) + Chr(10);
+            }
+            out += "call " + str2 + Chr(10);
+        } else {
+            // --- YOUR EXISTING X86 CODE - UNCHANGED ---
+            std::vector<std::string> items213 = LoopParseFunc(str3, ", ");
+            for (size_t A_Index213 = 0; A_Index213 < items213.size(); A_Index213++) {
+                std::string A_LoopField213 = items213[A_Index213 - 0];
+                if (RegExMatch(A_LoopField213, "^\\d+$")) {
+                    str4 += "push " + A_LoopField213 + Chr(10);
                 } else {
-                    out += str4 + "call " + str2 + Chr(10);
+                    str4 += "push qword [" + A_LoopField213 + "]" + Chr(10);
                 }
+                int5++;
             }
-        } else {
-            out += A_LoopField69 + Chr(10);
-        }
-        // Place this AFTER your main compilation loop finishes generating 'out'
-        for (int A_Index214 = 0; A_Index214 < HTVM_Size(funcArgsArr); A_Index214++) {
-            if (is_arm == 1) {
-                out = RegExReplace(out, Chr(61) + "\\b" + Trim(funcArgsArr[A_Index214]) + "\\b", "[sp, #" + STR((A_Index214 * 8)) + "]");
+            if (int1 == 0) {
+                out += str4 + "call " + str2 + Chr(10) + "add rsp, " + STR(8 * int5) + Chr(10);
+            } else {
+                out += str4 + "call " + str2 + Chr(10);
             }
-            if (is_arm == 0 && is_oryx == 1) {
-                out = RegExReplace(out, "\\b" + Trim(funcArgsArr[A_Index214]) + "\\b", "r" + STR(A_Index214 + 50));
+        }
+    };
+    // The string literals are all numbered by now, so each statement's code goes straight to the
+    // writer; only a line it leaves unfinished stays in out for the next one.
+    HTLL_AsmWriter writer(theIdNumOfThe34theVar, theIdNumOfThe34, keyWordEscpaeChar);
+    std::vector<std::string> allFuncCALLS;
+    // --watch: the function statements first..last (FUNC to FUNCEND) either come back from an
+    // earlier build, or start recording their code and state changes under functionKey.
+    std::string functionKey;
+    HTLL_FunctionCode functionCode;
+    size_t functionDataInts = 0;
+    size_t functionTempStrings = 0;
+    size_t functionArrBss = 0;
+    size_t functionNints = 0;
+    auto reuseFunction = [&](size_t first, size_t last) {
+        std::string key = langToConvertTo + " " + STR(HTLL_optLevel) + " " + STR(HTLL_loopDepth) + " " + STR(funcLoopDepths[funcCount]);
+        key += " " + STR(isOryxFuncFirst > 0 ? 1 : 0) + " " + STR(isDotCompile) + " " + STR(HTLL_fix_int) + " " + STR(dot_data_print_temp_strings_count) + Chr(10);
+        for (int count : loopCounts) {
+            key += STR(count) + " ";
+        }
+        key += Chr(10);
+        for (int count : ifCounts) {
+            key += STR(count) + " ";
+        }
+        key += Chr(10);
+        for (const std::string& nint : nintArr) {
+            key += nint + " ";
+        }
+        key += Chr(10);
+        for (size_t i = first; i <= last; i++) {
+            key += STR(stmtLevels[i]) + " " + items69[i] + Chr(10);
+        }
+        functionKey = HTLL_hash128(key);
+        HTLL_FunctionCode cached;
+        if (!HTLL_findFunctionCode(functionKey, cached)) {
+            functionCode = HTLL_FunctionCode();
+            functionDataInts = dot_data_ints.size();
+            functionTempStrings = dot_data_print_temp_strings.size();
+            functionArrBss = arrBss.size();
+            functionNints = nintArr.size();
+            return false;
+        }
+        functionKey.clear();
+        HTLL_collectCalls(cached.code, allFuncCALLS);
+        writer.emit(cached.code);
+        dot_data_ints += cached.dataInts;
+        dot_data_print_temp_strings += cached.tempStrings;
+        arrBss += cached.arrBss;
+        nintArr.insert(nintArr.end(), cached.nints.begin(), cached.nints.end());
+        loopCounts = cached.loopCounts;
+        ifCounts = cached.ifCounts;
+        HTLL_fix_int = cached.fixInt;
+        dot_data_print_temp_strings_count = cached.tempStringCount;
+        isDotCompile = cached.isDotCompile;
+        inFunc = 1;
+        funcName = cached.funcName;
+        funcArgsArr = cached.funcArgsArr;
+        funcArgsCount = cached.funcArgsCount;
+        localVarNum = cached.localVarNum;
+        isOryxFuncFirst++;
+        funcCount++;
+        for (size_t i = first; i <= last; i++) {
+            std::string().swap(items69[i]);
+        }
+        HTLL_count("reused functions", 1);
+        return true;
+    };
+    auto storeFunction = [&]() {
+        functionCode.dataInts = dot_data_ints.substr(functionDataInts);
+        functionCode.tempStrings = dot_data_print_temp_strings.substr(functionTempStrings);
+        functionCode.arrBss = arrBss.substr(functionArrBss);
+        functionCode.nints.assign(nintArr.begin() + functionNints, nintArr.end());
+        functionCode.loopCounts = loopCounts;
+        functionCode.ifCounts = ifCounts;
+        functionCode.fixInt = HTLL_fix_int;
+        functionCode.tempStringCount = dot_data_print_temp_strings_count;
+        functionCode.isDotCompile = isDotCompile;
+        functionCode.funcName = funcName;
+        functionCode.funcArgsArr = funcArgsArr;
+        functionCode.funcArgsCount = funcArgsCount;
+        functionCode.localVarNum = localVarNum;
+        HTLL_storeFunctionCode(functionKey, std::move(functionCode));
+    };
+    for (size_t A_Index69 = 0; A_Index69 < items69.size(); A_Index69++) {
+        if (HTLL_reuseFunctions == 1 && stmtKinds[A_Index69] == HTLL_STMT_FUNC && out.empty()) {
+            size_t last = A_Index69;
+            while (last < items69.size() && stmtKinds[last] != HTLL_STMT_FUNCEND) {
+                last++;
             }
-            if (is_arm == 0 && is_oryx == 0) {
-                // Your existing x86 formula
-                out = RegExReplace(out, "\\b" + Trim(funcArgsArr[A_Index214]) + "\\b", "rbp + " + STR(8 + ( (HTVM_Size(funcArgsArr) - A_Index214) * 8 )));
+            if (last < items69.size() && reuseFunction(A_Index69, last)) {
+                A_Index69 = last;
+                continue;
             }
         }
-        // ... after the main compilation loop ...
-        if (is_arm == 0) {
-            out = StrReplace(out, "']", "'");
-            out = StrReplace(out, "['", "'");
-            out = StrReplace(out, "push qword []", "");
-            out = StrReplace(out, "[A_Index]", "r13");
+        A_LoopField69 = std::move(items69[A_Index69 - 0]);
+        stmtLevel = stmtLevels[A_Index69];
+        int stmtKind = stmtKinds[A_Index69];
+        int stmtStart = StrLen(out);
+        if (stmtHandlers[stmtKind]) {
+            stmtHandlers[stmtKind]();
+        } else {
+            out += A_LoopField69 + Chr(10);
         }
+        HTLL_bindStatement(out, stmtStart);
         // This replacement is likely a mistake in your original code, as it would
         // turn `mov rax, [my_var]` into `mov rax, my_var`, which is a different instruction.
         // I'll keep it here but comment it out as a warning.
         // codeOUT := StrReplace(codeOUT, " [rax]", " rax")
-    }
-    code = out;
-    std::vector<std::string> allFuncCALLS;
-    std::vector<std::string> allFuncCALLS_alredy;
-    std::string code_TEMP = code + Chr(10) + main_syntax;
-    std::vector<std::string> items215 = LoopParseFunc(code_TEMP, "\n", "\r");
-    for (size_t A_Index215 = 0; A_Index215 < items215.size(); A_Index215++) {
-        std::string A_LoopField215 = items215[A_Index215 - 0];
-        if (is_arm == 1) {
-            if (SubStr(Trim(A_LoopField215), 1, 3) == "bl " || SubStr(Trim(A_LoopField215), 1, 2) == "b ") {
-                HTVM_Append(allFuncCALLS, Trim(StringTrimLeft(Trim(A_LoopField215), 2)));
-            }
-        } else {
-            if (SubStr(Trim(A_LoopField215), 1, 5) == "call " || SubStr(Trim(A_LoopField215), 1, 4) == "jmp ") {
-                HTVM_Append(allFuncCALLS, Trim(StringTrimLeft(Trim(A_LoopField215), 4)));
-            }
-        }
-    }
-    std::string HTLL_Libs_x86_new = Chr(10);
-    std::string temp_funcName = "";
-    int temp_in_funcName = 0;
-    int canWeGetFunc = 0;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    std::vector<std::string> items216 = LoopParseFunc(HTLL_Libs_x86, "\n", "\r");
-    for (size_t A_Index216 = 0; A_Index216 < items216.size(); A_Index216++) {
-        std::string A_LoopField216 = items216[A_Index216 - 0];
-        if (InStr(A_LoopField216, "$$$$") == false && InStr(A_LoopField216, "%%%%") == false && temp_in_funcName == 1 && canWeGetFunc == 1) {
-            HTLL_Libs_x86_new += A_LoopField216 + Chr(10);
-        }
-        if (InStr(A_LoopField216, "$$$$")) {
-            temp_funcName = StringTrimLeft(StringTrimRight(Trim(A_LoopField216), 4), 4);
-            temp_in_funcName = 1;
-            canWeGetFunc = 0;
-            for (int A_Index217 = 0; A_Index217 < HTVM_Size(allFuncCALLS); A_Index217++) {
-                if (temp_funcName == allFuncCALLS[A_Index217]) {
-                    canWeGetFunc = 1;
-                    HTVM_Append(allFuncCALLS_alredy, temp_funcName);
-                    break;
-                }
-            }
-        }
-        else if (InStr(A_LoopField216, "%%%%")) {
-            temp_in_funcName = 0;
-        }
-    }
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    allFuncCALLS = {};
-    int anotherVar_INT_HELP_BUILD_IN_FUNCS_INT = 0;
-    std::string ALoopField = "";
-    std::vector<std::string> items218 = LoopParseFunc(HTLL_Libs_x86_new, "\n", "\r");
-    for (size_t A_Index218 = 0; A_Index218 < items218.size(); A_Index218++) {
-        std::string A_LoopField218 = items218[A_Index218 - 0];
-        ALoopField = A_LoopField218;
-        if (is_arm == 1) {
-            if (SubStr(Trim(A_LoopField218), 1, 3) == "bl " || SubStr(Trim(A_LoopField218), 1, 2) == "b ") {
-                anotherVar_INT_HELP_BUILD_IN_FUNCS_INT = 1;
-                for (int A_Index219 = 0; A_Index219 < HTVM_Size(allFuncCALLS_alredy); A_Index219++) {
-                    if (allFuncCALLS_alredy[A_Index219] == Trim(StringTrimLeft(Trim(ALoopField), 2))) {
-                        anotherVar_INT_HELP_BUILD_IN_FUNCS_INT = 0;
-                    }
-                }
-                if (anotherVar_INT_HELP_BUILD_IN_FUNCS_INT == 1) {
-                    HTVM_Append(allFuncCALLS, Trim(StringTrimLeft(Trim(ALoopField), 4)));
-                }
-            }
-        } else {
-            if (SubStr(Trim(A_LoopField218), 1, 5) == "call " || SubStr(Trim(A_LoopField218), 1, 4) == "jmp ") {
-                anotherVar_INT_HELP_BUILD_IN_FUNCS_INT = 1;
-                for (int A_Index220 = 0; A_Index220 < HTVM_Size(allFuncCALLS_alredy); A_Index220++) {
-                    if (allFuncCALLS_alredy[A_Index220] == Trim(StringTrimLeft(Trim(ALoopField), 4))) {
-                        anotherVar_INT_HELP_BUILD_IN_FUNCS_INT = 0;
-                    }
-                }
-                if (anotherVar_INT_HELP_BUILD_IN_FUNCS_INT == 1) {
-                    HTVM_Append(allFuncCALLS, Trim(StringTrimLeft(Trim(ALoopField), 4)));
-                }
+        size_t stmtEnd = out.rfind('\n');
+        if (stmtEnd != std::string::npos) {
+            std::string stmtCode = out.substr(0, stmtEnd + 1);
+            out.erase(0, stmtEnd + 1);
+            HTLL_collectCalls(stmtCode, allFuncCALLS);
+            writer.emit(stmtCode);
+            if (!functionKey.empty()) {
+                functionCode.code += stmtCode;
             }
         }
-    }
-    temp_funcName = "";
-    temp_in_funcName = 0;
-    canWeGetFunc = 0;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    std::vector<std::string> items221 = LoopParseFunc(HTLL_Libs_x86, "\n", "\r");
-    for (size_t A_Index221 = 0; A_Index221 < items221.size(); A_Index221++) {
-        std::string A_LoopField221 = items221[A_Index221 - 0];
-        if (InStr(A_LoopField221, "$$$$") == false && InStr(A_LoopField221, "%%%%") == false && temp_in_funcName == 1 && canWeGetFunc == 1) {
-            HTLL_Libs_x86_new += A_LoopField221 + Chr(10);
-        }
-        if (InStr(A_LoopField221, "$$$$")) {
-            temp_funcName = StringTrimLeft(StringTrimRight(Trim(A_LoopField221), 4), 4);
-            temp_in_funcName = 1;
-            canWeGetFunc = 0;
-            for (int A_Index222 = 0; A_Index222 < HTVM_Size(allFuncCALLS); A_Index222++) {
-                if (temp_funcName == allFuncCALLS[A_Index222]) {
-                    canWeGetFunc = 1;
-                    break;
-                }
+        if (stmtKind == HTLL_STMT_FUNCEND && !functionKey.empty()) {
+            if (out.empty()) {
+                storeFunction();
             }
-        }
-        else if (InStr(A_LoopField221, "%%%%")) {
-            temp_in_funcName = 0;
+            functionKey.clear();
         }
     }
+    std::vector<std::string>().swap(items69);
+    HTLL_collectCalls(out, allFuncCALLS);
+    writer.emit(out);
+    std::string().swap(out);
+    HTLL_pass("runtime library splicing");
+    HTLL_collectCalls(main_syntax, allFuncCALLS);
+    std::string HTLL_Libs_x86_new = Chr(10);
     //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-    //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    // the runtime library routines are already split and indexed by name,
+    // this pulls in the called ones and everything they call in turn
+    HTLL_Libs_x86_new += HTLL_runtimeRoutines(HTLL_Libs_file, allFuncCALLS);
     //;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
     // =========================================================================
     // FINAL FASM OBJECT FILE ASSEMBLY - THE TRUE BLUEPRINT
@@ -10098,6 +9388,7 @@ std::string compiler(std::string code) {
             fasm_header += ".equ SYS_CLOSE, 57" + Chr(10);
             fasm_header += ".equ SYS_MMAP, 222" + Chr(10);
             fasm_header += ".equ SYS_MUNMAP, 215" + Chr(10);
+            fasm_header += ".equ SYS_MREMAP, 216" + Chr(10);
             fasm_header += ".equ SYS_EXIT, 93" + Chr(10);
             fasm_header += ".equ SYS_NANOSLEEP, 101" + Chr(10);
             fasm_header += ".equ SYS_UNLINKAT, 35" + Chr(10);
@@ -10107,6 +9398,7 @@ std::string compiler(std::string code) {
             fasm_header += ".equ O_CREAT_WRONLY_TRUNC, 0101 | 01000 | 0100" + Chr(10);
             fasm_header += ".equ PROT_READ_WRITE, 0x1 | 0x2" + Chr(10);
             fasm_header += ".equ MAP_PRIVATE_ANONYMOUS, 0x20 | 0x02" + Chr(10);
+            fasm_header += ".equ MREMAP_MAYMOVE, 1" + Chr(10);
             fasm_header += Chr(10);
             fasm_header += ".global _start" + Chr(10);
             fasm_header += Chr(10);
@@ -10114,7 +9406,8 @@ std::string compiler(std::string code) {
             fasm_header += ".equ DynamicArray_pointer, 0" + Chr(10);
             fasm_header += ".equ DynamicArray_size, 8" + Chr(10);
             fasm_header += ".equ DynamicArray_capacity, 16" + Chr(10);
-            fasm_header += ".equ INITIAL_CAPACITY, 4" + Chr(10);
+            // one 4096-byte page of qwords
+            fasm_header += ".equ INITIAL_CAPACITY, 512" + Chr(10);
         } else {
             // --- THIS IS YOUR EXISTING x86 CODE, UNCHANGED ---
             if (isDotCompile == 1) {
@@ -10140,47 +9433,51 @@ std::string compiler(std::string code) {
         }
     }
     // Use simple section names WITH the correct ELF flags for object files.
-    std::string upCode = "";
+    writer.startPrefix();
+    writer.emit(Chr(10));
+    writer.emit(fasm_header);
+    writer.emit(Chr(10));
     // --- FASM BODY ---
     if (is_oryx == 0) {
         if (is_arm == 1) {
             // --- ARM GNU AS SECTIONS & DATA ---
-            upCode = ".data" + Chr(10);
-            upCode += "SCALE_FACTOR:      .quad 1000000" + Chr(10);
-            upCode += "HTLL_dot:               .string " + Chr(34) + "." + Chr(34) + Chr(10);
-            upCode += "HTLL_minus_sign:        .string " + Chr(34) + "-" + Chr(34) + Chr(10);
-            upCode += "HTLL_nl:                .string " + Chr(34) + "\\n" + Chr(34) + Chr(10);
-            upCode += dot_data;
-            upCode += Chr(10) + ".bss" + Chr(10);
-            upCode += ".lcomm HTLL_input_buffer, 256" + Chr(10);
-            upCode += ".lcomm HTLL_file_read_buffer, 4096" + Chr(10);
-            upCode += ".lcomm filename_ptr_size, 8" + Chr(10);
-            upCode += ".lcomm source_ptr, 8" + Chr(10);
-            upCode += ".lcomm source_ptr_size, 8" + Chr(10);
-            upCode += ".lcomm args_array, 24" + Chr(10);
-            upCode += ".lcomm filename_ptr, 8" + Chr(10);
-            upCode += ".lcomm asm_code_ptr, 8" + Chr(10);
-            upCode += arrBss + dot_bss;
-            upCode += Chr(10) + ".text" + Chr(10);
-            upCode += HTLL_Libs_x86_new;
+            writer.emit(".data" + Chr(10));
+            writer.emit("SCALE_FACTOR:      .quad 1000000" + Chr(10));
+            writer.emit("HTLL_dot:               .string " + Chr(34) + "." + Chr(34) + Chr(10));
+            writer.emit("HTLL_minus_sign:        .string " + Chr(34) + "-" + Chr(34) + Chr(10));
+            writer.emit("HTLL_nl:                .string " + Chr(34) + "\\n" + Chr(34) + Chr(10));
+            writer.emit(dot_data);
+            writer.emit(Chr(10) + ".bss" + Chr(10));
+            writer.emit(".lcomm HTLL_input_buffer, 256" + Chr(10));
+            writer.emit(".lcomm HTLL_file_read_buffer, 4096" + Chr(10));
+            writer.emit(".lcomm filename_ptr_size, 8" + Chr(10));
+            writer.emit(".lcomm source_ptr, 8" + Chr(10));
+            writer.emit(".lcomm source_ptr_size, 8" + Chr(10));
+            writer.emit(".lcomm args_array, 24" + Chr(10));
+            writer.emit(".lcomm filename_ptr, 8" + Chr(10));
+            writer.emit(".lcomm asm_code_ptr, 8" + Chr(10));
+            writer.emit(arrBss + dot_bss);
+            writer.emit(Chr(10) + ".text" + Chr(10));
+            writer.emit(HTLL_Libs_x86_new);
         } else {
             if (isDotCompile == 1) {
-                upCode = "section '.data' writeable" + Chr(10) + "    SCALE_FACTOR   dq 1000000" + Chr(10) + "    INITIAL_CAPACITY = 2" + Chr(10) + "    print_buffer   rb 21" + Chr(10) + "    dot            db " + Chr(39) + "." + Chr(39) + Chr(10) + "    minus_sign     db " + Chr(39) + "-" + Chr(39) + " " + Chr(10) + "    nl   db 10" + Chr(10) + dot_data + Chr(10);
-                upCode += "section '.bss' writeable" + Chr(10) + "    input_buffer rb 256" + Chr(10) + "    file_read_buffer rb 4096" + Chr(10) + "    input_len    rq 1" + Chr(10) + "    filename_ptr_size  rq 1" + Chr(10) + "    source_ptr      rq 1" + Chr(10) + "    source_ptr_size rq 1" + Chr(10) + "    args_array rq 3" + Chr(10) + "    filename_ptr      rq 1" + Chr(10) + "    asm_code_ptr    rq 1" + Chr(10) + "    print_buffer_n rb 20" + Chr(10) + arrBss + dot_bss;
-                upCode += "section '.text' executable" + Chr(10) + HTLL_Libs_x86_new + Chr(10);
+                writer.emit("section '.data' writeable" + Chr(10) + "    SCALE_FACTOR   dq 1000000" + Chr(10) + "    INITIAL_CAPACITY = 512" + Chr(10) + "    print_buffer   rb 21" + Chr(10) + "    dot            db " + Chr(39) + "." + Chr(39) + Chr(10) + "    minus_sign     db " + Chr(39) + "-" + Chr(39) + " " + Chr(10) + "    nl   db 10" + Chr(10) + dot_data + Chr(10));
+                writer.emit("section '.bss' writeable" + Chr(10) + "    input_buffer rb 256" + Chr(10) + "    file_read_buffer rb 4096" + Chr(10) + "    input_len    rq 1" + Chr(10) + "    filename_ptr_size  rq 1" + Chr(10) + "    source_ptr      rq 1" + Chr(10) + "    source_ptr_size rq 1" + Chr(10) + "    args_array rq 3" + Chr(10) + "    filename_ptr      rq 1" + Chr(10) + "    asm_code_ptr    rq 1" + Chr(10) + "    print_buffer_n rb 20" + Chr(10) + arrBss + dot_bss);
+                writer.emit("section '.text' executable" + Chr(10) + HTLL_Libs_x86_new + Chr(10));
             } else {
                 if (ring0 == 0) {
-                    upCode = "segment readable writeable" + Chr(10) + "    SCALE_FACTOR   dq 1000000" + Chr(10) + "    INITIAL_CAPACITY = 2" + Chr(10) + "    print_buffer   rb 21" + Chr(10) + "    dot            db " + Chr(39) + "." + Chr(39) + "" + Chr(10) + "    minus_sign     db " + Chr(39) + "-" + Chr(39) + "" + Chr(10) + "    nl   db 10" + Chr(10) + dot_data + Chr(10);
-                    upCode += Chr(10) + Chr(10) + "    input_buffer rb 256" + Chr(10) + "    file_read_buffer rb 4096" + Chr(10) + "    input_len    rq 1" + Chr(10) + "    filename_ptr_size  rq 1" + Chr(10) + "    source_ptr      rq 1" + Chr(10) + "    source_ptr_size rq 1" + Chr(10) + "    args_array rq 3" + Chr(10) + "    filename_ptr      rq 1" + Chr(10) + "    asm_code_ptr    rq 1" + Chr(10) + "    print_buffer_n rb 20" + Chr(10) + arrBss + dot_bss;
-                    upCode += "segment readable executable" + Chr(10) + HTLL_Libs_x86_new + Chr(10);
+                    writer.emit("segment readable writeable" + Chr(10) + "    SCALE_FACTOR   dq 1000000" + Chr(10) + "    INITIAL_CAPACITY = 512" + Chr(10) + "    print_buffer   rb 21" + Chr(10) + "    dot            db " + Chr(39) + "." + Chr(39) + "" + Chr(10) + "    minus_sign     db " + Chr(39) + "-" + Chr(39) + "" + Chr(10) + "    nl   db 10" + Chr(10) + dot_data + Chr(10));
+                    writer.emit(Chr(10) + Chr(10) + "    input_buffer rb 256" + Chr(10) + "    file_read_buffer rb 4096" + Chr(10) + "    input_len    rq 1" + Chr(10) + "    filename_ptr_size  rq 1" + Chr(10) + "    source_ptr      rq 1" + Chr(10) + "    source_ptr_size rq 1" + Chr(10) + "    args_array rq 3" + Chr(10) + "    filename_ptr      rq 1" + Chr(10) + "    asm_code_ptr    rq 1" + Chr(10) + "    print_buffer_n rb 20" + Chr(10) + arrBss + dot_bss);
+                    writer.emit("segment readable executable" + Chr(10) + HTLL_Libs_x86_new + Chr(10));
                 } else {
-                    upCode = Chr(10) + "    SCALE_FACTOR   dq 1000000" + Chr(10) + "    INITIAL_CAPACITY = 2" + Chr(10) + "    print_buffer   rb 21" + Chr(10) + "    dot            db " + Chr(39) + "." + Chr(39) + "" + Chr(10) + "    minus_sign     db " + Chr(39) + "-" + Chr(39) + "" + Chr(10) + "    nl   db 10" + Chr(10) + dot_data + Chr(10);
-                    upCode += Chr(10) + Chr(10) + "    input_buffer rb 256" + Chr(10) + "    file_read_buffer rb 4096" + Chr(10) + "    input_len    rq 1" + Chr(10) + "    filename_ptr_size  rq 1" + Chr(10) + "    source_ptr      rq 1" + Chr(10) + "    source_ptr_size rq 1" + Chr(10) + "    args_array rq 3" + Chr(10) + "    filename_ptr      rq 1" + Chr(10) + "    asm_code_ptr    rq 1" + Chr(10) + "    print_buffer_n rb 20" + Chr(10) + arrBss + dot_bss + Chr(10) + "; Global variables for the 64-bit Runtime" + Chr(10) + "cursor_x dq 0" + Chr(10) + "cursor_y dq 0" + Chr(10) + "heap_ptr dq 0x40000" + Chr(10) + "; Minimal Scancode Map (QWERTY) - You can expand this" + Chr(10) + "scan_map:" + Chr(10) + "db 0,27,'1','2','3','4','5','6','7','8','9','0','-','=',8,9" + Chr(10) + "db 'q','w','e','r','t','y','u','i','o','p','[',']',10,0,'a','s'" + Chr(10) + "db 'd','f','g','h','j','k','l',';',39,'" + Chr(96) + "',0,'\\','z','x','c','v'" + Chr(10) + "db 'b','n','m',',','.','/',0,'*',0,32" + Chr(10) + "align 16" + Chr(10) + "video_buffer: rb 4000" + Chr(10);
-                    upCode += Chr(10) + HTLL_Libs_x86_new + Chr(10);
+                    writer.emit(Chr(10) + "    SCALE_FACTOR   dq 1000000" + Chr(10) + "    INITIAL_CAPACITY = 512" + Chr(10) + "    print_buffer   rb 21" + Chr(10) + "    dot            db " + Chr(39) + "." + Chr(39) + "" + Chr(10) + "    minus_sign     db " + Chr(39) + "-" + Chr(39) + "" + Chr(10) + "    nl   db 10" + Chr(10) + dot_data + Chr(10));
+                    writer.emit(Chr(10) + Chr(10) + "    input_buffer rb 256" + Chr(10) + "    file_read_buffer rb 4096" + Chr(10) + "    input_len    rq 1" + Chr(10) + "    filename_ptr_size  rq 1" + Chr(10) + "    source_ptr      rq 1" + Chr(10) + "    source_ptr_size rq 1" + Chr(10) + "    args_array rq 3" + Chr(10) + "    filename_ptr      rq 1" + Chr(10) + "    asm_code_ptr    rq 1" + Chr(10) + "    print_buffer_n rb 20" + Chr(10) + arrBss + dot_bss + Chr(10) + "; Global variables for the 64-bit Runtime" + Chr(10) + "cursor_x dq 0" + Chr(10) + "cursor_y dq 0" + Chr(10) + "heap_ptr dq 0x40000" + Chr(10) + "; Minimal Scancode Map (QWERTY) - You can expand this" + Chr(10) + "scan_map:" + Chr(10) + "db 0,27,'1','2','3','4','5','6','7','8','9','0','-','=',8,9" + Chr(10) + "db 'q','w','e','r','t','y','u','i','o','p','[',']',10,0,'a','s'" + Chr(10) + "db 'd','f','g','h','j','k','l',';',39,'" + Chr(96) + "',0,'\\','z','x','c','v'" + Chr(10) + "db 'b','n','m',',','.','/',0,'*',0,32" + Chr(10) + "align 16" + Chr(10) + "video_buffer: rb 4000" + Chr(10));
+                    writer.emit(Chr(10) + HTLL_Libs_x86_new + Chr(10));
                 }
             }
         }
     }
+    writer.emit(Chr(10));
     // --- FASM FOOTER ---
     std::string downCode = "";
     if (is_oryx == 0) {
@@ -10201,309 +9498,640 @@ std::string compiler(std::string code) {
         }
     }
     // --- ASSEMBLE THE FINAL STRING ---
-    std::string codeOUT = "";
+    std::string mainPart = "";
     if (seenMain == 0) {
         // The 'main_syntax' variable will also need an 'if (is_arm)' block
         // to generate the correct function prologue for the target architecture.
-        codeOUT = Chr(10) + fasm_header + Chr(10) + upCode + Chr(10) + main_syntax + Chr(10) + code + Chr(10) + downCode + Chr(10);
-    } else {
-        // The 'out' variable is the user's code. This must be generated as ARM or x86
-        // based on the 'is_arm' flag *before* this assembly stage.
-        codeOUT = Chr(10) + fasm_header + Chr(10) + upCode + Chr(10) + code + Chr(10) + downCode + Chr(10);
-    }
-    codeOUT = StrReplace(codeOUT, " [rax]", " rax");
-    //;;;;;;;;;;;;;;;;;;;;;;;;;
-    for (int A_Index223 = 0; A_Index223 < theIdNumOfThe34; A_Index223++) {
-        if (theIdNumOfThe34 == A_Index223 + 1) {
-            codeOUT = StrReplace(codeOUT, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(A_Index223 + 1) + Chr(65) + Chr(65), StrReplace(theIdNumOfThe34theVar[A_Index223 + 1], keyWordEscpaeChar, "\\") + Chr(34));
-        } else {
-            codeOUT = StrReplace(codeOUT, "VYIGUOYIYVIUCFCYIUCFCYIGCYGICFHYFHCTCFTFDFGYGFC" + Chr(65) + Chr(65) + STR(A_Index223 + 1) + Chr(65) + Chr(65), StrReplace(theIdNumOfThe34theVar[A_Index223 + 1], keyWordEscpaeChar, "\\"));
-        }
-    }
-    int is_1_optimize = 0;
-    int is_2_optimize = 0;
-    int is_3_optimize = 0;
-    int is_4_optimize = 0;
-    int is_5_optimize = 0;
-    int is_6_optimize = 0;
-    int is_7_optimize = 0;
-    int is_8_optimize = 0;
-    int is_9_optimize = 0;
-    int is_10_optimize = 0;
-    int is_11_optimize = 0;
-    int is_12_optimize = 0;
-    int is_13_optimize = 0;
-    int is_14_optimize = 0;
-    int is_15_optimize = 0;
-    int is_16_optimize = 0;
-    int is_17_optimize = 0;
-    int is_18_optimize = 0;
-    int is_19_optimize = 0;
-    int is_20_optimize = 0;
-    int is_21_optimize = 0;
-    int is_22_optimize = 0;
-    int is_in_under = 0;
-    std::string allInOne_temp = "";
-    int aredy_int = 0;
-    if (is_arm == 0 && is_oryx == 0) {
-        std::vector<std::string> items224 = LoopParseFunc(codeOUT, "\n", "\r");
-        for (size_t A_Index224 = 0; A_Index224 < items224.size(); A_Index224++) {
-            std::string A_LoopField224 = items224[A_Index224 - 0];
-            if (SubStr(Trim(A_LoopField224), 1, 2) != "; ") {
-                allInOne_temp += Trim(A_LoopField224) + Chr(10);
-                // Ignore definitions so they don't count as usage
-                if (InStr(A_LoopField224, " db ") == 0 && InStr(A_LoopField224, " rb ") == 0 && InStr(A_LoopField224, " rq ") == 0 && InStr(A_LoopField224, " dq ") == 0 && InStr(A_LoopField224, " = ") == 0) {
-                    // CHANGED ALL "else if" TO "if" TO PREVENT OVERLAPPING REGEX BUGS
-                    if (RegExMatch(A_LoopField224, "\\bDynamicArray.pointer\\b")) {
-                        is_1_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bDynamicArray.size\\b")) {
-                        is_2_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bDynamicArray.capacity\\b")) {
-                        is_3_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bsizeof.DynamicArray\\b")) {
-                        is_4_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bSCALE" + Chr(95) + "FACTOR\\b")) {
-                        is_5_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bINITIAL" + Chr(95) + "CAPACITY\\b")) {
-                        is_6_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bprint" + Chr(95) + "buffer\\b")) {
-                        is_7_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bdot\\b")) {
-                        is_8_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bminus" + Chr(95) + "sign\\b")) {
-                        is_9_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\b" + Chr(110) + Chr(108) + "\\b")) {
-                        is_10_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\binput" + Chr(95) + "buffer\\b")) {
-                        is_11_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bfile" + Chr(95) + "read" + Chr(95) + "buffer\\b")) {
-                        is_12_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\binput" + Chr(95) + "len\\b")) {
-                        is_13_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bfilename" + Chr(95) + "ptr" + Chr(95) + "size\\b")) {
-                        is_14_optimize = 1;
-                    }
-                    // FIXED REGEX FOR SOURCE_PTR (is_15)
-                    if (RegExMatch(A_LoopField224, "\\bsource" + Chr(95) + "ptr\\b")) {
-                        is_15_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bsource" + Chr(95) + "ptr" + Chr(95) + "size\\b")) {
-                        is_16_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bargs" + Chr(95) + "array\\b")) {
-                        is_17_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bfilename" + Chr(95) + "ptr\\b")) {
-                        is_18_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\basm" + Chr(95) + "code" + Chr(95) + "ptr\\b")) {
-                        is_19_optimize = 1;
-                    }
-                    if (RegExMatch(A_LoopField224, "\\bprint" + Chr(95) + "buffer" + Chr(95) + "n\\b")) {
-                        is_20_optimize = 1;
-                    }
-                }
+        mainPart = main_syntax + Chr(10);
+    }
+    // The user's code is already in the writer, behind the header, data and main part emitted
+    // above; the footer follows it.
+    writer.emit(mainPart);
+    writer.endPrefix();
+    writer.emit(Chr(10));
+    writer.emit(downCode);
+    writer.emit(Chr(10));
+    HTLL_pass("assembly output");
+    HTLL_Output output;
+    writer.finish(output);
+    return output;
+}
+// The front end (HTLL_Lang) lowers the source to one statement per line; the back end
+// turns that into assembly for the target picked by HTLL_selectTarget().
+HTLL_Output compiler(std::string code) {
+    code = HTLL_Lang(code);
+    return HTLL_backEnd(code);
+}
+#include <cerrno>
+#include <chrono>
+// Persistent compile cache. The output of a compile is stored under a 128-bit
+// hash (HTLL_hash128) of everything that can change it: the source with its includes
+// resolved, the target, the runtime library, the compiler version and the options.
+// HTLL_CACHE_DIR overrides the location, then $XDG_CACHE_HOME/htll, then ~/.cache/htll.
+const std::string HTLL_VERSION = std::string("HTLL 1.0 ") + __DATE__ + " " + __TIME__;
+int HTLL_useCache = 1;
+std::atomic<int> HTLL_cacheHits(0);
+std::atomic<int> HTLL_cacheMisses(0);
+std::string HTLL_cacheDir() {
+    const char* dir = std::getenv("HTLL_CACHE_DIR");
+    if (dir != nullptr && dir[0] != 0) {
+        return dir;
+    }
+    dir = std::getenv("XDG_CACHE_HOME");
+    if (dir != nullptr && dir[0] != 0) {
+        return std::string(dir) + "/htll";
+    }
+    dir = std::getenv("HOME");
+    if (dir != nullptr && dir[0] != 0) {
+        return std::string(dir) + "/.cache/htll";
+    }
+    return ".htll-cache";
+}
+bool HTLL_makeDirs(const std::string& path) {
+    for (size_t i = 1; i <= path.size(); i++) {
+        if (i == path.size() || path[i] == '/') {
+            std::string part = path.substr(0, i);
+            if (mkdir(part.c_str(), 0755) != 0 && errno != EEXIST) {
+                return false;
             }
         }
-        codeOUT = Trim(allInOne_temp);
-        allInOne_temp = "";
-        aredy_int = 0;
-        std::vector<std::string> items225 = LoopParseFunc(codeOUT, "\n", "\r");
-        for (size_t A_Index225 = 0; A_Index225 < items225.size(); A_Index225++) {
-            std::string A_LoopField225 = items225[A_Index225 - 0];
-            aredy_int = 0;
-            if (Trim(A_LoopField225) == "DynamicArray.pointer  = 0" && is_1_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "DynamicArray.size     = 8" && is_2_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "DynamicArray.capacity = 16" && is_3_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "sizeof.DynamicArray   = 24" && is_4_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "SCALE_FACTOR   dq 1000000" && is_5_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "INITIAL_CAPACITY = 2" && is_6_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "print_buffer   rb 21" && is_7_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "dot            db " + Chr(39) + "." + Chr(39) + "" && is_8_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "minus_sign     db " + Chr(39) + Chr(45) + Chr(39) && is_9_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == Chr(110) + Chr(108) + "   db 10" && is_10_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "input_buffer rb 256" && is_11_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "file_read_buffer rb 4096" && is_12_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "input_len    rq 1" && is_13_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "filename_ptr_size  rq 1" && is_14_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "source_ptr      rq 1" && is_15_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "source_ptr_size rq 1" && is_16_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "args_array rq 3" && is_17_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "filename_ptr      rq 1" && is_18_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "asm_code_ptr    rq 1" && is_19_optimize == 0) {
-                aredy_int = 1;
-            }
-            else if (Trim(A_LoopField225) == "print_buffer_n rb 20" && is_20_optimize == 0) {
-                aredy_int = 1;
-            }
-            if (aredy_int == 0) {
-                allInOne_temp += A_LoopField225 + Chr(10);
-            }
+    }
+    return true;
+}
+std::string HTLL_runtimeLibraryFileFor(const std::string& target) {
+    if (target == "arm") {
+        return "HTLL_Libs_AArch64.txt";
+    }
+    if (target == "x86-64-ring0") {
+        return "HTLL_Libs_ring0.txt";
+    }
+    if (target == "oryx") {
+        return "";
+    }
+    return "HTLL_Libs_x86.txt";
+}
+// The source with its includes resolved. The cache key is computed from it and the compiler
+// is handed the same text, so the include graph is walked once per compile, hit or miss.
+std::string HTLL_resolvedSource(const std::string& source) {
+    HTLL_pass("include resolution");
+    if (doseHaveInclude(source)) {
+        return HTLL_resolveIncludes(source);
+    }
+    return source;
+}
+std::string HTLL_cacheKey(const std::string& resolved, const std::string& target, const std::string& options) {
+    std::string runtimeLibrary = HTLL_runtimeLibraryText(HTLL_runtimeLibraryFileFor(target));
+    std::string keyData = HTLL_VERSION + Chr(0) + target + Chr(0) + options + Chr(0) + resolved + Chr(0) + runtimeLibrary;
+    return HTLL_hash128(keyData);
+}
+// Command-line options that change the generated code, so they are part of the cache key.
+std::string HTLL_cacheOptions() {
+    std::string options = HTLL_registerAllocation == 0 ? "--no-regalloc" : "";
+    return HTLL_optLevel >= 1 ? options + " -O1 --inline-budget=" + std::to_string(HTLL_inlineBudget) : options;
+}
+bool HTLL_cacheHas(const std::string& key) {
+    if (HTLL_useCache == 0) {
+        return false;
+    }
+    struct stat st;
+    if (stat((HTLL_cacheDir() + "/" + key).c_str(), &st) == 0) {
+        HTLL_cacheHits++;
+        return true;
+    }
+    HTLL_cacheMisses++;
+    return false;
+}
+void HTLL_cacheRead(const std::string& key, HTLL_Output& out) {
+    std::ifstream file(HTLL_cacheDir() + "/" + key, std::ios::binary);
+    std::string buffer(HTLL_Output::chunkSize, '\0');
+    while (file.read(&buffer[0], (std::streamsize)buffer.size()) || file.gcount() > 0) {
+        out.append(buffer.data(), (size_t)file.gcount());
+    }
+}
+void HTLL_cacheStore(const std::string& key, const HTLL_Output& content) {
+    if (HTLL_useCache == 0) {
+        return;
+    }
+    std::string dir = HTLL_cacheDir();
+    if (!HTLL_makeDirs(dir)) {
+        return;
+    }
+    // write to a temporary file first so a concurrent reader never sees a partial entry
+    std::string tempPath = dir + "/" + key + ".tmp" + STR((long long)std::chrono::steady_clock::now().time_since_epoch().count()) + "-" + STR((long long)std::hash<std::thread::id>()(std::this_thread::get_id()));
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return;
+    }
+    for (const std::string& chunk : content.parts()) {
+        file.write(chunk.data(), (std::streamsize)chunk.size());
+    }
+    file.close();
+    std::rename(tempPath.c_str(), (dir + "/" + key).c_str());
+}
+// Adds this run's hits/misses to the running totals kept in <cache dir>/stats
+// and returns a one-line summary for --cache-stats. The update holds an exclusive lock on
+// <cache dir>/stats.lock, so concurrent compiles add up instead of overwriting each other,
+// and the new totals are renamed into place so a reader never sees a half-written file.
+std::string HTLL_cacheFlushStats() {
+    std::string dir = HTLL_cacheDir();
+    bool update = (HTLL_cacheHits != 0 || HTLL_cacheMisses != 0) && HTLL_makeDirs(dir);
+    FILE* lock = update ? std::fopen((dir + "/stats.lock").c_str(), "a") : nullptr;
+    if (lock != nullptr) {
+        flock(fileno(lock), LOCK_EX);
+    }
+    long long totalHits = 0;
+    long long totalMisses = 0;
+    std::ifstream in(dir + "/stats");
+    std::string name;
+    long long value = 0;
+    while (in >> name >> value) {
+        if (name == "hits") {
+            totalHits = value;
+        } else if (name == "misses") {
+            totalMisses = value;
         }
-        codeOUT = Trim(allInOne_temp);
     }
-    if (COUNT_programmingBlock_InTheTranspiledLang != 0) {
-        for (int A_Index226 = 0; A_Index226 < COUNT_programmingBlock_InTheTranspiledLang; A_Index226++) {
-            codeOUT = StrReplace(codeOUT, "programmingBlock_InTheTranspiledLang-programmingBlock_InTheTranspiledLang-AA" + STR(A_Index226 + 1) + "AA", programmingBlock_InTheTranspiledLang[A_Index226]);
+    in.close();
+    totalHits += HTLL_cacheHits;
+    totalMisses += HTLL_cacheMisses;
+    if (update) {
+        std::string tempPath = dir + "/stats.tmp" + STR((long long)std::chrono::steady_clock::now().time_since_epoch().count());
+        std::ofstream out(tempPath, std::ios::trunc);
+        out << "hits " << totalHits << "\n" << "misses " << totalMisses << "\n";
+        out.close();
+        std::rename(tempPath.c_str(), (dir + "/stats").c_str());
+    }
+    if (lock != nullptr) {
+        // closing the file releases the lock
+        std::fclose(lock);
+    }
+    return "Cache: " + STR(HTLL_cacheHits.load()) + " hits, " + STR(HTLL_cacheMisses.load()) + " misses this run; " + STR(totalHits) + " hits, " + STR(totalMisses) + " misses total (" + dir + ")";
+}
+// Clears the per-thread compiler state so that every compilation starts fresh,
+// also when one thread compiles several files in a row.
+void HTLL_resetCompilerState() {
+    for (std::string* s : {&str0, &str1, &str2, &str3, &str4, &str5, &str6, &str7, &str8, &str9, &str10, &str11, &str12, &str13, &str14, &str15, &str16, &str17, &str18, &str19, &str20}) {
+        s->clear();
+    }
+    nintArr.clear();
+    programmingBlock_InTheTranspiledLang.clear();
+    programmingBlock_CPP.clear();
+    programmingBlock_PY.clear();
+    programmingBlock_JS.clear();
+    programmingBlock_GO.clear();
+    COUNT_programmingBlock_InTheTranspiledLang = 0;
+    COUNT_programmingBlock_CPP = 0;
+    COUNT_programmingBlock_PY = 0;
+    COUNT_programmingBlock_JS = 0;
+    COUNT_programmingBlock_GO = 0;
+    programmingBlocksTemp = "";
+    inProgarmmingBlock = 0;
+    holdTempDataProgrammingBlockThenPutInArr = "";
+}
+// Prints one line of progress; lines from parallel compilations never interleave.
+std::mutex HTLL_reportMutex;
+void HTLL_report(const std::string& message) {
+    std::lock_guard<std::mutex> lock(HTLL_reportMutex);
+    std::cout << message << std::endl;
+}
+bool HTLL_isTarget(const std::string& target) {
+    return target == "x86-64" || target == "arm" || target == "oryx" || target == "x86-64-ring0";
+}
+// The message for a target name that is not one of the above.
+std::string HTLL_unknownTarget(const std::string& target) {
+    return "Error: unknown target " + target + ". Targets: x86-64, arm, oryx, x86-64-ring0";
+}
+// Sets the target flags the back end branches on. Returns false for an unknown target.
+bool HTLL_selectTarget(const std::string& target) {
+    if (!HTLL_isTarget(target)) {
+        return false;
+    }
+    is_arm = target == "arm" ? 1 : 0;
+    is_oryx = target == "oryx" ? 1 : 0;
+    ring0 = target == "x86-64-ring0" ? 1 : 0;
+    langToConvertTo = target;
+    return true;
+}
+bool compileFile(std::string fileName, std::string target) {
+    std::string outFile = fileName + ".s";
+    HTLL_resetCompilerState();
+    if (HTLL_selectTarget(target) == false) {
+        return false;
+    }
+    if (target == "oryx") {
+        outFile = fileName + ".oryxir";
+    }
+    std::string source = HTLL_resolvedSource(FileRead(fileName + ".htll"));
+    std::string cacheKey = "";
+    if (HTLL_useCache == 1) {
+        cacheKey = HTLL_cacheKey(source, target, HTLL_cacheOptions());
+    }
+    HTLL_Output output;
+    if (HTLL_cacheHas(cacheKey)) {
+        HTLL_cacheRead(cacheKey, output);
+    } else {
+        output = compiler(source);
+        HTLL_cacheStore(cacheKey, output);
+        if (HTLL_timePasses != 0) {
+            HTLL_report(HTLL_passReport(outFile));
         }
     }
-    if (langToConvertTo == "x86-64") {
-        if (COUNT_programmingBlock_CPP != 0) {
-            for (int A_Index227 = 0; A_Index227 < COUNT_programmingBlock_CPP; A_Index227++) {
-                codeOUT = StrReplace(codeOUT, "programmingBlock_CPP-programmingBlock_CPP-AA" + STR(A_Index227 + 1) + "AA", programmingBlock_CPP[A_Index227]);
-            }
+    HTLL_writeOutput(outFile, output);
+    HTLL_report("Compilation finished: " + outFile + " generated.");
+    return true;
+}
+// Runs job(0) .. job(count - 1) on up to jobs threads (0 = one per CPU), the calling
+// thread included. Each thread pulls the next index from a shared counter.
+void HTLL_parallelFor(int count, int jobs, const std::function<void(int)>& job) {
+    if (jobs <= 0) {
+        jobs = (int)std::thread::hardware_concurrency();
+    }
+    jobs = std::max(1, std::min(jobs, count));
+    std::atomic<int> next(0);
+    auto worker = [&]() {
+        int i;
+        while ((i = next++) < count) {
+            job(i);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int t = 1; t < jobs; t++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+// Compiles many files on a pool of jobs threads (-j N); a failing file is reported and
+// does not stop the others. Returns the number of files that failed.
+int HTLL_compileFiles(const std::vector<std::string>& fileNames, const std::string& target, int jobs) {
+    std::atomic<int> failures(0);
+    HTLL_parallelFor((int)fileNames.size(), jobs, [&](int i) {
+        try {
+            if (!compileFile(fileNames[i], target)) {
+                failures++;
+            }
+        } catch (const std::exception& e) {
+            HTLL_report("Compilation failed: " + fileNames[i] + ".htll: " + e.what());
+            failures++;
+        }
+    });
+    return failures;
+}
+// What the front end (HTLL_Lang) hands to a back end: the program lowered to one
+// statement per line, and the inline code blocks it cut out of the source. None of it
+// depends on the target, so one front-end run feeds every back end of a --targets compile.
+struct HTLL_FrontEnd {
+    std::string code;
+    std::vector<std::string> blocksAsm, blocksX86, blocksArm, blocksOryx, blocksRing0;
+};
+HTLL_FrontEnd HTLL_runFrontEnd(const std::string& source) {
+    HTLL_resetCompilerState();
+    HTLL_FrontEnd frontEnd;
+    frontEnd.code = HTLL_Lang(source);
+    frontEnd.blocksAsm = programmingBlock_InTheTranspiledLang;
+    frontEnd.blocksX86 = programmingBlock_CPP;
+    frontEnd.blocksArm = programmingBlock_PY;
+    frontEnd.blocksOryx = programmingBlock_JS;
+    frontEnd.blocksRing0 = programmingBlock_GO;
+    return frontEnd;
+}
+// Loads a front-end result into this thread's compiler state, ready for HTLL_backEnd().
+void HTLL_loadFrontEnd(const HTLL_FrontEnd& frontEnd) {
+    HTLL_resetCompilerState();
+    programmingBlock_InTheTranspiledLang = frontEnd.blocksAsm;
+    programmingBlock_CPP = frontEnd.blocksX86;
+    programmingBlock_PY = frontEnd.blocksArm;
+    programmingBlock_JS = frontEnd.blocksOryx;
+    programmingBlock_GO = frontEnd.blocksRing0;
+    COUNT_programmingBlock_InTheTranspiledLang = (int)frontEnd.blocksAsm.size();
+    COUNT_programmingBlock_CPP = (int)frontEnd.blocksX86.size();
+    COUNT_programmingBlock_PY = (int)frontEnd.blocksArm.size();
+    COUNT_programmingBlock_JS = (int)frontEnd.blocksOryx.size();
+    COUNT_programmingBlock_GO = (int)frontEnd.blocksRing0.size();
+}
+// Compiles one file for several targets (--targets x86-64,arm,oryx). The source is parsed
+// and lowered once; the back ends then run from that result on up to jobs threads.
+// Assembly goes to <file>.<target>.s so that x86-64 and arm do not overwrite each other;
+// oryx still writes <file>.oryxir. Returns the number of targets that failed.
+int HTLL_compileTargets(const std::string& fileName, const std::vector<std::string>& targets, int jobs) {
+    std::string source = HTLL_resolvedSource(FileRead(fileName + ".htll"));
+    int count = (int)targets.size();
+    std::vector<std::string> outFiles(count), cacheKeys(count);
+    std::vector<HTLL_Output> outCodes(count);
+    std::vector<int> pending;
+    int failures = 0;
+    for (int i = 0; i < count; i++) {
+        if (!HTLL_selectTarget(targets[i])) {
+            HTLL_report(HTLL_unknownTarget(targets[i]));
+            failures++;
+            continue;
         }
-    } else {
-        if (COUNT_programmingBlock_CPP != 0) {
-            for (int A_Index228 = 0; A_Index228 < COUNT_programmingBlock_CPP; A_Index228++) {
-                codeOUT = StrReplace(codeOUT, "programmingBlock_CPP-programmingBlock_CPP-AA" + STR(A_Index228 + 1) + "AA", Chr(10));
-            }
+        outFiles[i] = targets[i] == "oryx" ? fileName + ".oryxir" : fileName + "." + targets[i] + ".s";
+        if (HTLL_useCache == 1) {
+            cacheKeys[i] = HTLL_cacheKey(source, targets[i], HTLL_cacheOptions());
+        }
+        if (HTLL_cacheHas(cacheKeys[i])) {
+            HTLL_cacheRead(cacheKeys[i], outCodes[i]);
+        } else {
+            pending.push_back(i);
         }
     }
-    if (langToConvertTo == "arm") {
-        if (COUNT_programmingBlock_PY != 0) {
-            for (int A_Index229 = 0; A_Index229 < COUNT_programmingBlock_PY; A_Index229++) {
-                codeOUT = StrReplace(codeOUT, "programmingBlock_PY-programmingBlock_PY-AA" + STR(A_Index229 + 1) + "AA", programmingBlock_PY[A_Index229]);
-            }
+    if (!pending.empty()) {
+        HTLL_FrontEnd frontEnd = HTLL_runFrontEnd(source);
+        if (HTLL_timePasses != 0) {
+            HTLL_report(HTLL_passReport(fileName + ".htll (front end)"));
+        }
+        HTLL_parallelFor((int)pending.size(), jobs, [&](int p) {
+            int i = pending[p];
+            HTLL_loadFrontEnd(frontEnd);
+            HTLL_selectTarget(targets[i]);
+            outCodes[i] = HTLL_backEnd(frontEnd.code);
+            HTLL_cacheStore(cacheKeys[i], outCodes[i]);
+            if (HTLL_timePasses != 0) {
+                HTLL_report(HTLL_passReport(outFiles[i]));
+            }
+        });
+    }
+    for (int i = 0; i < count; i++) {
+        if (outFiles[i] != "") {
+            HTLL_writeOutput(outFiles[i], outCodes[i]);
+            outCodes[i].clear();
+            HTLL_report("Compilation finished: " + outFiles[i] + " generated.");
         }
-    } else {
-        if (COUNT_programmingBlock_PY != 0) {
-            for (int A_Index230 = 0; A_Index230 < COUNT_programmingBlock_PY; A_Index230++) {
-                codeOUT = StrReplace(codeOUT, "programmingBlock_PY-programmingBlock_PY-AA" + STR(A_Index230 + 1) + "AA", Chr(10));
-            }
+    }
+    return failures;
+}
+// --watch: compiles every program in dir, then keeps running and recompiles the programs
+// whose source, or any file they include, changes. A program is a .htll file in dir that
+// no other .htll file in dir includes. Unchanged includes stay lexed in the include cache,
+// programs whose resolved source did not change are served from the compile cache, and the
+// functions of a recompiled program that did not change reuse their code (HTLL_functionCodes).
+std::vector<std::string> HTLL_watchPrograms(const std::string& dir, std::unordered_map<std::string, std::vector<std::string>>& deps) {
+    std::vector<std::string> sources;
+    DIR* handle = opendir(dir.c_str());
+    if (handle == nullptr) {
+        return sources;
+    }
+    while (struct dirent* entry = readdir(handle)) {
+        std::string name = entry->d_name;
+        if (HTLL_endsWith(name, ".htll") && name[0] != '.') {
+            sources.push_back(HTLL_canonicalPath(dir + "/" + name));
         }
     }
-    if (langToConvertTo == "oryx") {
-        if (COUNT_programmingBlock_JS != 0) {
-            for (int A_Index231 = 0; A_Index231 < COUNT_programmingBlock_JS; A_Index231++) {
-                codeOUT = StrReplace(codeOUT, "programmingBlock_JS-programmingBlock_JS-AA" + STR(A_Index231 + 1) + "AA", programmingBlock_JS[A_Index231]);
-            }
+    closedir(handle);
+    std::sort(sources.begin(), sources.end());
+    deps.clear();
+    std::unordered_set<std::string> included;
+    for (const std::string& source : sources) {
+        try {
+            deps[source] = HTLL_includeDeps(FileRead(source));
+        } catch (const std::exception& e) {
+            deps[source] = {};
+        }
+        included.insert(deps[source].begin(), deps[source].end());
+    }
+    std::vector<std::string> programs;
+    for (const std::string& source : sources) {
+        if (!included.count(source)) {
+            programs.push_back(source);
         }
-    } else {
-        if (COUNT_programmingBlock_JS != 0) {
-            for (int A_Index232 = 0; A_Index232 < COUNT_programmingBlock_JS; A_Index232++) {
-                codeOUT = StrReplace(codeOUT, "programmingBlock_JS-programmingBlock_JS-AA" + STR(A_Index232 + 1) + "AA", Chr(10));
+    }
+    return programs;
+}
+void HTLL_watchCompile(const std::vector<std::string>& programs, const std::string& target, int jobs) {
+    HTLL_parallelFor((int)programs.size(), jobs, [&](int i) {
+        try {
+            compileFile(StringTrimRight(programs[i], 5), target);
+        } catch (const std::exception& e) {
+            HTLL_report("Compilation failed: " + programs[i] + ": " + e.what());
+        }
+    });
+}
+int HTLL_watch(const std::string& dir, const std::string& target, int jobs) {
+    HTLL_reuseFunctions = 1;
+    int fd = inotify_init1(IN_CLOEXEC);
+    if (fd < 0) {
+        std::cerr << "Error: inotify is not available: " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+    const uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_MOVED_FROM;
+    std::unordered_map<int, std::string> watchedDirs;
+    std::unordered_set<std::string> watchedPaths;
+    auto watchDir = [&](const std::string& path) {
+        if (watchedPaths.insert(path).second) {
+            int wd = inotify_add_watch(fd, path.c_str(), mask);
+            if (wd >= 0) {
+                watchedDirs[wd] = path;
+            }
+        }
+    };
+    // watch dir itself and every directory an include lives in
+    auto watchDeps = [&](const std::unordered_map<std::string, std::vector<std::string>>& deps) {
+        watchDir(HTLL_canonicalPath(dir));
+        for (const auto& entry : deps) {
+            for (const std::string& dep : entry.second) {
+                watchDir(dep.substr(0, dep.find_last_of('/')));
+            }
+        }
+    };
+    std::unordered_map<std::string, std::vector<std::string>> deps;
+    std::vector<std::string> programs = HTLL_watchPrograms(dir, deps);
+    watchDeps(deps);
+    HTLL_watchCompile(programs, target, jobs);
+    HTLL_report("Watching " + dir + " (" + STR(programs.size()) + " programs). Press Ctrl+C to stop.");
+    alignas(struct inotify_event) char buffer[64 * 1024];
+    while (true) {
+        std::unordered_set<std::string> changed;
+        bool filesAddedOrRemoved = false;
+        // wait for the first event, then collect the rest of an editor's save burst
+        int timeout = -1;
+        while (true) {
+            struct pollfd pfd = {fd, POLLIN, 0};
+            int ready = poll(&pfd, 1, timeout);
+            if (ready < 0 && errno == EINTR) {
+                continue;
+            }
+            if (ready <= 0) {
+                break;
+            }
+            // readv: <unistd.h> clashes with the runtime's own environ declaration
+            struct iovec chunk = {buffer, sizeof(buffer)};
+            ssize_t length = readv(fd, &chunk, 1);
+            if (length <= 0) {
+                break;
+            }
+            for (char* p = buffer; p < buffer + length;) {
+                struct inotify_event* event = (struct inotify_event*)p;
+                p += sizeof(struct inotify_event) + event->len;
+                std::string name = event->len > 0 ? std::string(event->name) : "";
+                if (!HTLL_endsWith(name, ".htll") && !HTLL_endsWith(name, ".htllm")) {
+                    continue;
+                }
+                changed.insert(watchedDirs[event->wd] + "/" + name);
+                if (event->mask & (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO)) {
+                    filesAddedOrRemoved = true;
+                }
             }
+            timeout = 50;
         }
-    }
-    if (langToConvertTo == "x86-64-ring0") {
-        if (COUNT_programmingBlock_GO != 0) {
-            for (int A_Index233 = 0; A_Index233 < COUNT_programmingBlock_GO; A_Index233++) {
-                codeOUT = StrReplace(codeOUT, "programmingBlock_GO-programmingBlock_GO-AA" + STR(A_Index233 + 1) + "AA", programmingBlock_GO[A_Index233]);
+        if (changed.empty()) {
+            continue;
+        }
+        std::unordered_map<std::string, std::vector<std::string>> oldDeps = deps;
+        if (filesAddedOrRemoved) {
+            programs = HTLL_watchPrograms(dir, deps);
+        }
+        std::vector<std::string> affected;
+        for (const std::string& program : programs) {
+            bool isAffected = changed.count(program) > 0 || oldDeps.count(program) == 0;
+            for (const std::string& dep : oldDeps[program]) {
+                isAffected = isAffected || changed.count(dep) > 0;
+            }
+            if (isAffected) {
+                affected.push_back(program);
             }
         }
-    } else {
-        if (COUNT_programmingBlock_GO != 0) {
-            for (int A_Index234 = 0; A_Index234 < COUNT_programmingBlock_GO; A_Index234++) {
-                codeOUT = StrReplace(codeOUT, "programmingBlock_GO-programmingBlock_GO-AA" + STR(A_Index234 + 1) + "AA", Chr(10));
+        HTLL_watchCompile(affected, target, jobs);
+        // includes may have been added or removed by the edit
+        for (const std::string& program : affected) {
+            try {
+                deps[program] = HTLL_includeDeps(FileRead(program));
+            } catch (const std::exception& e) {
+                deps[program] = {};
             }
         }
+        watchDeps(deps);
     }
-    return codeOUT;
+    return 0;
 }
 int main(int argc, char* argv[]) {
     std::string params = Trim(GetParams());
     std::string paramsTemp = "";
     std::string paramsTemp_fileName = "";
-    if (params == "") {
-        print("Usage:" + Chr(10) + "./HTLL your_file.htll <target>" + Chr(10) + "Targets: x86-64, arm, oryx, x86-64-ring0");
+    std::string paramsTemp_target = "";
+    int paramsTemp_positional = 0;
+    int paramsTemp_showCacheStats = 0;
+    int paramsTemp_module = 0;
+    std::vector<std::string> paramsTemp_files;
+    int paramsTemp_jobs = 1;
+    int paramsTemp_expectJobs = 0;
+    int paramsTemp_expectTarget = 0;
+    std::vector<std::string> paramsTemp_targets;
+    int paramsTemp_expectTargets = 0;
+    std::string paramsTemp_watchDir = "";
+    int paramsTemp_expectWatch = 0;
+    int failedFiles = 0;
+    int moduleExports = 0;
+    std::string cacheStats = "";
+    std::string HTLL_usage = "Usage:" + Chr(10) + "./HTLL your_file.htll <target> [--no-cache] [--no-regalloc] [-O1] [--inline-budget=N] [--cache-stats] [--time-passes[=json]]" + Chr(10) + "./HTLL -j N a.htll b.htll ... --target <target>" + Chr(10) + "./HTLL your_file.htll --targets x86-64,arm,oryx" + Chr(10) + "./HTLL --watch dir/ --target <target>" + Chr(10) + "./HTLL your_lib.htll --module" + Chr(10) + "Targets: x86-64, arm, oryx, x86-64-ring0";
+    std::vector<std::string> items235 = LoopParseFunc(params, "\n", "\r");
+    for (size_t A_Index235 = 0; A_Index235 < items235.size(); A_Index235++) {
+        std::string A_LoopField235 = items235[A_Index235 - 0];
+        paramsTemp = Trim(A_LoopField235);
+        if (paramsTemp == "") {
+            continue;
+        }
+        if (paramsTemp_expectJobs == 1) {
+            paramsTemp_jobs = INT(paramsTemp);
+            paramsTemp_expectJobs = 0;
+        }
+        else if (paramsTemp_expectTarget == 1) {
+            paramsTemp_target = paramsTemp;
+            paramsTemp_expectTarget = 0;
+        }
+        else if (paramsTemp_expectWatch == 1) {
+            paramsTemp_watchDir = paramsTemp;
+            paramsTemp_expectWatch = 0;
+        }
+        else if (paramsTemp_expectTargets == 1) {
+            paramsTemp_targets = LoopParseFunc(paramsTemp, ",");
+            paramsTemp_expectTargets = 0;
+        }
+        else if (paramsTemp == "--no-cache") {
+            HTLL_useCache = 0;
+        }
+        else if (paramsTemp == "--no-regalloc") {
+            HTLL_registerAllocation = 0;
+        }
+        else if (paramsTemp == "-O0" || paramsTemp == "-O1") {
+            HTLL_optLevel = paramsTemp == "-O1" ? 1 : 0;
+        }
+        else if (SubStr(paramsTemp, 1, 16) == "--inline-budget=") {
+            HTLL_inlineBudget = INT(SubStr(paramsTemp, 17));
+        }
+        else if (paramsTemp == "--cache-stats") {
+            paramsTemp_showCacheStats = 1;
+        }
+        else if (paramsTemp == "--time-passes" || paramsTemp == "--time-passes=json") {
+            HTLL_timePasses = paramsTemp == "--time-passes" ? 1 : 2;
+            HTLL_useCache = 0;
+        }
+        else if (paramsTemp == "--module") {
+            paramsTemp_module = 1;
+        }
+        else if (paramsTemp == "-j") {
+            paramsTemp_expectJobs = 1;
+        }
+        else if (SubStr(paramsTemp, 1, 2) == "-j") {
+            paramsTemp_jobs = INT(SubStr(paramsTemp, 3));
+        }
+        else if (paramsTemp == "--target") {
+            paramsTemp_expectTarget = 1;
+        }
+        else if (paramsTemp == "--watch") {
+            paramsTemp_expectWatch = 1;
+        }
+        else if (paramsTemp == "--targets") {
+            paramsTemp_expectTargets = 1;
+        }
+        else if (paramsTemp_positional == 0 || SubStrLastChars(paramsTemp, 5) == ".htll") {
+            paramsTemp_fileName = Trim(StringTrimRight(paramsTemp, 5));
+            paramsTemp_files.push_back(paramsTemp_fileName);
+            paramsTemp_positional++;
+        }
+        else {
+            paramsTemp_target = paramsTemp;
+            paramsTemp_positional++;
+        }
     }
-    else if (InStr(params, Chr(10)) == false) {
-        print("Usage:" + Chr(10) + "./HTLL your_file.htll <target>" + Chr(10) + "Targets: x86-64, arm, oryx, x86-64-ring0");
-    } else {
-        std::vector<std::string> items235 = LoopParseFunc(params, "\n", "\r");
-        for (size_t A_Index235 = 0; A_Index235 < items235.size(); A_Index235++) {
-            std::string A_LoopField235 = items235[A_Index235 - 0];
-            paramsTemp = Trim(A_LoopField235);
-            if (A_Index235 == 0) {
-                paramsTemp_fileName = Trim(StringTrimRight(paramsTemp, 5));
-            }
-            if (A_Index235 == 1) {
-                langToConvertTo = paramsTemp;
-                if (paramsTemp == "x86-64") {
-                    is_arm = 0;
-                    is_oryx = 0;
-                    ring0 = 0;
-                    FileDelete(paramsTemp_fileName + ".s");
-                    FileAppend(compiler(FileRead(paramsTemp_fileName + ".htll")), paramsTemp_fileName + ".s");
-                    print("Compilation finished: " + paramsTemp_fileName + ".s generated.");
-                }
-                else if (paramsTemp == "arm") {
-                    is_arm = 1;
-                    is_oryx = 0;
-                    ring0 = 0;
-                    FileDelete(paramsTemp_fileName + ".s");
-                    FileAppend(compiler(FileRead(paramsTemp_fileName + ".htll")), paramsTemp_fileName + ".s");
-                    print("Compilation finished: " + paramsTemp_fileName + ".s generated.");
-                }
-                else if (paramsTemp == "oryx") {
-                    is_arm = 0;
-                    is_oryx = 1;
-                    ring0 = 0;
-                    FileDelete(paramsTemp_fileName + ".oryxir");
-                    FileAppend(compiler(FileRead(paramsTemp_fileName + ".htll")), paramsTemp_fileName + ".oryxir");
-                    print("Compilation finished: " + paramsTemp_fileName + ".oryxir generated.");
-                }
-                else if (paramsTemp == "x86-64-ring0") {
-                    is_arm = 0;
-                    is_oryx = 0;
-                    ring0 = 1;
-                    FileDelete(paramsTemp_fileName + ".s");
-                    FileAppend(compiler(FileRead(paramsTemp_fileName + ".htll")), paramsTemp_fileName + ".s");
-                    print("Compilation finished: " + paramsTemp_fileName + ".s generated.");
-                } else {
-                    print("Usage:" + Chr(10) + "./HTLL your_file.htll <target>" + Chr(10) + "Targets: x86-64, arm, oryx, x86-64-ring0");
-                }
-            }
+    if (paramsTemp_watchDir != "" && HTLL_isTarget(paramsTemp_target)) {
+        return HTLL_watch(paramsTemp_watchDir, paramsTemp_target, paramsTemp_jobs);
+    }
+    else if (paramsTemp_fileName != "" && paramsTemp_module == 1) {
+        for (int A_Index236 = 0; A_Index236 < paramsTemp_files.size() + 0; A_Index236++) {
+            paramsTemp_fileName = paramsTemp_files[A_Index236];
+            moduleExports = HTLL_writeLibraryModule(paramsTemp_fileName + ".htll", paramsTemp_fileName + ".htllm");
+            print("Module finished: " + paramsTemp_fileName + ".htllm generated (" + STR(moduleExports) + " exports).");
+        }
+    }
+    else if (paramsTemp_files.size() > 0 && paramsTemp_targets.size() > 0) {
+        for (int A_Index237 = 0; A_Index237 < paramsTemp_files.size() + 0; A_Index237++) {
+            failedFiles += HTLL_compileTargets(paramsTemp_files[A_Index237], paramsTemp_targets, paramsTemp_jobs);
+        }
+    }
+    else if (paramsTemp_files.size() == 1 && paramsTemp_jobs == 1 && paramsTemp_target != "") {
+        if (compileFile(paramsTemp_fileName, paramsTemp_target) == false) {
+            print(HTLL_unknownTarget(paramsTemp_target));
+        }
+    }
+    else if (paramsTemp_files.size() > 0 && HTLL_isTarget(paramsTemp_target)) {
+        failedFiles = HTLL_compileFiles(paramsTemp_files, paramsTemp_target, paramsTemp_jobs);
+        if (failedFiles > 0) {
+            print(STR(failedFiles) + " of " + STR(paramsTemp_files.size()) + " files failed.");
+        }
+    }
+    else if (paramsTemp_target != "" && HTLL_isTarget(paramsTemp_target) == false) {
+        print(HTLL_unknownTarget(paramsTemp_target));
+    }
+    else if (paramsTemp_showCacheStats == 0) {
+        print(HTLL_usage);
+    }
+    if (HTLL_useCache == 1) {
+        cacheStats = HTLL_cacheFlushStats();
+        if (paramsTemp_showCacheStats == 1) {
+            print(cacheStats);
         }
     }
     
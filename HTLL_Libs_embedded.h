@@ -0,0 +1,2393 @@
+// Generated by embed_libs.sh from HTLL_Libs_x86.txt, HTLL_Libs_ring0.txt and HTLL_Libs_AArch64.txt.
+// Do not edit by hand: edit the .txt files and run ./embed_libs.sh again.
+struct HTLL_EmbeddedRoutine {
+    const char* name;
+    const char* body;
+};
+struct HTLL_EmbeddedIndexEntry {
+    const char* name;
+    int routine;
+};
+struct HTLL_EmbeddedLibrary {
+    const char* file;
+    const HTLL_EmbeddedRoutine* routines;
+    const HTLL_EmbeddedIndexEntry* index;
+    int count;
+};
+static const HTLL_EmbeddedRoutine HTLL_Libs_x86_routines[] = {
+    {"is_nint_negative", R"HTLL_LIB(; =============================================================================
+; UTILITY FUNCTIONS (Correct and Properly Formatted)
+; =============================================================================
+; is_nint_negative: Reads a signed number, updates its corresponding sign
+;                   flag, AND converts the original number to its positive
+;                   magnitude if it was negative.
+;
+; [In]
+;   rdi - Pointer to the nint variable (which holds a signed value).
+;   rsi - Pointer to the is_negative flag variable for that nint.
+;
+; [Out]
+;   The memory at [rsi] will be overwritten with 0 or 1.
+;   The memory at [rdi] will be overwritten with its positive magnitude.
+is_nint_negative:
+    push rbp
+    mov rbp, rsp
+    push rax
+    ; Load the actual signed value from the first pointer
+    mov rax, [rdi]
+    ; Check its sign using the CPU's Sign Flag
+    test rax, rax
+    jns .is_positive_or_zero    
+.is_negative:
+    ; The number is negative.
+    ; 1. Update the flag variable to 1.
+    mov qword [rsi], 1
+    
+    ; 2. Negate the value to get its positive magnitude.
+    neg rax
+    
+    ; 3. Store the positive magnitude BACK into the original variable.
+    mov [rdi], rax
+    jmp .done
+.is_positive_or_zero:
+    ; The number is positive or zero.
+    ; 1. Update the flag variable to 0.
+    mov qword [rsi], 0
+    ; 2. The value at [rdi] is already its own positive magnitude, so we do nothing to it.
+.done:
+    pop rax
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"divide_and_store", R"HTLL_LIB(; divide_and_store: Performs fixed-point division and stores results in memory.
+; [In] rdi: dividend_int, rsi: dividend_dec
+;      rdx: divisor_int,  rcx: divisor_dec
+;      r8:  ptr to result_int, r9: ptr to result_dec
+divide_and_store:
+    ; Prologue
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    ; --- THE FIX: Save all volatile input arguments immediately ---
+    mov r12, rdi            
+    mov r13, rsi            
+    mov r14, rdx            
+    mov r15, rcx            
+    
+    ; --- Step 1: Scale the Dividend ---
+    mov rax, r12
+    mov rbx, [SCALE_FACTOR]
+    mul rbx
+    add rax, r13 
+    mov r12, rax 
+    ; --- Step 2: Scale the Divisor ---
+    mov rax, r14 
+    mov rbx, [SCALE_FACTOR]
+    mul rbx
+    add rax, r15 
+    mov r13, rax 
+    
+    ; --- Step 3: Perform the main 128-bit division ---
+    mov rax, r12        
+    mov rbx, [SCALE_FACTOR]
+    mul rbx
+    div r13
+    
+    ; --- Step 4: De-scale the final result ---
+    mov rbx, [SCALE_FACTOR]
+    xor rdx, rdx
+    div rbx
+    ; --- Step 5: Store the results using the pointers from r8 and r9 ---
+    mov [r8], rax 
+    mov [r9], rdx 
+    ; Epilogue
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    ret
+)HTLL_LIB"},
+    {"print_div", R"HTLL_LIB(; print_div: (Unchanged logic, but now properly formatted)
+; [In] rdi: integer part, rsi: decimal part
+print_div:
+    ; Prologue
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push rcx
+    push rsi
+    ; --- Print integer part ---
+    mov rax, rdi
+    lea r12, [print_buffer + 19]
+    mov byte [r12], 0
+    dec r12
+    mov rbx, 10
+.int_convert_loop:
+    xor rdx, rdx
+    div rbx
+    add rdx, '0'
+    mov [r12], dl
+    dec r12
+    cmp rax, 0
+    jne .int_convert_loop
+    inc r12
+    mov rsi, r12
+    lea rdx, [print_buffer + 19]
+    sub rdx, rsi
+    mov rax, 1
+    mov rdi, 1
+    syscall
+    ; --- Print decimal point ---
+    mov rax, 1
+    mov rdi, 1
+    mov rsi, dot
+    mov rdx, 1
+    syscall
+    ; --- Print decimal part ---
+    pop rax
+    lea r12, [print_buffer + 5]
+    mov rbx, 10
+    mov rcx, 6
+.dec_convert_loop:
+    xor rdx, rdx
+    div rbx
+    add rdx, '0'
+    mov [r12], dl
+    dec r12
+    loop .dec_convert_loop
+    mov rax, 1
+    mov rdi, 1
+    lea rsi, [print_buffer]
+    mov rdx, 6
+    syscall
+    ; Print a final newline.
+    mov rax, 1
+    mov rdi, 1
+    mov rsi, nl
+    mov rdx, 1
+    syscall
+    ; Epilogue
+    pop rcx
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"print_number", R"HTLL_LIB(; print_number: Prints a number, prepending a '-' sign if requested.
+;
+; [In]
+;   rdi - The number to print (as an unsigned, positive magnitude).
+;   rsi - The "is_negative" flag. 0 for positive, 1 for negative.
+print_number:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push rdi    
+    ; Check the is_negative flag passed in rsi
+    cmp rsi, 0
+    je .skip_sign_print
+    ; Flag is 1, so print a minus sign.
+    ; This is safe because the number is preserved on the stack.
+    mov rax, 1
+    mov rdi, 1
+    mov rsi, minus_sign
+    mov rdx, 1
+    syscall
+.skip_sign_print:
+    ; Restore the saved number from the stack directly into RAX,
+    ; which is the register we need for the division loop.
+    pop rax
+    ; The conversion loop, which now operates on the correct number in rax.
+    lea r12, [print_buffer + 19]
+    mov byte [r12], 0
+    dec r12
+    mov rbx, 10
+.conversion_loop:
+    xor rdx, rdx
+    div rbx
+    add rdx, '0'
+    mov [r12], dl
+    dec r12
+    cmp rax, 0
+    jne .conversion_loop
+    inc r12
+    mov rsi, r12
+    lea rdx, [print_buffer + 20]
+    sub rdx, rsi
+    mov rax, 1
+    mov rdi, 1
+    syscall
+    ; Print a final newline.
+    mov rax, 1
+    mov rdi, 1
+    mov rsi, nl
+    mov rdx, 1
+    syscall
+    ; The stack is balanced because we pushed RDI and popped it into RAX.
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"print_str", R"HTLL_LIB(print_str:
+    push rbp
+    mov rbp, rsp
+    mov rax, 1
+    mov rdi, 1
+    ; rsi and rdx are expected to be set by the caller
+    syscall
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"input", R"HTLL_LIB(; input: Reads a line from stdin, handles empty input, removes the trailing
+;        newline, and stores the raw string and its length.
+;
+; [In]
+;   rdi - Pointer to the buffer where the string should be stored.
+;   rsi - Pointer to a qword where the length of the clean string will be stored.
+input:
+    push rbp
+    mov rbp, rsp
+    push r12
+    push r13
+    ; Save the pointers passed as arguments immediately
+    mov r12, rdi 
+    mov r13, rsi 
+    ; Correctly set up all registers for the sys_read syscall
+    mov rax, 0
+    mov rdi, 0
+    mov rsi, r12
+    mov rdx, 100
+    syscall
+    ; The program waits here. rax will return with bytes read.
+    ; Check if the user entered anything. If they just press Enter, rax will be 1.
+    ; If they press Ctrl+D, rax will be 0. Both cases mean empty input.
+    cmp rax, 1
+    jle .read_empty
+    ; This code only runs for valid input (rax > 1).
+    ; The length of the clean string is (bytes_read - 1).
+    dec rax
+    jmp .store_length
+.read_empty:
+    ; === THE FIX IS HERE ===
+    ; If the input was empty, explicitly set the length to 0.
+    xor rax, rax
+.store_length:
+    ; Store the final calculated length (either from dec rax or xor rax)
+    ; into the memory location pointed to by r13.
+    mov [r13], rax
+    pop r13
+    pop r12
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"array_copy", R"HTLL_LIB(; =============================================================================
+; DYNAMIC ARRAY LIBRARY FUNCTIONS (Final, Corrected Version)
+; =============================================================================
+; array_clear: Clears a dynamic array by setting its size to 0.
+; =============================================================================
+; array_copy: Copies all elements from a source array to a destination array.
+; The destination keeps its buffer when its capacity already fits the source,
+; so copying into the same array again costs no syscall. Otherwise the buffer
+; is replaced by one of twice the old capacity, or the source size if larger.
+; Any existing data in the destination array will be overwritten.
+; [In]
+;   rdi - Pointer to the destination DynamicArray struct.
+;   rsi - Pointer to the source DynamicArray struct.
+; =============================================================================
+array_copy:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    mov r12, rdi
+    mov r13, rsi
+    cmp r12, r13
+    je .copy_epilogue_fix
+    mov rbx, [r13 + DynamicArray.size]
+    mov r15, [r12 + DynamicArray.capacity]
+    ; --- Step 1: Reuse the destination's memory block if it is big enough ---
+    mov rdi, [r12 + DynamicArray.pointer]
+    cmp rdi, 0
+    je .copy_grow
+    cmp rbx, r15
+    jbe .copy_data
+    mov rsi, r15
+    shl rsi, 3
+    mov rax, 11
+    syscall
+.copy_grow:
+    ; --- Step 2: Allocate max(2 * capacity, size) elements ---
+    mov qword [r12 + DynamicArray.pointer], 0
+    mov qword [r12 + DynamicArray.size], 0
+    mov qword [r12 + DynamicArray.capacity], 0
+    cmp rbx, 0
+    je .copy_epilogue_fix
+    mov r14, r15
+    shl r14, 1
+    cmp r14, rbx
+    jae .copy_alloc
+    mov r14, rbx
+.copy_alloc:
+    mov rax, 9
+    mov rdi, 0
+    mov rsi, r14
+    shl rsi, 3
+    mov rdx, 3
+    mov r10, 34
+    mov r8, -1
+    mov r9, 0
+    syscall
+    cmp rax, 0
+    jl .copy_epilogue_fix
+    mov [r12 + DynamicArray.pointer], rax
+    mov [r12 + DynamicArray.capacity], r14
+.copy_data:
+    ; --- Step 3: Copy the data ---
+    mov [r12 + DynamicArray.size], rbx
+    mov rsi, [r13 + DynamicArray.pointer]
+    mov rdi, [r12 + DynamicArray.pointer]
+    mov rcx, rbx
+    rep movsq
+.copy_epilogue_fix:
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"array_clear", R"HTLL_LIB(; [In] rdi: Pointer to the DynamicArray struct.
+array_clear:
+    push rbp
+    mov rbp, rsp
+    ; Set the .size field of the struct pointed to by rdi to 0.
+    mov qword [rdi + DynamicArray.size], 0
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"array_append", R"HTLL_LIB(; =============================================================================
+; array_append: Appends a qword value to a dynamic array, resizing if necessary.
+; The first block is one page of INITIAL_CAPACITY elements; after that the
+; capacity doubles and mremap lets the kernel move the pages instead of copying.
+; =============================================================================
+array_append:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    mov r12, rdi
+    mov r13, rsi
+    mov rcx, [r12 + DynamicArray.size]
+    cmp rcx, [r12 + DynamicArray.capacity]
+    jl .has_space
+; --- Resize Logic: new capacity = max(2 * capacity, INITIAL_CAPACITY) ---
+.resize:
+    mov rbx, [r12 + DynamicArray.capacity]
+    shl rbx, 1
+    cmp rbx, INITIAL_CAPACITY
+    jge .capacity_calculated
+    mov rbx, INITIAL_CAPACITY
+.capacity_calculated:
+    mov rdi, [r12 + DynamicArray.pointer]
+    cmp rdi, 0
+    je .append_map
+    ; --- mremap(pointer, capacity * 8, new capacity * 8, MREMAP_MAYMOVE) ---
+    mov rsi, [r12 + DynamicArray.capacity]
+    shl rsi, 3
+    mov rdx, rbx
+    shl rdx, 3
+    mov r10, 1
+    mov rax, 25
+    syscall
+    jmp .append_mapped
+.append_map:
+    mov rax, 9
+    mov rdi, 0
+    mov rsi, rbx
+    shl rsi, 3
+    mov rdx, 3
+    mov r10, 34
+    mov r8, -1
+    mov r9, 0
+    syscall
+.append_mapped:
+    ; Syscalls return a negative value on error.
+    cmp rax, 0
+    jl .mmap_failed
+    mov [r12 + DynamicArray.pointer], rax
+    mov [r12 + DynamicArray.capacity], rbx
+.has_space:
+    mov rbx, [r12 + DynamicArray.pointer]
+    mov rcx, [r12 + DynamicArray.size]
+    mov [rbx + rcx * 8], r13
+    inc qword [r12 + DynamicArray.size]
+    jmp .append_epilogue
+.mmap_failed:
+    ; If the allocation fails, we can't continue. Exit with an error code (e.g., 1).
+    mov rax, 60
+    mov rdi, 1
+    syscall
+.append_epilogue:
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"array_reserve", R"HTLL_LIB(; =============================================================================
+; array_reserve: Grows a dynamic array's capacity to at least rsi elements, so
+; the appends that follow do not resize. The size and the elements are kept.
+; [In]
+;   rdi - Pointer to the DynamicArray struct.
+;   rsi - Number of elements to make room for.
+; =============================================================================
+array_reserve:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    mov r12, rdi
+    mov rbx, rsi
+    cmp rbx, [r12 + DynamicArray.capacity]
+    jle .reserve_done
+    mov rdi, [r12 + DynamicArray.pointer]
+    cmp rdi, 0
+    je .reserve_map
+    mov rsi, [r12 + DynamicArray.capacity]
+    shl rsi, 3
+    mov rdx, rbx
+    shl rdx, 3
+    mov r10, 1
+    mov rax, 25
+    syscall
+    jmp .reserve_mapped
+.reserve_map:
+    mov rax, 9
+    mov rdi, 0
+    mov rsi, rbx
+    shl rsi, 3
+    mov rdx, 3
+    mov r10, 34
+    mov r8, -1
+    mov r9, 0
+    syscall
+.reserve_mapped:
+    cmp rax, 0
+    jl .reserve_failed
+    mov [r12 + DynamicArray.pointer], rax
+    mov [r12 + DynamicArray.capacity], rbx
+    jmp .reserve_done
+.reserve_failed:
+    mov rax, 60
+    mov rdi, 1
+    syscall
+.reserve_done:
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"array_pop", R"HTLL_LIB(array_pop:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push rcx
+    push r8
+    mov r8, rdi
+    mov rcx, [r8 + DynamicArray.size]
+    cmp rcx, 0
+    je .pop_empty
+    dec rcx
+    mov [r8 + DynamicArray.size], rcx
+    mov rbx, [r8 + DynamicArray.pointer]
+    mov rax, [rbx + rcx * 8]
+    jmp .pop_done
+.pop_empty:
+    xor rax, rax
+.pop_done:
+    pop r8
+    pop rcx
+    pop rbx
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"print_char", R"HTLL_LIB(print_char:
+    push rbp
+    mov rbp, rsp
+    ; Push the entire RDI register. This subtracts 8 bytes from RSP,
+    ; which keeps the stack correctly aligned. The character is in DIL,
+    ; the lowest byte of RDI, so this works perfectly.
+    push rdi
+    mov rax, 1                 
+    mov rdi, 1                 
+    mov rsi, rsp               
+    mov rdx, 1                 
+    syscall
+    ; Clean up the stack by popping the value we pushed.
+    ; This adds 8 back to RSP, restoring it.
+    pop rdi
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"sys_read_line", R"HTLL_LIB(; =============================================================================
+; sys_read_line: A low-level wrapper around the sys_read syscall for stdin.
+; [In]
+;   rdi - Pointer to the buffer where the string should be stored.
+;   rsi - Max number of bytes to read.
+; [Out]
+;   rax - The number of bytes actually read (including newline).
+; =============================================================================
+sys_read_line:
+    push rbp
+    mov rbp, rsp
+    ; Prepare arguments for the sys_read syscall
+    mov rax, 0      
+    mov rdx, rsi    
+    mov rsi, rdi    
+    mov rdi, 0      
+    
+    syscall         
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"get_user_input", R"HTLL_LIB(; =============================================================================
+; get_user_input: (Final, Clean, Production Version)
+; Correctly prompts, reads, and appends user input.
+; =============================================================================
+get_user_input:
+    ; --- Prologue: Save all callee-saved registers we will use. ---
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    ; Correctly align the entire stack frame for all subsequent calls.
+    sub rsp, 8
+    ; Save arguments immediately into safe callee-saved registers.
+    mov r12, rdi
+    mov r13, rsi
+    ; --- Part 1: Print the prompt string ---
+    mov rcx, [r13 + DynamicArray.size]
+    cmp rcx, 0
+    je .read_from_user
+    mov r14, rcx            
+    add rcx, 15             
+    and rcx, -16
+    mov rbx, rcx            
+    sub rsp, rbx            
+    ; Pack the prompt into the stack buffer.
+    mov rdi, rsp
+    mov rsi, [r13 + DynamicArray.pointer]
+    push rbx
+    xor rbx, rbx
+.pack_loop:
+    cmp rbx, r14
+    jge .do_prompt_print
+    mov al, [rsi + rbx*8]
+    mov [rdi + rbx], al
+    inc rbx
+    jmp .pack_loop
+.do_prompt_print:
+    pop rbx 
+    
+    mov rax, 1
+    mov rdi, 1
+    mov rsi, rsp
+    mov rdx, r14
+    syscall
+    add rsp, rbx
+    ; --- Part 2: Read user's input ---
+.read_from_user:
+    mov rax, 0
+    mov rdi, 0
+    mov rsi, input_buffer
+    mov rdx, 255
+    syscall
+    ; --- Part 3: Append the input to the dynamic array ---
+    cmp rax, 1
+    jle .done
+    dec rax
+    mov r14, rax
+    mov r15, input_buffer
+.append_char_loop:
+    cmp r14, 0
+    je .done
+    mov rdi, r12
+    movzx rsi, byte [r15]
+    call array_append
+    inc r15
+    dec r14
+    jmp .append_char_loop
+.done:
+    ; --- Epilogue: Restore the stack and all saved registers. ---
+    add rsp, 8
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"fileread_from_ptr", R"HTLL_LIB(; =============================================================================
+; =============================================================================
+; HTLL DYNAMIC FILE I/O LIBRARY - POINTER-BASED VERSIONS
+; These functions are the key to building a truly dynamic compiler.
+; =============================================================================
+; =============================================================================
+; =============================================================================
+; file_read_from_ptr: Appends a file's contents to a dynamic array.
+; [In]
+;   rdi - Pointer to the destination DynamicArray struct.
+;   rsi - A POINTER to a null-terminated string containing the file path.
+; =============================================================================
+fileread_from_ptr:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    mov r12, rdi             
+    mov r13, rsi             
+    ; --- Open the file ---
+    mov rax, 2               
+    mov rdi, r13
+    xor rsi, rsi             
+    syscall
+    
+    ; ======================= THE ARMOR PLATE =========================
+    ; A valid file descriptor is a small positive number. Errors are negative.
+    cmp rax, 0
+    jl .read_error_ptr
+    ; ===================================================================
+    mov r14, rax      
+.read_loop_ptr:
+    mov rax, 0        
+    mov rdi, r14
+    mov rsi, file_read_buffer
+    mov rdx, 4096
+    syscall
+    cmp rax, 0
+    jle .close_and_exit_ptr      
+    mov r15, rax             
+    mov rsi, file_read_buffer
+.append_byte_loop_ptr:
+    cmp r15, 0
+    je .read_loop_ptr            
+    movzx rbx, byte [rsi]    
+    
+    push rsi                 
+    mov rdi, r12             
+    mov rsi, rbx             
+    call array_append
+    pop rsi                  
+    inc rsi                  
+    dec r15                  
+    jmp .append_byte_loop_ptr
+.close_and_exit_ptr:
+    mov rax, 3
+    mov rdi, r14             
+    syscall
+    jmp .read_done_ptr
+.read_error_ptr:
+    ; The open failed. We do nothing. The destination array remains empty.
+    ; A real-world version would print an error to stderr.
+.read_done_ptr:
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"fileappend_from_ptr", R"HTLL_LIB(; =============================================================================
+; file_append_from_ptr: Appends an array of character codes to a file.
+; [In]
+;   rdi - A POINTER to a null-terminated string containing the file path.
+;   rsi - Pointer to the source DynamicArray struct.
+; =============================================================================
+fileappend_from_ptr:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    mov r12, rdi
+    mov r13, rsi
+    mov rcx, [r13 + DynamicArray.size]
+    cmp rcx, 0
+    je .append_epilogue_ptr
+    ; --- Pack the array into a byte buffer on the stack ---
+    mov r14, rcx
+    mov rbx, rcx
+    add rbx, 15
+    and rbx, -16
+    sub rsp, rbx
+    
+    mov r15, rsp
+    mov rsi, [r13 + DynamicArray.pointer]
+    xor rcx, rcx
+.pack_loop_ptr:
+    cmp rcx, r14
+    jge .pack_done_ptr
+    mov al, [rsi + rcx*8]
+    mov [r15 + rcx], al
+    inc rcx
+    jmp .pack_loop_ptr
+.pack_done_ptr:
+    ; --- Open the file ---
+    mov rax, 2
+    mov rdi, r12
+    mov rsi, 1089       
+    mov rdx, 420
+    syscall
+    ; ======================= THE ARMOR PLATE =========================
+    cmp rax, 0
+    jl .append_error_ptr     
+    ; ===================================================================
+    mov r14, rax            
+    ; --- Write the packed data ---
+    mov rax, 1
+    mov rdi, r14
+    mov rsi, r15
+    mov rdx, [r13 + DynamicArray.size]
+    syscall
+    ; --- Close the file ---
+    mov rax, 3
+    mov rdi, r14
+    syscall
+.append_error_ptr:
+    ; This label is jumped to if open fails. We just clean up the stack.
+.append_cleanup_ptr:
+    add rsp, rbx 
+.append_epilogue_ptr:
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"filedelete_from_ptr", R"HTLL_LIB(; =============================================================================
+; file_delete_from_ptr: Deletes a file from the filesystem.
+; [In]
+;   rdi - A POINTER to a null-terminated string containing the file path.
+; =============================================================================
+filedelete_from_ptr:
+    push rbp
+    mov rbp, rsp
+    
+    mov rax, 87
+    syscall
+    ; For robustness, you could check if rax is 0 (success) or -1 (failure)
+    
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"file_read", R"HTLL_LIB(; =============================================================================
+; =============================================================================
+; ORIGINAL STATIC (LABEL-BASED) FUNCTIONS
+; Kept for compatibility and for handling hardcoded file paths.
+; =============================================================================
+; =============================================================================
+; =============================================================================
+; file_read: Appends a file's contents to a dynamic array.
+; =============================================================================
+file_read:
+    ; This function's logic is already pointer-based, so it works as is.
+    ; We can simply call the new, more clearly named function.
+    jmp fileread_from_ptr
+)HTLL_LIB"},
+    {"file_append", R"HTLL_LIB(; =============================================================================
+; file_append: Appends an array of character codes to a file.
+; =============================================================================
+file_append:
+    ; This function's logic is also already pointer-based.
+    jmp fileappend_from_ptr
+)HTLL_LIB"},
+    {"file_delete", R"HTLL_LIB(; =============================================================================
+; file_delete: Deletes a file from the filesystem.
+; =============================================================================
+file_delete:
+    ; This function's logic is also already pointer-based.
+    jmp filedelete_from_ptr
+)HTLL_LIB"},
+    {"array_pack_to_bytes", R"HTLL_LIB(; =============================================================================
+; ADAPTER FUNCTION 1: HTLL arr -> C-style string (char*)
+; =============================================================================
+; Takes an HTLL array and creates a C-style string from it.
+; [In]  rdi - Pointer to the source DynamicArray struct.
+; [Out] rax - Pointer to the new C-style string (or 0 on error).
+;==============================================================================
+; =============================================================================
+; ADAPTER FUNCTION 1: HTLL arr -> C-style string (char*) (Robust Version)
+; =============================================================================
+array_pack_to_bytes:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    ; --- ROBUSTNESS CHECK 1 ---
+    ; Check if the struct pointer itself is null
+    cmp rdi, 0
+    je .pack_fail
+    mov r14, [rdi + DynamicArray.pointer] 
+    mov r12, [rdi + DynamicArray.size]    
+    ; --- ROBUSTNESS CHECK 2 ---
+    ; Check if the array's internal data pointer is null or if size is zero
+    cmp r14, 0
+    je .pack_fail
+    cmp r12, 0
+    je .pack_fail 
+    ; === Step A: Ask the kernel for memory ===
+    mov r13, r12
+    inc r13
+    mov rax, 9
+    mov rdi, 0
+    mov rsi, r13
+    mov rdx, 3
+    mov r10, 34
+    mov r8, -1
+    mov r9, 0
+    syscall
+    
+    cmp rax, 0
+    jl .pack_fail
+    ; === Step B: Copy the bytes, one by one ===
+    mov r13, rax
+    xor rbx, rbx
+.pack_loop:
+    cmp rbx, r12
+    jge .pack_add_null
+    mov rcx, [r14 + rbx*8]
+    mov [r13 + rbx], cl
+    
+    inc rbx
+    jmp .pack_loop
+.pack_add_null:
+    mov byte [r13 + rbx], 0
+    mov rax, r13
+    mov rdx, r12
+    inc rdx     
+    jmp .pack_done
+.pack_fail:
+    xor rax, rax
+.pack_done:
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"array_unpack_from_bytes", R"HTLL_LIB(; =============================================================================
+; ADAPTER FUNCTION 2: C-style string (char*) -> HTLL arr
+; =============================================================================
+; Takes a C-style string and populates an HTLL DynamicArray with its characters.
+; [In]
+;   rdi - Pointer to the destination DynamicArray struct.
+;   rsi - Pointer to the source, null-terminated C-style string.
+;==============================================================================
+; =============================================================================
+; ADAPTER FUNCTION 2: C-style string (char*) -> HTLL arr (Robust Version)
+; =============================================================================
+array_unpack_from_bytes:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    mov r12, rdi  
+    mov r13, rsi  
+    ; --- THE FIX IS HERE ---
+    ; Before we do anything, check if the C-string pointer is NULL.
+    cmp r13, 0
+    je .unpack_done       
+    ; --- END FIX ---
+    ; Clear the destination array to be safe.
+    mov rdi, r12
+    call array_clear
+.unpack_loop:
+    movzx rbx, byte [r13]
+    cmp rbx, 0           
+    je .unpack_done      
+    ; Append the character to the HTLL array.
+    mov rdi, r12
+    mov rsi, rbx
+    call array_append
+    
+    inc r13
+    jmp .unpack_loop
+.unpack_done:
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"free_packed_string", R"HTLL_LIB(; =============================================================================
+; free_packed_string: Frees memory allocated by sys_mmap.
+; [In]
+;   rdi - Pointer to the memory block.
+;   rsi - The size of the memory block in bytes.
+; =============================================================================
+free_packed_string:
+    push rbp
+    mov rbp, rsp
+    
+    ; Robustness check: Don't try to free a null pointer.
+    cmp rdi, 0
+    je .free_done
+    mov rax, 11
+    ; rdi (pointer) and rsi (size) are already set by the caller.
+    syscall
+.free_done:
+    pop rbp
+    ret
+)HTLL_LIB"},
+    {"sleep_ms", R"HTLL_LIB(; =============================================================
+; sleep_ms
+; [In] rdi = milliseconds to sleep
+; =============================================================
+sleep_ms:
+    ; --- 1. Math: Split ms into Seconds and Nanoseconds ---
+    mov rax, rdi            
+    xor rdx, rdx            
+    mov rcx, 1000
+    div rcx                 
+    imul rdx, rdx, 1000000  
+    ; --- 2. Build 'timespec' Struct on Stack ---
+    ; Struct is 16 bytes: { qword tv_sec, qword tv_nsec }
+    sub rsp, 16              
+    mov [rsp], rax           
+    mov [rsp+8], rdx         
+    ; --- 3. Call Kernel ---
+    mov rax, 35              
+    mov rdi, rsp             
+    xor rsi, rsi             
+    syscall
+    ; --- 4. Cleanup ---
+    add rsp, 16              
+    ret
+)HTLL_LIB"},
+};
+static const HTLL_EmbeddedIndexEntry HTLL_Libs_x86_index[] = {
+    {"array_append", 8},
+    {"array_clear", 7},
+    {"array_copy", 6},
+    {"array_pack_to_bytes", 20},
+    {"array_pop", 10},
+    {"array_reserve", 9},
+    {"array_unpack_from_bytes", 21},
+    {"divide_and_store", 1},
+    {"file_append", 18},
+    {"file_delete", 19},
+    {"file_read", 17},
+    {"fileappend_from_ptr", 15},
+    {"filedelete_from_ptr", 16},
+    {"fileread_from_ptr", 14},
+    {"free_packed_string", 22},
+    {"get_user_input", 13},
+    {"input", 5},
+    {"is_nint_negative", 0},
+    {"print_char", 11},
+    {"print_div", 2},
+    {"print_number", 3},
+    {"print_str", 4},
+    {"sleep_ms", 23},
+    {"sys_read_line", 12},
+};
+static const HTLL_EmbeddedRoutine HTLL_Libs_ring0_routines[] = {
+    {"_kmalloc", R"HTLL_LIB(_kmalloc:
+    push rbx
+    push rdx
+    mov rax, [heap_ptr]
+    mov rdx, rax
+    add rdx, rbx
+    mov [heap_ptr], rdx
+    mov rax, rdx
+    ; Standard bump alloc: Return OLD pointer, increment variable.
+    ; My previous logic was: load ptr, save to RDX, add size, save back.
+    ; This means RAX returned the END of the block? No.
+    
+    ; Correct Bump Alloc Logic:
+    sub rdx, rbx
+    mov rax, rdx
+    
+    pop rdx
+    pop rbx
+    ret
+)HTLL_LIB"},
+    {"_kfree", R"HTLL_LIB(; _kfree: No-op in bump allocator
+_kfree:
+    ret
+)HTLL_LIB"},
+    {"print_str", R"HTLL_LIB(; print_str: Prints string at RSI with length RDX
+; [In] RSI: Pointer to string
+; [In] RDX: Length of string (This is what your compiler provides!)
+print_str:
+    push rsi
+    push rax
+    push rcx
+    
+    mov rcx, rdx
+    cmp rcx, 0
+    je .done
+.loop:
+    mov al, [rsi]
+    call print_char
+    inc rsi
+    dec rcx
+    jnz .loop
+.done:
+    pop rcx
+    pop rax
+    pop rsi
+    ret
+)HTLL_LIB"},
+    {"print_char", R"HTLL_LIB(print_char:
+    ; 1. Save all registers to the stack
+    push rdi
+    push rbx
+    push rcx
+    push rdx
+    push rax
+    push rsi
+    ; 2. CRITICAL FIX: Save the character (AL) into BL immediately.
+    ; Since we pushed RBX, we can use BL as a safe scratchpad for this function.
+    mov bl, al
+    ; 3. Handle Newline Character (ASCII 10)
+    cmp bl, 10
+    je .handle_newline
+    ; 4. Handle Horizontal Line Wrapping
+    cmp qword [cursor_x], 80
+    jl .x_ok
+    mov qword [cursor_x], 0
+    inc qword [cursor_y]
+.x_ok:
+    ; 5. CRITICAL FIX: Ensure we scroll BEFORE calculating the memory address
+    cmp qword [cursor_y], 25
+    jl .y_ok
+    call .scroll_logic
+.y_ok:
+    ; 6. Calculate Memory Offset: (y * 80 + x) * 2
+    mov rax, [cursor_y]
+    imul rax, 80        ; imul is safe, it won't clobber RDX like 'mul' does
+    add rax, [cursor_x]
+    shl rax, 1          ; Multiply by 2 (char + attribute)
+    ; 7. Write to the Buffer
+    lea rdi, [video_buffer + rax]
+    mov [rdi], bl       ; Write the character we saved in BL
+    mov byte [rdi+1], 0x0F ; White text on Black background
+    
+    inc qword [cursor_x]
+    jmp .done
+.handle_newline:
+    mov qword [cursor_x], 0
+    inc qword [cursor_y]
+    cmp qword [cursor_y], 25
+    jl .done
+    call .scroll_logic
+    jmp .done
+.scroll_logic:
+    ; Move the entire screen up by one line (160 bytes)
+    lea rsi, [video_buffer + 160]
+    lea rdi, [video_buffer]
+    mov rcx, 480        ; 3840 bytes / 8 bytes per qword
+    cld
+    rep movsq
+    
+    ; Clear the newly created bottom line with spaces
+    lea rdi, [video_buffer + 3840]
+    mov rax, 0x0F200F200F200F20 ; "Space" char with white attribute
+    mov rcx, 20         ; 160 bytes / 8
+    rep stosq
+    
+    mov qword [cursor_y], 24
+    ret
+.done:
+    ; Restore all registers and return
+    pop rsi
+    pop rax
+    pop rdx
+    pop rcx
+    pop rbx
+    pop rdi
+    ret
+)HTLL_LIB"},
+    {"array_clear", R"HTLL_LIB(; array_clear: Resets the array size to 0.
+; [In] RDI: Pointer to the array struct.
+array_clear:
+    mov qword [rdi + 8], 0
+    ret
+)HTLL_LIB"},
+    {"get_user_input", R"HTLL_LIB(get_user_input:
+    push rbx
+    push rcx
+    push rdx
+    push rsi
+    push rdi
+    push r12
+    push r13
+    mov r12, rdi
+    mov r13, rsi
+    ; --- 1. Print Prompt ---
+    mov rax, [r13 + 8]
+    cmp rax, 0
+    je .read_start
+    mov rcx, rax
+    mov rbx, [r13]
+    xor rdx, rdx
+.prompt_loop:
+    mov al, [rbx + rdx*8]
+    call print_char
+    inc rdx
+    loop .prompt_loop
+    call draw_all ; Show the prompt immediately
+.read_start:
+.wait_key:
+    in al, 0x64  
+    test al, 1
+    jz .wait_key
+    in al, 0x60
+    test al, 0x80
+    jnz .wait_key
+    lea rdx, [scan_map]
+    and rax, 0xFF
+    mov al, [rdx + rax]
+    
+    cmp al, 0
+    je .wait_key
+    cmp al, 10
+    je .input_done
+    cmp al, 8
+    je .handle_backspace
+    ; Valid Char: Echo to buffer
+    call print_char
+    
+    ; --- THE FIX: Blit to hardware so user sees the character ---
+    call draw_all
+    
+    mov rdi, r12
+    movzx rsi, al
+    call array_append
+    jmp .wait_key
+.handle_backspace:
+    ; Safety Guard: Don't backspace if we are at the start of the line!
+    cmp qword [cursor_x], 0
+    je .wait_key
+    
+    ; Safety Guard: Don't backspace if the input buffer is empty!
+    cmp qword [r12 + 8], 0  
+    je .wait_key
+    mov rdi, r12
+    call array_pop
+    dec qword [cursor_x]
+    mov rax, [cursor_y]
+    imul rax, 80
+    add rax, [cursor_x]
+    shl rax, 1
+    lea rdi, [video_buffer + rax]
+    mov word [rdi], 0x0F20 ; Space in buffer
+    call draw_all
+    jmp .wait_key
+.input_done:
+    mov al, 10
+    call print_char
+    call draw_all ; Final newline sync
+    pop r13
+    pop r12
+    pop rdi
+    pop rsi
+    pop rdx
+    pop rcx
+    pop rbx
+    ret
+)HTLL_LIB"},
+    {"print_number", R"HTLL_LIB(; print_number: Prints 64-bit number in RAX
+print_number:
+    push rax
+    push rbx
+    push rcx
+    push rdx
+    
+    cmp rax, 0
+    jne .p_setup
+    mov al, '0'
+    call print_char
+    jmp .p_done
+.p_setup:
+    mov rbx, 10
+    ; digit counter
+    xor rcx, rcx
+.p_loop:
+    xor rdx, rdx
+    ; rax / 10
+    div rbx
+    ; remainder
+    push rdx
+    inc rcx
+    test rax, rax
+    jnz .p_loop
+.p_print:
+    pop rax
+    add al, '0'
+    call print_char
+    loop .p_print
+.p_done:
+    ; Print newline
+    mov al, 10
+    call print_char
+    call draw_all
+    pop rdx
+    pop rcx
+    pop rbx
+    pop rax
+    ret
+)HTLL_LIB"},
+    {"input", R"HTLL_LIB(input:
+    push rdi
+    push rbx
+    mov rbx, 0 
+.wait_key:
+    in al, 0x64
+    test al, 1
+    jz .wait_key
+    in al, 0x60
+    test al, 0x80
+    jnz .wait_key
+    lea rdx, [scan_map]
+    and rax, 0xFF
+    mov al, [rdx + rax]
+    
+    cmp al, 0
+    je .wait_key
+    cmp al, 10
+    je .finish
+    cmp al, 8
+    je .handle_backspace
+    mov [rdi], al
+    inc rdi
+    inc rbx
+    
+    call print_char
+    call draw_all ; <--- Sync every key
+    jmp .wait_key
+.handle_backspace:
+    cmp rbx, 0
+    je .wait_key
+    dec rdi
+    dec rbx
+    
+    ; Logic to erase in buffer
+    dec qword [cursor_x]
+    mov rax, [cursor_y]
+    push rbx
+    mov rbx, 80
+    mul rbx
+    add rax, [cursor_x]
+    shl rax, 1
+    lea rdx, [video_buffer + rax]
+    mov word [rdx], 0x0F20
+    pop rbx
+    
+    call draw_all ; <--- Sync backspace
+    jmp .wait_key
+.finish:
+    mov byte [rdi], 0
+    mov al, 10
+    call print_char
+    call draw_all
+    mov rax, rbx
+    pop rbx
+    pop rdi
+    ret
+)HTLL_LIB"},
+    {"array_copy", R"HTLL_LIB(; array_copy: 64-bit
+; [In] rdi: dest struct ptr, rsi: source struct ptr
+array_copy:
+    push rdi
+    push rsi
+    ; Get size
+    ; Offset 8 is size (assuming qword structure)
+    mov rcx, [rsi + 8] 
+    mov [rdi + 8], rcx
+    ; capacity
+    mov [rdi + 16], rcx
+    
+    cmp rcx, 0
+    je .done
+    ; Allocate
+    mov rbx, rcx
+    ; * 8 (qwords)
+    shl rbx, 3
+    call _kmalloc
+    ; Store pointer
+    mov [rdi], rax
+    
+    ; Copy
+    mov rdi, rax
+    ; Load source data pointer
+    mov rsi, [rsi]
+    rep movsq
+.done:
+    pop rsi
+    pop rdi
+    ret
+)HTLL_LIB"},
+    {"array_pop", R"HTLL_LIB(array_pop:
+    ; [In] RDI: Pointer to the array struct.
+    ; Check if size is already 0
+    cmp qword [rdi + 8], 0  
+    je .done
+    ; Decrement size
+    dec qword [rdi + 8]
+.done:
+    ret
+)HTLL_LIB"},
+    {"array_append", R"HTLL_LIB(array_append:
+    push rbx
+    push rcx
+    push rax
+    mov rcx, [rdi + 8]
+    mov rbx, [rdi]
+    cmp rbx, 0
+    jne .store
+    mov rbx, 1024 
+    call _kmalloc
+    mov rbx, rax
+    mov [rdi], rbx
+    mov qword [rdi+16], 128
+.store:
+    mov [rbx + rcx*8], rsi
+    inc qword [rdi + 8]
+    
+    pop rax
+    pop rcx
+    pop rbx
+    ret
+)HTLL_LIB"},
+    {"array_reserve", R"HTLL_LIB(; rdi = array, rsi = number of elements to make room for (at least the 128 array_append starts with)
+array_reserve:
+    push rbx
+    push rcx
+    push rsi
+    push rdi
+    push rax
+    cmp rsi, 128
+    jge .reserve_size
+    mov rsi, 128
+.reserve_size:
+    cmp rsi, [rdi + 16]
+    jle .reserve_done
+    mov rbx, rsi
+    shl rbx, 3
+    call _kmalloc
+    mov rcx, [rdi + 8]
+    mov rbx, [rdi]
+    mov [rdi], rax
+    mov [rdi + 16], rsi
+    cmp rbx, 0
+    je .reserve_done
+    mov rsi, rbx
+    mov rdi, rax
+    rep movsq
+.reserve_done:
+    pop rax
+    pop rdi
+    pop rsi
+    pop rcx
+    pop rbx
+    ret
+)HTLL_LIB"},
+    {"_htll_draw", R"HTLL_LIB(; --- _htll_draw(x, y, color) ---
+; Stack: [RSP]=Ret, [RSP+8]=Color, [RSP+16]=Y, [RSP+24]=X
+_htll_draw:
+    mov rdx, [rsp+8]    ; Color
+    mov rsi, [rsp+16]   ; Y
+    mov rdi, [rsp+24]   ; X
+    cmp rdi, 80
+    jge .done
+    cmp rsi, 50
+    jge .done
+    
+    mov rax, rsi
+    shr rax, 1          ; Y / 2
+    imul rax, 160       ; Row * 160
+    imul rbx, rdi, 2    ; X * 2
+    add rax, rbx
+    add rax, video_buffer ; <--- TARGETS BUFFER
+    
+    mov bl, byte [rax+1] ; Read existing color from buffer
+    test rsi, 1
+    jnz .draw_bottom
+.draw_top:
+    and bl, 240
+    and dl, 15
+    or bl, dl
+    jmp .write_pixel
+.draw_bottom:
+    and bl, 15
+    and dl, 15
+    shl dl, 4
+    or bl, dl
+.write_pixel:
+    mov byte [rax+0], 223
+    mov byte [rax+1], bl
+.done:
+    ret
+)HTLL_LIB"},
+    {"_htll_clear", R"HTLL_LIB(; --- _htll_clear(color) ---
+; Stack: [RSP]=Ret, [RSP+8]=Color
+_htll_clear:
+    mov rdx, [rsp+8]    ; Read Color
+    mov rax, rdx
+    shl rax, 4
+    or rax, rdx
+    mov rdx, rax
+    
+    mov rdi, video_buffer ; <--- TARGETS BUFFER
+    mov rcx, 2000
+.loop:
+    mov byte [rdi], 32 ; Space char
+    mov byte [rdi+1], dl
+    add rdi, 2
+    dec rcx
+    jnz .loop
+    ret
+)HTLL_LIB"},
+    {"draw_all", R"HTLL_LIB(; --- The Buffer Swap (Writes to VRAM) ---
+draw_all:
+    cld
+    mov rsi, video_buffer
+    mov rdi, 0xB8000
+    mov rcx, 500       ; 4000 bytes / 8 bytes per qword = 500 ops
+    rep movsq          ; Blit buffer to VRAM
+    ret
+)HTLL_LIB"},
+    {"_htll_get_key", R"HTLL_LIB(; --- _htll_get_key() ---
+_htll_get_key:
+    xor rax, rax
+    in al, 0x64
+    test al, 1
+    jz .no_key
+    in al, 0x60
+    ret
+.no_key:
+    ret
+)HTLL_LIB"},
+    {"_htll_draw_char", R"HTLL_LIB(; --- _htll_draw_char(x, y, char_id, color_id) ---
+; ABI: Caller-Cleanup Stack (Peeking)
+; Stack: [RSP]=Ret, [RSP+8]=Color, [RSP+16]=Char, [RSP+24]=Y, [RSP+32]=X
+_htll_draw_char:
+    mov r8,  [rsp+8]     ; Color ID
+    mov r9,  [rsp+16]    ; Character ID
+    mov rsi, [rsp+24]    ; Y
+    mov rdi, [rsp+32]    ; X
+    cmp rdi, 80
+    jge .done
+    cmp rsi, 25
+    jge .done
+    imul rsi, 160
+    imul rdi, 2
+    add rsi, rdi
+    add rsi, video_buffer ; <--- TARGETS BUFFER
+    mov byte [rsi], r9b
+    mov byte [rsi+1], r8b
+.done:
+    ret
+)HTLL_LIB"},
+    {"bcd2bin", R"HTLL_LIB(bcd2bin:
+    movzx eax, al      ; AL -> EAX (32-bit)
+    mov ecx, eax
+    and ecx, 0x0F      ; low nibble
+    shr eax, 4         ; high nibble
+    imul eax, 10       ; multiply high nibble by 10
+    add eax, ecx       ; add low nibble
+    ret
+)HTLL_LIB"},
+    {"print_two_digits", R"HTLL_LIB(; ----------------------------
+; Print number in RAX as two digits
+; ----------------------------
+print_two_digits:
+    xor rdx, rdx       ; clear RDX for div
+    mov rcx, 10
+    div rcx            ; RAX = quotient (tens), RDX = remainder (units)
+    mov al, al         ; get quotient in AL
+    add al, '0'
+    call print_char
+    mov al, dl         ; remainder
+    add al, '0'
+    call print_char
+    ret
+)HTLL_LIB"},
+    {"_htll_display_clock", R"HTLL_LIB(; --- _htll_display_clock(x, y, color, utc_dir, utc_val, is_12h) ---
+; ABI: Caller-Cleanup Stack (Peeking)
+; Stack: [RSP]=Ret, [RSP+8]=12h, [RSP+16]=utc_val, [RSP+24]=utc_dir, [RSP+32]=color, [RSP+40]=y, [RSP+48]=x
+_htll_display_clock:
+    ; --- Read Arguments from Stack ---
+    mov rdi, [rsp+48]   ; X
+    mov rsi, [rsp+40]   ; Y
+    mov rdx, [rsp+32]   ; Color
+    mov r8,  [rsp+24]   ; UTC Direction (1 for +, 0 for -)
+    mov r9,  [rsp+16]   ; UTC Value
+    mov r10, [rsp+8]    ; 12h Mode Flag (1 for 12h, 0 for 24h)
+    ; --- Set Cursor Position ---
+    mov [cursor_x], rdi
+    mov [cursor_y], rsi
+    ; --- Read RTC and store in registers (local variables) ---
+    ; r12 = hour, r13 = minute, r14 = second
+    mov al, 4
+    out 0x70, al
+    in al, 0x71
+    call bcd2bin
+    mov r12, rax
+    mov al, 2
+    out 0x70, al
+    in al, 0x71
+    call bcd2bin
+    mov r13, rax
+    mov al, 0
+    out 0x70, al
+    in al, 0x71
+    call bcd2bin
+    mov r14, rax
+    ; --- Apply UTC Offset ---
+    cmp r8, 1
+    je .utc_add
+.utc_sub:
+    sub r12, r9
+    jmp .utc_done
+.utc_add:
+    add r12, r9
+.utc_done:
+    ; Handle hour wrapping
+.utc_wrap_check:
+    cmp r12, 23
+    jg .utc_wrap_sub
+    cmp r12, 0
+    jl .utc_wrap_add
+    jmp .apply_12h_mode
+.utc_wrap_sub:
+    sub r12, 24
+    jmp .utc_wrap_check
+.utc_wrap_add:
+    add r12, 24
+    jmp .utc_wrap_check
+    ; --- Apply 12-hour formatting if requested ---
+.apply_12h_mode:
+    cmp r10, 1
+    jne .print_time
+    ; It is 12h mode
+    cmp r12, 12
+    jg .subtract_12
+    cmp r12, 0
+    je .is_midnight
+    jmp .print_time ; Hours 1-12 are fine
+.subtract_12:
+    sub r12, 12
+    jmp .print_time
+.is_midnight:
+    mov r12, 12 ; 0 hour becomes 12 AM
+    ; --- Print the final time ---
+.print_time:
+    mov rax, r12
+    call print_two_digits
+    mov al, ':'
+    call print_char
+    mov rax, r13
+    call print_two_digits
+    mov al, ':'
+    call print_char
+    mov rax, r14
+    call print_two_digits
+    ret
+)HTLL_LIB"},
+};
+static const HTLL_EmbeddedIndexEntry HTLL_Libs_ring0_index[] = {
+    {"_htll_clear", 13},
+    {"_htll_display_clock", 19},
+    {"_htll_draw", 12},
+    {"_htll_draw_char", 16},
+    {"_htll_get_key", 15},
+    {"_kfree", 1},
+    {"_kmalloc", 0},
+    {"array_append", 10},
+    {"array_clear", 4},
+    {"array_copy", 8},
+    {"array_pop", 9},
+    {"array_reserve", 11},
+    {"bcd2bin", 17},
+    {"draw_all", 14},
+    {"get_user_input", 5},
+    {"input", 7},
+    {"print_char", 3},
+    {"print_number", 6},
+    {"print_str", 2},
+    {"print_two_digits", 18},
+};
+static const HTLL_EmbeddedRoutine HTLL_Libs_AArch64_routines[] = {
+    {"is_nint_negative", R"HTLL_LIB(// In: x0 -> ptr to nint, x1 -> ptr to is_negative flag
+// Out: Memory at [x0] becomes positive magnitude, [x1] gets 0 or 1.
+is_nint_negative:
+    stp     x29, x30, [sp, #-16]!
+    mov     x29, sp
+    ldr     x2, [x0]            // Load the signed value into x2
+    cmp     x2, #0              // Check its sign
+    b.ge    .is_positive_or_zero
+.is_negative:
+    mov     x3, #1              // The flag is 1
+    str     x3, [x1]            // Store the flag
+    neg     x2, x2              // Negate the value to get magnitude
+    str     x2, [x0]            // Store positive magnitude back
+    b       .done_nint
+.is_positive_or_zero:
+    str     xzr, [x1]           // Store flag = 0 (using zero register)
+.done_nint:
+    ldp     x29, x30, [sp], #16
+    ret
+)HTLL_LIB"},
+    {"divide_and_store", R"HTLL_LIB(// In: x0: dividend_int, x1: dividend_dec
+//     x2: divisor_int,  x3: divisor_dec
+//     x4: ptr to result_int, x5: ptr to result_dec
+divide_and_store:
+    stp     x29, x30, [sp, #-32]!
+    stp     x19, x20, [sp, #16]
+    // Callee-saved registers for inputs
+    mov     x19, x0     // dividend_int
+    mov     x20, x1     // dividend_dec
+    mov     x21, x2     // divisor_int
+    mov     x22, x3     // divisor_dec
+    mov     x23, x4     // ptr to result_int
+    mov     x24, x5     // ptr to result_dec
+    // Assuming SCALE_FACTOR is a label pointing to a qword
+    ldr     x9, =SCALE_FACTOR
+    ldr     x9, [x9]
+    // Step 1: Scale dividend
+    mul     x19, x19, x9
+    add     x19, x19, x20   // x19 = scaled dividend
+    // Step 2: Scale divisor
+    mul     x21, x21, x9
+    add     x21, x21, x22   // x21 = scaled divisor
+    // Step 3: Main 128-bit equivalent division
+    mul     x12, x19, x9    // x12 = scaled dividend * scale
+    udiv    x12, x12, x21   // x12 = (scaled dividend * scale) / scaled divisor
+    // Step 4: De-scale the result
+    udiv    x0, x12, x9     // x0 = final_quotient (integer part)
+    msub    x1, x0, x9, x12 // x1 = final_remainder (decimal part)
+    // Step 5: Store results
+    str     x0, [x23]
+    str     x1, [x24]
+    ldp     x19, x20, [sp, #16]
+    ldp     x29, x30, [sp], #32
+    ret
+)HTLL_LIB"},
+    {"print_div", R"HTLL_LIB(// In: x0: integer part, x1: decimal part
+print_div:
+    stp     x29, x30, [sp, #-32]!
+    mov     x29, sp
+    sub     sp, sp, #32             // Buffer space on stack
+    stp     x19, x20, [sp, #16]     // Save callee-saved regs
+    mov     x19, x0                 // Save integer part
+    mov     x20, x1                 // Save decimal part
+    // --- Print integer part ---
+    add     x9, sp, #19             // x9 = buffer pointer (end)
+    mov     x10, #10                // Divisor
+.int_convert_loop:
+    udiv    x11, x19, x10           // quotient
+    msub    x12, x11, x10, x19      // remainder
+    add     x12, x12, #'0'          // to ASCII
+    strb    w12, [x9], #-1          // store byte, pre-decrement
+    mov     x19, x11                // next dividend is quotient
+    cmp     x19, #0
+    b.ne    .int_convert_loop
+    add     x9, x9, #1              // Point to start of number string
+    add     x1, sp, #20             // Calculate length
+    sub     x2, x1, x9
+    mov     x0, #1                  // stdout
+    mov     x1, x9                  // buffer
+    // x2 has length
+    mov     x8, #SYS_WRITE
+    svc     #0
+    // --- Print decimal point ---
+    ldr     x1, =HTLL_dot
+    mov     x2, #1
+    mov     x0, #1
+    mov     x8, #SYS_WRITE
+    svc     #0
+    // --- Print decimal part ---
+    add     x9, sp, #5              // buffer pointer
+    mov     x10, #10                // divisor
+    mov     x11, #6                 // loop counter for 6 decimal places
+.dec_convert_loop:
+    udiv    x12, x20, x10
+    msub    x13, x12, x10, x20
+    add     x13, x13, #'0'
+    strb    w13, [x9], #-1
+    mov     x20, x12
+    sub     x11, x11, #1
+    cmp     x11, #0
+    b.ne    .dec_convert_loop
+    mov     x0, #1
+    mov     x1, sp                  // buffer start
+    mov     x2, #6
+    mov     x8, #SYS_WRITE
+    svc     #0
+    // Print newline
+    ldr     x1, =HTLL_nl
+    mov     x2, #1
+    mov     x0, #1
+    mov     x8, #SYS_WRITE
+    svc     #0
+    ldp     x19, x20, [sp, #16]
+    add     sp, sp, #32
+    ldp     x29, x30, [sp], #32
+    ret
+)HTLL_LIB"},
+    {"print_number", R"HTLL_LIB(// In: x0 - positive magnitude, x1 - is_negative flag (0 or 1)
+print_number:
+    stp     x29, x30, [sp, #-32]!
+    mov     x29, sp
+    sub     sp, sp, #32             
+    str     x0, [sp, #16]           // Save number magnitude
+    cmp     x1, #0                  // Check is_negative flag
+    b.eq    .skip_sign_print
+    
+    // Print minus sign if needed... (this part is fine)
+    mov     x0, #1
+    ldr     x1, =HTLL_minus_sign
+    mov     x2, #1
+    mov     x8, #SYS_WRITE
+    svc     #0
+.skip_sign_print:
+    ldr     x9, [sp, #16]           // Restore number into x9 (x9 = 9, which is correct)
+    
+    // The flawed 'neg' block is GONE. We proceed directly from here.
+    
+    add     x10, sp, #19            // Buffer ptr
+    mov     x11, #10                // Divisor
+.conversion_loop:
+    udiv    x12, x9, x11            // This now correctly divides 9 by 10
+    msub    x13, x12, x11, x9
+    add     x13, x13, #'0'
+    strb    w13, [x10], #-1
+    mov     x9, x12
+    cmp     x9, #0
+    b.ne    .conversion_loop
+    add     x10, x10, #1
+    add     x1, sp, #20
+    sub     x2, x1, x10
+    mov     x0, #1
+    mov     x1, x10
+    mov     x8, #SYS_WRITE
+    svc     #0
+    // Print newline
+    mov     x0, #1
+    ldr     x1, =HTLL_nl
+    mov     x2, #1
+    mov     x8, #SYS_WRITE
+    svc     #0
+    add     sp, sp, #32
+    ldp     x29, x30, [sp], #32
+    ret
+)HTLL_LIB"},
+    {"print_str", R"HTLL_LIB(// In: x1 (rsi) -> string, x2 (rdx) -> length
+print_str:
+    stp     x29, x30, [sp, #-16]!
+    mov     x29, sp
+    mov     x0, #1              // stdout
+    // x1 and x2 are passed through
+    mov     x8, #SYS_WRITE
+    svc     #0
+    ldp     x29, x30, [sp], #16
+    ret
+)HTLL_LIB"},
+    {"input", R"HTLL_LIB(// In: x0 -> buffer, x1 -> ptr to store length
+input:
+    stp     x29, x30, [sp, #-32]!
+    mov     x29, sp
+    stp     x19, x20, [sp, #16]
+    mov     x19, x0             // Save buffer ptr
+    mov     x20, x1             // Save length ptr
+    // sys_read from stdin
+    mov     x0, #0              // stdin fd
+    mov     x1, x19             // buffer
+    mov     x2, #100            // max length
+    mov     x8, #SYS_READ
+    svc     #0
+    // x0 returns bytes read
+    cmp     x0, #1
+    b.le    .read_empty
+    // Valid input, length is bytes_read - 1
+    sub     x0, x0, #1
+    b       .store_length
+.read_empty:
+    mov     x0, xzr             // Set length to 0
+.store_length:
+    str     x0, [x20]           // Store final length
+    ldp     x19, x20, [sp, #16]
+    ldp     x29, x30, [sp], #32
+    ret
+)HTLL_LIB"},
+    {"array_copy", R"HTLL_LIB(// In: x0 -> dest DynamicArray, x1 -> src DynamicArray
+// Keeps dest's buffer when its capacity fits src; otherwise replaces it with
+// one of max(2 * capacity, size) elements.
+array_copy:
+    stp     x29, x30, [sp, #-48]!
+    mov     x29, sp
+    stp     x19, x20, [sp, #16]
+    stp     x21, x22, [sp, #32]
+    mov     x19, x0             // dest
+    mov     x20, x1             // src
+    cmp     x19, x20
+    b.eq    .copy_epilogue
+    ldr     x21, [x20, #DynamicArray_size]      // new size
+    ldr     x22, [x19, #DynamicArray_capacity]  // old capacity
+    // Step 1: Reuse dest's memory if it is big enough, else free it
+    ldr     x0, [x19, #DynamicArray_pointer]
+    cbz     x0, .copy_grow
+    cmp     x21, x22
+    b.ls    .copy_data
+    lsl     x1, x22, #3         // capacity * 8
+    mov     x8, #SYS_MUNMAP
+    svc     #0
+.copy_grow:
+    // Step 2: Allocate max(2 * capacity, size) elements
+    str     xzr, [x19, #DynamicArray_pointer]
+    str     xzr, [x19, #DynamicArray_size]
+    str     xzr, [x19, #DynamicArray_capacity]
+    cbz     x21, .copy_epilogue
+    lsl     x22, x22, #1
+    cmp     x22, x21
+    csel    x22, x22, x21, hs
+    lsl     x1, x22, #3
+    mov     x0, #0
+    mov     x2, #PROT_READ_WRITE
+    mov     x3, #MAP_PRIVATE_ANONYMOUS
+    mov     x4, #-1
+    mov     x5, #0
+    mov     x8, #SYS_MMAP
+    svc     #0
+    cmp     x0, #0
+    b.lt    .copy_epilogue
+    str     x0, [x19, #DynamicArray_pointer]
+    str     x22, [x19, #DynamicArray_capacity]
+.copy_data:
+    // Step 3: Copy the data
+    str     x21, [x19, #DynamicArray_size]
+    ldr     x1, [x20, #DynamicArray_pointer]
+    ldr     x0, [x19, #DynamicArray_pointer]
+    mov     x2, x21
+.copy_loop:
+    cmp     x2, #0
+    b.eq    .copy_epilogue
+    ldr     x9, [x1], #8
+    str     x9, [x0], #8
+    sub     x2, x2, #1
+    b       .copy_loop
+.copy_epilogue:
+    ldp     x21, x22, [sp, #32]
+    ldp     x19, x20, [sp, #16]
+    ldp     x29, x30, [sp], #48
+    ret
+)HTLL_LIB"},
+    {"array_clear", R"HTLL_LIB(// In: x0 -> DynamicArray struct
+array_clear:
+    stp     x29, x30, [sp, #-16]!
+    mov     x29, sp
+    str     xzr, [x0, #DynamicArray_size] // Set size to 0
+    ldp     x29, x30, [sp], #16
+    ret
+)HTLL_LIB"},
+    {"array_append", R"HTLL_LIB(// In: x0 -> DynamicArray, x1 -> value to append
+// The first block is one page of INITIAL_CAPACITY elements; after that the
+// capacity doubles and mremap lets the kernel move the pages instead of copying.
+array_append:
+    stp     x29, x30, [sp, #-32]!
+    mov     x29, sp
+    stp     x19, x20, [sp, #16]
+    mov     x19, x0             // array
+    mov     x20, x1             // value
+    ldr     x9, [x19, #DynamicArray_size]
+    ldr     x10, [x19, #DynamicArray_capacity]
+    cmp     x9, x10
+    b.lt    .has_space
+// --- Resize Logic: new_cap = max(old_cap * 2, INITIAL_CAPACITY) ---
+.resize:
+    lsl     x10, x10, #1
+    mov     x11, #INITIAL_CAPACITY
+    cmp     x10, x11
+    csel    x10, x10, x11, ge
+    ldr     x0, [x19, #DynamicArray_pointer]
+    cbz     x0, .append_map
+    // mremap(old_ptr, old_cap * 8, new_cap * 8, MREMAP_MAYMOVE)
+    ldr     x1, [x19, #DynamicArray_capacity]
+    lsl     x1, x1, #3
+    lsl     x2, x10, #3
+    mov     x3, #MREMAP_MAYMOVE
+    mov     x8, #SYS_MREMAP
+    svc     #0
+    b       .append_mapped
+.append_map:
+    lsl     x1, x10, #3                         // new_cap * 8
+    mov     x0, #0
+    mov     x2, #PROT_READ_WRITE
+    mov     x3, #MAP_PRIVATE_ANONYMOUS
+    mov     x4, #-1
+    mov     x5, #0
+    mov     x8, #SYS_MMAP
+    svc     #0
+.append_mapped:
+    cmp     x0, #0
+    b.lt    .mmap_failed
+    str     x0, [x19, #DynamicArray_pointer]
+    str     x10, [x19, #DynamicArray_capacity]
+.has_space:
+    ldr     x9, [x19, #DynamicArray_pointer]
+    ldr     x10, [x19, #DynamicArray_size]
+    str     x20, [x9, x10, lsl #3]  // ptr[size] = value
+    add     x10, x10, #1
+    str     x10, [x19, #DynamicArray_size]
+    b       .append_epilogue
+.mmap_failed:
+    mov     x0, #1          // exit code 1
+    mov     x8, #SYS_EXIT
+    svc     #0
+.append_epilogue:
+    ldp     x19, x20, [sp, #16]
+    ldp     x29, x30, [sp], #32
+    ret
+)HTLL_LIB"},
+    {"array_reserve", R"HTLL_LIB(// In: x0 -> DynamicArray, x1 -> number of elements to make room for
+// Grows the capacity to at least x1 so the appends that follow do not resize.
+array_reserve:
+    stp     x29, x30, [sp, #-32]!
+    mov     x29, sp
+    str     x19, [sp, #16]
+    mov     x19, x0             // array
+    mov     x10, x1             // new_cap
+    ldr     x11, [x19, #DynamicArray_capacity]
+    cmp     x10, x11
+    b.le    .reserve_done
+    ldr     x0, [x19, #DynamicArray_pointer]
+    cbz     x0, .reserve_map
+    lsl     x1, x11, #3
+    lsl     x2, x10, #3
+    mov     x3, #MREMAP_MAYMOVE
+    mov     x8, #SYS_MREMAP
+    svc     #0
+    b       .reserve_mapped
+.reserve_map:
+    lsl     x1, x10, #3
+    mov     x0, #0
+    mov     x2, #PROT_READ_WRITE
+    mov     x3, #MAP_PRIVATE_ANONYMOUS
+    mov     x4, #-1
+    mov     x5, #0
+    mov     x8, #SYS_MMAP
+    svc     #0
+.reserve_mapped:
+    cmp     x0, #0
+    b.lt    .reserve_failed
+    str     x0, [x19, #DynamicArray_pointer]
+    str     x10, [x19, #DynamicArray_capacity]
+    b       .reserve_done
+.reserve_failed:
+    mov     x0, #1          // exit code 1
+    mov     x8, #SYS_EXIT
+    svc     #0
+.reserve_done:
+    ldr     x19, [sp, #16]
+    ldp     x29, x30, [sp], #32
+    ret
+)HTLL_LIB"},
+    {"array_pop", R"HTLL_LIB(// In: x0 -> DynamicArray
+// Out: x0 = popped value (or 0 if empty)
+array_pop:
+    stp     x29, x30, [sp, #-16]!
+    mov     x29, sp
+    ldr     x1, [x0, #DynamicArray_size]
+    cmp     x1, #0
+    b.eq    .pop_empty
+    sub     x1, x1, #1
+    str     x1, [x0, #DynamicArray_size]
+    ldr     x2, [x0, #DynamicArray_pointer]
+    ldr     x0, [x2, x1, lsl #3] // x0 = ptr[new_size]
+    b       .pop_done
+.pop_empty:
+    mov     x0, xzr
+.pop_done:
+    ldp     x29, x30, [sp], #16
+    ret
+)HTLL_LIB"},
+    {"print_char", R"HTLL_LIB(// In: x0 (lowest byte) -> char to print
+print_char:
+    stp     x29, x30, [sp, #-16]!
+    mov     x29, sp
+    sub     sp, sp, #16
+    strb    w0, [sp, #15]       // Store byte on stack
+    mov     x0, #1              // stdout
+    add     x1, sp, #15         // pointer to char on stack
+    mov     x2, #1
+    mov     x8, #SYS_WRITE
+    svc     #0
+    add     sp, sp, #16
+    ldp     x29, x30, [sp], #16
+    ret
+)HTLL_LIB"},
+    {"sys_read_line", R"HTLL_LIB(// In: x0 -> buffer, x1 -> max bytes
+// Out: x0 = bytes read
+sys_read_line:
+    stp     x29, x30, [sp, #-16]!
+    mov     x29, sp
+    
+    mov     x2, x1              // max bytes
+    mov     x1, x0              // buffer
+    mov     x0, #0              // stdin
+    mov     x8, #SYS_READ
+    svc     #0
+    ldp     x29, x30, [sp], #16
+    ret
+)HTLL_LIB"},
+    {"get_user_input", R"HTLL_LIB(// In: x0 -> dest array, x1 -> prompt array
+get_user_input:
+    stp     x29, x30, [sp, #-48]!
+    stp     x19, x20, [sp, #16]
+    stp     x21, x22, [sp, #32]
+    mov     x29, sp
+    mov     x19, x0             // dest array
+    mov     x20, x1             // prompt array
+    // --- Part 1: Print Prompt ---
+    ldr     x9, [x20, #DynamicArray_size]
+    cmp     x9, #0
+    b.eq    .read_from_user
+    // Pack prompt array into a temporary byte string
+    mov     x0, x20
+    bl      array_pack_to_bytes
+    mov     x21, x0             // buffer
+    mov     x22, x1             // size
+    cmp     x21, #0
+    b.eq    .read_from_user
+    // Print the prompt string
+    mov     x0, #1              // stdout
+    mov     x1, x21             // buffer
+    sub     x2, x22, #1         // size - 1 (don't print null terminator)
+    mov     x8, #SYS_WRITE
+    svc     #0
+    // Free the temporary string
+    mov     x0, x21
+    mov     x1, x22
+    bl      free_packed_string
+    // --- Part 2: Read Input ---
+.read_from_user:
+    ldr     x1, =HTLL_input_buffer
+    mov     x2, #255            // Max chars to read
+    mov     x0, #0              // stdin
+    mov     x8, #SYS_READ
+    svc     #0
+    cmp     x0, #1              // Check if read anything (> 1 because of newline)
+    b.le    .done
+    sub     x21, x0, #1         // x21 = length (strip newline)
+    ldr     x22, =HTLL_input_buffer  // x22 = ptr to input buffer
+.append_char_loop:
+    cmp     x21, #0
+    b.eq    .done
+    ldrb    w1, [x22], #1       // load char from buffer, auto-increment ptr
+    mov     x0, x19             // dest array
+    bl      array_append        // append char
+    // REMOVED EXTRA INCREMENT HERE
+    sub     x21, x21, #1
+    b       .append_char_loop
+.done:
+    ldp     x21, x22, [sp, #32]
+    ldp     x19, x20, [sp, #16]
+    ldp     x29, x30, [sp], #48
+    ret
+)HTLL_LIB"},
+    {"fileread_from_ptr", R"HTLL_LIB(// In: x0 -> dest array, x1 -> ptr to filename string
+fileread_from_ptr:
+    stp     x29, x30, [sp, #-64]!   // Increased stack size
+    stp     x19, x20, [sp, #16]
+    stp     x21, x22, [sp, #32]
+    stp     x23, x24, [sp, #48]     // Save x23
+    mov     x29, sp
+    
+    mov     x19, x0             // dest array
+    mov     x20, x1             // filename ptr
+    // Open file
+    mov     x0, #AT_FDCWD
+    mov     x1, x20             // filename
+    mov     x2, #O_RDONLY       // flags
+    mov     x3, #0              // mode
+    mov     x8, #SYS_OPENAT
+    svc     #0
+    cmp     x0, #0
+    b.lt    .read_error_ptr
+    mov     x21, x0             // x21 = file descriptor
+.read_loop_ptr:
+    mov     x0, x21
+    ldr     x1, =HTLL_file_read_buffer
+    mov     x2, #4096
+    mov     x8, #SYS_READ
+    svc     #0
+    
+    cmp     x0, #0
+    b.le    .close_and_exit_ptr // EOF or Error
+    
+    mov     x22, x0             // bytes read count
+    ldr     x23, =HTLL_file_read_buffer // x23 = SAFE buffer read pointer
+.append_byte_loop_ptr:
+    cmp     x22, #0
+    b.eq    .read_loop_ptr      // Done with this chunk, read next
+    
+    ldrb    w9, [x23], #1       // Load byte from x23, increment x23
+    
+    mov     x0, x19             // Dest array
+    mov     x1, x9              // Byte value (safe to use x1 now)
+    bl      array_append
+    
+    sub     x22, x22, #1
+    b       .append_byte_loop_ptr
+.close_and_exit_ptr:
+    mov     x0, x21
+    mov     x8, #SYS_CLOSE
+    svc     #0
+    b       .read_done_ptr
+.read_error_ptr:
+.read_done_ptr:
+    ldp     x23, x24, [sp, #48]
+    ldp     x21, x22, [sp, #32]
+    ldp     x19, x20, [sp, #16]
+    ldp     x29, x30, [sp], #64
+    ret
+)HTLL_LIB"},
+    {"fileappend_from_ptr", R"HTLL_LIB(// In: x0 -> ptr to filename string, x1 -> src array
+// In: x0 -> ptr to filename string, x1 -> src array
+fileappend_from_ptr:
+    stp     x29, x30, [sp, #-48]!
+    stp     x19, x20, [sp, #16]
+    stp     x21, x22, [sp, #32]
+    mov     x29, sp
+    mov     x19, x0             // filename
+    mov     x20, x1             // src array
+    // 1. Pack the array into a flat buffer
+    mov     x0, x20
+    bl      array_pack_to_bytes
+    // Returns: x0 = buffer, x1 = size (including null)
+    
+    cmp     x0, #0
+    b.eq    .append_done
+    
+    mov     x21, x0             // buffer
+    mov     x22, x1             // size
+    // 2. Open File (O_WRONLY | O_CREAT | O_APPEND)
+    // 0x441 = 01000(O_APPEND) | 0100(O_CREAT) | 01(O_WRONLY)
+    mov     x0, #AT_FDCWD
+    mov     x1, x19
+    mov     x2, #0x441
+    mov     x3, #438            // 0666 permission (rw-rw-rw-)
+    mov     x8, #SYS_OPENAT
+    svc     #0
+    
+    cmp     x0, #0
+    b.lt    .append_free        // Open failed
+    mov     x20, x0             // file descriptor (reuse x20)
+    // 3. Write to File
+    mov     x0, x20             // fd
+    mov     x1, x21             // buffer
+    sub     x2, x22, #1         // size - 1 (exclude null terminator)
+    mov     x8, #SYS_WRITE
+    svc     #0
+    // 4. Close File
+    mov     x0, x20
+    mov     x8, #SYS_CLOSE
+    svc     #0
+.append_free:
+    // 5. Free memory
+    mov     x0, x21
+    mov     x1, x22
+    bl      free_packed_string
+.append_done:
+    ldp     x21, x22, [sp, #32]
+    ldp     x19, x20, [sp, #16]
+    ldp     x29, x30, [sp], #48
+    ret
+)HTLL_LIB"},
+    {"filedelete_from_ptr", R"HTLL_LIB(// In: x0 -> ptr to filename string
+filedelete_from_ptr:
+    stp     x29, x30, [sp, #-16]!
+    mov     x29, sp
+    mov     x1, x0              // pathname
+    mov     x0, #AT_FDCWD       // dirfd
+    mov     x2, xzr             // flags = 0 (THE FIX)
+    mov     x8, #SYS_UNLINKAT
+    svc     #0
+    ldp     x29, x30, [sp], #16
+    ret
+)HTLL_LIB"},
+    {"file_read", R"HTLL_LIB(file_read:
+    b       fileread_from_ptr
+)HTLL_LIB"},
+    {"file_append", R"HTLL_LIB(file_append:
+    b       fileappend_from_ptr
+)HTLL_LIB"},
+    {"file_delete", R"HTLL_LIB(file_delete:
+    b       filedelete_from_ptr
+)HTLL_LIB"},
+    {"array_pack_to_bytes", R"HTLL_LIB(// In: x0 -> src array
+// Out: x0 -> new C-string ptr, x1 -> size
+array_pack_to_bytes:
+    stp     x29, x30, [sp, #-32]!
+    stp     x19, x20, [sp, #16]
+    mov     x19, x0
+    cmp     x19, #0
+    b.eq    .pack_fail
+    ldr     x9, [x19, #DynamicArray_size]
+    cmp     x9, #0
+    b.eq    .pack_fail
+    // Allocate memory (size + 1 for null)
+    add     x1, x9, #1
+    mov     x0, #0
+    mov     x2, #PROT_READ_WRITE
+    mov     x3, #MAP_PRIVATE_ANONYMOUS
+    mov     x4, #-1
+    mov     x5, #0
+    mov     x8, #SYS_MMAP
+    svc     #0
+    cmp     x0, #0
+    b.lt    .pack_fail
+    mov     x20, x0     // new buffer ptr
+    // Copy bytes
+    ldr     x1, [x19, #DynamicArray_pointer]
+    mov     x2, #0
+.pack_loop:
+    cmp     x2, x9
+    b.ge    .pack_add_null
+    ldr     x10, [x1, x2, lsl #3]
+    strb    w10, [x20, x2]
+    add     x2, x2, #1
+    b       .pack_loop
+.pack_add_null:
+    strb    wzr, [x20, x2] // Store null terminator
+    mov     x0, x20
+    add     x1, x9, #1     // return size
+    b       .pack_done
+.pack_fail:
+    mov     x0, xzr
+    mov     x1, xzr
+.pack_done:
+    ldp     x19, x20, [sp, #16]
+    ldp     x29, x30, [sp], #32
+    ret
+)HTLL_LIB"},
+    {"array_unpack_from_bytes", R"HTLL_LIB(// In: x0 -> dest array, x1 -> src C-string
+array_unpack_from_bytes:
+    stp     x29, x30, [sp, #-32]!
+    stp     x19, x20, [sp, #16]
+    mov     x19, x0     // dest array
+    mov     x20, x1     // src string
+    cmp     x20, #0
+    b.eq    .unpack_done
+    // Clear dest array first
+    mov     x0, x19
+    bl      array_clear
+.unpack_loop:
+    ldrb    w1, [x20], #1
+    cmp     w1, #0
+    b.eq    .unpack_done
+    mov     x0, x19
+    // x1 has char
+    bl      array_append
+    b       .unpack_loop
+.unpack_done:
+    ldp     x19, x20, [sp, #16]
+    ldp     x29, x30, [sp], #32
+    ret
+)HTLL_LIB"},
+    {"free_packed_string", R"HTLL_LIB(// In: x0 -> ptr to free, x1 -> size
+free_packed_string:
+    stp     x29, x30, [sp, #-16]!
+    cmp     x0, #0
+    b.eq    .free_done
+    mov     x8, #SYS_MUNMAP
+    svc     #0
+.free_done:
+    ldp     x29, x30, [sp], #16
+    ret
+)HTLL_LIB"},
+    {"sleep_ms", R"HTLL_LIB(// In: x0 -> milliseconds
+sleep_ms:
+    stp     x29, x30, [sp, #-32]!
+    mov     x29, sp
+    sub     sp, sp, #16             // space for timespec struct
+    // Convert ms to seconds and nanoseconds
+    mov     x1, #1000
+    udiv    x2, x0, x1              // x2 = seconds
+    msub    x3, x2, x1, x0          // x3 = remainder ms
+    ldr x1, =1000000
+    mul     x3, x3, x1              // x3 = nanoseconds
+    // Store timespec struct on stack
+    str     x2, [sp, #0]            // tv_sec
+    str     x3, [sp, #8]            // tv_nsec
+    // Call syscall
+    mov     x0, sp                  // req*
+    mov     x1, xzr                 // rem* (NULL)
+    mov     x8, #SYS_NANOSLEEP
+    svc     #0
+    add     sp, sp, #16             // cleanup stack
+    ldp     x29, x30, [sp], #32
+    ret
+)HTLL_LIB"},
+};
+static const HTLL_EmbeddedIndexEntry HTLL_Libs_AArch64_index[] = {
+    {"array_append", 8},
+    {"array_clear", 7},
+    {"array_copy", 6},
+    {"array_pack_to_bytes", 20},
+    {"array_pop", 10},
+    {"array_reserve", 9},
+    {"array_unpack_from_bytes", 21},
+    {"divide_and_store", 1},
+    {"file_append", 18},
+    {"file_delete", 19},
+    {"file_read", 17},
+    {"fileappend_from_ptr", 15},
+    {"filedelete_from_ptr", 16},
+    {"fileread_from_ptr", 14},
+    {"free_packed_string", 22},
+    {"get_user_input", 13},
+    {"input", 5},
+    {"is_nint_negative", 0},
+    {"print_char", 11},
+    {"print_div", 2},
+    {"print_number", 3},
+    {"print_str", 4},
+    {"sleep_ms", 23},
+    {"sys_read_line", 12},
+};
+static const HTLL_EmbeddedLibrary HTLL_embeddedLibraries[] = {
+    {"HTLL_Libs_x86.txt", HTLL_Libs_x86_routines, HTLL_Libs_x86_index, (int)(sizeof(HTLL_Libs_x86_routines) / sizeof(HTLL_EmbeddedRoutine))},
+    {"HTLL_Libs_ring0.txt", HTLL_Libs_ring0_routines, HTLL_Libs_ring0_index, (int)(sizeof(HTLL_Libs_ring0_routines) / sizeof(HTLL_EmbeddedRoutine))},
+    {"HTLL_Libs_AArch64.txt", HTLL_Libs_AArch64_routines, HTLL_Libs_AArch64_index, (int)(sizeof(HTLL_Libs_AArch64_routines) / sizeof(HTLL_EmbeddedRoutine))},
+};
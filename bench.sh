@@ -0,0 +1,176 @@
+#!/bin/sh
+# Compiler throughput benchmark.
+# Generates synthetic HTLL programs of the sizes in HTLL_BENCH_SIZES (source lines,
+# default "1000 10000 100000 1000000") with a mix of globals, Loop/if blocks nested up to
+# 9 deep, functions with array parameters, arradd, print, file I/O and an include. Each
+# one is compiled for every target with the cache off, and lines/second, peak RSS and
+# output size are reported and written to bench_output.txt. The timed compile runs
+# without --time-passes, whose allocation counting slows the compiler down; peak RSS
+# comes from a second, untimed compile with --time-passes=json.
+#
+# The results are compared with bench_baseline.txt: a size/target whose lines/second
+# dropped by more than HTLL_BENCH_TOLERANCE percent (default 20) fails the run.
+#
+#     ./bench.sh              build HTLL.cpp, run and compare with the baseline
+#     ./bench.sh --save       run and store the results as the new baseline
+#     HTLL_BENCH_SIZES="500 1000" ./bench.sh
+#
+# HTLL.cpp is built the way the README builds it; HTLL_BENCH_CXXFLAGS adds flags such as
+# -O2 (slow to build; bench_baseline.txt was made with -O2). HTLL_BENCH_COMPILER=path
+# uses an already built compiler instead.
+# Compare results only against a baseline made with the same build and machine. The
+# checked-in baseline stops at 100000 lines: 1000000 needs about 6.5 GB of memory, more
+# than the machine it was made on had, so that size is reported but not compared.
+set -e
+cd "$(dirname "$0")"
+root=$(pwd)
+sizes=${HTLL_BENCH_SIZES:-"1000 10000 100000 1000000"}
+tolerance=${HTLL_BENCH_TOLERANCE:-20}
+targets="x86-64 arm oryx x86-64-ring0"
+work=${TMPDIR:-/tmp}/htll_bench.$$
+mkdir -p "$work"
+trap 'rm -rf "$work"' EXIT
+
+compiler=${HTLL_BENCH_COMPILER:-}
+if [ -z "$compiler" ]; then
+    compiler=$work/HTLL
+    echo "Building HTLL.cpp..."
+    g++ ${HTLL_BENCH_CXXFLAGS:-} HTLL.cpp -o "$compiler"
+fi
+case $compiler in
+    /*) ;;
+    *) compiler=$root/$compiler ;;
+esac
+
+# gen_program LINES NAME: writes NAME.htll of about LINES lines and its include NAME_lib.htll
+gen_program() {
+    awk -v lines="$1" -v name="$2" '
+    function emit(s) { print s > file; n++ }
+    function indent(d,   s, i) { s = ""; for (i = 0; i < d; i++) s = s "    "; return s }
+    BEGIN {
+        lib = name "_lib.htll"
+        file = lib
+        nlib = 4
+        for (k = 0; k < nlib; k++) {
+            emit("func " name "_lib" k "(x) {")
+            emit("    int " name "_lib" k "_t := 0")
+            emit("    " name "_lib" k "_t := x")
+            emit("    " name "_lib" k "_t *= " (k + 2))
+            emit("    return " name "_lib" k "_t + " k)
+            emit("}")
+        }
+        close(lib)
+        file = name ".htll"
+        n = 0
+        nglobals = int(lines / 50) + 4
+        nfuncs = int(lines / 100) + 1
+        emit("include \"" lib "\"")
+        for (g = 0; g < nglobals; g++) emit("int g_v" g " := " g)
+        emit("arr g_buf")
+        emit("arr g_rd")
+        for (f = 0; f < nfuncs; f++) {
+            p = "f" f
+            emit("func " p "(arr " p "_a, " p "_x) {")
+            emit("    int " p "_t := 0")
+            emit("    " p "_t := 0")
+            emit("    Loop, " p "_a.size {")
+            emit("        " p "_a.index A_Index")
+            emit("        " p "_t += rax")
+            emit("        if (" p "_t > 1000) {")
+            emit("            " p "_t := " p "_t % 1000")
+            emit("        }")
+            emit("    }")
+            emit("    " p "_t += " p "_x")
+            emit("    return " p "_t")
+            emit("}")
+        }
+        emit("main")
+        for (b = 0; n < lines; b++) {
+            v = "g_v" (b % nglobals)
+            w = "g_v" ((b * 7 + 3) % nglobals)
+            kind = b % 6
+            if (kind == 0) {
+                # Loop/if blocks nested 1..9 deep
+                depth = b % 9 + 1
+                for (d = 0; d < depth; d++) {
+                    if (d % 2 == 0) emit(indent(d + 1) "Loop, 2 {")
+                    else emit(indent(d + 1) "if (" v " < 100000) {")
+                }
+                emit(indent(depth + 1) v " += 1")
+                emit(indent(depth + 1) w " := " v " * 3 + 1")
+                for (d = depth - 1; d >= 0; d--) emit(indent(d + 1) "}")
+            } else if (kind == 1) {
+                emit("    arradd g_buf block" b)
+                emit("    g_buf.add 10")
+                emit("    print(\"block " b "\")")
+                emit("    print(" v ")")
+            } else if (kind == 2) {
+                emit("    " "f" (b % nfuncs) "(g_buf, " v ")")
+                emit("    " w " := rax")
+            } else if (kind == 3) {
+                emit("    filedelete \"" name "_out.txt\"")
+                emit("    fileappend \"" name "_out.txt\", g_buf")
+                emit("    fileread g_rd, \"" name "_out.txt\"")
+                emit("    g_buf.clear")
+            } else if (kind == 4) {
+                emit("    " v " := " w " + " v " * 2 - 7 // 3")
+                emit("    " w " %= 97")
+                emit("    " v " <<= 1")
+            } else {
+                emit("    " name "_lib" (b % nlib) "(" v ")")
+                emit("    " v " := rax")
+            }
+        }
+        close(file)
+    }'
+}
+
+# now_ns: wall clock in nanoseconds
+now_ns() {
+    date +%s%N
+}
+
+results=$work/results.txt
+: > "$results"
+printf '%-9s %-14s %12s %12s %14s\n' "lines" "target" "lines/s" "peak RSS KB" "output bytes"
+for size in $sizes; do
+    name=bench$size
+    (cd "$work" && gen_program "$size" "$name")
+    src_lines=$(cat "$work/$name.htll" "$work/${name}_lib.htll" | wc -l)
+    for target in $targets; do
+        out=$work/$name.s
+        [ "$target" = oryx ] && out=$work/$name.oryxir
+        rm -f "$out"
+        start=$(now_ns)
+        (cd "$work" && "$compiler" "$name.htll" "$target" --no-cache > /dev/null)
+        end=$(now_ns)
+        report=$(cd "$work" && "$compiler" "$name.htll" "$target" --time-passes=json)
+        peak=$(echo "$report" | sed -n 's/.*"peak_rss_kb": \([0-9]*\)}$/\1/p' | tail -n 1)
+        bytes=$(wc -c < "$out")
+        rate=$(awk -v l="$src_lines" -v ns="$((end - start))" 'BEGIN { printf "%d", l / (ns / 1e9) }')
+        printf '%-9s %-14s %12s %12s %14s\n' "$src_lines" "$target" "$rate" "$peak" "$bytes"
+        echo "$size $target $rate $peak $bytes" >> "$results"
+    done
+done
+cp "$results" bench_output.txt
+
+if [ "$1" = "--save" ]; then
+    cp "$results" bench_baseline.txt
+    echo "Saved bench_baseline.txt."
+    exit 0
+fi
+if [ ! -f bench_baseline.txt ]; then
+    echo "No bench_baseline.txt yet; run ./bench.sh --save to create one."
+    exit 0
+fi
+awk -v tolerance="$tolerance" '
+    NR == FNR { base[$1 " " $2] = $3; next }
+    ($1 " " $2) in base {
+        old = base[$1 " " $2]
+        if (old > 0 && $3 < old * (100 - tolerance) / 100) {
+            printf "REGRESSION: %s lines, %s: %d lines/s (baseline %d)\n", $1, $2, $3, old
+            failed = 1
+        }
+    }
+    END { exit failed }
+' bench_baseline.txt "$results" && echo "No throughput regressions against bench_baseline.txt."
@@ -0,0 +1,115 @@
+#!/bin/sh
+# Array parameter borrowing check.
+# An array argument is passed by reference only when the callee cannot write the
+# parameter; a callee that does write it must get its own copy, or the caller's array
+# changes, or its pages move under it and the program crashes. The program below passes
+# the same two-element array to one function per statement that writes an array
+# (fileread of a 100 KB file, arradd, .add, .pop, .clear, .set, .copy, .reserve, .swap)
+# and checks after each call that the caller's array is unchanged. It prints the sum of
+# the array, read through a parameter that is borrowed, and the number of mismatches:
+# "125 0". fileread goes through file_read in the runtime on both targets.
+#
+# check_lib.sh compiles it at -O0 and -O1 and runs it for each target it has the tools
+# for; the check fails when none of them can be run.
+#
+#     ./check_borrow.sh
+#     HTLL_CHECK_COMPILER=./HTLL ./check_borrow.sh
+set -e
+. "$(dirname "$0")/check_lib.sh"
+check_setup borrow
+
+awk 'BEGIN { for (i = 0; i < 100000; i++) printf "x" }' > "$work/borrow_in.txt"
+cat > "$work/borrow.htll" <<'EOF'
+arr big
+arr other
+int n := 0
+int bad := 0
+func w_fileread(arr p) {
+    fileread p, "borrow_in.txt"
+}
+func w_arradd(arr p) {
+    Loop, 3000 {
+        arradd p xyz
+    }
+}
+func w_add(arr p) {
+    Loop, 5000 {
+        p.add 7
+    }
+}
+func w_pop(arr p) {
+    p.pop
+}
+func w_clear(arr p) {
+    p.clear
+}
+func w_set(arr p) {
+    p.set 0, 9
+}
+func w_copy(arr p) {
+    p.copy big
+}
+func w_reserve(arr p) {
+    p.reserve 100000
+}
+func w_swap(arr p) {
+    p.swap other
+}
+func sum(arr p) {
+    n := 0
+    Loop, p.size {
+        p.index A_Index
+        n += rax
+    }
+    return n
+}
+func check(arr p) {
+    p.size
+    n := rax
+    if (n != 2) {
+        bad += 1
+    }
+    p.index 0
+    n := rax
+    if (n != 120) {
+        bad += 1
+    }
+    p.index 1
+    n := rax
+    if (n != 5) {
+        bad += 1
+    }
+}
+main
+Loop, 5000 {
+    big.add 3
+    other.add 4
+}
+arr a
+a.add 120
+a.add 5
+w_fileread(a)
+check(a)
+w_arradd(a)
+check(a)
+w_add(a)
+check(a)
+w_pop(a)
+check(a)
+w_clear(a)
+check(a)
+w_set(a)
+check(a)
+w_copy(a)
+check(a)
+w_reserve(a)
+check(a)
+w_swap(a)
+check(a)
+sum(a)
+n := rax
+print(n)
+print(bad)
+EOF
+
+check_run borrow "125 0"
@@ -0,0 +1,92 @@
+# Shared part of the check_*.sh scripts; they source it and supply only their program and
+# the output it must print:
+#
+#     . "$(dirname "$0")/check_lib.sh"
+#     check_setup NAME            work directory in $work, compiler in $compiler
+#     ... write "$work/NAME.htll" (and any files it reads) ...
+#     check_run NAME "EXPECTED"   exits with the number of failed runs
+#
+# check_run compiles the program at -O0 and -O1 and runs it for x86-64 (assembled with
+# fasm) and, when the tools are there, for AArch64: as/ld on an arm64 host, or
+# aarch64-linux-gnu-as/-ld and qemu-aarch64 elsewhere. A run passes when the program
+# prints EXPECTED, one line per word. When no target could be run at all the check fails
+# too, so a missing assembler never passes for a clean run.
+#
+# HTLL.cpp is built the way the README builds it unless HTLL_CHECK_COMPILER names an
+# already built compiler.
+
+check_setup() {
+    cd "$(dirname "$0")"
+    root=$(pwd)
+    work=${TMPDIR:-/tmp}/htll_$1.$$
+    mkdir -p "$work"
+    trap 'rm -rf "$work"' EXIT
+
+    compiler=${HTLL_CHECK_COMPILER:-}
+    if [ -z "$compiler" ]; then
+        compiler=$work/HTLL
+        echo "Building HTLL.cpp..."
+        g++ HTLL.cpp -o "$compiler"
+    fi
+    case $compiler in
+        /*) ;;
+        *) compiler=$root/$compiler ;;
+    esac
+
+    arch=$(uname -m)
+    if [ "$arch" = aarch64 ] || [ "$arch" = arm64 ]; then
+        arm_as=as
+        arm_ld=ld
+        arm_run=
+    elif command -v aarch64-linux-gnu-as >/dev/null 2>&1 && command -v qemu-aarch64 >/dev/null 2>&1; then
+        arm_as=aarch64-linux-gnu-as
+        arm_ld=aarch64-linux-gnu-ld
+        arm_run=qemu-aarch64
+    else
+        arm_as=
+    fi
+}
+
+check_run() {
+    program=$1
+    expected=$2
+    failures=0
+    ran=0
+    cd "$work"
+    for opt in "" "-O1"; do
+        for target in x86-64 arm; do
+            name="$target ${opt:--O0}"
+            if [ $target = arm ] && [ -z "$arm_as" ]; then
+                echo "$name: skipped (no AArch64 assembler)"
+                continue
+            fi
+            if [ $target = x86-64 ] && ! command -v fasm >/dev/null 2>&1; then
+                echo "$name: skipped (no fasm)"
+                continue
+            fi
+            rm -f "$program.s" "$program" "$program.o"
+            "$compiler" "$program.htll" $target --no-cache $opt > /dev/null
+            if [ $target = arm ]; then
+                $arm_as "$program.s" -o "$program.o"
+                $arm_ld "$program.o" -o "$program"
+                result=$($arm_run "./$program" | tr '\n' ' ')
+            else
+                fasm "$program.s" "$program" > /dev/null
+                chmod +x "$program"
+                result=$("./$program" | tr '\n' ' ')
+            fi
+            ran=$((ran + 1))
+            if [ "$result" = "$expected " ]; then
+                echo "$name: ok"
+            else
+                echo "$name: FAILED (got \"$result\", expected \"$expected\")"
+                failures=$((failures + 1))
+            fi
+        done
+    done
+    if [ $ran -eq 0 ]; then
+        echo "FAILED: no target could be run (needs fasm or an AArch64 assembler)"
+        exit 1
+    fi
+    exit $failures
+}
@@ -0,0 +1,69 @@
+#!/bin/sh
+# Strength-reduction check.
+# Generates a program that, for 36 literal divisors (1, powers of two, small odd numbers,
+# 641, 2^31-1, 2^32-1, 2^63, 2^64-1, ...), compares x * K, x // K and x % K, as statements
+# and inside expressions, with the same operation by a variable that holds K, over 300
+# xorshift values and over small dividends. The variable is set from x (x ^ x + K), so
+# constant propagation at -O1 cannot turn it back into the literal. The literal forms
+# take the shift, mask and magic-multiply paths, including the 33-bit add fix-up; the
+# variable forms take the generic mul/div. The program prints the number of mismatches,
+# which must be 0, and the last xorshift value shifted right by one.
+#
+# check_lib.sh compiles it at -O0 and -O1 and runs it for each target it has the tools
+# for; the check fails when none of them can be run.
+#
+#     ./check_strength.sh
+#     HTLL_CHECK_COMPILER=./HTLL ./check_strength.sh
+set -e
+. "$(dirname "$0")/check_lib.sh"
+check_setup strength
+
+awk '
+function check(src, op, k) {
+    print "q := " src
+    print "q " op "= " k
+    print "g := " src
+    print "g " op "= dv"
+    print "if (q != g) {"
+    print "bad += 1"
+    print "}"
+}
+BEGIN {
+    n = split("1 2 3 4 5 6 7 8 9 10 12 16 25 31 32 60 64 100 641 1000 1024 4095 4096 65535 65536 100000 1000000007 2147483647 2147483648 4294967295 4294967296 1099511627776 6700417 9223372036854775807 9223372036854775808 18446744073709551615", divisors, " ")
+    print "int x := 88172645463325252"
+    print "int q := 0"
+    print "int g := 0"
+    print "int dv := 0"
+    print "int z := 0"
+    print "int bad := 0"
+    print "int e := 0"
+    print "main"
+    print "Loop, 300 {"
+    print "x ^= x << 13"
+    print "x ^= x >> 7"
+    print "x ^= x << 17"
+    print "z := x ^ x"
+    for (i = 1; i <= n; i++) {
+        k = divisors[i]
+        print "dv := z + " k
+        check("x", "*", k)
+        check("x", "//", k)
+        check("x", "%", k)
+        split("* // %", ops, " ")
+        for (j = 1; j <= 3; j++) {
+            print "e := x " ops[j] " " k " + 1"
+            print "g := x " ops[j] " dv + 1"
+            print "if (e != g) {"
+            print "bad += 1"
+            print "}"
+        }
+        check("x >> 40", "//", k)
+        check("x >> 40", "%", k)
+    }
+    print "}"
+    print "print(bad)"
+    print "x >>= 1"
+    print "print(x)"
+}' > "$work/strength.htll"
+
+check_run strength "0 8168158942489689071"
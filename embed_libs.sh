@@ -0,0 +1,71 @@
+#!/bin/sh
+# Regenerates HTLL_Libs_embedded.h from the runtime library sources
+# (HTLL_Libs_x86.txt, HTLL_Libs_ring0.txt, HTLL_Libs_AArch64.txt).
+# Every $$$$name$$$$ ... %%%%name%%%% routine becomes one entry of a
+# routine table, plus a name -> routine index sorted by name,
+# both compiled into the HTLL binary, so the compiler never reads or scans
+# these files at run time.
+#
+# Run it after editing any HTLL_Libs_*.txt file, then rebuild:
+#     ./embed_libs.sh && g++ HTLL.cpp -o HTLL
+set -e
+cd "$(dirname "$0")"
+out=HTLL_Libs_embedded.h
+{
+    echo "// Generated by embed_libs.sh from HTLL_Libs_x86.txt, HTLL_Libs_ring0.txt and HTLL_Libs_AArch64.txt."
+    echo "// Do not edit by hand: edit the .txt files and run ./embed_libs.sh again."
+    echo "struct HTLL_EmbeddedRoutine {"
+    echo "    const char* name;"
+    echo "    const char* body;"
+    echo "};"
+    echo "struct HTLL_EmbeddedIndexEntry {"
+    echo "    const char* name;"
+    echo "    int routine;"
+    echo "};"
+    echo "struct HTLL_EmbeddedLibrary {"
+    echo "    const char* file;"
+    echo "    const HTLL_EmbeddedRoutine* routines;"
+    echo "    const HTLL_EmbeddedIndexEntry* index;"
+    echo "    int count;"
+    echo "};"
+    for lib in x86 ring0 AArch64; do
+        echo "static const HTLL_EmbeddedRoutine HTLL_Libs_${lib}_routines[] = {"
+        # Same slicing as the compiler used to do at run time: marker lines start
+        # and end a routine, empty lines are dropped, CRs are stripped.
+        tr -d '\r' < "HTLL_Libs_${lib}.txt" | awk '
+            index($0, "$$$$") {
+                line = $0
+                gsub(/^[ \t]+|[ \t]+$/, "", line)
+                printf "    {\"%s\", R\"HTLL_LIB(", substr(line, 5, length(line) - 8)
+                inRoutine = 1
+                next
+            }
+            index($0, "%%%%") {
+                if (inRoutine) {
+                    print ")HTLL_LIB\"},"
+                }
+                inRoutine = 0
+                next
+            }
+            inRoutine && length($0) > 0 {
+                print
+            }
+        '
+        echo "};"
+        echo "static const HTLL_EmbeddedIndexEntry HTLL_Libs_${lib}_index[] = {"
+        tr -d '\r' < "HTLL_Libs_${lib}.txt" | awk '
+            index($0, "$$$$") {
+                line = $0
+                gsub(/^[ \t]+|[ \t]+$/, "", line)
+                print substr(line, 5, length(line) - 8), count++
+            }
+        ' | LC_ALL=C sort -k1,1 | awk '{ printf "    {\"%s\", %d},\n", $1, $2 }'
+        echo "};"
+    done
+    echo "static const HTLL_EmbeddedLibrary HTLL_embeddedLibraries[] = {"
+    for lib in x86 ring0 AArch64; do
+        echo "    {\"HTLL_Libs_${lib}.txt\", HTLL_Libs_${lib}_routines, HTLL_Libs_${lib}_index, (int)(sizeof(HTLL_Libs_${lib}_routines) / sizeof(HTLL_EmbeddedRoutine))},"
+    done
+    echo "};"
+} > "$out"
+echo "Generated $out"